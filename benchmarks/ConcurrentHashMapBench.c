@@ -0,0 +1,186 @@
+/**
+ * @file ConcurrentHashMapBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include "ConcurrentHashMap.h"
+#include "Clock.h"
+#include "Utility.h"
+
+struct chm_bench_worker
+{
+    ConcurrentHashMap_t *map;
+    const double *cdf;
+    int64_t keys;
+    int64_t operations;
+    uint64_t seed;
+};
+
+// A per-thread generator since rand() is not thread-safe
+static uint64_t chm_bench_random(uint64_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+// Draws a key following the Zipfian distribution described by the cdf
+static int64_t chm_bench_zipf(const double *cdf, int64_t keys, uint64_t *state)
+{
+    double u = (double)(chm_bench_random(state) >> 11) / 9007199254740992.0;
+
+    int64_t low = 0, high = keys - 1;
+
+    while (low < high)
+    {
+        int64_t middle = low + (high - low) / 2;
+
+        if (cdf[middle] < u)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+static void *chm_bench_load(const void *key, void *context)
+{
+    (void)context;
+
+    return new_int64_t(*(const int64_t *)key);
+}
+
+// A cache workload: 90% lookups that load missing keys, 9% updates and 1%
+// invalidations
+static void *chm_bench_run(void *argument)
+{
+    struct chm_bench_worker *worker = argument;
+
+    for (int64_t i = 0; i < worker->operations; i++)
+    {
+        int64_t key = chm_bench_zipf(worker->cdf, worker->keys, &worker->seed);
+        uint64_t operation = chm_bench_random(&worker->seed) % 100;
+
+        if (operation < 90)
+        {
+            void *value = NULL;
+            chm_compute_if_absent(worker->map, &key, chm_bench_load, NULL,
+                                  &value);
+            free(value);
+        }
+        else if (operation < 99)
+        {
+            chm_put(worker->map, new_int64_t(key), new_int64_t(-key));
+        }
+        else
+        {
+            chm_remove(worker->map, &key, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+void
+chm_bench_zipfian(int64_t keys, int64_t operations, double skew)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, hash_int64_t,
+                                           NULL);
+
+    double *cdf = malloc(sizeof(double) * (size_t)keys);
+
+    if (!interface || !cdf)
+    {
+        free(cdf);
+        if (interface)
+            interface_free(interface);
+        return;
+    }
+
+    double total = 0.0;
+
+    for (int64_t i = 0; i < keys; i++)
+    {
+        total += 1.0 / pow((double)(i + 1), skew);
+        cdf[i] = total;
+    }
+
+    for (int64_t i = 0; i < keys; i++)
+        cdf[i] /= total;
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Keys                   : %" PRId64 "\n", keys);
+    printf("  Operations per thread  : %" PRId64 "\n", operations);
+    printf("  Zipfian skew           : %.2lf\n", skew);
+    printf("+--------------------------------------------------+\n");
+
+    integer_t shards[2] = { 1, 0 };
+    integer_t threads[4] = { 1, 2, 4, 8 };
+
+    pthread_t handles[8];
+    struct chm_bench_worker workers[8];
+
+    for (int s = 0; s < 2; s++)
+    {
+        for (int t = 0; t < 4; t++)
+        {
+            ConcurrentHashMap_t *map = chm_new(interface, interface, shards[s]);
+
+            if (!map)
+                continue;
+
+            double start = clk_now();
+
+            for (integer_t i = 0; i < threads[t]; i++)
+            {
+                workers[i].map = map;
+                workers[i].cdf = cdf;
+                workers[i].keys = keys;
+                workers[i].operations = operations;
+                workers[i].seed = 0x9E3779B97F4A7C15 * (uint64_t)(i + 1);
+
+                pthread_create(&handles[i], NULL, chm_bench_run, &workers[i]);
+            }
+
+            for (integer_t i = 0; i < threads[t]; i++)
+                pthread_join(handles[i], NULL);
+
+            double elapsed = clk_now() - start;
+            double throughput = (double)(operations * threads[t]) / elapsed;
+
+            printf("  %3" PRIdMAX " shards %2" PRIdMAX " threads : "
+                   "%10.0lf operations per second\n",
+                   chm_shards(map), threads[t], throughput);
+
+            chm_free(map);
+        }
+    }
+
+    printf("+--------------------------------------------------+\n");
+
+    free(cdf);
+    interface_free(interface);
+}
+
+// Runs all ConcurrentHashMap benchmarks
+void ConcurrentHashMapBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                ConcurrentHashMap Benchmark                 |\n");
+    printf("+------------------------------------------------------------+\n");
+
+    chm_bench_zipfian(100000, 1000000, 0.99);
+    chm_bench_zipfian(1000000, 1000000, 1.20);
+
+    printf("\n");
+}
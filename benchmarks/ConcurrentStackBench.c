@@ -0,0 +1,153 @@
+/**
+ * @file ConcurrentStackBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include <pthread.h>
+#include "ConcurrentStack.h"
+#include "StackList.h"
+#include "Clock.h"
+#include "Utility.h"
+
+struct cst_bench_worker
+{
+    ConcurrentStack_t *stack;
+    StackList_t *locked;
+    pthread_mutex_t *mutex;
+    int64_t operations;
+};
+
+// Every thread uses the stack as an object cache: take one, put it back
+static void *cst_bench_lock_free(void *argument)
+{
+    struct cst_bench_worker *worker = argument;
+
+    for (int64_t i = 0; i < worker->operations; i++)
+    {
+        void *object;
+
+        if (cst_pop(worker->stack, &object))
+            cst_push(worker->stack, object);
+    }
+
+    return NULL;
+}
+
+static void *cst_bench_mutex(void *argument)
+{
+    struct cst_bench_worker *worker = argument;
+
+    for (int64_t i = 0; i < worker->operations; i++)
+    {
+        void *object;
+
+        pthread_mutex_lock(worker->mutex);
+        bool popped = stl_pop(worker->locked, &object);
+        pthread_mutex_unlock(worker->mutex);
+
+        if (popped)
+        {
+            pthread_mutex_lock(worker->mutex);
+            stl_push(worker->locked, object);
+            pthread_mutex_unlock(worker->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+static double
+cst_bench_run(void *(*function)(void *), struct cst_bench_worker *template,
+              integer_t threads)
+{
+    pthread_t handles[16];
+    struct cst_bench_worker workers[16];
+
+    double start = clk_now();
+
+    for (integer_t i = 0; i < threads; i++)
+    {
+        workers[i] = *template;
+
+        pthread_create(&handles[i], NULL, function, &workers[i]);
+    }
+
+    for (integer_t i = 0; i < threads; i++)
+        pthread_join(handles[i], NULL);
+
+    return clk_now() - start;
+}
+
+void
+cst_bench_push_pop(int64_t objects, int64_t operations)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    ConcurrentStack_t *stack = cst_new(interface);
+    StackList_t *locked = stl_new(interface);
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    if (!interface || !stack || !locked)
+    {
+        if (stack)
+            cst_free(stack);
+        if (locked)
+            stl_free(locked);
+        if (interface)
+            interface_free(interface);
+        return;
+    }
+
+    for (int64_t i = 0; i < objects; i++)
+    {
+        cst_push(stack, new_int64_t(i));
+        stl_push(locked, new_int64_t(i));
+    }
+
+    struct cst_bench_worker template = { stack, locked, &mutex, operations };
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Cached objects         : %" PRId64 "\n", objects);
+    printf("  Operations per thread  : %" PRId64 "\n", operations);
+    printf("+--------------------------------------------------+\n");
+
+    integer_t threads[5] = { 1, 2, 4, 8, 16 };
+
+    for (int t = 0; t < 5; t++)
+    {
+        double lock_free = cst_bench_run(cst_bench_lock_free, &template,
+                                         threads[t]);
+        double mutex_time = cst_bench_run(cst_bench_mutex, &template,
+                                          threads[t]);
+
+        double total = (double)(operations * threads[t]);
+
+        printf("  %2" PRIdMAX " threads : lock-free %10.0lf ops/s, "
+               "mutex %10.0lf ops/s\n", threads[t], total / lock_free,
+               total / mutex_time);
+    }
+
+    printf("+--------------------------------------------------+\n");
+
+    cst_free(stack);
+    stl_free(locked);
+    interface_free(interface);
+}
+
+// Runs all ConcurrentStack benchmarks
+void ConcurrentStackBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                 ConcurrentStack Benchmark                  |\n");
+    printf("+------------------------------------------------------------+\n");
+
+    cst_bench_push_pop(16, 1000000);
+    cst_bench_push_pop(100000, 1000000);
+
+    printf("\n");
+}
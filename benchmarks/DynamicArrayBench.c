@@ -0,0 +1,233 @@
+/**
+ * @file DynamicArrayBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include "Array.h"
+#include "DynamicArray.h"
+#include "Clock.h"
+#include "Utility.h"
+
+// A bit of arithmetic per element so that the benchmark is not only memory
+// bound
+static int64_t dar_bench_work(int64_t value)
+{
+    for (int i = 0; i < 16; i++)
+        value = (value * 31 + 7) % 1000003;
+
+    return value;
+}
+
+static void *dar_bench_map(const void *element, void *context)
+{
+    (void)context;
+
+    return new_int64_t(dar_bench_work(*(const int64_t *)element));
+}
+
+static bool dar_bench_filter(const void *element, void *context)
+{
+    (void)context;
+
+    return dar_bench_work(*(const int64_t *)element) % 2 == 0;
+}
+
+static void dar_bench_reduce(void *accumulator, const void *element,
+                             void *context)
+{
+    (void)context;
+
+    *(int64_t *)accumulator += dar_bench_work(*(const int64_t *)element);
+}
+
+static void dar_bench_combine(void *accumulator, const void *partial,
+                              void *context)
+{
+    (void)context;
+
+    *(int64_t *)accumulator += *(const int64_t *)partial;
+}
+
+static void
+dar_bench_row(const char *name, integer_t threads, double time,
+              double baseline)
+{
+    if (threads < 0)
+        printf("  %-7s sequential : %lf seconds\n", name, time);
+    else
+        printf("  %-7s %2" PRIdMAX " threads : %lf seconds (%.2lfx)\n", name,
+               threads, time, baseline / time);
+}
+
+void
+dar_bench_functional(integer_t elements)
+{
+    srand(5113);
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    DynamicArray_t *array = dar_create(interface, elements, 200);
+
+    if (!array)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    for (integer_t i = 0; i < elements; i++)
+        dar_insert_back(array, new_int64_t(random_int64_t(0, 1000000)));
+
+    printf("+--------------------------------------------------+\n");
+    printf("  DynamicArray elements  : %" PRIdMAX "\n", elements);
+    printf("+--------------------------------------------------+\n");
+
+    // The sequential functions are the baseline for the speedup
+    int64_t expected = 0;
+
+    double start = clk_now();
+    dar_reduce(array, &expected, dar_bench_reduce, NULL);
+    double reduce_base = clk_now() - start;
+
+    start = clk_now();
+    DynamicArray_t *result = dar_map(array, NULL, dar_bench_map, NULL);
+    double map_base = clk_now() - start;
+    dar_free(result);
+
+    start = clk_now();
+    result = dar_filter(array, dar_bench_filter, NULL);
+    double filter_base = clk_now() - start;
+    dar_free(result);
+
+    dar_bench_row("reduce", -1, reduce_base, reduce_base);
+    dar_bench_row("map", -1, map_base, map_base);
+    dar_bench_row("filter", -1, filter_base, filter_base);
+
+    integer_t threads[5] = { 1, 2, 4, 8, 16 };
+
+    for (int t = 0; t < 5; t++)
+    {
+        ThreadPool_t *pool = tpl_new(threads[t]);
+
+        if (!pool)
+            break;
+
+        int64_t sum = 0;
+
+        start = clk_now();
+        dar_parallel_reduce(array, pool, &sum, sizeof(int64_t),
+                            dar_bench_reduce, dar_bench_combine, NULL);
+        double reduce_time = clk_now() - start;
+
+        start = clk_now();
+        result = dar_parallel_map(array, pool, NULL, dar_bench_map, NULL);
+        double map_time = clk_now() - start;
+        dar_free(result);
+
+        start = clk_now();
+        result = dar_parallel_filter(array, pool, dar_bench_filter, NULL);
+        double filter_time = clk_now() - start;
+        dar_free(result);
+
+        if (sum != expected)
+            printf("ERROR\n");
+
+        printf("+--------------------------------------------------+\n");
+        dar_bench_row("reduce", threads[t], reduce_time, reduce_base);
+        dar_bench_row("map", threads[t], map_time, map_base);
+        dar_bench_row("filter", threads[t], filter_time, filter_base);
+
+        tpl_free(pool);
+    }
+
+    printf("+--------------------------------------------------+\n");
+
+    dar_free(array);
+    interface_free(interface);
+}
+
+void
+arr_bench_functional(integer_t elements)
+{
+    srand(5113);
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    Array_t *array = arr_new(interface, elements);
+
+    if (!array)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    for (integer_t i = 0; i < elements; i++)
+        arr_set(array, new_int64_t(random_int64_t(0, 1000000)), i);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Array elements         : %" PRIdMAX "\n", elements);
+    printf("+--------------------------------------------------+\n");
+
+    int64_t expected = 0;
+
+    double start = clk_now();
+    arr_reduce(array, &expected, dar_bench_reduce, NULL);
+    double reduce_base = clk_now() - start;
+
+    dar_bench_row("reduce", -1, reduce_base, reduce_base);
+
+    integer_t threads[5] = { 1, 2, 4, 8, 16 };
+
+    for (int t = 0; t < 5; t++)
+    {
+        ThreadPool_t *pool = tpl_new(threads[t]);
+
+        if (!pool)
+            break;
+
+        int64_t sum = 0;
+
+        start = clk_now();
+        arr_parallel_reduce(array, pool, &sum, sizeof(int64_t),
+                            dar_bench_reduce, dar_bench_combine, NULL);
+        double reduce_time = clk_now() - start;
+
+        if (sum != expected)
+            printf("ERROR\n");
+
+        dar_bench_row("reduce", threads[t], reduce_time, reduce_base);
+
+        tpl_free(pool);
+    }
+
+    printf("+--------------------------------------------------+\n");
+
+    arr_free(array);
+    interface_free(interface);
+}
+
+// Runs all DynamicArray and Array benchmarks
+void DynamicArrayBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                   DynamicArray Benchmark                   |\n");
+    printf("+------------------------------------------------------------+\n");
+    printf("  Hardware threads : %" PRIdMAX "\n", tpl_hardware_threads());
+
+    dar_bench_functional(100000);
+    dar_bench_functional(1000000);
+    arr_bench_functional(1000000);
+
+    printf("\n");
+}
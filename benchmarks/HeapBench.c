@@ -8,6 +8,8 @@
 
 #include <inttypes.h>
 #include "Heap.h"
+#include "PairingHeap.h"
+#include "RadixHeap.h"
 #include "Clock.h"
 #include "Utility.h"
 
@@ -122,8 +124,8 @@ hep_bench_IO(unsigned_t elements, unsigned_t iterations)
 
         for (unsigned_t j = 0; j < elements; j++)
         {
-            free(buffer[i]);
-            buffer[i] = NULL;
+            free(buffer[j]);
+            buffer[j] = NULL;
         }
 
         clk_reset(stopwatch);
@@ -150,6 +152,7 @@ hep_bench_IO(unsigned_t elements, unsigned_t iterations)
     free(removal_timings);
 
     printf("+--------------------------------------------------+\n");
+    printf("  Heap\n");
     printf("  Total elements added   : %" PRIuMAX "\n", elements);
     printf("  Total iterations       : %" PRIuMAX "\n", iterations);
     printf("+--------------------------------------------------+\n");
@@ -159,6 +162,360 @@ hep_bench_IO(unsigned_t elements, unsigned_t iterations)
     printf("+--------------------------------------------------+\n");
 }
 
+void
+pqh_bench_IO(unsigned_t elements, unsigned_t iterations)
+{
+    srand(5113);
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    Clock_t *stopwatch = clk_new(iterations);
+
+    if (!stopwatch)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    PairingHeap_t *heap = pqh_new(interface, MaxHeap);
+
+    if (!heap)
+    {
+        interface_free(interface);
+        clk_free(stopwatch);
+        return;
+    }
+
+    double *insertion_timings = malloc(sizeof(double) * iterations);
+    double *removal_timings = malloc(sizeof(double) * iterations);
+    double *search_timings = malloc(sizeof(double) * iterations);
+
+    unsigned_t insertion_total = 0, removal_total = 0, search_total = 0;
+
+    PairingHeapNode_t **handles = malloc(sizeof(PairingHeapNode_t*) * elements);
+    int64_t **buffer = malloc(sizeof(int64_t*) * elements);
+
+    if (!insertion_timings || !removal_timings || !search_timings ||
+        !handles || !buffer)
+    {
+        pqh_free(heap);
+        clk_free(stopwatch);
+        interface_free(interface);
+        return;
+    }
+
+    int64_t min = elements * (-1);
+    int64_t max = elements;
+    void *element = NULL;
+    bool success;
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        // Insertion
+        clk_start(stopwatch);
+        for (unsigned_t j = 0; j < elements; j++)
+        {
+            element = new_int64_t(random_int64_t(min, max));
+            if (!pqh_insert(heap, element, &handles[j]))
+            {
+                free(element);
+                printf("ERROR!0\n");
+            }
+        }
+        clk_stop(stopwatch);
+        insertion_timings[insertion_total++] = stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Decrease keys (increase, since this is a max-heap) of random
+        // elements through their handles
+        clk_start(stopwatch);
+        for (unsigned_t j = 0; j < elements; j++)
+        {
+            PairingHeapNode_t *handle =
+                    handles[random_int64_t(0, (int64_t)elements - 1)];
+            *(int64_t *)pqh_element(handle) += random_int64_t(20, 200);
+            if (!pqh_decrease_key(heap, handle))
+                printf("ERROR!1\n");
+        }
+        clk_stop(stopwatch);
+        search_timings[search_total++] = stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Removal
+        int64_t t = 0;
+        clk_start(stopwatch);
+        while (!pqh_empty(heap))
+        {
+            success = pqh_remove(heap, &element);
+            if (!success)
+                printf("ERROR!2\n");
+            buffer[t++] = (int64_t*)element;
+        }
+        clk_stop(stopwatch);
+        removal_timings[removal_total++] = stopwatch->time;
+
+        if (pqh_count(heap) != 0)
+            printf("ERROR!3\n");
+
+        bool is_sorted = true;
+
+        for (unsigned_t j = 0; j < elements - 1; j++)
+        {
+            if (*buffer[j] < *buffer[j + 1])
+            {
+                is_sorted = false;
+                break;
+            }
+        }
+
+        if (!is_sorted)
+            printf("ERROR!4\n");
+
+        for (unsigned_t j = 0; j < elements; j++)
+        {
+            free(buffer[j]);
+            buffer[j] = NULL;
+        }
+
+        clk_reset(stopwatch);
+    }
+
+    free(buffer);
+    free(handles);
+
+    // The result will be sum / iterations
+    double insertion_sum = 0.0, search_sum = 0.0, removal_sum = 0.0;
+
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        insertion_sum += insertion_timings[i];
+        search_sum += search_timings[i];
+        removal_sum += removal_timings[i];
+    }
+
+    pqh_free(heap);
+    clk_free(stopwatch);
+    interface_free(interface);
+    free(insertion_timings);
+    free(search_timings);
+    free(removal_timings);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Pairing Heap\n");
+    printf("  Total elements added   : %" PRIuMAX "\n", elements);
+    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
+    printf("+--------------------------------------------------+\n");
+    printf("  Average insertion time : %lf seconds\n", insertion_sum / (double)iterations);
+    printf("  Average removal time   : %lf seconds\n", removal_sum / (double)iterations);
+    printf("  Average decr-key time  : %lf seconds\n", search_sum / (double)iterations);
+    printf("+--------------------------------------------------+\n");
+}
+
+// Compares merging two heaps of the same size. A Heap_s has to reinsert every
+// element of the other heap while a PairingHeap_s links the two roots.
+void
+hep_bench_meld(unsigned_t elements, unsigned_t iterations)
+{
+    srand(5113);
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    Clock_t *stopwatch = clk_new(iterations);
+
+    if (!stopwatch)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    int64_t min = elements * (-1);
+    int64_t max = elements;
+    void *element = NULL;
+    double heap_sum = 0.0, pairing_sum = 0.0;
+
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        Heap_t *heap = hep_new(interface, MaxHeap);
+        Heap_t *heap_other = hep_new(interface, MaxHeap);
+        PairingHeap_t *pairing = pqh_new(interface, MaxHeap);
+        PairingHeap_t *pairing_other = pqh_new(interface, MaxHeap);
+
+        if (!heap || !heap_other || !pairing || !pairing_other)
+            printf("ERROR!0\n");
+
+        for (unsigned_t j = 0; j < elements; j++)
+        {
+            int64_t value = random_int64_t(min, max);
+
+            hep_insert(j % 2 ? heap : heap_other, new_int64_t(value));
+            pqh_insert(j % 2 ? pairing : pairing_other, new_int64_t(value),
+                       NULL);
+        }
+
+        clk_start(stopwatch);
+        while (!hep_empty(heap_other))
+        {
+            hep_remove(heap_other, &element);
+            hep_insert(heap, element);
+        }
+        clk_stop(stopwatch);
+        heap_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        clk_start(stopwatch);
+        if (!pqh_meld(pairing, pairing_other))
+            printf("ERROR!1\n");
+        clk_stop(stopwatch);
+        pairing_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        if (hep_count(heap) != pqh_count(pairing) ||
+            *(int64_t *)hep_peek(heap) != *(int64_t *)pqh_peek(pairing))
+            printf("ERROR!2\n");
+
+        hep_free(heap);
+        hep_free(heap_other);
+        pqh_free(pairing);
+        pqh_free(pairing_other);
+    }
+
+    clk_free(stopwatch);
+    interface_free(interface);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Meld of two heaps\n");
+    printf("  Total elements         : %" PRIuMAX "\n", elements);
+    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
+    printf("+--------------------------------------------------+\n");
+    printf("  Heap                   : %lf seconds\n", heap_sum / (double)iterations);
+    printf("  Pairing Heap           : %lf seconds\n", pairing_sum / (double)iterations);
+    printf("+--------------------------------------------------+\n");
+}
+
+// An event loop with a fixed amount of pending events where each removed
+// event schedules a new one a little later, so the removed keys never
+// decrease. Compares a Heap_s min-heap with a RadixHeap_s.
+void
+rxh_bench_monotone(unsigned_t pending, unsigned_t operations,
+                   unsigned_t iterations)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        return;
+
+    Clock_t *stopwatch = clk_new(iterations);
+
+    if (!stopwatch)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    int64_t *events = malloc(sizeof(int64_t) * pending);
+
+    if (!events)
+    {
+        clk_free(stopwatch);
+        interface_free(interface);
+        return;
+    }
+
+    double heap_sum = 0.0, radix_sum = 0.0;
+    void *element = NULL;
+    uint64_t key;
+
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        Heap_t *heap = hep_create(interface, (integer_t)pending, 200, MinHeap);
+        RadixHeap_t *radix = rxh_new(interface);
+
+        if (!heap || !radix)
+            printf("ERROR!0\n");
+
+        uint64_t heap_check = 0, radix_check = 0;
+
+        // Heap
+        srand(5113);
+
+        for (unsigned_t j = 0; j < pending; j++)
+        {
+            events[j] = random_int64_t(0, 1000);
+            hep_insert(heap, &events[j]);
+        }
+
+        clk_start(stopwatch);
+        for (unsigned_t j = 0; j < operations; j++)
+        {
+            if (!hep_remove(heap, &element))
+                printf("ERROR!1\n");
+            heap_check += (uint64_t)*(int64_t *)element;
+            *(int64_t *)element += random_int64_t(1, 1000);
+            hep_insert(heap, element);
+        }
+        clk_stop(stopwatch);
+        heap_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Radix Heap
+        srand(5113);
+
+        for (unsigned_t j = 0; j < pending; j++)
+        {
+            events[j] = random_int64_t(0, 1000);
+            rxh_insert(radix, (uint64_t)events[j], &events[j]);
+        }
+
+        clk_start(stopwatch);
+        for (unsigned_t j = 0; j < operations; j++)
+        {
+            if (!rxh_remove(radix, &key, &element))
+                printf("ERROR!1\n");
+            radix_check += key;
+            *(int64_t *)element += random_int64_t(1, 1000);
+            rxh_insert(radix, (uint64_t)*(int64_t *)element, element);
+        }
+        clk_stop(stopwatch);
+        radix_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Both removed the same keys
+        if (heap_check != radix_check)
+            printf("ERROR!2\n");
+
+        hep_free_shallow(heap);
+        rxh_free_shallow(radix);
+    }
+
+    free(events);
+    clk_free(stopwatch);
+    interface_free(interface);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Monotone event loop\n");
+    printf("  Pending events         : %" PRIuMAX "\n", pending);
+    printf("  Total operations       : %" PRIuMAX "\n", operations);
+    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
+    printf("+--------------------------------------------------+\n");
+    printf("  Heap                   : %lf seconds\n", heap_sum / (double)iterations);
+    printf("  Radix Heap             : %lf seconds\n", radix_sum / (double)iterations);
+    printf("+--------------------------------------------------+\n");
+}
+
 // Runs all Heap benchmarks
 void HeapBench(void)
 {
@@ -170,5 +527,16 @@ void HeapBench(void)
     hep_bench_IO(1000000, 10);
     hep_bench_IO(10000000, 1);
 
+    pqh_bench_IO(100000, 100);
+    pqh_bench_IO(1000000, 10);
+    pqh_bench_IO(10000000, 1);
+
+    hep_bench_meld(100000, 100);
+    hep_bench_meld(1000000, 10);
+
+    rxh_bench_monotone(1000, 10000000, 10);
+    rxh_bench_monotone(100000, 10000000, 10);
+    rxh_bench_monotone(1000000, 10000000, 1);
+
     printf("\n");
 }
\ No newline at end of file
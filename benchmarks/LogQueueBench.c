@@ -0,0 +1,96 @@
+/**
+ * @file LogQueueBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "LogQueue.h"
+#include "Clock.h"
+#include "Utility.h"
+
+// Enqueues everything and then dequeues everything, syncing every batch
+// operations, so the window is refilled from the log on the way out
+void
+lgq_bench_IO(int64_t elements, integer_t batch)
+{
+    char directory[] = "/tmp/lgq_benchXXXXXX";
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface || !mkdtemp(directory))
+    {
+        if (interface)
+            interface_free(interface);
+        return;
+    }
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    LogQueue_t *queue = lgq_create(directory, interface, 4096,
+                                   64 * 1024 * 1024, batch);
+
+    if (!queue)
+    {
+        rmdir(directory);
+        interface_free(interface);
+        return;
+    }
+
+    double start = clk_now();
+
+    for (int64_t i = 0; i < elements; i++)
+        lgq_enqueue(queue, new_int64_t(i));
+
+    lgq_sync(queue);
+
+    double enqueue_time = clk_now() - start;
+
+    void *element;
+
+    start = clk_now();
+
+    while (lgq_dequeue(queue, &element))
+        free(element);
+
+    lgq_sync(queue);
+
+    double dequeue_time = clk_now() - start;
+
+    lgq_close(queue);
+
+    // Only the last segment and the checkpoint are left
+    char command[64];
+
+    snprintf(command, sizeof(command), "rm -rf %s", directory);
+
+    if (system(command) != 0)
+        printf("  Could not remove %s\n", directory);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Elements          : %" PRId64 "\n", elements);
+    printf("  Sync every        : %" PRIdMAX " operations\n", batch);
+    printf("  Enqueue           : %10.0lf ops/s\n", elements / enqueue_time);
+    printf("  Dequeue           : %10.0lf ops/s\n", elements / dequeue_time);
+    printf("+--------------------------------------------------+\n");
+
+    interface_free(interface);
+}
+
+// Runs all LogQueue benchmarks
+void LogQueueBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                     LogQueue Benchmark                     |\n");
+    printf("+------------------------------------------------------------+\n");
+
+    lgq_bench_IO(1000000, 1024);
+    lgq_bench_IO(1000000, 16384);
+
+    printf("\n");
+}
@@ -0,0 +1,384 @@
+/**
+ * @file ShortestPathBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include "Heap.h"
+#include "PairingHeap.h"
+#include "FibonacciHeap.h"
+#include "BinomialHeap.h"
+#include "RadixHeap.h"
+#include "Clock.h"
+#include "Utility.h"
+
+// Runs Dijkstra's algorithm on the same random graph with every heap of the
+// library. The heaps with handles update a vertex in place with
+// decrease-key; Heap_s and RadixHeap_s have no handles, so a vertex is
+// inserted again every time its distance improves and outdated entries are
+// skipped when removed.
+
+// Amount of heaps compared
+#define SP_HEAPS 5
+
+// A graph in compressed sparse row format
+struct sp_graph
+{
+    integer_t vertices;
+    integer_t *offsets; // Edges of v are in [offsets[v], offsets[v + 1])
+    integer_t *targets;
+    int64_t *weights;
+};
+
+// A vertex and its tentative distance, the elements of every heap
+struct sp_entry
+{
+    int64_t distance;
+    integer_t vertex;
+};
+
+static int sp_compare(const void *first, const void *second)
+{
+    int64_t a = ((const struct sp_entry *)first)->distance;
+    int64_t b = ((const struct sp_entry *)second)->distance;
+
+    return (a > b) - (a < b);
+}
+
+static void sp_display(const void *element)
+{
+    printf("%" PRId64, ((const struct sp_entry *)element)->distance);
+}
+
+// Every vertex links to the next one so the whole graph is reachable, plus
+// degree - 1 edges to random vertices
+static bool sp_graph_init(struct sp_graph *graph, integer_t vertices,
+                          integer_t degree)
+{
+    integer_t edges = vertices * degree;
+
+    graph->vertices = vertices;
+    graph->offsets = malloc(sizeof(integer_t) * (size_t)(vertices + 1));
+    graph->targets = malloc(sizeof(integer_t) * (size_t)edges);
+    graph->weights = malloc(sizeof(int64_t) * (size_t)edges);
+
+    if (!graph->offsets || !graph->targets || !graph->weights)
+    {
+        free(graph->offsets);
+        free(graph->targets);
+        free(graph->weights);
+        return false;
+    }
+
+    for (integer_t v = 0, e = 0; v < vertices; v++)
+    {
+        graph->offsets[v] = e;
+
+        for (integer_t d = 0; d < degree; d++, e++)
+        {
+            if (d == 0)
+                graph->targets[e] = (v + 1) % vertices;
+            else
+                graph->targets[e] = random_int64_t(0, vertices - 1);
+
+            graph->weights[e] = random_int64_t(1, 1000);
+        }
+    }
+
+    graph->offsets[vertices] = edges;
+
+    return true;
+}
+
+static void sp_graph_free(struct sp_graph *graph)
+{
+    free(graph->offsets);
+    free(graph->targets);
+    free(graph->weights);
+}
+
+static void sp_dijkstra_heap(struct sp_graph *graph, Interface_t *interface,
+                             int64_t *distances)
+{
+    integer_t edges = graph->offsets[graph->vertices];
+
+    // Each improvement inserts a new entry, at most one per edge
+    struct sp_entry *entries =
+            malloc(sizeof(struct sp_entry) * (size_t)(edges + 1));
+
+    Heap_t *heap = hep_new(interface, MinHeap);
+
+    if (!entries || !heap)
+    {
+        printf("ERROR!0\n");
+        free(entries);
+        if (heap)
+            hep_free_shallow(heap);
+        return;
+    }
+
+    integer_t used = 0;
+    void *element;
+
+    for (integer_t v = 0; v < graph->vertices; v++)
+        distances[v] = INT64_MAX;
+
+    distances[0] = 0;
+    entries[used] = (struct sp_entry){ 0, 0 };
+    hep_insert(heap, &entries[used++]);
+
+    while (hep_remove(heap, &element))
+    {
+        struct sp_entry *entry = element;
+        integer_t v = entry->vertex;
+
+        // An outdated entry of a vertex that was already settled
+        if (entry->distance != distances[v])
+            continue;
+
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            integer_t u = graph->targets[e];
+            int64_t distance = distances[v] + graph->weights[e];
+
+            if (distance < distances[u])
+            {
+                distances[u] = distance;
+                entries[used] = (struct sp_entry){ distance, u };
+                hep_insert(heap, &entries[used++]);
+            }
+        }
+    }
+
+    hep_free_shallow(heap);
+    free(entries);
+}
+
+// The distances removed by Dijkstra's algorithm never decrease, so they can
+// be the keys of a radix heap
+static void sp_dijkstra_radix(struct sp_graph *graph, Interface_t *interface,
+                              int64_t *distances)
+{
+    integer_t edges = graph->offsets[graph->vertices];
+
+    struct sp_entry *entries =
+            malloc(sizeof(struct sp_entry) * (size_t)(edges + 1));
+
+    RadixHeap_t *heap = rxh_new(interface);
+
+    if (!entries || !heap)
+    {
+        printf("ERROR!0\n");
+        free(entries);
+        if (heap)
+            rxh_free_shallow(heap);
+        return;
+    }
+
+    integer_t used = 0;
+    void *element;
+
+    for (integer_t v = 0; v < graph->vertices; v++)
+        distances[v] = INT64_MAX;
+
+    distances[0] = 0;
+    entries[used] = (struct sp_entry){ 0, 0 };
+    rxh_insert(heap, 0, &entries[used++]);
+
+    while (rxh_remove(heap, NULL, &element))
+    {
+        struct sp_entry *entry = element;
+        integer_t v = entry->vertex;
+
+        if (entry->distance != distances[v])
+            continue;
+
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            integer_t u = graph->targets[e];
+            int64_t distance = distances[v] + graph->weights[e];
+
+            if (distance < distances[u])
+            {
+                distances[u] = distance;
+                entries[used] = (struct sp_entry){ distance, u };
+                rxh_insert(heap, (uint64_t)distance, &entries[used++]);
+            }
+        }
+    }
+
+    rxh_free_shallow(heap);
+    free(entries);
+}
+
+// The heaps with handles share the same algorithm, only the calls differ
+#define SP_DIJKSTRA_HANDLES(name, prefix, Heap_type, Node_type)               \
+static void name(struct sp_graph *graph, Interface_t *interface,              \
+                 int64_t *distances)                                          \
+{                                                                             \
+    struct sp_entry *entries =                                                \
+            malloc(sizeof(struct sp_entry) * (size_t)graph->vertices);        \
+    Node_type **handles =                                                     \
+            malloc(sizeof(Node_type *) * (size_t)graph->vertices);            \
+    Heap_type *heap = prefix##_new(interface, MinHeap);                       \
+                                                                              \
+    if (!entries || !handles || !heap)                                        \
+    {                                                                         \
+        printf("ERROR!0\n");                                                  \
+        free(entries);                                                        \
+        free(handles);                                                        \
+        if (heap)                                                             \
+            prefix##_free_shallow(heap);                                      \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    void *element;                                                            \
+                                                                              \
+    for (integer_t v = 0; v < graph->vertices; v++)                           \
+    {                                                                         \
+        distances[v] = INT64_MAX;                                             \
+        handles[v] = NULL;                                                    \
+    }                                                                         \
+                                                                              \
+    distances[0] = 0;                                                         \
+    entries[0] = (struct sp_entry){ 0, 0 };                                   \
+    prefix##_insert(heap, &entries[0], &handles[0]);                          \
+                                                                              \
+    while (prefix##_remove(heap, &element))                                   \
+    {                                                                         \
+        integer_t v = ((struct sp_entry *)element)->vertex;                   \
+                                                                              \
+        for (integer_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) \
+        {                                                                     \
+            integer_t u = graph->targets[e];                                  \
+            int64_t distance = distances[v] + graph->weights[e];              \
+                                                                              \
+            if (distance >= distances[u])                                     \
+                continue;                                                     \
+                                                                              \
+            distances[u] = distance;                                          \
+            entries[u].distance = distance;                                   \
+                                                                              \
+            if (handles[u])                                                   \
+            {                                                                 \
+                prefix##_decrease_key(heap, handles[u]);                      \
+            }                                                                 \
+            else                                                              \
+            {                                                                 \
+                entries[u].vertex = u;                                        \
+                prefix##_insert(heap, &entries[u], &handles[u]);              \
+            }                                                                 \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    prefix##_free_shallow(heap);                                              \
+    free(entries);                                                            \
+    free(handles);                                                            \
+}
+
+SP_DIJKSTRA_HANDLES(sp_dijkstra_pairing, pqh, PairingHeap_t,
+                    PairingHeapNode_t)
+SP_DIJKSTRA_HANDLES(sp_dijkstra_fibonacci, fbh, FibonacciHeap_t,
+                    FibonacciHeapNode_t)
+SP_DIJKSTRA_HANDLES(sp_dijkstra_binomial, bnh, BinomialHeap_t,
+                    BinomialHeapNode_t)
+
+void
+sp_bench_dijkstra(integer_t vertices, integer_t degree, unsigned_t iterations)
+{
+    srand(5113);
+
+    const char *names[SP_HEAPS] = {
+            "Heap", "Pairing Heap", "Fibonacci Heap", "Binomial Heap",
+            "Radix Heap"
+    };
+
+    void (*algorithms[SP_HEAPS])(struct sp_graph *, Interface_t *,
+                                 int64_t *) = {
+            sp_dijkstra_heap, sp_dijkstra_pairing, sp_dijkstra_fibonacci,
+            sp_dijkstra_binomial, sp_dijkstra_radix
+    };
+
+    Interface_t *interface = interface_new(sp_compare, NULL, sp_display, NULL,
+                                           NULL, NULL);
+
+    if (!interface)
+        return;
+
+    Clock_t *stopwatch = clk_new(iterations);
+
+    if (!stopwatch)
+    {
+        interface_free(interface);
+        return;
+    }
+
+    struct sp_graph graph;
+
+    int64_t *expected = malloc(sizeof(int64_t) * (size_t)vertices);
+    int64_t *distances = malloc(sizeof(int64_t) * (size_t)vertices);
+
+    if (!expected || !distances || !sp_graph_init(&graph, vertices, degree))
+    {
+        free(expected);
+        free(distances);
+        clk_free(stopwatch);
+        interface_free(interface);
+        return;
+    }
+
+    double timings[SP_HEAPS] = { 0.0 };
+
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        for (int h = 0; h < SP_HEAPS; h++)
+        {
+            clk_start(stopwatch);
+            algorithms[h](&graph, interface, h == 0 ? expected : distances);
+            clk_stop(stopwatch);
+            timings[h] += stopwatch->time;
+
+            clk_reset(stopwatch);
+
+            if (h > 0 && memcmp(expected, distances,
+                                sizeof(int64_t) * (size_t)vertices) != 0)
+                printf("ERROR!1\n");
+        }
+    }
+
+    sp_graph_free(&graph);
+    free(expected);
+    free(distances);
+    clk_free(stopwatch);
+    interface_free(interface);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Dijkstra on a random graph\n");
+    printf("  Total vertices         : %" PRIdMAX "\n", vertices);
+    printf("  Total edges            : %" PRIdMAX "\n", vertices * degree);
+    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
+    printf("+--------------------------------------------------+\n");
+
+    for (int h = 0; h < SP_HEAPS; h++)
+        printf("  %-22s : %lf seconds\n", names[h],
+               timings[h] / (double)iterations);
+
+    printf("+--------------------------------------------------+\n");
+}
+
+// Runs all shortest path benchmarks
+void ShortestPathBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                  Shortest Path Benchmark                   |\n");
+    printf("+------------------------------------------------------------+\n");
+
+    sp_bench_dijkstra(100000, 8, 10);
+    sp_bench_dijkstra(1000000, 4, 3);
+    sp_bench_dijkstra(1000000, 16, 1);
+
+    printf("\n");
+}
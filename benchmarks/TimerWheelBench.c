@@ -0,0 +1,215 @@
+/**
+ * @file TimerWheelBench.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include <inttypes.h>
+#include "Heap.h"
+#include "TimerWheel.h"
+#include "Clock.h"
+#include "Utility.h"
+
+// Connection timeouts: every tick some random connections have activity and
+// their timeout is pushed forward, and idle connections that time out are
+// replaced by new ones. A Heap_s has no handles, so every refresh inserts a
+// new deadline and outdated deadlines are skipped when removed.
+
+// A connection and one of its deadlines, the elements of the heap
+struct tmw_deadline
+{
+    uint64_t expires;
+    integer_t connection;
+};
+
+static int tmw_bench_compare(const void *first, const void *second)
+{
+    uint64_t a = ((const struct tmw_deadline *)first)->expires;
+    uint64_t b = ((const struct tmw_deadline *)second)->expires;
+
+    return (a > b) - (a < b);
+}
+
+static void tmw_bench_display(const void *element)
+{
+    printf("%" PRIu64, ((const struct tmw_deadline *)element)->expires);
+}
+
+// State shared with the function that replaces timed out connections
+struct tmw_bench_state
+{
+    TimerWheel_t *wheel;
+    TimerWheelNode_t **handles;
+    uint64_t timeout;
+};
+
+static void tmw_bench_expire(void *element, void *context)
+{
+    struct tmw_bench_state *state = context;
+    integer_t connection = (integer_t)(intptr_t)element;
+
+    tmw_schedule(state->wheel, tmw_now(state->wheel) + state->timeout,
+                 element, &state->handles[connection]);
+}
+
+void
+tmw_bench_timeouts(integer_t connections, integer_t active, unsigned_t ticks,
+                   unsigned_t iterations)
+{
+    const uint64_t timeout = 1000;
+
+    Interface_t *interface = interface_new(tmw_bench_compare, NULL,
+                                           tmw_bench_display, free, NULL,
+                                           NULL);
+
+    if (!interface)
+        return;
+
+    Clock_t *stopwatch = clk_new(iterations);
+
+    uint64_t *deadlines = malloc(sizeof(uint64_t) * (size_t)connections);
+    TimerWheelNode_t **handles =
+            malloc(sizeof(TimerWheelNode_t *) * (size_t)connections);
+
+    if (!stopwatch || !deadlines || !handles)
+    {
+        if (stopwatch)
+            clk_free(stopwatch);
+        free(deadlines);
+        free(handles);
+        interface_free(interface);
+        return;
+    }
+
+    double heap_sum = 0.0, wheel_sum = 0.0;
+    void *element = NULL;
+
+    for (unsigned_t i = 0; i < iterations; i++)
+    {
+        Heap_t *heap = hep_new(interface, MinHeap);
+        TimerWheel_t *wheel = tmw_new(interface, 0);
+
+        if (!heap || !wheel)
+            printf("ERROR!0\n");
+
+        integer_t heap_expired = 0, wheel_expired = 0;
+
+        // Heap
+        srand(5113);
+
+        clk_start(stopwatch);
+        for (integer_t c = 0; c < connections; c++)
+        {
+            struct tmw_deadline *deadline = malloc(sizeof(*deadline));
+
+            *deadline = (struct tmw_deadline){ timeout, c };
+            deadlines[c] = timeout;
+            hep_insert(heap, deadline);
+        }
+
+        for (uint64_t now = 1; now <= ticks; now++)
+        {
+            for (integer_t j = 0; j < active; j++)
+            {
+                integer_t c = random_int64_t(0, connections - 1);
+                struct tmw_deadline *deadline = malloc(sizeof(*deadline));
+
+                *deadline = (struct tmw_deadline){ now + timeout, c };
+                deadlines[c] = now + timeout;
+                hep_insert(heap, deadline);
+            }
+
+            struct tmw_deadline *top;
+
+            while ((top = hep_peek(heap)) && top->expires <= now)
+            {
+                hep_remove(heap, &element);
+
+                // Only the latest deadline of a connection counts
+                if (top->expires == deadlines[top->connection])
+                {
+                    heap_expired++;
+
+                    top->expires = now + timeout;
+                    deadlines[top->connection] = top->expires;
+                    hep_insert(heap, top);
+                }
+                else
+                {
+                    free(top);
+                }
+            }
+        }
+        clk_stop(stopwatch);
+        heap_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Timer Wheel
+        srand(5113);
+
+        struct tmw_bench_state state = { wheel, handles, timeout };
+
+        clk_start(stopwatch);
+        for (integer_t c = 0; c < connections; c++)
+            tmw_schedule(wheel, timeout, (void *)(intptr_t)c, &handles[c]);
+
+        for (uint64_t now = 1; now <= ticks; now++)
+        {
+            for (integer_t j = 0; j < active; j++)
+            {
+                integer_t c = random_int64_t(0, connections - 1);
+
+                tmw_reschedule(wheel, handles[c], now + timeout);
+            }
+
+            wheel_expired += tmw_advance(wheel, now, tmw_bench_expire,
+                                         &state);
+        }
+        clk_stop(stopwatch);
+        wheel_sum += stopwatch->time;
+
+        clk_reset(stopwatch);
+
+        // Both timed out the same connections
+        if (heap_expired != wheel_expired)
+            printf("ERROR!1\n");
+
+        hep_free(heap);
+        tmw_free_shallow(wheel);
+    }
+
+    free(deadlines);
+    free(handles);
+    clk_free(stopwatch);
+    interface_free(interface);
+
+    printf("+--------------------------------------------------+\n");
+    printf("  Connection timeouts\n");
+    printf("  Total connections      : %" PRIdMAX "\n", connections);
+    printf("  Active per tick        : %" PRIdMAX "\n", active);
+    printf("  Total ticks            : %" PRIuMAX "\n", ticks);
+    printf("  Total iterations       : %" PRIuMAX "\n", iterations);
+    printf("+--------------------------------------------------+\n");
+    printf("  Heap                   : %lf seconds\n",
+           heap_sum / (double)iterations);
+    printf("  Timer Wheel            : %lf seconds\n",
+           wheel_sum / (double)iterations);
+    printf("+--------------------------------------------------+\n");
+}
+
+// Runs all TimerWheel benchmarks
+void TimerWheelBench(void)
+{
+    printf("+------------------------------------------------------------+\n");
+    printf("|                   Timer Wheel Benchmark                    |\n");
+    printf("+------------------------------------------------------------+\n");
+
+    tmw_bench_timeouts(10000, 100, 100000, 5);
+    tmw_bench_timeouts(100000, 1000, 10000, 3);
+    tmw_bench_timeouts(1000000, 10000, 5000, 1);
+
+    printf("\n");
+}
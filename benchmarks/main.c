@@ -8,6 +8,12 @@ int main(void)
 
     AssociativeListBench();
     AVLTreeBench();
+    ConcurrentHashMapBench();
+    ConcurrentStackBench();
+    DynamicArrayBench();
     HeapBench();
+    LogQueueBench();
     RedBlackTreeBench();
+    ShortestPathBench();
+    TimerWheelBench();
 }
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -139,6 +140,18 @@ avl_max(AVLTree_t *tree);
 void *
 avl_min(AVLTree_t *tree);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref avl_serialize
+/// \brief Saves the tree's keys in order to a stream.
+bool
+avl_serialize(AVLTree_t *tree, Serial_t *serial);
+
+/// \ref avl_deserialize
+/// \brief Loads keys saved with avl_serialize() into an empty tree.
+bool
+avl_deserialize(AVLTree_t *tree, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref avl_display
@@ -163,6 +176,72 @@ avl_traversal(AVLTree_t *tree, int traversal_mode);
 
 /// \todo AVLTreeWrapper
 
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////// Sync ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \struct AVLTreeSync_s
+/// \brief A thread-safe wrapper around a AVL tree.
+struct AVLTreeSync_s;
+
+/// \ref AVLTreeSync_t
+/// \brief A type for a thread-safe AVL tree.
+///
+/// A type for a <code> struct AVLTreeSync_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct AVLTreeSync_s AVLTreeSync_t;
+
+/// \ref AVLTreeSync
+/// \brief A pointer type for a thread-safe AVL tree.
+///
+/// A pointer type to <code> struct AVLTreeSync_s </code>.
+typedef struct AVLTreeSync_s *AVLTreeSync;
+
+/// \ref avl_sync_new
+/// \brief Creates a new empty thread-safe AVL tree.
+AVLTreeSync_t *
+avl_sync_new(Interface_t *interface, SyncMode mode);
+
+/// \ref avl_sync_free
+/// \brief Frees from memory the wrapper, its tree and all of its elements.
+void
+avl_sync_free(AVLTreeSync_t *sync);
+
+/// \ref avl_sync_mode
+/// \brief Returns how the wrapper protects its tree.
+SyncMode
+avl_sync_mode(AVLTreeSync_t *sync);
+
+/// \ref avl_sync_size
+/// \brief Returns the amount of elements in the tree.
+integer_t
+avl_sync_size(AVLTreeSync_t *sync);
+
+/// \ref avl_sync_insert
+/// \brief Adds a new element to the tree.
+bool
+avl_sync_insert(AVLTreeSync_t *sync, void *element);
+
+/// \ref avl_sync_remove
+/// \brief Removes and frees an element that matches a given element.
+bool
+avl_sync_remove(AVLTreeSync_t *sync, void *element);
+
+/// \ref avl_sync_contains
+/// \brief Returns true if an element is in the tree.
+bool
+avl_sync_contains(AVLTreeSync_t *sync, void *element);
+
+/// \ref avl_sync_max
+/// \brief Returns a copy of the maximum element or NULL if the tree is empty.
+void *
+avl_sync_max(AVLTreeSync_t *sync);
+
+/// \ref avl_sync_min
+/// \brief Returns a copy of the minimum element or NULL if the tree is empty.
+void *
+avl_sync_min(AVLTreeSync_t *sync);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,8 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
+#include "ThreadPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -212,6 +214,52 @@ arr_sort(Array_t *array);
 void
 arr_sortby(Array_t *array, compare_f comparator);
 
+/// \ref arr_for_each
+/// \brief Applies a function to every element in the array.
+void
+arr_for_each(Array_t *array, foreach_f function, void *context);
+
+/// \ref arr_map
+/// \brief Creates a new array with the result of a function on each element.
+Array_t *
+arr_map(Array_t *array, Interface_t *interface, map_f function,
+        void *context);
+
+/// \ref arr_filter
+/// \brief Creates a new array with copies of the elements that pass a test.
+Array_t *
+arr_filter(Array_t *array, predicate_f predicate, void *context);
+
+/// \ref arr_reduce
+/// \brief Folds every element of the array into an accumulator.
+void
+arr_reduce(Array_t *array, void *result, reduce_f function, void *context);
+
+/// \ref arr_parallel_for_each
+/// \brief Applies a function to every element in the array in parallel.
+void
+arr_parallel_for_each(Array_t *array, ThreadPool_t *pool, foreach_f function,
+                      void *context);
+
+/// \ref arr_parallel_map
+/// \brief Parallel version of arr_map().
+Array_t *
+arr_parallel_map(Array_t *array, ThreadPool_t *pool, Interface_t *interface,
+                 map_f function, void *context);
+
+/// \ref arr_parallel_filter
+/// \brief Parallel version of arr_filter().
+Array_t *
+arr_parallel_filter(Array_t *array, ThreadPool_t *pool, predicate_f predicate,
+                    void *context);
+
+/// \ref arr_parallel_reduce
+/// \brief Parallel version of arr_reduce() for associative reductions.
+bool
+arr_parallel_reduce(Array_t *array, ThreadPool_t *pool, void *result,
+                    integer_t result_size, reduce_f function,
+                    combine_f combine, void *context);
+
 /// \ref arr_to_array
 /// \brief Makes a copy to a C array.
 void **
@@ -222,6 +270,18 @@ arr_to_array(Array_t *array, integer_t *length, bool shallow);
 Array_t *
 arr_from_array(Interface_t *interface, void **buffer, integer_t length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref arr_serialize
+/// \brief Saves the array's slots to a stream.
+bool
+arr_serialize(Array_t *array, Serial_t *serial);
+
+/// \ref arr_deserialize
+/// \brief Loads slots saved with arr_serialize() into an empty array.
+bool
+arr_deserialize(Array_t *array, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref arr_display
@@ -247,6 +307,10 @@ typedef struct ArrayIterator_s ArrayIterator_t;
 /// A pointer type for a <code> struct ArrayIterator_s </code>.
 typedef struct ArrayIterator_s *ArrayIterator;
 
+/// \ref arr_iter_size
+/// \brief The size of an ArrayIterator_s in bytes.
+extern const unsigned_t arr_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref arr_iter_new
@@ -254,6 +318,11 @@ typedef struct ArrayIterator_s *ArrayIterator;
 ArrayIterator_t *
 arr_iter_new(Array_t *target);
 
+/// \ref arr_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+arr_iter_init(ArrayIterator_t *iter, Array_t *target);
+
 /// \ref arr_iter_retarget
 /// \brief Retarget or resets an existing iterator.
 bool
@@ -337,6 +406,10 @@ arr_iter_peek(ArrayIterator_t *iter);
 void *
 arr_iter_peek_prev(ArrayIterator_t *iter);
 
+#define ARR_ITER_DECL(name)                                         \
+    char name##_storage__[arr_iter_size];                           \
+    ArrayIterator_t *name = (ArrayIterator_t*)&name##_storage__[0]; \
+
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
 ///////////////////////////////////////////////////////////////////////////////
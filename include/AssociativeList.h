@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -87,6 +88,11 @@ ali_limit(AssociativeList_t *list);
 bool
 ali_multiple_keys(AssociativeList_t *list);
 
+/// \ref ali_indexed
+/// \brief Returns true if the key index of the associative list is enabled.
+bool
+ali_indexed(AssociativeList_t *list);
+
 /// \ref ali_get
 /// \brief Returns the value associated with a key, or NULL if not found.
 void *
@@ -99,6 +105,11 @@ ali_get(AssociativeList_t *list, void *key);
 bool
 ali_set_limit(AssociativeList_t *list, integer_t limit);
 
+/// \ref ali_set_indexed
+/// \brief Enables or disables a hash index that speeds up key lookups.
+bool
+ali_set_indexed(AssociativeList_t *list, bool enabled);
+
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
 
 /// \ref ali_insert
@@ -151,6 +162,18 @@ bool
 ali_from_arrays(AssociativeList_t **list, void **K_array, void **V_array,
         unsigned_t from_index, unsigned_t to_index);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref ali_serialize
+/// \brief Saves the list's key-value pairs to a stream.
+bool
+ali_serialize(AssociativeList_t *list, Serial_t *serial);
+
+/// \ref ali_deserialize
+/// \brief Loads pairs saved with ali_serialize() into an empty list.
+bool
+ali_deserialize(AssociativeList_t *list, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref ali_display
@@ -162,7 +185,103 @@ ali_display(AssociativeList_t *list);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo AssociativeListIterator
+/// \struct AssociativeListIterator_s.
+/// \brief An AssociativeList_s iterator.
+struct AssociativeListIterator_s;
+
+/// \brief A type for an associative list iterator.
+///
+/// A type for a <code> struct AssociativeListIterator_s </code>.
+typedef struct AssociativeListIterator_s AssociativeListIterator_t;
+
+/// \brief A pointer type for an associative list iterator.
+///
+/// A pointer type for a <code> struct AssociativeListIterator_s </code>.
+typedef struct AssociativeListIterator_s *AssociativeListIterator;
+
+/// \ref ali_iter_size
+/// \brief The size of an AssociativeListIterator_s in bytes.
+extern const unsigned_t ali_iter_size;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref ali_iter_new
+/// \brief Creates a new associative list iterator given a target list.
+AssociativeListIterator_t *
+ali_iter_new(AssociativeList_t *target);
+
+/// \ref ali_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+ali_iter_init(AssociativeListIterator_t *iter, AssociativeList_t *target);
+
+/// \ref ali_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+ali_iter_retarget(AssociativeListIterator_t *iter, AssociativeList_t *target);
+
+/// \ref ali_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+ali_iter_free(AssociativeListIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref ali_iter_next
+/// \brief Iterates to the next key-value pair if available.
+bool
+ali_iter_next(AssociativeListIterator_t *iter);
+
+/// \ref ali_iter_prev
+/// \brief Iterates to the previous key-value pair if available.
+bool
+ali_iter_prev(AssociativeListIterator_t *iter);
+
+/// \ref ali_iter_to_head
+/// \brief Iterates to the first key-value pair in the list.
+bool
+ali_iter_to_head(AssociativeListIterator_t *iter);
+
+/// \ref ali_iter_to_tail
+/// \brief Iterates to the last key-value pair in the list.
+bool
+ali_iter_to_tail(AssociativeListIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref ali_iter_has_next
+/// \brief Returns true if there is another pair next in the iteration.
+bool
+ali_iter_has_next(AssociativeListIterator_t *iter);
+
+/// \ref ali_iter_has_prev
+/// \brief Returns true if there is a previous pair in the iteration.
+bool
+ali_iter_has_prev(AssociativeListIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref ali_iter_get
+/// \brief Gets the key-value pair pointed by the iterator.
+bool
+ali_iter_get(AssociativeListIterator_t *iter, void **key, void **value);
+
+/// \ref ali_iter_set_value
+/// \brief Sets the value pointed by the iterator to a new value.
+bool
+ali_iter_set_value(AssociativeListIterator_t *iter, void *value);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref ali_iter_peek_key
+/// \brief Returns the current key in the iteration if available.
+void *
+ali_iter_peek_key(AssociativeListIterator_t *iter);
+
+/// \ref ali_iter_peek_value
+/// \brief Returns the current value in the iteration if available.
+void *
+ali_iter_peek_value(AssociativeListIterator_t *iter);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -139,6 +140,18 @@ bst_max(BinarySearchTree_t *tree);
 void *
 bst_min(BinarySearchTree_t *tree);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref bst_serialize
+/// \brief Saves the tree's keys in order to a stream.
+bool
+bst_serialize(BinarySearchTree_t *tree, Serial_t *serial);
+
+/// \ref bst_deserialize
+/// \brief Loads keys saved with bst_serialize() into an empty tree.
+bool
+bst_deserialize(BinarySearchTree_t *tree, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref bst_display
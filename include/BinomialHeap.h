@@ -0,0 +1,155 @@
+/**
+ * @file BinomialHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_BINOMIALHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_BINOMIALHEAP_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Heap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct BinomialHeap_s
+/// \brief A binomial heap with node handles.
+struct BinomialHeap_s;
+
+/// \brief A type for a binomial heap.
+///
+/// A type for a <code> struct BinomialHeap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct BinomialHeap_s BinomialHeap_t;
+
+/// \brief A pointer type for a binomial heap.
+///
+/// A pointer type to <code> struct BinomialHeap_s </code>. This typedef is
+/// used to avoid having to declare every binomial heap as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct BinomialHeap_s *BinomialHeap;
+
+/// \struct BinomialHeapNode_s
+/// \brief A handle to an element inserted into a BinomialHeap_s.
+struct BinomialHeapNode_s;
+
+/// \brief A type for a binomial heap handle.
+///
+/// A type for a <code> struct BinomialHeapNode_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct BinomialHeapNode_s BinomialHeapNode_t;
+
+/// \brief A pointer type for a binomial heap handle.
+///
+/// A pointer type to <code> struct BinomialHeapNode_s </code>.
+typedef struct BinomialHeapNode_s *BinomialHeapNode;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref bnh_new
+/// \brief Initializes a new BinomialHeap_s.
+BinomialHeap_t *
+bnh_new(Interface_t *interface, HeapKind kind);
+
+/// \ref bnh_free
+/// \brief Frees from memory a BinomialHeap_s and its elements.
+void
+bnh_free(BinomialHeap_t *heap);
+
+/// \ref bnh_free_shallow
+/// \brief Frees from memory a BinomialHeap_s leaving its elements intact.
+void
+bnh_free_shallow(BinomialHeap_t *heap);
+
+/// \ref bnh_erase
+/// \brief Frees from memory all elements of a BinomialHeap_s.
+void
+bnh_erase(BinomialHeap_t *heap);
+
+/// \ref bnh_erase_shallow
+/// \brief Removes all elements from a BinomialHeap_s leaving them intact.
+void
+bnh_erase_shallow(BinomialHeap_t *heap);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref bnh_config
+/// \brief Sets a new interface for the target binomial heap.
+void
+bnh_config(BinomialHeap_t *heap, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref bnh_count
+/// \brief Returns the amount of elements in the binomial heap.
+integer_t
+bnh_count(BinomialHeap_t *heap);
+
+/// \ref bnh_kind
+/// \brief Returns if the binomial heap is a MaxHeap or a MinHeap.
+HeapKind
+bnh_kind(BinomialHeap_t *heap);
+
+/// \ref bnh_element
+/// \brief Returns the element referenced by a handle.
+void *
+bnh_element(BinomialHeapNode_t *handle);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref bnh_insert
+/// \brief Inserts an element in the binomial heap.
+bool
+bnh_insert(BinomialHeap_t *heap, void *element, BinomialHeapNode_t **handle);
+
+/// \ref bnh_remove
+/// \brief Removes the top element from the binomial heap.
+bool
+bnh_remove(BinomialHeap_t *heap, void **result);
+
+/// \ref bnh_delete
+/// \brief Removes the element referenced by a handle.
+bool
+bnh_delete(BinomialHeap_t *heap, BinomialHeapNode_t *handle, void **result);
+
+/// \ref bnh_peek
+/// \brief Returns the top element of the binomial heap.
+void *
+bnh_peek(BinomialHeap_t *heap);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref bnh_empty
+/// \brief Returns true if the binomial heap is empty, otherwise false.
+bool
+bnh_empty(BinomialHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref bnh_decrease_key
+/// \brief Moves an element up after it gained priority.
+bool
+bnh_decrease_key(BinomialHeap_t *heap, BinomialHeapNode_t *handle);
+
+/// \ref bnh_meld
+/// \brief Moves all elements of a binomial heap into another.
+bool
+bnh_meld(BinomialHeap_t *heap, BinomialHeap_t *other);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref bnh_display
+/// \brief Displays a BinomialHeap_s in the console.
+void
+bnh_display(BinomialHeap_t *heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_BINOMIALHEAP_H
@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_BITARRAY_H
 
 #include "Core.h"
+#include "Serial.h"
 
 /// \struct BitArray_s
 /// \brief An array of bits to represent 0 and 1 values.
@@ -229,6 +230,18 @@ bit_NXOR(BitArray_t *bits1, BitArray_t *bits2);
 bool
 bit_DIFF(BitArray_t *bits1, BitArray_t *bits2);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref bit_serialize
+/// \brief Saves the bit array to a stream.
+bool
+bit_serialize(BitArray_t *bits, Serial_t *serial);
+
+/// \ref bit_deserialize
+/// \brief Replaces the bit array with one saved by bit_serialize().
+bool
+bit_deserialize(BitArray_t *bits, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref bit_display
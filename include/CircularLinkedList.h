@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_CIRCULARLINKEDLIST_H
 
 #include "Core.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,6 +123,9 @@ void *cll_peek_prev(CircularLinkedList cll);
 
 Status cll_copy(CircularLinkedList cll, CircularLinkedList *result);
 
+Status cll_splice(CircularLinkedList dst, integer_t dst_pos,
+        CircularLinkedList src, integer_t from, integer_t to);
+
 ///////////////////////////////////////////////////////////////// ITERATION ///
 
 Status cll_iter_next(CircularLinkedList cll, integer_t positions);
@@ -130,6 +134,14 @@ Status cll_iter(CircularLinkedList cll, integer_t positions);
 
 Status cll_iter_prev(CircularLinkedList cll, integer_t positions);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+Status cll_serialize(CircularLinkedList list, serialize_f function,
+                     Serial_t *serial);
+
+Status cll_deserialize(CircularLinkedList list, deserialize_f function,
+                       Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 Status cll_display(CircularLinkedList cll);
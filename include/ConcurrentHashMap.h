@@ -0,0 +1,120 @@
+/**
+ * @file ConcurrentHashMap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CONCURRENTHASHMAP_H
+#define C_DATASTRUCTURES_LIBRARY_CONCURRENTHASHMAP_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ConcurrentHashMap_s
+///
+/// \brief A thread-safe hash map split in independently locked shards.
+struct ConcurrentHashMap_s;
+
+/// \brief A type for a concurrent hash map.
+///
+/// A type for a <code> struct ConcurrentHashMap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct ConcurrentHashMap_s ConcurrentHashMap_t;
+
+/// \brief A pointer type for a concurrent hash map.
+///
+/// A pointer type to <code> struct ConcurrentHashMap_s </code>. This typedef
+/// is used to avoid having to declare every map as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct ConcurrentHashMap_s *ConcurrentHashMap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref chm_new
+/// \brief Initializes a new ConcurrentHashMap_s.
+ConcurrentHashMap_t *
+chm_new(Interface_t *key_interface, Interface_t *value_interface,
+        integer_t shards);
+
+/// \ref chm_free
+/// \brief Frees from memory a ConcurrentHashMap_s and its key-value pairs.
+void
+chm_free(ConcurrentHashMap_t *map);
+
+/// \ref chm_free_shallow
+/// \brief Frees from memory a ConcurrentHashMap_s leaving its pairs intact.
+void
+chm_free_shallow(ConcurrentHashMap_t *map);
+
+/// \ref chm_erase
+/// \brief Frees from memory all key-value pairs of a ConcurrentHashMap_s.
+void
+chm_erase(ConcurrentHashMap_t *map);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref chm_size
+/// \brief Returns the amount of key-value pairs in the map.
+integer_t
+chm_size(ConcurrentHashMap_t *map);
+
+/// \ref chm_shards
+/// \brief Returns the amount of shards the map was split in.
+integer_t
+chm_shards(ConcurrentHashMap_t *map);
+
+/// \ref chm_get
+/// \brief Retrieves a copy of the value associated with a key.
+bool
+chm_get(ConcurrentHashMap_t *map, void *key, void **value);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref chm_put
+/// \brief Maps a key to a value, replacing the previous value if any.
+bool
+chm_put(ConcurrentHashMap_t *map, void *key, void *value);
+
+/// \ref chm_remove
+/// \brief Removes a given key from the map and retrieves its value.
+bool
+chm_remove(ConcurrentHashMap_t *map, void *key, void **value);
+
+/// \ref chm_compute_if_absent
+/// \brief Retrieves a copy of a key's value, computing it if not present.
+bool
+chm_compute_if_absent(ConcurrentHashMap_t *map, void *key, map_f function,
+                      void *context, void **value);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref chm_empty
+/// \brief Returns true if the map has no key-value pairs.
+bool
+chm_empty(ConcurrentHashMap_t *map);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref chm_contains_key
+/// \brief Returns true if the map contains a given key.
+bool
+chm_contains_key(ConcurrentHashMap_t *map, void *key);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref chm_display
+/// \brief Displays in the console a concurrent hash map.
+void
+chm_display(ConcurrentHashMap_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_CONCURRENTHASHMAP_H
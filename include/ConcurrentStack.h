@@ -0,0 +1,97 @@
+/**
+ * @file ConcurrentStack.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_CONCURRENTSTACK_H
+#define C_DATASTRUCTURES_LIBRARY_CONCURRENTSTACK_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ConcurrentStack_s
+/// \brief A lock-free linked list implementation of a generic stack.
+struct ConcurrentStack_s;
+
+/// \ref ConcurrentStack_t
+/// \brief A type for a lock-free stack.
+///
+/// A type for a <code> struct ConcurrentStack_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct ConcurrentStack_s ConcurrentStack_t;
+
+/// \ref ConcurrentStack
+/// \brief A pointer type for a lock-free stack.
+///
+/// A pointer type to <code> struct ConcurrentStack_s </code>. This typedef is
+/// used to avoid having to declare every stack as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct ConcurrentStack_s *ConcurrentStack;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref cst_new
+/// \brief Initializes a new ConcurrentStack_s allocated on the heap.
+ConcurrentStack_t *
+cst_new(Interface_t *interface);
+
+/// \ref cst_free
+/// \brief Frees from memory a ConcurrentStack_s and all its elements.
+void
+cst_free(ConcurrentStack_t *stack);
+
+/// \ref cst_free_shallow
+/// \brief Frees from memory a ConcurrentStack_s without freeing its elements.
+void
+cst_free_shallow(ConcurrentStack_t *stack);
+
+/// \ref cst_erase
+/// \brief Pops and frees every element of the stack.
+void
+cst_erase(ConcurrentStack_t *stack);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref cst_config
+/// \brief Sets a new interface for the stack.
+void
+cst_config(ConcurrentStack_t *stack, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref cst_count
+/// \brief Returns the amount of elements in the stack.
+integer_t
+cst_count(ConcurrentStack_t *stack);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref cst_push
+/// \brief Inserts an element onto the top of the stack.
+bool
+cst_push(ConcurrentStack_t *stack, void *element);
+
+/// \ref cst_pop
+/// \brief Removes an element from the top of the stack.
+bool
+cst_pop(ConcurrentStack_t *stack, void **result);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref cst_empty
+/// \brief Returns true if the stack has no elements.
+bool
+cst_empty(ConcurrentStack_t *stack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_CONCURRENTSTACK_H
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -208,6 +209,18 @@ dqa_prepend(DequeArray_t *deque1, DequeArray_t *deque2);
 void **
 dqa_to_array(DequeArray_t *deque, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref dqa_serialize
+/// \brief Saves the deque's elements to a stream.
+bool
+dqa_serialize(DequeArray_t *deque, Serial_t *serial);
+
+/// \ref dqa_deserialize
+/// \brief Loads elements saved with dqa_serialize() into an empty deque.
+bool
+dqa_deserialize(DequeArray_t *deque, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref dqa_display
@@ -219,7 +232,123 @@ dqa_display(DequeArray_t *deque, int display_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo DequeArrayIterator
+/// \struct DequeArrayIterator_s.
+/// \brief A DequeArray_s iterator.
+struct DequeArrayIterator_s;
+
+/// \brief A type for a deque array iterator.
+///
+/// A type for a <code> struct DequeArrayIterator_s </code>.
+typedef struct DequeArrayIterator_s DequeArrayIterator_t;
+
+/// \brief A pointer type for a deque array iterator.
+///
+/// A pointer type for a <code> struct DequeArrayIterator_s </code>.
+typedef struct DequeArrayIterator_s *DequeArrayIterator;
+
+/// \ref dqa_iter_size
+/// \brief The size of a DequeArrayIterator_s in bytes.
+extern const unsigned_t dqa_iter_size;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref dqa_iter_new
+/// \brief Creates a new deque array iterator given a target deque.
+DequeArrayIterator_t *
+dqa_iter_new(DequeArray_t *target);
+
+/// \ref dqa_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+dqa_iter_init(DequeArrayIterator_t *iter, DequeArray_t *target);
+
+/// \ref dqa_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+dqa_iter_retarget(DequeArrayIterator_t *iter, DequeArray_t *target);
+
+/// \ref dqa_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+dqa_iter_free(DequeArrayIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref dqa_iter_next
+/// \brief Iterates to the next element towards the rear if available.
+bool
+dqa_iter_next(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_prev
+/// \brief Iterates to the previous element towards the front if available.
+bool
+dqa_iter_prev(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_to_front
+/// \brief Iterates to the front element in the deque.
+bool
+dqa_iter_to_front(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_to_rear
+/// \brief Iterates to the rear element in the deque.
+bool
+dqa_iter_to_rear(DequeArrayIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref dqa_iter_has_next
+/// \brief Returns true if there is another element next in the iteration.
+bool
+dqa_iter_has_next(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_has_prev
+/// \brief Returns true if there is a previous element in the iteration.
+bool
+dqa_iter_has_prev(DequeArrayIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref dqa_iter_get
+/// \brief Gets the element pointed by the iterator.
+bool
+dqa_iter_get(DequeArrayIterator_t *iter, void **result);
+
+/// \ref dqa_iter_set
+/// \brief Sets the element pointed by the iterator to a new element.
+bool
+dqa_iter_set(DequeArrayIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref dqa_iter_peek_next
+/// \brief Returns the next element in the iteration if available.
+void *
+dqa_iter_peek_next(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_peek
+/// \brief Returns the current element in the iteration if available.
+void *
+dqa_iter_peek(DequeArrayIterator_t *iter);
+
+/// \ref dqa_iter_peek_prev
+/// \brief Returns the previous element in the iteration if available.
+void *
+dqa_iter_peek_prev(DequeArrayIterator_t *iter);
+
+#define DQA_ITER_DECL(name)                                                   \
+    char name##_storage__[dqa_iter_size];                                     \
+    DequeArrayIterator_t *name = (DequeArrayIterator_t*)&name##_storage__[0]; \
+
+#define DQA_FOR_EACH(target, body)                \
+    do {                                          \
+        DQA_ITER_DECL(iter_)                      \
+        if (dqa_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = dqa_iter_peek(iter_); \
+                body;                             \
+            } while (dqa_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -174,16 +175,34 @@ dql_compare(DequeList_t *deque1, DequeList_t *deque2);
 bool
 dql_append(DequeList_t *deque1, DequeList_t *deque2);
 
-/// \ref dql_append
+/// \ref dql_prepend
 /// \brief Prepends deque2 at the front of deque1.
 bool
 dql_prepend(DequeList_t *deque1, DequeList_t *deque2);
 
+/// \ref dql_splice
+/// \brief Moves a range of elements from one deque into another.
+bool
+dql_splice(DequeList_t *dst, integer_t dst_pos, DequeList_t *src,
+           integer_t from, integer_t to);
+
 /// \ref dql_to_array
 /// \brief Makes a copy of the deque as a C array.
 void **
 dql_to_array(DequeList_t *deque, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref dql_serialize
+/// \brief Saves the deque's elements to a stream.
+bool
+dql_serialize(DequeList_t *deque, Serial_t *serial);
+
+/// \ref dql_deserialize
+/// \brief Loads elements saved with dql_serialize() into an empty deque.
+bool
+dql_deserialize(DequeList_t *deque, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref dql_display
@@ -209,6 +228,10 @@ typedef struct DequeListIterator_s DequeListIterator_t;
 /// A pointer type for a <code> struct DequeListIterator_s </code>.
 typedef struct DequeListIterator_s *DequeListIterator;
 
+/// \ref dql_iter_size
+/// \brief The size of a DequeListIterator_s in bytes.
+extern const unsigned_t dql_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref dql_iter_new
@@ -216,6 +239,11 @@ typedef struct DequeListIterator_s *DequeListIterator;
 DequeListIterator_t *
 dql_iter_new(DequeList_t *target);
 
+/// \ref dql_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+dql_iter_init(DequeListIterator_t *iter, DequeList_t *target);
+
 /// \ref dql_iter_retarget
 /// \brief Retargets an existing iterator.
 void
@@ -289,16 +317,20 @@ dql_iter_peek(DequeListIterator_t *iter);
 void *
 dql_iter_peek_prev(DequeListIterator_t *iter);
 
-#define DQL_FOR_EACH(target, body)                         \
-    do {                                                   \
-        DequeListIterator_t *iter_ = dql_iter_new(target); \
-        while (dql_iter_has_next(iter_)) {                 \
-            void *var = dql_iter_peek(iter_);              \
-            body;                                          \
-            dql_iter_next(iter_);                          \
-        }                                                  \
-        dql_iter_free(iter_);                              \
-    } while (0);                                           \
+#define DQL_ITER_DECL(name)                                                 \
+    char name##_storage__[dql_iter_size];                                   \
+    DequeListIterator_t *name = (DequeListIterator_t*)&name##_storage__[0]; \
+
+#define DQL_FOR_EACH(target, body)                \
+    do {                                          \
+        DQL_ITER_DECL(iter_)                      \
+        if (dql_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = dql_iter_peek(iter_); \
+                body;                             \
+            } while (dql_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 #define DQL_DECL(name)                                      \
     char name##_storage__[dql_size];                        \
@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_DOUBLYLINKEDLIST_H
 
 #include "Core.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -126,6 +127,8 @@ bool dll_contains(DoublyLinkedList list, void *key);
 
 Status dll_reverse(DoublyLinkedList list);
 
+Status dll_sort(DoublyLinkedList list);
+
 Status dll_copy(DoublyLinkedList list, DoublyLinkedList *result);
 
 Status dll_to_array(DoublyLinkedList list, void ***result, integer_t *length);
@@ -143,6 +146,17 @@ Status dll_unlink(DoublyLinkedList list, DoublyLinkedList result,
 Status dll_unlink_at(DoublyLinkedList list, DoublyLinkedList result,
                      integer_t position1, integer_t position2);
 
+Status dll_splice(DoublyLinkedList dst, integer_t dst_pos,
+                  DoublyLinkedList src, integer_t from, integer_t to);
+
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+Status dll_serialize(DoublyLinkedList list, serialize_f function,
+                     Serial_t *serial);
+
+Status dll_deserialize(DoublyLinkedList list, deserialize_f function,
+                       Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 Status dll_display(DoublyLinkedList list);
@@ -11,6 +11,8 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
+#include "ThreadPool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -259,6 +261,65 @@ dar_from_array(Interface_t *interface, void **buffer, integer_t length,
 void
 dar_sort(DynamicArray_t *array);
 
+/// \ref dar_for_each
+/// \brief Applies a function to every element in the array.
+void
+dar_for_each(DynamicArray_t *array, foreach_f function, void *context);
+
+/// \ref dar_map
+/// \brief Creates a new array with the result of a function on each element.
+DynamicArray_t *
+dar_map(DynamicArray_t *array, Interface_t *interface, map_f function,
+        void *context);
+
+/// \ref dar_filter
+/// \brief Creates a new array with copies of the elements that pass a test.
+DynamicArray_t *
+dar_filter(DynamicArray_t *array, predicate_f predicate, void *context);
+
+/// \ref dar_reduce
+/// \brief Folds every element of the array into an accumulator.
+void
+dar_reduce(DynamicArray_t *array, void *result, reduce_f function,
+           void *context);
+
+/// \ref dar_parallel_for_each
+/// \brief Applies a function to every element in the array in parallel.
+void
+dar_parallel_for_each(DynamicArray_t *array, ThreadPool_t *pool,
+                      foreach_f function, void *context);
+
+/// \ref dar_parallel_map
+/// \brief Parallel version of dar_map().
+DynamicArray_t *
+dar_parallel_map(DynamicArray_t *array, ThreadPool_t *pool,
+                 Interface_t *interface, map_f function, void *context);
+
+/// \ref dar_parallel_filter
+/// \brief Parallel version of dar_filter().
+DynamicArray_t *
+dar_parallel_filter(DynamicArray_t *array, ThreadPool_t *pool,
+                    predicate_f predicate, void *context);
+
+/// \ref dar_parallel_reduce
+/// \brief Parallel version of dar_reduce() for associative reductions.
+bool
+dar_parallel_reduce(DynamicArray_t *array, ThreadPool_t *pool, void *result,
+                    integer_t result_size, reduce_f function,
+                    combine_f combine, void *context);
+
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref dar_serialize
+/// \brief Saves the array's elements to a stream.
+bool
+dar_serialize(DynamicArray_t *array, Serial_t *serial);
+
+/// \ref dar_deserialize
+/// \brief Loads elements saved with dar_serialize() into an empty array.
+bool
+dar_deserialize(DynamicArray_t *array, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref dar_display
@@ -283,6 +344,10 @@ typedef struct DynamicArrayIterator_s DynamicArrayIterator_t;
 /// A pointer type for a <code> struct DynamicArrayIterator_s </code>.
 typedef struct DynamicArrayIterator_s *DynamicArrayIterator;
 
+/// \ref dar_iter_size
+/// \brief The size of a DynamicArrayIterator_s in bytes.
+extern const unsigned_t dar_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref dar_iter_new
@@ -290,6 +355,11 @@ typedef struct DynamicArrayIterator_s *DynamicArrayIterator;
 DynamicArrayIterator_t *
 dar_iter_new(DynamicArray_t *target);
 
+/// \ref dar_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+dar_iter_init(DynamicArrayIterator_t *iter, DynamicArray_t *target);
+
 /// \ref dar_iter_retarget
 /// \brief Retargets an existing iterator.
 void
@@ -363,6 +433,11 @@ dar_iter_peek(DynamicArrayIterator_t *iter);
 void *
 dar_iter_peek_prev(DynamicArrayIterator_t *iter);
 
+#define DAR_ITER_DECL(name)                            \
+    char name##_storage__[dar_iter_size];              \
+    DynamicArrayIterator_t *name =                     \
+        (DynamicArrayIterator_t*)&name##_storage__[0]; \
+
 #ifdef __cplusplus
 }
 #endif
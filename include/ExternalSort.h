@@ -0,0 +1,91 @@
+/**
+ * @file ExternalSort.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_EXTERNALSORT_H
+#define C_DATASTRUCTURES_LIBRARY_EXTERNALSORT_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Serial.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct ExternalSort_s
+/// \brief Sorts more elements than fit in a given amount of memory.
+struct ExternalSort_s;
+
+/// \brief A type for an ExternalSort_s.
+///
+/// A type for a <code> struct ExternalSort_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct ExternalSort_s ExternalSort_t;
+
+/// \brief A pointer type for an ExternalSort_s.
+///
+/// A pointer type to <code> struct ExternalSort_s </code>.
+typedef struct ExternalSort_s *ExternalSort;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref exs_new
+/// \brief Initializes a new ExternalSort_s with a memory budget in bytes.
+ExternalSort_t *
+exs_new(Interface_t *interface, size_t memory);
+
+/// \ref exs_free
+/// \brief Frees the sorter, its temporary files and the elements not taken.
+void
+exs_free(ExternalSort_t *sorter);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref exs_count
+/// \brief Returns the amount of elements added to the sorter.
+integer_t
+exs_count(ExternalSort_t *sorter);
+
+/// \ref exs_runs
+/// \brief Returns the amount of sorted runs spilled to temporary files.
+integer_t
+exs_runs(ExternalSort_t *sorter);
+
+/// \ref exs_failed
+/// \brief Returns true if allocating, sorting or any file operation failed.
+bool
+exs_failed(ExternalSort_t *sorter);
+
+/////////////////////////////////////////////////////////////////// SORTING ///
+
+/// \ref exs_add
+/// \brief Adds an element to be sorted, spilling a run if memory is full.
+bool
+exs_add(ExternalSort_t *sorter, void *element);
+
+/// \ref exs_finish
+/// \brief Ends the input and prepares the final merge.
+bool
+exs_finish(ExternalSort_t *sorter);
+
+/// \ref exs_next
+/// \brief Takes the next element in ascending order.
+bool
+exs_next(ExternalSort_t *sorter, void **result);
+
+/// \ref exs_sort
+/// \brief Sorts a DynamicArray_s saved in a stream into another stream.
+bool
+exs_sort(Serial_t *input, Serial_t *output, Interface_t *interface,
+         size_t memory);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_EXTERNALSORT_H
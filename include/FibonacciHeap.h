@@ -0,0 +1,155 @@
+/**
+ * @file FibonacciHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_FIBONACCIHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_FIBONACCIHEAP_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Heap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct FibonacciHeap_s
+/// \brief A Fibonacci heap with node handles.
+struct FibonacciHeap_s;
+
+/// \brief A type for a Fibonacci heap.
+///
+/// A type for a <code> struct FibonacciHeap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct FibonacciHeap_s FibonacciHeap_t;
+
+/// \brief A pointer type for a Fibonacci heap.
+///
+/// A pointer type to <code> struct FibonacciHeap_s </code>. This typedef is
+/// used to avoid having to declare every Fibonacci heap as a pointer type since
+/// they all must be dynamically allocated.
+typedef struct FibonacciHeap_s *FibonacciHeap;
+
+/// \struct FibonacciHeapNode_s
+/// \brief A handle to an element inserted into a FibonacciHeap_s.
+struct FibonacciHeapNode_s;
+
+/// \brief A type for a Fibonacci heap handle.
+///
+/// A type for a <code> struct FibonacciHeapNode_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct FibonacciHeapNode_s FibonacciHeapNode_t;
+
+/// \brief A pointer type for a Fibonacci heap handle.
+///
+/// A pointer type to <code> struct FibonacciHeapNode_s </code>.
+typedef struct FibonacciHeapNode_s *FibonacciHeapNode;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref fbh_new
+/// \brief Initializes a new FibonacciHeap_s.
+FibonacciHeap_t *
+fbh_new(Interface_t *interface, HeapKind kind);
+
+/// \ref fbh_free
+/// \brief Frees from memory a FibonacciHeap_s and its elements.
+void
+fbh_free(FibonacciHeap_t *heap);
+
+/// \ref fbh_free_shallow
+/// \brief Frees from memory a FibonacciHeap_s leaving its elements intact.
+void
+fbh_free_shallow(FibonacciHeap_t *heap);
+
+/// \ref fbh_erase
+/// \brief Frees from memory all elements of a FibonacciHeap_s.
+void
+fbh_erase(FibonacciHeap_t *heap);
+
+/// \ref fbh_erase_shallow
+/// \brief Removes all elements from a FibonacciHeap_s leaving them intact.
+void
+fbh_erase_shallow(FibonacciHeap_t *heap);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref fbh_config
+/// \brief Sets a new interface for the target Fibonacci heap.
+void
+fbh_config(FibonacciHeap_t *heap, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref fbh_count
+/// \brief Returns the amount of elements in the Fibonacci heap.
+integer_t
+fbh_count(FibonacciHeap_t *heap);
+
+/// \ref fbh_kind
+/// \brief Returns if the Fibonacci heap is a MaxHeap or a MinHeap.
+HeapKind
+fbh_kind(FibonacciHeap_t *heap);
+
+/// \ref fbh_element
+/// \brief Returns the element referenced by a handle.
+void *
+fbh_element(FibonacciHeapNode_t *handle);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref fbh_insert
+/// \brief Inserts an element in the Fibonacci heap.
+bool
+fbh_insert(FibonacciHeap_t *heap, void *element, FibonacciHeapNode_t **handle);
+
+/// \ref fbh_remove
+/// \brief Removes the top element from the Fibonacci heap.
+bool
+fbh_remove(FibonacciHeap_t *heap, void **result);
+
+/// \ref fbh_delete
+/// \brief Removes the element referenced by a handle.
+bool
+fbh_delete(FibonacciHeap_t *heap, FibonacciHeapNode_t *handle, void **result);
+
+/// \ref fbh_peek
+/// \brief Returns the top element of the Fibonacci heap.
+void *
+fbh_peek(FibonacciHeap_t *heap);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref fbh_empty
+/// \brief Returns true if the Fibonacci heap is empty, otherwise false.
+bool
+fbh_empty(FibonacciHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref fbh_decrease_key
+/// \brief Moves an element up after it gained priority.
+bool
+fbh_decrease_key(FibonacciHeap_t *heap, FibonacciHeapNode_t *handle);
+
+/// \ref fbh_meld
+/// \brief Moves all elements of a Fibonacci heap into another.
+bool
+fbh_meld(FibonacciHeap_t *heap, FibonacciHeap_t *other);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref fbh_display
+/// \brief Displays a FibonacciHeap_s in the console.
+void
+fbh_display(FibonacciHeap_t *heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_FIBONACCIHEAP_H
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -182,6 +183,18 @@ hep_copy(Heap_t *heap);
 Heap_t *
 hep_copy_shallow(Heap_t *heap);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref hep_serialize
+/// \brief Saves the heap's elements in heap order to a stream.
+bool
+hep_serialize(Heap_t *heap, Serial_t *serial);
+
+/// \ref hep_deserialize
+/// \brief Loads elements saved with hep_serialize() into an empty heap.
+bool
+hep_deserialize(Heap_t *heap, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref hep_display
@@ -193,7 +206,118 @@ hep_display(Heap_t *heap, int display_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo HeapIterator
+/// \struct HeapIterator_s.
+/// \brief A Heap_s iterator.
+struct HeapIterator_s;
+
+/// \brief A type for a heap iterator.
+///
+/// A type for a <code> struct HeapIterator_s </code>.
+typedef struct HeapIterator_s HeapIterator_t;
+
+/// \brief A pointer type for a heap iterator.
+///
+/// A pointer type for a <code> struct HeapIterator_s </code>.
+typedef struct HeapIterator_s *HeapIterator;
+
+/// \ref hep_iter_size
+/// \brief The size of a HeapIterator_s in bytes.
+extern const unsigned_t hep_iter_size;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref hep_iter_new
+/// \brief Creates a new heap iterator given a target heap.
+HeapIterator_t *
+hep_iter_new(Heap_t *target);
+
+/// \ref hep_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+hep_iter_init(HeapIterator_t *iter, Heap_t *target);
+
+/// \ref hep_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+hep_iter_retarget(HeapIterator_t *iter, Heap_t *target);
+
+/// \ref hep_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+hep_iter_free(HeapIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref hep_iter_next
+/// \brief Iterates to the next element in the buffer if available.
+bool
+hep_iter_next(HeapIterator_t *iter);
+
+/// \ref hep_iter_prev
+/// \brief Iterates to the previous element in the buffer if available.
+bool
+hep_iter_prev(HeapIterator_t *iter);
+
+/// \ref hep_iter_to_start
+/// \brief Iterates to the root of the heap.
+bool
+hep_iter_to_start(HeapIterator_t *iter);
+
+/// \ref hep_iter_to_end
+/// \brief Iterates to the last element in the heap's buffer.
+bool
+hep_iter_to_end(HeapIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref hep_iter_has_next
+/// \brief Returns true if there is another element next in the iteration.
+bool
+hep_iter_has_next(HeapIterator_t *iter);
+
+/// \ref hep_iter_has_prev
+/// \brief Returns true if there is a previous element in the iteration.
+bool
+hep_iter_has_prev(HeapIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref hep_iter_get
+/// \brief Gets the element pointed by the iterator.
+bool
+hep_iter_get(HeapIterator_t *iter, void **result);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref hep_iter_peek_next
+/// \brief Returns the next element in the iteration if available.
+void *
+hep_iter_peek_next(HeapIterator_t *iter);
+
+/// \ref hep_iter_peek
+/// \brief Returns the current element in the iteration if available.
+void *
+hep_iter_peek(HeapIterator_t *iter);
+
+/// \ref hep_iter_peek_prev
+/// \brief Returns the previous element in the iteration if available.
+void *
+hep_iter_peek_prev(HeapIterator_t *iter);
+
+#define HEP_ITER_DECL(name)                                       \
+    char name##_storage__[hep_iter_size];                         \
+    HeapIterator_t *name = (HeapIterator_t*)&name##_storage__[0]; \
+
+#define HEP_FOR_EACH(target, body)                \
+    do {                                          \
+        HEP_ITER_DECL(iter_)                      \
+        if (hep_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = hep_iter_peek(iter_); \
+                body;                             \
+            } while (hep_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -0,0 +1,141 @@
+/**
+ * @file IntervalTree.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_INTERVALTREE_H
+#define C_DATASTRUCTURES_LIBRARY_INTERVALTREE_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "DynamicArray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct IntervalTree_s
+/// \brief A red-black tree of closed intervals with overlap queries.
+struct IntervalTree_s;
+
+/// \brief A type for an interval tree.
+///
+/// A type for a <code> struct IntervalTree_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct IntervalTree_s IntervalTree_t;
+
+/// \brief A pointer type for an interval tree.
+///
+/// A pointer type to <code> struct IntervalTree_s </code>. This typedef is
+/// used to avoid having to declare every interval tree as a pointer type
+/// since they all must be dynamically allocated.
+typedef struct IntervalTree_s *IntervalTree;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref ivt_new
+/// \brief Initializes a new IntervalTree_s.
+IntervalTree_t *
+ivt_new(Interface_t *interface);
+
+/// \ref ivt_free
+/// \brief Frees from memory an IntervalTree_s and its elements.
+void
+ivt_free(IntervalTree_t *tree);
+
+/// \ref ivt_free_shallow
+/// \brief Frees from memory an IntervalTree_s leaving its elements intact.
+void
+ivt_free_shallow(IntervalTree_t *tree);
+
+/// \ref ivt_erase
+/// \brief Frees from memory all elements of an IntervalTree_s.
+void
+ivt_erase(IntervalTree_t *tree);
+
+/// \ref ivt_erase_shallow
+/// \brief Removes all intervals of an IntervalTree_s leaving their elements
+/// intact.
+void
+ivt_erase_shallow(IntervalTree_t *tree);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref ivt_config
+/// \brief Sets a new interface for the target interval tree.
+void
+ivt_config(IntervalTree_t *tree, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref ivt_size
+/// \brief Returns the amount of intervals in the interval tree.
+integer_t
+ivt_size(IntervalTree_t *tree);
+
+/// \ref ivt_span
+/// \brief Returns the lowest start and the highest end of all intervals.
+bool
+ivt_span(IntervalTree_t *tree, int64_t *low, int64_t *high);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref ivt_insert
+/// \brief Adds an element with the interval [low, high] to the tree.
+bool
+ivt_insert(IntervalTree_t *tree, int64_t low, int64_t high, void *element);
+
+/// \ref ivt_remove
+/// \brief Removes an element with the interval [low, high] from the tree.
+bool
+ivt_remove(IntervalTree_t *tree, int64_t low, int64_t high, void *element,
+           void **result);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref ivt_empty
+/// \brief Returns true if the interval tree is empty, otherwise false.
+bool
+ivt_empty(IntervalTree_t *tree);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref ivt_contains
+/// \brief Checks if an element with the interval [low, high] is in the tree.
+bool
+ivt_contains(IntervalTree_t *tree, int64_t low, int64_t high, void *element);
+
+/// \ref ivt_overlap
+/// \brief Visits every element whose interval overlaps [low, high].
+integer_t
+ivt_overlap(IntervalTree_t *tree, int64_t low, int64_t high,
+            foreach_f function, void *context);
+
+/// \ref ivt_overlap_array
+/// \brief Appends every element whose interval overlaps [low, high] to an
+/// array.
+bool
+ivt_overlap_array(IntervalTree_t *tree, int64_t low, int64_t high,
+                  DynamicArray_t *result);
+
+/// \ref ivt_stab
+/// \brief Visits every element whose interval contains a point.
+integer_t
+ivt_stab(IntervalTree_t *tree, int64_t point, foreach_f function,
+         void *context);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref ivt_display
+/// \brief Displays the intervals of an IntervalTree_s in order.
+void
+ivt_display(IntervalTree_t *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_INTERVALTREE_H
@@ -0,0 +1,161 @@
+/**
+ * @file LRUCache.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_LRUCACHE_H
+#define C_DATASTRUCTURES_LIBRARY_LRUCACHE_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct LRUCache_s
+///
+/// \brief A bounded key-value cache that evicts the least recently used pair.
+struct LRUCache_s;
+
+/// \brief A type for a least recently used cache.
+///
+/// A type for a <code> struct LRUCache_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct LRUCache_s LRUCache_t;
+
+/// \brief A pointer type for a least recently used cache.
+///
+/// A pointer type to <code> struct LRUCache_s </code>. This typedef is used
+/// to avoid having to declare every cache as a pointer type since they all
+/// must be dynamically allocated.
+typedef struct LRUCache_s *LRUCache;
+
+/// \brief Which pair an LRUCache_s evicts when it is full.
+enum LRUPolicy
+{
+    LRU_PLAIN     = 0, ///< The least recently used pair
+    LRU_SEGMENTED = 1  ///< The least recently used pair not used twice first
+};
+
+/// Defines a type to an <code> enum LRUPolicy </code>
+typedef enum LRUPolicy LRUPolicy;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref lru_new
+/// \brief Initializes a new LRUCache_s.
+LRUCache_t *
+lru_new(Interface_t *key_interface, Interface_t *value_interface,
+        integer_t capacity, LRUPolicy policy);
+
+/// \ref lru_free
+/// \brief Frees from memory an LRUCache_s and its key-value pairs.
+void
+lru_free(LRUCache_t *cache);
+
+/// \ref lru_erase
+/// \brief Frees from memory all key-value pairs of an LRUCache_s.
+void
+lru_erase(LRUCache_t *cache);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref lru_count
+/// \brief Returns the amount of key-value pairs in the cache.
+integer_t
+lru_count(LRUCache_t *cache);
+
+/// \ref lru_weight
+/// \brief Returns the total weight of the pairs in the cache.
+integer_t
+lru_weight(LRUCache_t *cache);
+
+/// \ref lru_capacity
+/// \brief Returns the maximum total weight of the pairs in the cache.
+integer_t
+lru_capacity(LRUCache_t *cache);
+
+/// \ref lru_policy
+/// \brief Returns the eviction policy of the cache.
+LRUPolicy
+lru_policy(LRUCache_t *cache);
+
+/// \ref lru_hits
+/// \brief Returns how many times lru_get() found its key.
+integer_t
+lru_hits(LRUCache_t *cache);
+
+/// \ref lru_misses
+/// \brief Returns how many times lru_get() did not find its key.
+integer_t
+lru_misses(LRUCache_t *cache);
+
+/// \ref lru_evictions
+/// \brief Returns how many pairs were evicted to make room for others.
+integer_t
+lru_evictions(LRUCache_t *cache);
+
+/// \ref lru_get
+/// \brief Returns the value of a key and marks it as recently used.
+void *
+lru_get(LRUCache_t *cache, void *key);
+
+/// \ref lru_peek
+/// \brief Returns the value of a key without marking it as used.
+void *
+lru_peek(LRUCache_t *cache, void *key);
+
+/////////////////////////////////////////////////////////////////// SETTERS ///
+
+/// \ref lru_set_capacity
+/// \brief Sets a new capacity, evicting pairs until they fit.
+bool
+lru_set_capacity(LRUCache_t *cache, integer_t capacity);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref lru_put
+/// \brief Maps a key to a value, evicting pairs if the cache is full.
+bool
+lru_put(LRUCache_t *cache, void *key, void *value);
+
+/// \ref lru_remove
+/// \brief Removes a given key from the cache and retrieves its value.
+bool
+lru_remove(LRUCache_t *cache, void *key, void **value);
+
+/// \ref lru_pop
+/// \brief Removes a given key from the cache and does not retrieve it.
+bool
+lru_pop(LRUCache_t *cache, void *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref lru_empty
+/// \brief Returns true if the cache has no key-value pairs.
+bool
+lru_empty(LRUCache_t *cache);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref lru_contains_key
+/// \brief Returns true if the cache contains a given key.
+bool
+lru_contains_key(LRUCache_t *cache, void *key);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref lru_display
+/// \brief Displays in the console a cache from the most to the least recent.
+void
+lru_display(LRUCache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_LRUCACHE_H
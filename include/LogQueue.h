@@ -0,0 +1,99 @@
+/**
+ * @file LogQueue.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_LOGQUEUE_H
+#define C_DATASTRUCTURES_LIBRARY_LOGQUEUE_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct LogQueue_s
+/// \brief A queue that survives restarts by appending to a log on disk.
+struct LogQueue_s;
+
+/// \ref LogQueue_t
+/// \brief A type for a durable queue.
+///
+/// A type for a <code> struct LogQueue_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct LogQueue_s LogQueue_t;
+
+/// \ref LogQueue
+/// \brief A pointer type for a durable queue.
+///
+/// A pointer type to <code> struct LogQueue_s </code>.
+typedef struct LogQueue_s *LogQueue;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref lgq_open
+/// \brief Opens or creates a LogQueue_s in a directory with default settings.
+LogQueue_t *
+lgq_open(const char *directory, Interface_t *interface);
+
+/// \ref lgq_create
+/// \brief Opens or creates a LogQueue_s in a directory with custom settings.
+LogQueue_t *
+lgq_create(const char *directory, Interface_t *interface, integer_t window,
+           size_t segment_size, integer_t batch);
+
+/// \ref lgq_close
+/// \brief Syncs and frees a LogQueue_s. Queued elements stay on disk.
+bool
+lgq_close(LogQueue_t *queue);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref lgq_count
+/// \brief Returns the amount of elements in the queue.
+integer_t
+lgq_count(LogQueue_t *queue);
+
+/// \ref lgq_segments
+/// \brief Returns the amount of segment files in the log.
+integer_t
+lgq_segments(LogQueue_t *queue);
+
+/// \ref lgq_failed
+/// \brief Returns true if writing to or reading from the log failed.
+bool
+lgq_failed(LogQueue_t *queue);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref lgq_enqueue
+/// \brief Appends an element to the log and to the end of the queue.
+bool
+lgq_enqueue(LogQueue_t *queue, void *element);
+
+/// \ref lgq_dequeue
+/// \brief Removes the element at the front of the queue.
+bool
+lgq_dequeue(LogQueue_t *queue, void **result);
+
+/// \ref lgq_sync
+/// \brief Makes every enqueue and dequeue done so far durable.
+bool
+lgq_sync(LogQueue_t *queue);
+
+/////////////////////////////////////////////////////////////////// BOOLEAN ///
+
+/// \ref lgq_empty
+/// \brief Returns true if the queue has no elements.
+bool
+lgq_empty(LogQueue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_LOGQUEUE_H
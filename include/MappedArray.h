@@ -0,0 +1,133 @@
+/**
+ * @file MappedArray.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_MAPPEDARRAY_H
+#define C_DATASTRUCTURES_LIBRARY_MAPPEDARRAY_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct MappedArray_s
+/// \brief A read-only array of fixed-size records mapped from a file.
+struct MappedArray_s;
+
+/// \brief A type for a MappedArray_s.
+///
+/// A type for a <code> struct MappedArray_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct MappedArray_s MappedArray_t;
+
+/// \brief A pointer type for a MappedArray_s.
+///
+/// A pointer type to <code> struct MappedArray_s </code>.
+typedef struct MappedArray_s *MappedArray;
+
+/// \brief How the records of a MappedArray_s are going to be accessed.
+///
+/// Passed to mar_advise() so that the kernel can choose how to read the file
+/// ahead.
+enum MappedAccess
+{
+    MAR_NORMAL     = 0, ///< No particular order
+    MAR_SEQUENTIAL = 1, ///< From the first record to the last one
+    MAR_RANDOM     = 2, ///< In any order, like binary searches do
+    MAR_WILLNEED   = 3  ///< The whole file will be needed soon
+};
+
+/// Defines a type to an <code> enum MappedAccess </code>
+typedef enum MappedAccess MappedAccess;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref mar_open
+/// \brief Maps a file of fixed-size records into memory.
+MappedArray_t *
+mar_open(const char *path, size_t element_size, Interface_t *interface);
+
+/// \ref mar_close
+/// \brief Unmaps the file and frees the MappedArray_s.
+bool
+mar_close(MappedArray_t *array);
+
+/// \ref mar_config
+/// \brief Sets a new interface for the target MappedArray_s.
+void
+mar_config(MappedArray_t *array, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref mar_count
+/// \brief Returns the amount of records in the file.
+integer_t
+mar_count(MappedArray_t *array);
+
+/// \ref mar_element_size
+/// \brief Returns the size in bytes of each record.
+size_t
+mar_element_size(MappedArray_t *array);
+
+/// \ref mar_data
+/// \brief Returns the first byte of the mapped file.
+const void *
+mar_data(MappedArray_t *array);
+
+/// \ref mar_get
+/// \brief Returns the record at a given index.
+const void *
+mar_get(MappedArray_t *array, integer_t index);
+
+/////////////////////////////////////////////////////////////////// ADVISES ///
+
+/// \ref mar_advise
+/// \brief Tells the kernel how the records are going to be accessed.
+bool
+mar_advise(MappedArray_t *array, MappedAccess access);
+
+/////////////////////////////////////////////////////////////////// BOOLEAN ///
+
+/// \ref mar_empty
+/// \brief Returns true if the file has no records.
+bool
+mar_empty(MappedArray_t *array);
+
+/// \ref mar_sorted
+/// \brief Returns true if the records are in ascending order.
+bool
+mar_sorted(MappedArray_t *array);
+
+/// \ref mar_contains
+/// \brief Searches a sorted MappedArray_s for a key.
+bool
+mar_contains(MappedArray_t *array, const void *key);
+
+//////////////////////////////////////////////////////////////////// SEARCH ///
+
+/// \ref mar_lower_bound
+/// \brief Returns the index of the first record not smaller than a key.
+integer_t
+mar_lower_bound(MappedArray_t *array, const void *key);
+
+/// \ref mar_index_first
+/// \brief Returns the index of the first record equal to a key.
+integer_t
+mar_index_first(MappedArray_t *array, const void *key);
+
+/// \ref mar_index_last
+/// \brief Returns the index of the last record equal to a key.
+integer_t
+mar_index_last(MappedArray_t *array, const void *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_MAPPEDARRAY_H
@@ -0,0 +1,160 @@
+/**
+ * @file PairingHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_PAIRINGHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_PAIRINGHEAP_H
+
+#include "Core.h"
+#include "Interface.h"
+#include "Heap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct PairingHeap_s
+/// \brief A generic, node-based pairing heap.
+struct PairingHeap_s;
+
+/// \brief A type for a pairing heap.
+///
+/// A type for a <code> struct PairingHeap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct PairingHeap_s PairingHeap_t;
+
+/// \brief A pointer type for a pairing heap.
+///
+/// A pointer type to <code> struct PairingHeap_s </code>. This typedef is used
+/// to avoid having to declare every pairing heap as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct PairingHeap_s *PairingHeap;
+
+/// \struct PairingHeapNode_s
+/// \brief A handle to an element inserted into a PairingHeap_s.
+struct PairingHeapNode_s;
+
+/// \brief A type for a pairing heap handle.
+///
+/// A type for a <code> struct PairingHeapNode_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct PairingHeapNode_s PairingHeapNode_t;
+
+/// \brief A pointer type for a pairing heap handle.
+///
+/// A pointer type to <code> struct PairingHeapNode_s </code>.
+typedef struct PairingHeapNode_s *PairingHeapNode;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref pqh_new
+/// \brief Initializes a new PairingHeap_s.
+PairingHeap_t *
+pqh_new(Interface_t *interface, HeapKind kind);
+
+/// \ref pqh_free
+/// \brief Frees from memory a PairingHeap_s and its elements.
+void
+pqh_free(PairingHeap_t *heap);
+
+/// \ref pqh_free_shallow
+/// \brief Frees from memory a PairingHeap_s leaving its elements intact.
+void
+pqh_free_shallow(PairingHeap_t *heap);
+
+/// \ref pqh_erase
+/// \brief Frees from memory all elements of a PairingHeap_s.
+void
+pqh_erase(PairingHeap_t *heap);
+
+/// \ref pqh_erase_shallow
+/// \brief Removes all elements from a PairingHeap_s leaving them intact.
+void
+pqh_erase_shallow(PairingHeap_t *heap);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref pqh_config
+/// \brief Sets a new interface for the target pairing heap.
+void
+pqh_config(PairingHeap_t *heap, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref pqh_count
+/// \brief Returns the amount of elements in the pairing heap.
+integer_t
+pqh_count(PairingHeap_t *heap);
+
+/// \ref pqh_kind
+/// \brief Returns if the pairing heap is a MaxHeap or a MinHeap.
+HeapKind
+pqh_kind(PairingHeap_t *heap);
+
+/// \ref pqh_element
+/// \brief Returns the element referenced by a handle.
+void *
+pqh_element(PairingHeapNode_t *handle);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref pqh_insert
+/// \brief Inserts an element in the pairing heap.
+bool
+pqh_insert(PairingHeap_t *heap, void *element, PairingHeapNode_t **handle);
+
+/// \ref pqh_remove
+/// \brief Removes the top element from the pairing heap.
+bool
+pqh_remove(PairingHeap_t *heap, void **result);
+
+/// \ref pqh_delete
+/// \brief Removes the element referenced by a handle.
+bool
+pqh_delete(PairingHeap_t *heap, PairingHeapNode_t *handle, void **result);
+
+/// \ref pqh_peek
+/// \brief Returns the top element of the pairing heap.
+void *
+pqh_peek(PairingHeap_t *heap);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref pqh_empty
+/// \brief Returns true if the pairing heap is empty, otherwise false.
+bool
+pqh_empty(PairingHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref pqh_decrease_key
+/// \brief Moves an element up after it gained priority.
+bool
+pqh_decrease_key(PairingHeap_t *heap, PairingHeapNode_t *handle);
+
+/// \ref pqh_update
+/// \brief Moves an element to its place after it was changed in any way.
+bool
+pqh_update(PairingHeap_t *heap, PairingHeapNode_t *handle);
+
+/// \ref pqh_meld
+/// \brief Moves all elements of a pairing heap into another.
+bool
+pqh_meld(PairingHeap_t *heap, PairingHeap_t *other);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref pqh_display
+/// \brief Displays a PairingHeap_s in the console.
+void
+pqh_display(PairingHeap_t *heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_PAIRINGHEAP_H
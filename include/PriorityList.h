@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -149,6 +150,18 @@ pli_merge(PriorityList_t *plist1, PriorityList_t *plist2);
 void **
 pli_to_array(PriorityList_t *plist, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref pli_serialize
+/// \brief Saves the list's elements in priority order to a stream.
+bool
+pli_serialize(PriorityList_t *plist, Serial_t *serial);
+
+/// \ref pli_deserialize
+/// \brief Loads elements saved with pli_serialize() into an empty list.
+bool
+pli_deserialize(PriorityList_t *plist, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref pli_display
@@ -160,7 +173,99 @@ pli_display(PriorityList_t *plist, int display_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo PriorityListIterator
+/// \struct PriorityListIterator_s.
+/// \brief A PriorityList_s iterator.
+struct PriorityListIterator_s;
+
+/// \brief A type for a priority list iterator.
+///
+/// A type for a <code> struct PriorityListIterator_s </code>.
+typedef struct PriorityListIterator_s PriorityListIterator_t;
+
+/// \brief A pointer type for a priority list iterator.
+///
+/// A pointer type for a <code> struct PriorityListIterator_s </code>.
+typedef struct PriorityListIterator_s *PriorityListIterator;
+
+/// \ref pli_iter_size
+/// \brief The size of a PriorityListIterator_s in bytes.
+extern const unsigned_t pli_iter_size;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref pli_iter_new
+/// \brief Creates a new priority list iterator given a target list.
+PriorityListIterator_t *
+pli_iter_new(PriorityList_t *target);
+
+/// \ref pli_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+pli_iter_init(PriorityListIterator_t *iter, PriorityList_t *target);
+
+/// \ref pli_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+pli_iter_retarget(PriorityListIterator_t *iter, PriorityList_t *target);
+
+/// \ref pli_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+pli_iter_free(PriorityListIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref pli_iter_next
+/// \brief Iterates to the next element with a lower priority if available.
+bool
+pli_iter_next(PriorityListIterator_t *iter);
+
+/// \ref pli_iter_to_front
+/// \brief Iterates to the element with the highest priority.
+bool
+pli_iter_to_front(PriorityListIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref pli_iter_has_next
+/// \brief Returns true if there is another element next in the iteration.
+bool
+pli_iter_has_next(PriorityListIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref pli_iter_get
+/// \brief Gets the element pointed by the iterator.
+bool
+pli_iter_get(PriorityListIterator_t *iter, void **result);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref pli_iter_peek_next
+/// \brief Returns the next element in the iteration if available.
+void *
+pli_iter_peek_next(PriorityListIterator_t *iter);
+
+/// \ref pli_iter_peek
+/// \brief Returns the current element in the iteration if available.
+void *
+pli_iter_peek(PriorityListIterator_t *iter);
+
+#define PLI_ITER_DECL(name)                            \
+    char name##_storage__[pli_iter_size];              \
+    PriorityListIterator_t *name =                     \
+        (PriorityListIterator_t*)&name##_storage__[0]; \
+
+#define PLI_FOR_EACH(target, body)                \
+    do {                                          \
+        PLI_ITER_DECL(iter_)                      \
+        if (pli_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = pli_iter_peek(iter_); \
+                body;                             \
+            } while (pli_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -196,6 +197,18 @@ qar_append(QueueArray_t *queue1, QueueArray_t *queue2);
 void **
 qar_to_array(QueueArray_t *queue, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref qar_serialize
+/// \brief Saves the queue's elements to a stream.
+bool
+qar_serialize(QueueArray_t *queue, Serial_t *serial);
+
+/// \ref qar_deserialize
+/// \brief Loads elements saved with qar_serialize() into an empty queue.
+bool
+qar_deserialize(QueueArray_t *queue, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref qar_display
@@ -207,7 +220,123 @@ qar_display(QueueArray_t *queue, int display_mode);
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo QueueArrayIterator
+/// \struct QueueArrayIterator_s.
+/// \brief A QueueArray_s iterator.
+struct QueueArrayIterator_s;
+
+/// \brief A type for a queue array iterator.
+///
+/// A type for a <code> struct QueueArrayIterator_s </code>.
+typedef struct QueueArrayIterator_s QueueArrayIterator_t;
+
+/// \brief A pointer type for a queue array iterator.
+///
+/// A pointer type for a <code> struct QueueArrayIterator_s </code>.
+typedef struct QueueArrayIterator_s *QueueArrayIterator;
+
+/// \ref qar_iter_size
+/// \brief The size of a QueueArrayIterator_s in bytes.
+extern const unsigned_t qar_iter_size;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref qar_iter_new
+/// \brief Creates a new queue array iterator given a target queue.
+QueueArrayIterator_t *
+qar_iter_new(QueueArray_t *target);
+
+/// \ref qar_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+qar_iter_init(QueueArrayIterator_t *iter, QueueArray_t *target);
+
+/// \ref qar_iter_retarget
+/// \brief Retargets an existing iterator.
+void
+qar_iter_retarget(QueueArrayIterator_t *iter, QueueArray_t *target);
+
+/// \ref qar_iter_free
+/// \brief Frees from memory an existing iterator.
+void
+qar_iter_free(QueueArrayIterator_t *iter);
+
+///////////////////////////////////////////////////////////////// ITERATION ///
+
+/// \ref qar_iter_next
+/// \brief Iterates to the next element towards the rear if available.
+bool
+qar_iter_next(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_prev
+/// \brief Iterates to the previous element towards the front if available.
+bool
+qar_iter_prev(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_to_front
+/// \brief Iterates to the front element in the queue.
+bool
+qar_iter_to_front(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_to_rear
+/// \brief Iterates to the rear element in the queue.
+bool
+qar_iter_to_rear(QueueArrayIterator_t *iter);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref qar_iter_has_next
+/// \brief Returns true if there is another element next in the iteration.
+bool
+qar_iter_has_next(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_has_prev
+/// \brief Returns true if there is a previous element in the iteration.
+bool
+qar_iter_has_prev(QueueArrayIterator_t *iter);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref qar_iter_get
+/// \brief Gets the element pointed by the iterator.
+bool
+qar_iter_get(QueueArrayIterator_t *iter, void **result);
+
+/// \ref qar_iter_set
+/// \brief Sets the element pointed by the iterator to a new element.
+bool
+qar_iter_set(QueueArrayIterator_t *iter, void *element);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref qar_iter_peek_next
+/// \brief Returns the next element in the iteration if available.
+void *
+qar_iter_peek_next(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_peek
+/// \brief Returns the current element in the iteration if available.
+void *
+qar_iter_peek(QueueArrayIterator_t *iter);
+
+/// \ref qar_iter_peek_prev
+/// \brief Returns the previous element in the iteration if available.
+void *
+qar_iter_peek_prev(QueueArrayIterator_t *iter);
+
+#define QAR_ITER_DECL(name)                                                   \
+    char name##_storage__[qar_iter_size];                                     \
+    QueueArrayIterator_t *name = (QueueArrayIterator_t*)&name##_storage__[0]; \
+
+#define QAR_FOR_EACH(target, body)                \
+    do {                                          \
+        QAR_ITER_DECL(iter_)                      \
+        if (qar_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = qar_iter_peek(iter_); \
+                body;                             \
+            } while (qar_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -164,11 +165,29 @@ qli_compare(QueueList_t *queue1, QueueList_t *queue2);
 bool
 qli_append(QueueList_t *queue1, QueueList_t *queue2);
 
+/// \ref qli_splice
+/// \brief Moves a range of elements from one queue into another.
+bool
+qli_splice(QueueList_t *dst, integer_t dst_pos, QueueList_t *src,
+           integer_t from, integer_t to);
+
 /// \ref qli_to_array
 /// \brief Makes a copy of the queue as a C array.
 void **
 qli_to_array(QueueList_t *queue, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref qli_serialize
+/// \brief Saves the queue's elements to a stream.
+bool
+qli_serialize(QueueList_t *queue, Serial_t *serial);
+
+/// \ref qli_deserialize
+/// \brief Loads elements saved with qli_serialize() into an empty queue.
+bool
+qli_deserialize(QueueList_t *queue, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref qli_display
@@ -194,6 +213,10 @@ typedef struct QueueListIterator_s QueueListIterator_t;
 /// A pointer type for a <code> struct QueueListIterator_s </code>.
 typedef struct QueueListIterator_s *QueueListIterator;
 
+/// \ref qli_iter_size
+/// \brief The size of a QueueListIterator_s in bytes.
+extern const unsigned_t qli_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref stl_iter_new
@@ -264,16 +287,20 @@ qli_iter_peek_next(QueueListIterator_t *iter);
 void *
 qli_iter_peek(QueueListIterator_t *iter);
 
-#define QLI_FOR_EACH(target, body)                         \
-    do {                                                   \
-        QueueListIterator_t *iter_ = qli_iter_new(target); \
-        while (qli_iter_has_next(iter_)) {                 \
-            void *var = qli_iter_peek(iter_);              \
-            body;                                          \
-            qli_iter_next(iter_);                          \
-        }                                                  \
-        qli_iter_free(iter_);                              \
-    } while (0);                                           \
+#define QLI_ITER_DECL(name)                                                 \
+    char name##_storage__[qli_iter_size];                                   \
+    QueueListIterator_t *name = (QueueListIterator_t*)&name##_storage__[0]; \
+
+#define QLI_FOR_EACH(target, body)                \
+    do {                                          \
+        QLI_ITER_DECL(iter_)                      \
+        if (qli_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = qli_iter_peek(iter_); \
+                body;                             \
+            } while (qli_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 #define QLI_DECL(name)                                      \
     char name##_storage__[qli_size];                        \
@@ -0,0 +1,117 @@
+/**
+ * @file RadixHeap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_RADIXHEAP_H
+#define C_DATASTRUCTURES_LIBRARY_RADIXHEAP_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct RadixHeap_s
+/// \brief A monotone min-heap of elements with unsigned integer keys.
+struct RadixHeap_s;
+
+/// \brief A type for a radix heap.
+///
+/// A type for a <code> struct RadixHeap_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct RadixHeap_s RadixHeap_t;
+
+/// \brief A pointer type for a radix heap.
+///
+/// A pointer type to <code> struct RadixHeap_s </code>. This typedef is used
+/// to avoid having to declare every radix heap as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct RadixHeap_s *RadixHeap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref rxh_new
+/// \brief Initializes a new RadixHeap_s.
+RadixHeap_t *
+rxh_new(Interface_t *interface);
+
+/// \ref rxh_free
+/// \brief Frees from memory a RadixHeap_s and its elements.
+void
+rxh_free(RadixHeap_t *heap);
+
+/// \ref rxh_free_shallow
+/// \brief Frees from memory a RadixHeap_s leaving its elements intact.
+void
+rxh_free_shallow(RadixHeap_t *heap);
+
+/// \ref rxh_erase
+/// \brief Frees from memory all elements of a RadixHeap_s.
+void
+rxh_erase(RadixHeap_t *heap);
+
+/// \ref rxh_erase_shallow
+/// \brief Removes all elements from a RadixHeap_s leaving them intact.
+void
+rxh_erase_shallow(RadixHeap_t *heap);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref rxh_config
+/// \brief Sets a new interface for the target radix heap.
+void
+rxh_config(RadixHeap_t *heap, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref rxh_count
+/// \brief Returns the amount of elements in the radix heap.
+integer_t
+rxh_count(RadixHeap_t *heap);
+
+/// \ref rxh_last
+/// \brief Returns the lowest key that can still be inserted.
+uint64_t
+rxh_last(RadixHeap_t *heap);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref rxh_insert
+/// \brief Inserts an element with a key not lower than the last removed one.
+bool
+rxh_insert(RadixHeap_t *heap, uint64_t key, void *element);
+
+/// \ref rxh_remove
+/// \brief Removes an element with the lowest key from the radix heap.
+bool
+rxh_remove(RadixHeap_t *heap, uint64_t *key, void **result);
+
+/// \ref rxh_peek
+/// \brief Returns an element with the lowest key of the radix heap.
+void *
+rxh_peek(RadixHeap_t *heap, uint64_t *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref rxh_empty
+/// \brief Returns true if the radix heap is empty, otherwise false.
+bool
+rxh_empty(RadixHeap_t *heap);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref rxh_display
+/// \brief Displays a RadixHeap_s in the console.
+void
+rxh_display(RadixHeap_t *heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_RADIXHEAP_H
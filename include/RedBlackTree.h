@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -139,6 +140,18 @@ rbt_max(RedBlackTree_t *tree);
 void *
 rbt_min(RedBlackTree_t *tree);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref rbt_serialize
+/// \brief Saves the tree's keys in order to a stream.
+bool
+rbt_serialize(RedBlackTree_t *tree, Serial_t *serial);
+
+/// \ref rbt_deserialize
+/// \brief Loads keys saved with rbt_serialize() into an empty tree.
+bool
+rbt_deserialize(RedBlackTree_t *tree, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref rbt_display
@@ -163,6 +176,72 @@ rbt_traversal(RedBlackTree_t *tree, int traversal_mode);
 
 /// \todo RedBlackTreeWrapper
 
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////// Sync ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// \struct RedBlackTreeSync_s
+/// \brief A thread-safe wrapper around a red-black tree.
+struct RedBlackTreeSync_s;
+
+/// \ref RedBlackTreeSync_t
+/// \brief A type for a thread-safe red-black tree.
+///
+/// A type for a <code> struct RedBlackTreeSync_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct RedBlackTreeSync_s RedBlackTreeSync_t;
+
+/// \ref RedBlackTreeSync
+/// \brief A pointer type for a thread-safe red-black tree.
+///
+/// A pointer type to <code> struct RedBlackTreeSync_s </code>.
+typedef struct RedBlackTreeSync_s *RedBlackTreeSync;
+
+/// \ref rbt_sync_new
+/// \brief Creates a new empty thread-safe red-black tree.
+RedBlackTreeSync_t *
+rbt_sync_new(Interface_t *interface, SyncMode mode);
+
+/// \ref rbt_sync_free
+/// \brief Frees from memory the wrapper, its tree and all of its elements.
+void
+rbt_sync_free(RedBlackTreeSync_t *sync);
+
+/// \ref rbt_sync_mode
+/// \brief Returns how the wrapper protects its tree.
+SyncMode
+rbt_sync_mode(RedBlackTreeSync_t *sync);
+
+/// \ref rbt_sync_size
+/// \brief Returns the amount of elements in the tree.
+integer_t
+rbt_sync_size(RedBlackTreeSync_t *sync);
+
+/// \ref rbt_sync_insert
+/// \brief Adds a new element to the tree.
+bool
+rbt_sync_insert(RedBlackTreeSync_t *sync, void *element);
+
+/// \ref rbt_sync_remove
+/// \brief Removes and frees an element that matches a given element.
+bool
+rbt_sync_remove(RedBlackTreeSync_t *sync, void *element);
+
+/// \ref rbt_sync_contains
+/// \brief Returns true if an element is in the tree.
+bool
+rbt_sync_contains(RedBlackTreeSync_t *sync, void *element);
+
+/// \ref rbt_sync_max
+/// \brief Returns a copy of the maximum element or NULL if the tree is empty.
+void *
+rbt_sync_max(RedBlackTreeSync_t *sync);
+
+/// \ref rbt_sync_min
+/// \brief Returns a copy of the minimum element or NULL if the tree is empty.
+void *
+rbt_sync_min(RedBlackTreeSync_t *sync);
+
 #ifdef __cplusplus
 }
 #endif
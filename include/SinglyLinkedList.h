@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_SINGLYLINKEDLIST_H
 
 #include "Core.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -126,6 +127,8 @@ bool sll_contains(SinglyLinkedList list, void *key);
 
 Status sll_reverse(SinglyLinkedList list);
 
+Status sll_sort(SinglyLinkedList list);
+
 Status sll_copy(SinglyLinkedList list, SinglyLinkedList *result);
 
 Status sll_to_array(SinglyLinkedList list, void ***result, integer_t *length);
@@ -143,6 +146,17 @@ Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
 Status sll_unlink_at(SinglyLinkedList list, SinglyLinkedList result,
                      integer_t position1, integer_t position2);
 
+Status sll_splice(SinglyLinkedList dst, integer_t dst_pos,
+                  SinglyLinkedList src, integer_t from, integer_t to);
+
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+Status sll_serialize(SinglyLinkedList list, serialize_f function,
+                     Serial_t *serial);
+
+Status sll_deserialize(SinglyLinkedList list, deserialize_f function,
+                       Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 Status sll_display(SinglyLinkedList list);
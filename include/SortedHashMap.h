@@ -0,0 +1,131 @@
+/**
+ * @file SortedHashMap.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SORTEDHASHMAP_H
+#define C_DATASTRUCTURES_LIBRARY_SORTEDHASHMAP_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \struct SortedHashMap_s
+///
+/// \brief A hash map that keeps its key-value pairs in insertion order.
+struct SortedHashMap_s;
+
+/// \brief A type for a sorted hash map.
+///
+/// A type for a <code> struct SortedHashMap_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct SortedHashMap_s SortedHashMap_t;
+
+/// \brief A pointer type for a sorted hash map.
+///
+/// A pointer type to <code> struct SortedHashMap_s </code>. This typedef is
+/// used to avoid having to declare every map as a pointer type since they all
+/// must be dynamically allocated.
+typedef struct SortedHashMap_s *SortedHashMap;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref shm_new
+/// \brief Initializes a new SortedHashMap_s.
+SortedHashMap_t *
+shm_new(Interface_t *key_interface, Interface_t *value_interface);
+
+/// \ref shm_free
+/// \brief Frees from memory a SortedHashMap_s and its key-value pairs.
+void
+shm_free(SortedHashMap_t *map);
+
+/// \ref shm_free_shallow
+/// \brief Frees from memory a SortedHashMap_s leaving its pairs intact.
+void
+shm_free_shallow(SortedHashMap_t *map);
+
+/// \ref shm_erase
+/// \brief Frees from memory all key-value pairs of a SortedHashMap_s.
+void
+shm_erase(SortedHashMap_t *map);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref shm_config
+/// \brief Sets new interfaces for a target sorted hash map.
+void
+shm_config(SortedHashMap_t *map, Interface_t *key_interface,
+           Interface_t *value_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref shm_size
+/// \brief Returns the amount of key-value pairs in the map.
+integer_t
+shm_size(SortedHashMap_t *map);
+
+/// \ref shm_capacity
+/// \brief Returns the amount of pairs the map can hold without growing.
+integer_t
+shm_capacity(SortedHashMap_t *map);
+
+/// \ref shm_get
+/// \brief Returns the value associated with a key, or NULL if not found.
+void *
+shm_get(SortedHashMap_t *map, void *key);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref shm_insert
+/// \brief Inserts a new key mapped to a value at the end of the map.
+bool
+shm_insert(SortedHashMap_t *map, void *key, void *value);
+
+/// \ref shm_remove
+/// \brief Removes a given key from the map and retrieves its value.
+bool
+shm_remove(SortedHashMap_t *map, void *key, void **value);
+
+/// \ref shm_pop
+/// \brief Removes a given key from the map and does not retrieve it.
+bool
+shm_pop(SortedHashMap_t *map, void *key);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref shm_empty
+/// \brief Returns true if the map has no key-value pairs.
+bool
+shm_empty(SortedHashMap_t *map);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref shm_contains_key
+/// \brief Returns true if the map contains a given key.
+bool
+shm_contains_key(SortedHashMap_t *map, void *key);
+
+/// \ref shm_to_arrays
+/// \brief Creates two arrays with copies of the keys and values in order.
+bool
+shm_to_arrays(SortedHashMap_t *map, void ***K_array, void ***V_array);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref shm_display
+/// \brief Displays in the console a sorted hash map.
+void
+shm_display(SortedHashMap_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SORTEDHASHMAP_H
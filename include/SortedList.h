@@ -11,6 +11,7 @@
 
 #include "./core/Core.h"
 #include "./core/CoreSort.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -85,6 +86,8 @@ Status sli_set_limit(SortedList list, integer_t limit);
 
 Status sli_set_order(SortedList list, SortOrder order);
 
+Status sli_set_indexed(SortedList list, bool indexed);
+
 // No setter because the user might break the sorted property of the list.
 
 /////////////////////////////////////////////////////////////////// GETTERS ///
@@ -95,6 +98,8 @@ integer_t sli_limit(SortedList list);
 
 SortOrder sli_order(SortedList list);
 
+bool sli_indexed(SortedList list);
+
 Status sli_get(SortedList list, void **result, integer_t index);
 
 ////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
@@ -142,6 +147,13 @@ Status sli_unlink(SortedList list, SortedList *result, integer_t position);
 Status sli_sublist(SortedList list, SortedList *result, integer_t start,
         integer_t end);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+Status sli_serialize(SortedList list, serialize_f function, Serial_t *serial);
+
+Status sli_deserialize(SortedList list, deserialize_f function,
+                       Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 Status sli_display(SortedList list);
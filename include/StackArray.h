@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -191,6 +192,18 @@ sta_stack(StackArray_t *stack1, StackArray_t *stack2);
 void **
 sta_to_array(StackArray_t *stack, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref sta_serialize
+/// \brief Saves the stack's elements to a stream.
+bool
+sta_serialize(StackArray_t *stack, Serial_t *serial);
+
+/// \ref sta_deserialize
+/// \brief Loads elements saved with sta_serialize() into an empty stack.
+bool
+sta_deserialize(StackArray_t *stack, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref sta_display
@@ -216,6 +229,10 @@ typedef struct StackArrayIterator_s StackArrayIterator_t;
 /// A pointer type for a <code> struct StackArrayIterator_s </code>.
 typedef struct StackArrayIterator_s *StackArrayIterator;
 
+/// \ref sta_iter_size
+/// \brief The size of a StackArrayIterator_s in bytes.
+extern const unsigned_t sta_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref sta_iter_new
@@ -223,6 +240,11 @@ typedef struct StackArrayIterator_s *StackArrayIterator;
 StackArrayIterator_t *
 sta_iter_new(StackArray_t *target);
 
+/// \ref sta_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+sta_iter_init(StackArrayIterator_t *iter, StackArray_t *target);
+
 /// \ref sta_iter_retarget
 /// \brief Retargets an existing iterator.
 void
@@ -296,16 +318,20 @@ sta_iter_peek(StackArrayIterator_t *iter);
 void *
 sta_iter_peek_prev(StackArrayIterator_t *iter);
 
-#define STA_FOR_EACH(target, body)                          \
-    do {                                                    \
-        StackArrayIterator_t *iter_ = sta_iter_new(target); \
-        while (sta_iter_has_next(iter_)) {                  \
-            void *var = sta_iter_peek(iter_);               \
-            body;                                           \
-            sta_iter_next(iter_);                           \
-        }                                                   \
-        sta_iter_free(iter_);                               \
-    } while (0);                                            \
+#define STA_ITER_DECL(name)                                                   \
+    char name##_storage__[sta_iter_size];                                     \
+    StackArrayIterator_t *name = (StackArrayIterator_t*)&name##_storage__[0]; \
+
+#define STA_FOR_EACH(target, body)                \
+    do {                                          \
+        STA_ITER_DECL(iter_)                      \
+        if (sta_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = sta_iter_peek(iter_); \
+                body;                             \
+            } while (sta_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 #define STA_DECL(name)                                        \
     char name##_storage__[sta_size];                          \
@@ -11,6 +11,7 @@
 
 #include "Core.h"
 #include "Interface.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -164,6 +165,18 @@ stl_stack(StackList_t *stack1, StackList_t *stack2);
 void **
 stl_to_array(StackList_t *stack, integer_t *length);
 
+///////////////////////////////////////////////////////////// SERIALIZATION ///
+
+/// \ref stl_serialize
+/// \brief Saves the stack's elements to a stream.
+bool
+stl_serialize(StackList_t *stack, Serial_t *serial);
+
+/// \ref stl_deserialize
+/// \brief Loads elements saved with stl_serialize() into an empty stack.
+bool
+stl_deserialize(StackList_t *stack, Serial_t *serial);
+
 /////////////////////////////////////////////////////////////////// DISPLAY ///
 
 /// \ref stl_display
@@ -189,6 +202,10 @@ typedef struct StackListIterator_s StackListIterator_t;
 /// A pointer type for a <code> struct StackListIterator_s </code>.
 typedef struct StackListIterator_s *StackListIterator;
 
+/// \ref stl_iter_size
+/// \brief The size of a StackListIterator_s in bytes.
+extern const unsigned_t stl_iter_size;
+
 ///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
 
 /// \ref stl_iter_new
@@ -196,6 +213,11 @@ typedef struct StackListIterator_s *StackListIterator;
 StackListIterator_t *
 stl_iter_new(StackList_t *target);
 
+/// \ref stl_iter_init
+/// \brief Initializes a new iterator allocated on the stack.
+bool
+stl_iter_init(StackListIterator_t *iter, StackList_t *target);
+
 /// \ref stl_iter_retarget
 /// \brief Retargets an existing iterator.
 void
@@ -249,16 +271,20 @@ stl_iter_peek_next(StackListIterator_t *iter);
 void *
 stl_iter_peek(StackListIterator_t *iter);
 
-#define STL_FOR_EACH(target, body)                         \
-    do {                                                   \
-        StackListIterator_t *iter_ = stl_iter_new(target); \
-        while (stl_iter_has_next(iter_)) {                 \
-            void *var = stl_iter_peek(iter_);              \
-            body;                                          \
-            stl_iter_next(iter_);                          \
-        }                                                  \
-        stl_iter_free(iter_);                              \
-    } while (0);                                           \
+#define STL_ITER_DECL(name)                                                 \
+    char name##_storage__[stl_iter_size];                                   \
+    StackListIterator_t *name = (StackListIterator_t*)&name##_storage__[0]; \
+
+#define STL_FOR_EACH(target, body)                \
+    do {                                          \
+        STL_ITER_DECL(iter_)                      \
+        if (stl_iter_init(iter_, target)) {       \
+            do {                                  \
+                void *var = stl_iter_peek(iter_); \
+                body;                             \
+            } while (stl_iter_next(iter_));       \
+        }                                         \
+    } while (0);                                  \
 
 #define STL_DECL(name)                                      \
     char name##_storage__[stl_size];                        \
@@ -0,0 +1,162 @@
+/**
+ * @file TimerWheel.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
+#define C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Amount of bits of a tick used to index the slots of a level.
+#define TMW_LEVEL_BITS 6
+
+/// \brief Amount of slots in each level of a timer wheel.
+#define TMW_SLOTS (1 << TMW_LEVEL_BITS)
+
+/// \brief Amount of levels of a timer wheel.
+///
+/// Timers further than <code> 2^(TMW_LEVEL_BITS * TMW_LEVELS) </code> ticks
+/// in the future wait in the last level until they are close enough.
+#define TMW_LEVELS 8
+
+/// \struct TimerWheel_s
+/// \brief A hierarchical timing wheel.
+struct TimerWheel_s;
+
+/// \brief A type for a timer wheel.
+///
+/// A type for a <code> struct TimerWheel_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct TimerWheel_s TimerWheel_t;
+
+/// \brief A pointer type for a timer wheel.
+///
+/// A pointer type to <code> struct TimerWheel_s </code>. This typedef is used
+/// to avoid having to declare every timer wheel as a pointer type since they
+/// all must be dynamically allocated.
+typedef struct TimerWheel_s *TimerWheel;
+
+/// \struct TimerWheelNode_s
+/// \brief A handle to a timer scheduled in a TimerWheel_s.
+struct TimerWheelNode_s;
+
+/// \brief A type for a timer handle.
+///
+/// A type for a <code> struct TimerWheelNode_s </code> so you don't have to
+/// always write the full name of it.
+typedef struct TimerWheelNode_s TimerWheelNode_t;
+
+/// \brief A pointer type for a timer handle.
+///
+/// A pointer type to <code> struct TimerWheelNode_s </code>.
+typedef struct TimerWheelNode_s *TimerWheelNode;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref tmw_new
+/// \brief Initializes a new TimerWheel_s starting at a given tick.
+TimerWheel_t *
+tmw_new(Interface_t *interface, uint64_t now);
+
+/// \ref tmw_free
+/// \brief Frees from memory a TimerWheel_s and the elements of its timers.
+void
+tmw_free(TimerWheel_t *wheel);
+
+/// \ref tmw_free_shallow
+/// \brief Frees from memory a TimerWheel_s leaving its elements intact.
+void
+tmw_free_shallow(TimerWheel_t *wheel);
+
+/// \ref tmw_erase
+/// \brief Cancels every timer and frees their elements.
+void
+tmw_erase(TimerWheel_t *wheel);
+
+/// \ref tmw_erase_shallow
+/// \brief Cancels every timer leaving their elements intact.
+void
+tmw_erase_shallow(TimerWheel_t *wheel);
+
+//////////////////////////////////////////////////////////// CONFIGURATIONS ///
+
+/// \ref tmw_config
+/// \brief Sets a new interface for the target timer wheel.
+void
+tmw_config(TimerWheel_t *wheel, Interface_t *new_interface);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref tmw_count
+/// \brief Returns the amount of scheduled timers.
+integer_t
+tmw_count(TimerWheel_t *wheel);
+
+/// \ref tmw_now
+/// \brief Returns the current tick of the timer wheel.
+uint64_t
+tmw_now(TimerWheel_t *wheel);
+
+/// \ref tmw_element
+/// \brief Returns the element of the timer referenced by a handle.
+void *
+tmw_element(TimerWheelNode_t *handle);
+
+/// \ref tmw_expires
+/// \brief Returns the tick when the timer referenced by a handle expires.
+uint64_t
+tmw_expires(TimerWheelNode_t *handle);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref tmw_schedule
+/// \brief Schedules an element to expire at a given tick.
+bool
+tmw_schedule(TimerWheel_t *wheel, uint64_t expires, void *element,
+             TimerWheelNode_t **handle);
+
+/// \ref tmw_cancel
+/// \brief Cancels the timer referenced by a handle.
+bool
+tmw_cancel(TimerWheel_t *wheel, TimerWheelNode_t *handle, void **result);
+
+/// \ref tmw_reschedule
+/// \brief Moves the timer referenced by a handle to expire at another tick.
+bool
+tmw_reschedule(TimerWheel_t *wheel, TimerWheelNode_t *handle,
+               uint64_t expires);
+
+/// \ref tmw_advance
+/// \brief Advances the wheel to a given tick, expiring every timer due.
+integer_t
+tmw_advance(TimerWheel_t *wheel, uint64_t now, foreach_f function,
+            void *context);
+
+/////////////////////////////////////////////////////////// STRUCTURE STATE ///
+
+/// \ref tmw_empty
+/// \brief Returns true if there are no scheduled timers.
+bool
+tmw_empty(TimerWheel_t *wheel);
+
+/////////////////////////////////////////////////////////////////// DISPLAY ///
+
+/// \ref tmw_display
+/// \brief Displays in the console every non-empty slot of a timer wheel.
+void
+tmw_display(TimerWheel_t *wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_TIMERWHEEL_H
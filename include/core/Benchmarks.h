@@ -16,8 +16,20 @@ void AssociativeListBench(void);
 
 void AVLTreeBench(void);
 
+void ConcurrentHashMapBench(void);
+
+void ConcurrentStackBench(void);
+
+void DynamicArrayBench(void);
+
 void HeapBench(void);
 
+void LogQueueBench(void);
+
 void RedBlackTreeBench(void);
 
+void ShortestPathBench(void);
+
+void TimerWheelBench(void);
+
 #endif //C_DATASTRUCTURES_LIBRARY_BENCHMARKS_H
@@ -72,12 +72,33 @@ enum Status
     DS_ERR_ITER_STATE             = 13,
 
     /// When a wrapper structure error occurs.
-    DS_ERR_WRAPPER                = 14
+    DS_ERR_WRAPPER                = 14,
+
+    /// When reading from or writing to a stream fails or when a stream has an
+    /// invalid format.
+    DS_ERR_STREAM                 = 15
 };
 
 /// Defines a type to an <code> enum Status </code>
 typedef enum Status Status;
 
+/// \brief How a synchronized wrapper protects its structure.
+///
+/// Used by the thread-safe wrappers of some data structures, like
+/// rbt_sync_new() and avl_sync_new().
+enum SyncMode
+{
+    /// Every operation takes a writer-preferring readers-writer lock.
+    SYNC_RWLOCK = 0,
+
+    /// Readers never block. Writers copy the structure, modify the copy and
+    /// publish it, freeing the old version once no reader can be using it.
+    SYNC_RCU = 1
+};
+
+/// Defines a type to an <code> enum SyncMode </code>
+typedef enum SyncMode SyncMode;
+
 typedef intmax_t integer_t;
 
 typedef uintmax_t unsigned_t;
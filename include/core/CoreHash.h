@@ -0,0 +1,32 @@
+/**
+ * @file CoreHash.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_COREHASH_H
+#define C_DATASTRUCTURES_LIBRARY_COREHASH_H
+
+#include <stdint.h>
+
+/// Mixes the bits of a hash so that every bit of the result depends on every
+/// bit of the input. Hashes given by the user may have poor low or high bits,
+/// like the identity function on integers, while the hash tables of the
+/// library pick a bucket or a slot from only a few of those bits. This is the
+/// 64-bit finalizer of MurmurHash3.
+///
+/// \param[in] hash The hash given by the user.
+///
+/// \return The mixed hash.
+static inline uint64_t
+ds_hash_mix(uint64_t hash)
+{
+    hash = (hash ^ (hash >> 33)) * UINT64_C(0xff51afd7ed558ccd);
+    hash = (hash ^ (hash >> 33)) * UINT64_C(0xc4ceb9fe1a85ec53);
+
+    return hash ^ (hash >> 33);
+}
+
+#endif //C_DATASTRUCTURES_LIBRARY_COREHASH_H
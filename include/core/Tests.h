@@ -26,10 +26,16 @@ Status AVLTreeTests(void);
 
 Status BinarySearchTreeTests(void);
 
+Status BinomialHeapTests(void);
+
 Status BitArrayTests(void);
 
 Status CircularLinkedListTests(void);
 
+Status ConcurrentHashMapTests(void);
+
+Status ConcurrentStackTests(void);
+
 Status DequeArrayTests(void);
 
 Status DequeListTests(void);
@@ -38,24 +44,50 @@ Status DoublyLinkedListTests(void);
 
 Status DynamicArrayTests(void);
 
+Status EpochTests(void);
+
+Status ExternalSortTests(void);
+
+Status FibonacciHeapTests(void);
+
 Status HeapTests(void);
 
+Status IntervalTreeTests(void);
+
+Status LogQueueTests(void);
+
+Status LRUCacheTests(void);
+
+Status MappedArrayTests(void);
+
+Status NodePoolTests(void);
+
+Status PairingHeapTests(void);
+
 Status PriorityListTests(void);
 
 Status QueueArrayTests(void);
 
 Status QueueListTests(void);
 
+Status RadixHeapTests(void);
+
 Status RedBlackTreeTests(void);
 
 Status SinglyLinkedListTests(void);
 
+Status SortedHashMapTests(void);
+
 Status SortedListTests(void);
 
 Status StackArrayTests(void);
 
 Status StackListTests(void);
 
+Status ThreadPoolTests(void);
+
+Status TimerWheelTests(void);
+
 #ifdef __cplusplus
 }
 #endif
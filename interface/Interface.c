@@ -35,6 +35,9 @@ interface_new(compare_f compare, copy_f copy, display_f display, free_f free,
     interface->free = free;
     interface->hash = hash;
     interface->priority = priority;
+    interface->serialize = NULL;
+    interface->deserialize = NULL;
+    interface->size = NULL;
 
     return interface;
 }
@@ -60,6 +63,9 @@ interface_init(Interface_t *interface, compare_f compare, copy_f copy,
     interface->free = free;
     interface->hash = hash;
     interface->priority = priority;
+    interface->serialize = NULL;
+    interface->deserialize = NULL;
+    interface->size = NULL;
 }
 
 /// Changes the configuration of an interface. Any NULL parameters are ignored
@@ -91,6 +97,36 @@ interface_config(Interface_t *interface,
         interface->priority = priority;
 }
 
+/// Sets the functions used to save and load elements of this type with the
+/// *_serialize() and *_deserialize() functions of each structure. Like in
+/// interface_config(), NULL parameters are ignored.
+///
+/// \param interface An interface to be changed.
+/// \param serialize A function that encodes an element.
+/// \param deserialize A function that decodes an element.
+void
+interface_codec(Interface_t *interface, serialize_f serialize,
+                deserialize_f deserialize)
+{
+    if (serialize)
+        interface->serialize = serialize;
+    if (deserialize)
+        interface->deserialize = deserialize;
+}
+
+/// Sets the function that tells how many bytes an element takes. It is used
+/// by structures that can be limited by memory, like LRUCache_s, whose
+/// capacity is then counted in bytes. A NULL parameter is ignored.
+///
+/// \param interface An interface to be changed.
+/// \param size A function that returns the size of an element.
+void
+interface_size(Interface_t *interface, size_f size)
+{
+    if (size)
+        interface->size = size;
+}
+
 /// Frees from memory the specified interface.
 ///
 /// \param interface The interface to be deallocated.
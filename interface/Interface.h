@@ -58,6 +58,65 @@ typedef unsigned_t(*hash_f)(const void *);
 /// - <code>[ 0 ]</code> if elements have the same priority.
 typedef int(*priority_f)(const void *, const void *);
 
+/// \brief A function that visits an element.
+///
+/// A function that is applied to every element of a structure. The first
+/// parameter is the element and the second one is a user defined context.
+/// When used by a parallel function, the context is shared between threads.
+typedef void(*foreach_f)(void *, void *);
+
+/// \brief A function that maps an element to a new one.
+///
+/// A function that returns a new, dynamically allocated, element made from
+/// the first parameter. The second parameter is a user defined context.
+typedef void *(*map_f)(const void *, void *);
+
+/// \brief A function that tests an element.
+///
+/// A function that returns true if the element, given as the first
+/// parameter, matches a condition. The second parameter is a user defined
+/// context.
+typedef bool(*predicate_f)(const void *, void *);
+
+/// \brief A function that folds an element into an accumulator.
+///
+/// A function that updates the accumulator, given as the first parameter,
+/// with the element given as the second parameter. The third parameter is a
+/// user defined context.
+typedef void(*reduce_f)(void *, const void *, void *);
+
+/// \brief A function that combines two accumulators.
+///
+/// Used by parallel reductions to fold the partial result of a chunk, given
+/// as the second parameter, into the accumulator given as the first
+/// parameter. Together with \ref reduce_f it must be associative so that the
+/// final result doesn't depend on how the elements were split. The third
+/// parameter is a user defined context.
+typedef void(*combine_f)(void *, const void *, void *);
+
+/// \brief A function that encodes an element into bytes.
+///
+/// Writes the encoding of the element, given as the first parameter, to the
+/// buffer given as the second parameter, whose size is given as the third
+/// parameter. Returns the size of the encoding. If it is larger than the
+/// buffer nothing has to be written and the function will be called again
+/// with a buffer that is large enough.
+typedef size_t(*serialize_f)(const void *, void *, size_t);
+
+/// \brief A function that decodes an element from bytes.
+///
+/// Returns a new, dynamically allocated, element decoded from the buffer
+/// given as the first parameter, whose size is given as the second
+/// parameter, or NULL if the buffer is not a valid encoding.
+typedef void *(*deserialize_f)(const void *, size_t);
+
+/// \brief A function that returns the size of an element.
+///
+/// Returns how much memory, in bytes, the element given as the parameter
+/// takes, including anything it points to. Used by structures that are
+/// limited by memory instead of by the amount of elements.
+typedef size_t(*size_f)(const void *);
+
 /// \brief An interface used by all data structures that stores functions for a
 /// user defined data type.
 ///
@@ -75,7 +134,18 @@ typedef int(*priority_f)(const void *, const void *);
 /// - hash - Creates a hash number from a single element according to the
 /// specification of \ref hash_f;
 /// - priority - A function that compares the priority of two elements
-/// according to the specification of \ref priority_f.
+/// according to the specification of \ref priority_f;
+/// - serialize - Encodes an element into bytes according to the
+/// specification of \ref serialize_f;
+/// - deserialize - Decodes an element from bytes according to the
+/// specification of \ref deserialize_f;
+/// - size - Returns the size of an element in bytes according to the
+/// specification of \ref size_f.
+///
+/// The element codec, \c serialize and \c deserialize, is only used when
+/// saving and loading structures and is set separately with
+/// interface_codec(). The \c size function is only used by structures with
+/// a memory budget and is set separately with interface_size().
 ///
 /// \par Functions
 /// Located in file Interface.c
@@ -92,6 +162,12 @@ struct Interface_s
     hash_f hash;
 
     priority_f priority;
+
+    serialize_f serialize;
+
+    deserialize_f deserialize;
+
+    size_f size;
 };
 
 typedef struct Interface_s Interface_t;
@@ -118,6 +194,17 @@ interface_config(Interface_t *interface,
                  compare_f compare, copy_f copy, display_f display,
                  free_f free, hash_f hash, priority_f priority);
 
+/// \ref interface_codec
+/// \brief Sets the element codec of an interface.
+void
+interface_codec(Interface_t *interface, serialize_f serialize,
+                deserialize_f deserialize);
+
+/// \ref interface_size
+/// \brief Sets the function that measures the elements of an interface.
+void
+interface_size(Interface_t *interface, size_f size);
+
 /// \ref interface_free
 /// \brief Frees from memory an Interface_s.
 void
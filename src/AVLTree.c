@@ -7,6 +7,9 @@
  */
 
 #include "AVLTree.h"
+#include "Epoch.h"
+#include "Sync.h"
+#include <stdatomic.h>
 
 /// An AVLTree_s is a self-balancing binary search tree where the heights of
 /// two child subtrees of any node differ by at most one. If at any time they
@@ -172,6 +175,9 @@ avl_traversal_postorder(AVLTreeNode_t *root, display_f function);
 static void
 avl_traversal_leaves(AVLTreeNode_t *root, display_f function);
 
+static AVLTreeNode_t *
+avl_build(AVLTreeNode_t **nodes, integer_t first, integer_t last);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a new AVLTree_s with \c size, \c limit, and \c version_id to 0,
@@ -797,6 +803,142 @@ avl_traversal(AVLTree_t *tree, int traversal_mode)
     printf("\n");
 }
 
+/// Saves the tree's keys in ascending order, each one encoded by the
+/// interface's codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] tree The AVL tree to be saved.
+/// \param[in] serial The stream where the tree is written to.
+///
+/// \return True if the tree was saved or false if writing failed.
+bool
+avl_serialize(AVLTree_t *tree, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_AVL_TREE, 0, tree->size))
+        return false;
+
+    AVLTreeNode_t *node = tree->root;
+
+    while (node != NULL && node->left != NULL)
+        node = node->left;
+
+    // In-order traversal using the parent pointers
+    while (node != NULL)
+    {
+        if (!ser_write_element(serial, tree->interface->serialize, node->key))
+            return false;
+
+        if (node->right != NULL)
+        {
+            node = node->right;
+
+            while (node->left != NULL)
+                node = node->left;
+        }
+        else
+        {
+            while (node->parent != NULL && node == node->parent->right)
+                node = node->parent;
+
+            node = node->parent;
+        }
+    }
+
+    return true;
+}
+
+/// Loads keys saved with avl_serialize(). Since they are in order the tree is
+/// built already balanced, with every level complete except possibly the
+/// last one, so no rotation is made. Keys are only compared to check that
+/// they really are in ascending order.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - compare
+/// - free
+///
+/// \param[in] tree An empty AVL tree.
+/// \param[in] serial The stream where the tree is read from.
+///
+/// \return True if all keys were loaded. False if the tree is not empty, if
+/// the keys don't fit in the tree's limit, if they are not in ascending
+/// order, if the stream is not a valid AVLTree_s or if reading failed,
+/// in which case the tree is left empty.
+bool
+avl_deserialize(AVLTree_t *tree, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t size;
+
+    if (!avl_empty(tree))
+        return false;
+
+    if (!ser_read_header(serial, SER_AVL_TREE, &layout, &size))
+        return false;
+
+    if (tree->limit > 0 && size > tree->limit)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    AVLTreeNode_t **nodes = malloc(sizeof(AVLTreeNode_t *) * (size_t)size);
+
+    if (!nodes)
+        return false;
+
+    integer_t loaded = 0;
+    bool valid = true;
+
+    while (valid && loaded < size)
+    {
+        void *key;
+
+        valid = ser_read_element(serial, tree->interface->deserialize, &key)
+                && key != NULL;
+
+        if (!valid)
+            break;
+
+        nodes[loaded] = avl_new_node(key);
+
+        if (!nodes[loaded])
+        {
+            tree->interface->free(key);
+            break;
+        }
+
+        // Keys must be unique and in ascending order
+        if (loaded > 0 &&
+            tree->interface->compare(nodes[loaded - 1]->key, key) >= 0)
+            valid = false;
+
+        loaded++;
+    }
+
+    if (!valid || loaded < size)
+    {
+        for (integer_t i = 0; i < loaded; i++)
+            avl_free_node(nodes[i], tree->interface->free);
+
+        free(nodes);
+
+        return false;
+    }
+
+    tree->root = avl_build(nodes, 0, size - 1);
+    tree->root->parent = NULL;
+
+    tree->size = size;
+    tree->version_id++;
+
+    free(nodes);
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AVLTreeNode_t *
@@ -1275,6 +1417,31 @@ avl_traversal_leaves(AVLTreeNode_t *root, display_f function)
     }
 }
 
+// Links the nodes between first and last, in order, into a balanced subtree
+// and returns its root
+static AVLTreeNode_t *
+avl_build(AVLTreeNode_t **nodes, integer_t first, integer_t last)
+{
+    if (first > last)
+        return NULL;
+
+    integer_t middle = first + (last - first) / 2;
+
+    AVLTreeNode_t *node = nodes[middle];
+
+    node->left = avl_build(nodes, first, middle - 1);
+    node->right = avl_build(nodes, middle + 1, last);
+
+    if (node->left != NULL)
+        node->left->parent = node;
+    if (node->right != NULL)
+        node->right->parent = node;
+
+    node->height = avl_height_update(node);
+
+    return node;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 
@@ -1289,3 +1456,421 @@ avl_traversal_leaves(AVLTreeNode_t *root, display_f function)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// \todo AVLTreeWrapper
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////// Sync ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// In \c SYNC_RWLOCK mode every operation runs on a single tree while holding
+/// a writer-preferring readers-writer lock.
+///
+/// In \c SYNC_RCU mode the published tree is never modified. A writer makes a
+/// copy of its nodes, which still point to the same elements, applies the
+/// change to the copy and publishes it with an atomic pointer swap. Readers
+/// run inside an epoch-based reclamation critical section and read whichever
+/// tree is published, so they never wait for anything. The old nodes, and the
+/// element of a removal, are retired with ebr_retire() and freed once every
+/// reader that could have seen them is gone, so writers don't wait either.
+/// Writes cost <code> O(n) </code> and are serialized, which suits
+/// read-mostly data.
+struct AVLTreeSync_s
+{
+    /// \brief How the tree is protected.
+    SyncMode mode;
+
+    /// \brief The published tree.
+    ///
+    /// Only replaced in \c SYNC_RCU mode.
+    AVLTree_t *_Atomic tree;
+
+    /// \brief Protects the tree in \c SYNC_RWLOCK mode.
+    RWLock_t lock;
+
+    /// \brief Serializes writers in \c SYNC_RCU mode.
+    pthread_mutex_t writer;
+
+    /// \brief The user's interface.
+    struct Interface_s *interface;
+
+    /// \brief The interface of published trees in \c SYNC_RCU mode.
+    ///
+    /// A copy of the user's interface with a free function that does nothing,
+    /// so that removing from a copy does not free an element that older
+    /// versions still reference.
+    struct Interface_s shared_interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+avl_sync_keep(void *element);
+
+static AVLTree_t *
+avl_sync_clone(AVLTreeSync_t *sync, AVLTree_t *tree);
+
+static AVLTreeNode_t *
+avl_sync_clone_node(AVLTreeNode_t *node, AVLTreeNode_t *parent,
+                    bool *success);
+
+static void
+avl_sync_publish(AVLTreeSync_t *sync, AVLTree_t *old_tree,
+                 AVLTree_t *new_tree);
+
+static void
+avl_sync_free_version(void *tree);
+
+static AVLTree_t *
+avl_sync_read_lock(AVLTreeSync_t *sync);
+
+static void
+avl_sync_read_unlock(AVLTreeSync_t *sync);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// \par Interface Requirements
+/// - compare
+/// - copy (for avl_sync_max() and avl_sync_min())
+/// - free
+///
+/// \param interface An interface for the elements of the tree.
+/// \param mode How the wrapper protects the tree.
+///
+/// \return A new AVLTreeSync_s or NULL if allocation failed.
+AVLTreeSync_t *
+avl_sync_new(Interface_t *interface, SyncMode mode)
+{
+    AVLTreeSync_t *sync = malloc(sizeof(AVLTreeSync_t));
+
+    if (!sync)
+        return NULL;
+
+    sync->mode = mode;
+    sync->interface = interface;
+    sync->shared_interface = *interface;
+    sync->shared_interface.free = avl_sync_keep;
+
+    AVLTree_t *tree = avl_new(mode == SYNC_RCU ? &sync->shared_interface
+                                                : interface);
+
+    if (!tree)
+    {
+        free(sync);
+        return NULL;
+    }
+
+    atomic_init(&sync->tree, tree);
+
+    if (!rwl_init(&sync->lock))
+    {
+        avl_free(tree);
+        free(sync);
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&sync->writer, NULL) != 0)
+    {
+        rwl_destroy(&sync->lock);
+        avl_free(tree);
+        free(sync);
+        return NULL;
+    }
+
+    return sync;
+}
+
+/// No other thread may be using the wrapper.
+///
+/// \param sync The wrapper to be freed from memory.
+void
+avl_sync_free(AVLTreeSync_t *sync)
+{
+    AVLTree_t *tree = atomic_load(&sync->tree);
+
+    avl_config(tree, sync->interface);
+    avl_free(tree);
+
+    pthread_mutex_destroy(&sync->writer);
+    rwl_destroy(&sync->lock);
+
+    free(sync);
+}
+
+/// \param sync The target wrapper.
+///
+/// \return The mode the wrapper was created with.
+SyncMode
+avl_sync_mode(AVLTreeSync_t *sync)
+{
+    return sync->mode;
+}
+
+/// \param sync The target wrapper.
+///
+/// \return The amount of elements in the tree.
+integer_t
+avl_sync_size(AVLTreeSync_t *sync)
+{
+    AVLTree_t *tree = avl_sync_read_lock(sync);
+
+    integer_t size = avl_size(tree);
+
+    avl_sync_read_unlock(sync);
+
+    return size;
+}
+
+/// \param sync The target wrapper.
+/// \param element The element to be added. The tree takes its ownership only
+/// if the insertion succeeds.
+///
+/// \return True if the element was added to the tree.
+/// \return False if the element is already present, if the tree is full or if
+/// any allocations failed.
+bool
+avl_sync_insert(AVLTreeSync_t *sync, void *element)
+{
+    if (sync->mode == SYNC_RWLOCK)
+    {
+        rwl_write_lock(&sync->lock);
+
+        bool success = avl_insert(atomic_load(&sync->tree), element);
+
+        rwl_write_unlock(&sync->lock);
+
+        return success;
+    }
+
+    pthread_mutex_lock(&sync->writer);
+
+    AVLTree_t *tree = atomic_load(&sync->tree);
+
+    // Avoid copying the whole tree for nothing
+    if (avl_full(tree) || avl_contains(tree, element))
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    AVLTree_t *copy = avl_sync_clone(sync, tree);
+
+    if (!copy || !avl_insert(copy, element))
+    {
+        if (copy)
+            avl_free_shallow(copy);
+
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    avl_sync_publish(sync, tree, copy);
+
+    pthread_mutex_unlock(&sync->writer);
+
+    return true;
+}
+
+/// \param sync The target wrapper.
+/// \param element The element to be removed has to match this element.
+///
+/// \return True if the element was removed.
+/// \return False if the element was not found or if any allocations failed.
+bool
+avl_sync_remove(AVLTreeSync_t *sync, void *element)
+{
+    if (sync->mode == SYNC_RWLOCK)
+    {
+        rwl_write_lock(&sync->lock);
+
+        bool success = avl_remove(atomic_load(&sync->tree), element);
+
+        rwl_write_unlock(&sync->lock);
+
+        return success;
+    }
+
+    pthread_mutex_lock(&sync->writer);
+
+    AVLTree_t *tree = atomic_load(&sync->tree);
+    AVLTreeNode_t *node = avl_find(tree, element);
+
+    if (!node)
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    // The element itself can only be freed after a grace period
+    void *removed = node->key;
+
+    AVLTree_t *copy = avl_sync_clone(sync, tree);
+
+    if (!copy)
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    avl_remove(copy, element);
+
+    avl_sync_publish(sync, tree, copy);
+
+    ebr_retire_element(sync->interface, removed);
+
+    pthread_mutex_unlock(&sync->writer);
+
+    return true;
+}
+
+/// In \c SYNC_RCU mode this function never blocks.
+///
+/// \param sync The target wrapper.
+/// \param element The element to be searched.
+///
+/// \return True if the element is in the tree.
+bool
+avl_sync_contains(AVLTreeSync_t *sync, void *element)
+{
+    AVLTree_t *tree = avl_sync_read_lock(sync);
+
+    bool found = avl_contains(tree, element);
+
+    avl_sync_read_unlock(sync);
+
+    return found;
+}
+
+/// The element is copied while the tree is protected since another thread
+/// could remove and free it right after. In \c SYNC_RCU mode this function
+/// never blocks.
+///
+/// \param sync The target wrapper.
+///
+/// \return A copy of the maximum element, owned by the caller, or NULL if the
+/// tree is empty.
+void *
+avl_sync_max(AVLTreeSync_t *sync)
+{
+    AVLTree_t *tree = avl_sync_read_lock(sync);
+
+    void *element = avl_max(tree);
+    void *result = element ? sync->interface->copy(element) : NULL;
+
+    avl_sync_read_unlock(sync);
+
+    return result;
+}
+
+/// The element is copied while the tree is protected since another thread
+/// could remove and free it right after. In \c SYNC_RCU mode this function
+/// never blocks.
+///
+/// \param sync The target wrapper.
+///
+/// \return A copy of the minimum element, owned by the caller, or NULL if the
+/// tree is empty.
+void *
+avl_sync_min(AVLTreeSync_t *sync)
+{
+    AVLTree_t *tree = avl_sync_read_lock(sync);
+
+    void *element = avl_min(tree);
+    void *result = element ? sync->interface->copy(element) : NULL;
+
+    avl_sync_read_unlock(sync);
+
+    return result;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+avl_sync_keep(void *element)
+{
+    (void)element;
+}
+
+// Copies the nodes of a tree; the elements are shared
+static AVLTree_t *
+avl_sync_clone(AVLTreeSync_t *sync, AVLTree_t *tree)
+{
+    AVLTree_t *copy = avl_new(&sync->shared_interface);
+
+    if (!copy)
+        return NULL;
+
+    bool success = true;
+
+    copy->root = avl_sync_clone_node(tree->root, NULL, &success);
+    copy->size = tree->size;
+    copy->limit = tree->limit;
+
+    if (!success)
+    {
+        avl_free_shallow(copy);
+        return NULL;
+    }
+
+    return copy;
+}
+
+static AVLTreeNode_t *
+avl_sync_clone_node(AVLTreeNode_t *node, AVLTreeNode_t *parent,
+                    bool *success)
+{
+    if (!node || !*success)
+        return NULL;
+
+    AVLTreeNode_t *copy = malloc(sizeof(AVLTreeNode_t));
+
+    if (!copy)
+    {
+        *success = false;
+        return NULL;
+    }
+
+    *copy = *node;
+
+    copy->parent = parent;
+    copy->left = avl_sync_clone_node(node->left, copy, success);
+    copy->right = avl_sync_clone_node(node->right, copy, success);
+
+    return copy;
+}
+
+// Makes a new version visible and retires the old one
+static void
+avl_sync_publish(AVLTreeSync_t *sync, AVLTree_t *old_tree,
+                 AVLTree_t *new_tree)
+{
+    atomic_store(&sync->tree, new_tree);
+
+    ebr_retire(old_tree, avl_sync_free_version);
+}
+
+static void
+avl_sync_free_version(void *tree)
+{
+    avl_free_shallow(tree);
+}
+
+static AVLTree_t *
+avl_sync_read_lock(AVLTreeSync_t *sync)
+{
+    if (sync->mode == SYNC_RWLOCK)
+        rwl_read_lock(&sync->lock);
+    else
+        ebr_enter();
+
+    return atomic_load(&sync->tree);
+}
+
+static void
+avl_sync_read_unlock(AVLTreeSync_t *sync)
+{
+    if (sync->mode == SYNC_RWLOCK)
+        rwl_read_unlock(&sync->lock);
+    else
+        ebr_leave();
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -93,8 +93,52 @@ static void
 arr_quicksort(Array_t *array, void **buffer, integer_t length,
                           compare_f comparator);
 
+static void
+arr_for_each_range(integer_t from, integer_t to, integer_t chunk,
+                   void *context);
+
+static void
+arr_map_range(integer_t from, integer_t to, integer_t chunk, void *context);
+
+static void
+arr_filter_count_range(integer_t from, integer_t to, integer_t chunk,
+                       void *context);
+
+static void
+arr_filter_copy_range(integer_t from, integer_t to, integer_t chunk,
+                      void *context);
+
+static void
+arr_reduce_range(integer_t from, integer_t to, integer_t chunk, void *context);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
+/// \brief Shared state of a parallel operation.
+///
+/// Implementation detail. Used as the context of tpl_parallel_for() by the
+/// parallel functions. Each chunk only writes to its own positions of
+/// \c result, \c mask, \c offsets and \c partials.
+struct ArrayParallel_s
+{
+    Array_t *array;
+    Array_t *result;
+    foreach_f foreach;
+    map_f map;
+    predicate_f predicate;
+    reduce_f reduce;
+    void *context;
+
+    /// Which elements passed the predicate.
+    bool *mask;
+
+    /// Amount of matches of each chunk and later where each chunk starts.
+    integer_t *offsets;
+
+    /// One accumulator per chunk, each one \c result_size bytes long.
+    char *partials;
+    integer_t result_size;
+};
+
 /// Initializes a new Array_s with a custom interface and a defined length.
 ///
 /// \param[in] interface An interface for the new array.
@@ -109,7 +153,9 @@ arr_new(Interface_t *interface, integer_t length)
     if (!array)
         return NULL;
 
-    array->buffer = malloc(sizeof(void*) * (size_t)length);
+    // A filter with no matches creates an array of length 0, and malloc(0)
+    // is allowed to return NULL, so at least one slot is always allocated
+    array->buffer = malloc(sizeof(void*) * (size_t)(length > 0 ? length : 1));
 
     if (!array->buffer)
     {
@@ -748,6 +794,289 @@ arr_sortby(Array_t *array, compare_f comparator)
     array->version_id++;
 }
 
+/// Calls \c function for every element of the array, from the first to the
+/// last position. Empty positions are skipped. The function may change the
+/// element it receives but it must not change the array itself.
+///
+/// \param[in] array The target array.
+/// \param[in] function Function applied to each element.
+/// \param[in] context User context passed to \c function.
+void
+arr_for_each(Array_t *array, foreach_f function, void *context)
+{
+    for (integer_t i = 0; i < array->length; i++)
+    {
+        if (array->buffer[i] != NULL)
+            function(array->buffer[i], context);
+    }
+}
+
+/// Creates a new array with the same length where each element is the result
+/// of \c function on the element at the same position of the original array.
+/// Empty positions stay empty.
+///
+/// \param[in] array The target array.
+/// \param[in] interface Interface of the resulting array or NULL to use the
+/// same interface of \c array.
+/// \param[in] function Function that creates a new element from an existing
+/// one.
+/// \param[in] context User context passed to \c function.
+///
+/// \return A new Array_s or NULL if allocation failed.
+Array_t *
+arr_map(Array_t *array, Interface_t *interface, map_f function, void *context)
+{
+    Array_t *result = arr_new(interface ? interface : array->interface,
+                              array->length);
+
+    if (!result)
+        return NULL;
+
+    for (integer_t i = 0; i < array->length; i++)
+    {
+        if (array->buffer[i] != NULL)
+            result->buffer[i] = function(array->buffer[i], context);
+    }
+
+    result->count = array->count;
+
+    return result;
+}
+
+/// Creates a new array with a copy of every element that passes the test
+/// given by \c predicate, keeping their relative order. The new array has no
+/// empty positions and its length is the amount of elements that passed. If
+/// no element passed the result is a valid array of length 0, which must
+/// still be freed with arr_free().
+///
+/// \param[in] array The target array.
+/// \param[in] predicate The test applied to each element.
+/// \param[in] context User context passed to \c predicate.
+///
+/// \return A new Array_s or NULL if allocation failed.
+Array_t *
+arr_filter(Array_t *array, predicate_f predicate, void *context)
+{
+    integer_t total = 0;
+
+    bool *mask = malloc(sizeof(bool) * (size_t)(array->length + 1));
+
+    if (!mask)
+        return NULL;
+
+    for (integer_t i = 0; i < array->length; i++)
+    {
+        mask[i] = array->buffer[i] != NULL &&
+                  predicate(array->buffer[i], context);
+
+        if (mask[i])
+            total++;
+    }
+
+    Array_t *result = arr_new(array->interface, total);
+
+    if (result)
+    {
+        for (integer_t i = 0, j = 0; i < array->length; i++)
+        {
+            if (mask[i])
+                result->buffer[j++] = array->interface->copy(array->buffer[i]);
+        }
+
+        result->count = total;
+    }
+
+    free(mask);
+
+    return result;
+}
+
+/// Folds every element of the array, from the first to the last position,
+/// into \c result using \c function. Empty positions are skipped.
+///
+/// \param[in] array The target array.
+/// \param[in,out] result The accumulator, already initialized.
+/// \param[in] function Function that folds an element into the accumulator.
+/// \param[in] context User context passed to \c function.
+void
+arr_reduce(Array_t *array, void *result, reduce_f function, void *context)
+{
+    for (integer_t i = 0; i < array->length; i++)
+    {
+        if (array->buffer[i] != NULL)
+            function(result, array->buffer[i], context);
+    }
+}
+
+/// Parallel version of arr_for_each(). The array is split in chunks that are
+/// processed by the threads of \c pool, so elements are not visited in
+/// order and \c function must be safe to be called concurrently.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] function Function applied to each element.
+/// \param[in] context User context passed to \c function.
+void
+arr_parallel_for_each(Array_t *array, ThreadPool_t *pool, foreach_f function,
+                      void *context)
+{
+    struct ArrayParallel_s state = { .array = array,
+                                     .foreach = function,
+                                     .context = context };
+
+    tpl_parallel_for(pool, 0, array->length, 0, arr_for_each_range, &state);
+}
+
+/// Parallel version of arr_map(). Each element of the result is still placed
+/// at the same position of its original element.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] interface Interface of the resulting array or NULL to use the
+/// same interface of \c array.
+/// \param[in] function Function that creates a new element from an existing
+/// one. It must be safe to be called concurrently.
+/// \param[in] context User context passed to \c function.
+///
+/// \return A new Array_s or NULL if allocation failed.
+Array_t *
+arr_parallel_map(Array_t *array, ThreadPool_t *pool, Interface_t *interface,
+                 map_f function, void *context)
+{
+    Array_t *result = arr_new(interface ? interface : array->interface,
+                              array->length);
+
+    if (!result)
+        return NULL;
+
+    struct ArrayParallel_s state = { .array = array,
+                                     .result = result,
+                                     .map = function,
+                                     .context = context };
+
+    tpl_parallel_for(pool, 0, array->length, 0, arr_map_range, &state);
+
+    result->count = array->count;
+
+    return result;
+}
+
+/// Parallel version of arr_filter(). It works in two passes: first each
+/// chunk tests its elements and counts how many passed, then, knowing where
+/// each chunk starts in the result, all chunks copy their elements. The
+/// relative order of the elements is kept and, as in arr_filter(), the
+/// result has length 0 if no element passed.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] predicate The test applied to each element. It must be safe to
+/// be called concurrently.
+/// \param[in] context User context passed to \c predicate.
+///
+/// \return A new Array_s or NULL if allocation failed.
+Array_t *
+arr_parallel_filter(Array_t *array, ThreadPool_t *pool, predicate_f predicate,
+                    void *context)
+{
+    integer_t chunks = tpl_chunks(pool, 0, array->length, 0);
+
+    bool *mask = malloc(sizeof(bool) * (size_t)(array->length + 1));
+    integer_t *offsets = calloc((size_t)(chunks + 1), sizeof(integer_t));
+
+    if (!mask || !offsets)
+    {
+        free(mask);
+        free(offsets);
+        return NULL;
+    }
+
+    struct ArrayParallel_s state = { .array = array,
+                                     .predicate = predicate,
+                                     .context = context,
+                                     .mask = mask,
+                                     .offsets = offsets };
+
+    tpl_parallel_for(pool, 0, array->length, 0, arr_filter_count_range,
+                     &state);
+
+    // Exclusive prefix sum of how many elements passed in each chunk
+    integer_t total = 0;
+    for (integer_t c = 0; c < chunks; c++)
+    {
+        integer_t count = offsets[c];
+        offsets[c] = total;
+        total += count;
+    }
+
+    Array_t *result = arr_new(array->interface, total);
+
+    if (result)
+    {
+        state.result = result;
+
+        tpl_parallel_for(pool, 0, array->length, 0, arr_filter_copy_range,
+                         &state);
+
+        result->count = total;
+    }
+
+    free(mask);
+    free(offsets);
+
+    return result;
+}
+
+/// Parallel version of arr_reduce(). Each chunk is folded into its own copy
+/// of the initial value of \c result and then all partial results are
+/// combined into \c result, in chunk order, using \c combine. Because of
+/// that the initial value of \c result must be the identity of the
+/// reduction (like 0 for a sum) and both \c function and \c combine must
+/// form an associative operation.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in,out] result The accumulator, initialized with the identity
+/// value.
+/// \param[in] result_size The size in bytes of the accumulator.
+/// \param[in] function Function that folds an element into an accumulator.
+/// \param[in] combine Function that combines two accumulators.
+/// \param[in] context User context passed to \c function and \c combine.
+///
+/// \return True if the reduction was done or false if allocation failed.
+bool
+arr_parallel_reduce(Array_t *array, ThreadPool_t *pool, void *result,
+                    integer_t result_size, reduce_f function,
+                    combine_f combine, void *context)
+{
+    integer_t chunks = tpl_chunks(pool, 0, array->length, 0);
+
+    if (chunks == 0)
+        return true;
+
+    char *partials = malloc((size_t)(result_size * chunks));
+
+    if (!partials)
+        return false;
+
+    for (integer_t c = 0; c < chunks; c++)
+        memcpy(partials + c * result_size, result, (size_t)result_size);
+
+    struct ArrayParallel_s state = { .array = array,
+                                     .reduce = function,
+                                     .context = context,
+                                     .partials = partials,
+                                     .result_size = result_size };
+
+    tpl_parallel_for(pool, 0, array->length, 0, arr_reduce_range, &state);
+
+    for (integer_t c = 0; c < chunks; c++)
+        combine(result, partials + c * result_size, context);
+
+    free(partials);
+
+    return true;
+}
+
 ///
 /// \param[in] array
 /// \param[out] length
@@ -855,6 +1184,79 @@ arr_display(Array_t *array, int display_mode)
     }
 }
 
+/// Saves every slot of the array, including empty ones, so that elements
+/// keep their indexes. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] array The array to be saved.
+/// \param[in] serial The stream where the array is written to.
+///
+/// \return True if the array was saved or false if writing failed.
+bool
+arr_serialize(Array_t *array, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_ARRAY, 0, array->length))
+        return false;
+
+    for (integer_t i = 0; i < array->length; i++)
+    {
+        if (!ser_write_element(serial, array->interface->serialize,
+                               array->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads slots saved with arr_serialize() into the same indexes.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] array An empty array with at least as many slots as the saved
+/// one.
+/// \param[in] serial The stream where the array is read from.
+///
+/// \return True if all slots were loaded. False if the array is not empty or
+/// is too short, if the stream is not a valid Array_s or if reading failed,
+/// in which case the array is left empty.
+bool
+arr_deserialize(Array_t *array, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t length;
+
+    if (!arr_empty(array))
+        return false;
+
+    if (!ser_read_header(serial, SER_ARRAY, &layout, &length))
+        return false;
+
+    if (length > array->length)
+        return false;
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        if (!ser_read_element(serial, array->interface->deserialize,
+                              &array->buffer[i]))
+        {
+            arr_erase(array);
+            array->count = 0;
+            return false;
+        }
+
+        if (array->buffer[i] != NULL)
+            array->count++;
+    }
+
+    array->version_id++;
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static void
@@ -887,6 +1289,87 @@ arr_quicksort(Array_t *array, void **buffer, integer_t length,
     arr_quicksort(array, buffer + i, length - i, comparator);
 }
 
+static void
+arr_for_each_range(integer_t from, integer_t to, integer_t chunk,
+                   void *context)
+{
+    struct ArrayParallel_s *state = context;
+
+    (void)chunk;
+
+    for (integer_t i = from; i < to; i++)
+    {
+        if (state->array->buffer[i] != NULL)
+            state->foreach(state->array->buffer[i], state->context);
+    }
+}
+
+static void
+arr_map_range(integer_t from, integer_t to, integer_t chunk, void *context)
+{
+    struct ArrayParallel_s *state = context;
+
+    (void)chunk;
+
+    for (integer_t i = from; i < to; i++)
+    {
+        if (state->array->buffer[i] != NULL)
+            state->result->buffer[i] = state->map(state->array->buffer[i],
+                                                  state->context);
+    }
+}
+
+static void
+arr_filter_count_range(integer_t from, integer_t to, integer_t chunk,
+                       void *context)
+{
+    struct ArrayParallel_s *state = context;
+
+    integer_t count = 0;
+
+    for (integer_t i = from; i < to; i++)
+    {
+        state->mask[i] = state->array->buffer[i] != NULL &&
+                         state->predicate(state->array->buffer[i],
+                                          state->context);
+
+        if (state->mask[i])
+            count++;
+    }
+
+    state->offsets[chunk] = count;
+}
+
+static void
+arr_filter_copy_range(integer_t from, integer_t to, integer_t chunk,
+                      void *context)
+{
+    struct ArrayParallel_s *state = context;
+
+    integer_t j = state->offsets[chunk];
+
+    for (integer_t i = from; i < to; i++)
+    {
+        if (state->mask[i])
+            state->result->buffer[j++] =
+                    state->array->interface->copy(state->array->buffer[i]);
+    }
+}
+
+static void
+arr_reduce_range(integer_t from, integer_t to, integer_t chunk, void *context)
+{
+    struct ArrayParallel_s *state = context;
+
+    void *partial = state->partials + chunk * state->result_size;
+
+    for (integer_t i = from; i < to; i++)
+    {
+        if (state->array->buffer[i] != NULL)
+            state->reduce(partial, state->array->buffer[i], state->context);
+    }
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -915,6 +1398,10 @@ struct ArrayIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t arr_iter_size = sizeof(ArrayIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool
@@ -941,6 +1428,24 @@ arr_iter_new(Array_t *target)
     return iter;
 }
 
+///
+/// \param[in,out] iter
+/// \param[in] target
+///
+/// \return
+bool
+arr_iter_init(ArrayIterator_t *iter, Array_t *target)
+{
+    if (arr_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
 ///
 /// \param[in] iter
 /// \param[in] target
@@ -7,6 +7,10 @@
  */
 
 #include "AssociativeList.h"
+#include "CoreHash.h"
+
+/// \brief Amount of pairs an indexed list needs before its index is built.
+#define ALI_INDEX_THRESHOLD 16
 
 /// The associative list is a singly-linked list with keys that are mapped to a
 /// single value or possibly more. Each node contains both the key and the
@@ -34,6 +38,33 @@ struct AssociativeList_s
     /// with an already existing key.
     bool duplicate_keys;
 
+    /// \brief A flag if the key index is enabled.
+    ///
+    /// If set to true then a hash table of the list's nodes is built as soon
+    /// as the list has \c ALI_INDEX_THRESHOLD pairs, making key lookups
+    /// constant time in the average case. It can only be set if the key
+    /// interface has a hash function.
+    bool indexed;
+
+    /// \brief The key index buckets.
+    ///
+    /// Each bucket chains the nodes whose keys fall into it, in the same order
+    /// they are in the list, so the first match in a bucket is also the first
+    /// match in the list. It is \c NULL while the index is not built.
+    struct AssociativeListNode_s **buckets;
+
+    /// \brief The last node of each key index bucket.
+    ///
+    /// Shares the allocation of \c buckets, right after it, so new nodes can
+    /// go to the end of their bucket without walking it. Many equal keys
+    /// would otherwise make every append cost as much as the keys before it.
+    struct AssociativeListNode_s **tails;
+
+    /// \brief Amount of buckets in the key index.
+    ///
+    /// Always a power of two and never smaller than the list's length.
+    integer_t capacity;
+
     /// \brief Points to the first Node on the list.
     ///
     /// Points to the first Node on the list or \c NULL if the list is empty.
@@ -71,9 +102,9 @@ struct AssociativeList_s
 
 /// \brief An AssociativeList_s node.
 ///
-/// Implementation detail. This is a singly-linked node. It has one key member,
-/// one value member and one pointer to the next node or \c NULL if it is the
-/// tail node.
+/// Implementation detail. This is a doubly-linked node. It has one key member,
+/// one value member and pointers to its neighbours. Indexed lists also chain
+/// it in a bucket of the key index.
 struct AssociativeListNode_s
 {
     /// \brief This node's key.
@@ -90,6 +121,22 @@ struct AssociativeListNode_s
     ///
     /// Next node on the list or NULL if this is the last element.
     struct AssociativeListNode_s *next;
+
+    /// \brief Previous node on the list.
+    ///
+    /// Previous node on the list or NULL if this is the first element.
+    struct AssociativeListNode_s *prev;
+
+    /// \brief Next node on the same key index bucket.
+    ///
+    /// Only valid while the key index is built.
+    struct AssociativeListNode_s *chain;
+
+    /// \brief The mixed hash of the key.
+    ///
+    /// Only valid while the key index is built. It is kept so the index can
+    /// grow without calling the hash function again.
+    unsigned_t hash;
 };
 
 typedef struct AssociativeListNode_s AssociativeListNode_t;
@@ -109,7 +156,22 @@ static void
 ali_free_node_shallow(AssociativeListNode_t *node);
 
 static AssociativeListNode_t *
-ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key);
+ali_find(AssociativeList_t *list, void *key);
+
+static void
+ali_link(AssociativeList_t *list, AssociativeListNode_t *node);
+
+static void
+ali_unlink(AssociativeList_t *list, AssociativeListNode_t *node);
+
+static unsigned_t
+ali_hash(AssociativeList_t *list, void *key);
+
+static void
+ali_index_build(AssociativeList_t *list, integer_t capacity, bool rehash);
+
+static void
+ali_index_drop(AssociativeList_t *list);
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
@@ -135,6 +197,11 @@ ali_new(Interface_t *key_interface, Interface_t *value_interface,
     list->version_id = 0;
     list->duplicate_keys = duplicate_keys;
 
+    list->indexed = false;
+    list->buckets = NULL;
+    list->tails = NULL;
+    list->capacity = 0;
+
     list->head = NULL;
     list->tail = NULL;
 
@@ -160,6 +227,8 @@ ali_free(AssociativeList_t *list)
         prev = list->head;
     }
 
+    ali_index_drop(list);
+
     free(list);
 }
 
@@ -179,6 +248,8 @@ ali_free_shallow(AssociativeList_t *list)
         prev = list->head;
     }
 
+    ali_index_drop(list);
+
     free(list);
 }
 
@@ -198,7 +269,10 @@ ali_erase(AssociativeList_t *list)
         prev = list->head;
     }
 
+    ali_index_drop(list);
+
     list->head = NULL;
+    list->tail = NULL;
     list->length = 0;
     list->version_id++;
 }
@@ -219,7 +293,10 @@ ali_erase_shallow(AssociativeList_t *list)
         prev = list->head;
     }
 
+    ali_index_drop(list);
+
     list->head = NULL;
+    list->tail = NULL;
     list->length = 0;
     list->version_id++;
 }
@@ -233,8 +310,18 @@ ali_config(AssociativeList_t *list, Interface_t *key_interface,
            Interface_t *value_interface)
 {
     if (key_interface)
+    {
         list->K_interface = key_interface;
 
+        // The stored hashes came from the previous interface
+        ali_index_drop(list);
+
+        if (!key_interface->hash)
+            list->indexed = false;
+        else if (list->indexed && list->length >= ALI_INDEX_THRESHOLD)
+            ali_index_build(list, list->length, true);
+    }
+
     if (value_interface)
         list->V_interface = value_interface;
 }
@@ -269,6 +356,18 @@ ali_duplicate_keys(AssociativeList_t *list)
     return list->duplicate_keys;
 }
 
+/// Returns true if the key index is enabled. The index itself is only built
+/// once the list has enough pairs.
+///
+/// \param[in] list The associative list.
+///
+/// \return True if the key index is enabled.
+bool
+ali_indexed(AssociativeList_t *list)
+{
+    return list->indexed;
+}
+
 ///
 /// \param[in] list
 /// \param[in] key
@@ -277,8 +376,7 @@ ali_duplicate_keys(AssociativeList_t *list)
 void *
 ali_get(AssociativeList_t *list, void *key)
 {
-    AssociativeListNode_t *_;
-    AssociativeListNode_t *node = ali_find(list, &_, key);
+    AssociativeListNode_t *node = ali_find(list, key);
 
     if (node == NULL)
         return NULL;
@@ -303,6 +401,37 @@ ali_set_limit(AssociativeList_t *list, integer_t limit)
     return true;
 }
 
+/// Enables or disables the key index. Once enabled, a hash table of the
+/// list's nodes is built when the list reaches a certain length and from then
+/// on ali_get(), ali_contains_key(), ali_remove() and ali_pop() take constant
+/// time in the average case. The list order and the handling of duplicate
+/// keys are the same with or without it. The key interface's hash function
+/// must be consistent with its compare function. If the index can't be
+/// allocated the list keeps working without it.
+///
+/// \par Interface Requirements
+/// - K_interface: hash
+///
+/// \param[in] list The associative list.
+/// \param[in] enabled True to enable the index or false to drop it.
+///
+/// \return False if the key interface has no hash function, otherwise true.
+bool
+ali_set_indexed(AssociativeList_t *list, bool enabled)
+{
+    if (enabled && !list->K_interface->hash)
+        return false;
+
+    list->indexed = enabled;
+
+    if (!enabled)
+        ali_index_drop(list);
+    else if (!list->buckets && list->length >= ALI_INDEX_THRESHOLD)
+        ali_index_build(list, list->length, true);
+
+    return true;
+}
+
 ///
 /// \param[in] list
 /// \param[in] key
@@ -327,18 +456,8 @@ ali_insert(AssociativeList_t *list, void *key, void *value)
     if (!node)
         return false;
 
-    if (ali_empty(list))
-    {
-        list->head = node;
-        list->tail = node;
-    }
-    else
-    {
-        list->tail->next = node;
-        list->tail = node;
-    }
+    ali_link(list, node);
 
-    list->length++;
     list->version_id++;
 
     return true;
@@ -358,29 +477,19 @@ ali_remove(AssociativeList_t *list, void *key, void **value)
     if (ali_empty(list))
         return false;
 
-    AssociativeListNode_t *before;
-    AssociativeListNode_t *node = ali_find(list, &before, key);
+    AssociativeListNode_t *node = ali_find(list, key);
 
     // Not found
     if (node == NULL)
         return false;
 
-    if (before == NULL)
-    {
-        // Removing head
-        list->head = list->head->next;
-    }
-    else
-    {
-        before->next = node->next;
-    }
+    ali_unlink(list, node);
 
     *value = node->value;
 
     list->K_interface->free(node->key);
     free(node);
 
-    list->length--;
     list->version_id++;
 
     return true;
@@ -394,26 +503,16 @@ ali_remove(AssociativeList_t *list, void *key, void **value)
 bool
 ali_pop(AssociativeList_t *list, void *key)
 {
-    AssociativeListNode_t *before;
-    AssociativeListNode_t *node = ali_find(list, &before, key);
+    AssociativeListNode_t *node = ali_find(list, key);
 
     // Not found
     if (node == NULL)
         return false;
 
-    if (before == NULL)
-    {
-        // Removing head
-        list->head = list->head->next;
-    }
-    else
-    {
-        before->next = node->next;
-    }
+    ali_unlink(list, node);
 
     ali_free_node(node, list->K_interface->free, list->V_interface->free);
 
-    list->length--;
     list->version_id++;
 
     return true;
@@ -447,17 +546,7 @@ ali_empty(AssociativeList_t *list)
 bool
 ali_contains_key(AssociativeList_t *list, void *key)
 {
-    AssociativeListNode_t *scan = list->head;
-
-    while (scan != NULL)
-    {
-        if (list->K_interface->compare(key, scan->key) == 0)
-            return true;
-
-        scan = scan->next;
-    }
-
-    return false;
+    return ali_find(list, key) != NULL;
 }
 
 ///
@@ -481,17 +570,54 @@ ali_contains_value(AssociativeList_t *list, void *value)
     return false;
 }
 
+/// Creates two arrays of ali_length() elements, one with copies of the keys
+/// and the other with copies of the values, both in the list order. The
+/// caller owns the arrays and their elements.
 ///
-/// \param[in] list
-/// \param[out] K_array
-/// \param[out] V_array
+/// \par Interface Requirements
+/// - K_interface: copy
+/// - V_interface: copy
 ///
-/// \return
+/// \param[in] list The associative list.
+/// \param[out] K_array The resulting array of keys.
+/// \param[out] V_array The resulting array of values.
+///
+/// \return False if the list is empty or if allocation failed, in which case
+/// both arrays are \c NULL.
 bool
 ali_to_arrays(AssociativeList_t *list, void ***K_array, void ***V_array)
 {
-    /// \todo ali_to_arrays
-    return  false;
+    *K_array = NULL;
+    *V_array = NULL;
+
+    if (ali_empty(list))
+        return false;
+
+    void **keys = malloc(sizeof(void *) * (size_t)list->length);
+    void **values = malloc(sizeof(void *) * (size_t)list->length);
+
+    if (!keys || !values)
+    {
+        free(keys);
+        free(values);
+
+        return false;
+    }
+
+    integer_t i = 0;
+
+    for (AssociativeListNode_t *scan = list->head; scan; scan = scan->next)
+    {
+        keys[i] = list->K_interface->copy(scan->key);
+        values[i] = list->V_interface->copy(scan->value);
+
+        i++;
+    }
+
+    *K_array = keys;
+    *V_array = values;
+
+    return true;
 }
 
 ///
@@ -538,6 +664,110 @@ ali_display(AssociativeList_t *list)
     }
 }
 
+/// Saves the list's pairs in order, each key followed by its value. Keys are
+/// encoded by the key interface's codec and values by the value interface's
+/// codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - K_interface: serialize
+/// - V_interface: serialize
+///
+/// \param[in] list The associative list to be saved.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return True if the list was saved or false if writing failed.
+bool
+ali_serialize(AssociativeList_t *list, Serial_t *serial)
+{
+    uint32_t layout = list->duplicate_keys ? 1 : 0;
+
+    if (!ser_write_header(serial, SER_ASSOCIATIVE_LIST, layout, list->length))
+        return false;
+
+    for (AssociativeListNode_t *scan = list->head; scan; scan = scan->next)
+    {
+        if (!ser_write_element(serial, list->K_interface->serialize,
+                               scan->key))
+            return false;
+
+        if (!ser_write_element(serial, list->V_interface->serialize,
+                               scan->value))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads pairs saved with ali_serialize(), keeping their order. Keys are only
+/// searched for duplicates if the saved list allowed them and this one
+/// doesn't.
+///
+/// \par Interface Requirements
+/// - K_interface: deserialize, free
+/// - V_interface: deserialize, free
+/// - K_interface: compare (only if duplicates need to be checked)
+///
+/// \param[in] list An empty associative list.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return True if all pairs were loaded. False if the list is not empty, if
+/// the pairs don't fit in the list's limit, if a key is duplicated, if the
+/// stream is not a valid AssociativeList_s or if reading failed, in which
+/// case the list is left empty.
+bool
+ali_deserialize(AssociativeList_t *list, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t length;
+
+    if (!ali_empty(list))
+        return false;
+
+    if (!ser_read_header(serial, SER_ASSOCIATIVE_LIST, &layout, &length))
+        return false;
+
+    if (list->limit > 0 && length > list->limit)
+        return false;
+
+    bool check_keys = layout == 1 && !list->duplicate_keys;
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        void *key, *value;
+
+        if (!ser_read_element(serial, list->K_interface->deserialize, &key))
+            goto error;
+
+        if (!ser_read_element(serial, list->V_interface->deserialize, &value))
+        {
+            list->K_interface->free(key);
+            goto error;
+        }
+
+        AssociativeListNode_t *node = NULL;
+
+        if (!check_keys || !ali_contains_key(list, key))
+            node = ali_new_node(key, value);
+
+        if (!node)
+        {
+            list->K_interface->free(key);
+            list->V_interface->free(value);
+            goto error;
+        }
+
+        ali_link(list, node);
+    }
+
+    list->version_id++;
+
+    return true;
+
+    error:
+    ali_erase(list);
+    return false;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static AssociativeListNode_t *
@@ -551,6 +781,9 @@ ali_new_node(void *key, void *value)
     node->key = key;
     node->value = value;
     node->next = NULL;
+    node->prev = NULL;
+    node->chain = NULL;
+    node->hash = 0;
 
     return node;
 }
@@ -571,31 +804,460 @@ ali_free_node_shallow(AssociativeListNode_t *node)
     free(node);
 }
 
+// Returns the first node with the given key in the list order
 static AssociativeListNode_t *
-ali_find(AssociativeList_t *list, AssociativeListNode_t **before, void *key)
+ali_find(AssociativeList_t *list, void *key)
 {
+    if (list->buckets)
+    {
+        unsigned_t hash = ali_hash(list, key);
+
+        AssociativeListNode_t *scan =
+                list->buckets[hash & (unsigned_t)(list->capacity - 1)];
+
+        while (scan != NULL)
+        {
+            if (scan->hash == hash &&
+                list->K_interface->compare(key, scan->key) == 0)
+                return scan;
+
+            scan = scan->chain;
+        }
+
+        return NULL;
+    }
+
     AssociativeListNode_t *scan = list->head;
-    *before = NULL;
 
     while (scan != NULL)
     {
         if (list->K_interface->compare(key, scan->key) == 0)
             break;
 
-        *before = scan;
         scan = scan->next;
     }
 
     return scan;
 }
 
+// Appends a node to the list and to the key index, building or growing the
+// index if needed
+static void
+ali_link(AssociativeList_t *list, AssociativeListNode_t *node)
+{
+    node->next = NULL;
+    node->prev = list->tail;
+
+    if (list->tail == NULL)
+        list->head = node;
+    else
+        list->tail->next = node;
+
+    list->tail = node;
+    list->length++;
+
+    if (!list->indexed)
+        return;
+
+    if (!list->buckets)
+    {
+        if (list->length >= ALI_INDEX_THRESHOLD)
+            ali_index_build(list, list->length, true);
+
+        return;
+    }
+
+    if (list->length > list->capacity)
+    {
+        node->hash = ali_hash(list, node->key);
+
+        ali_index_build(list, list->capacity * 2, false);
+
+        return;
+    }
+
+    node->hash = ali_hash(list, node->key);
+    node->chain = NULL;
+
+    // Equal keys must stay in the list order so it goes last
+    unsigned_t i = node->hash & (unsigned_t)(list->capacity - 1);
+
+    if (list->tails[i] == NULL)
+        list->buckets[i] = node;
+    else
+        list->tails[i]->chain = node;
+
+    list->tails[i] = node;
+}
+
+// Takes a node out of the list and out of the key index
+static void
+ali_unlink(AssociativeList_t *list, AssociativeListNode_t *node)
+{
+    if (node->prev == NULL)
+        list->head = node->next;
+    else
+        node->prev->next = node->next;
+
+    if (node->next == NULL)
+        list->tail = node->prev;
+    else
+        node->next->prev = node->prev;
+
+    list->length--;
+
+    if (!list->buckets)
+        return;
+
+    unsigned_t i = node->hash & (unsigned_t)(list->capacity - 1);
+
+    AssociativeListNode_t *before = NULL;
+    AssociativeListNode_t *scan = list->buckets[i];
+
+    while (scan != node)
+    {
+        before = scan;
+        scan = scan->chain;
+    }
+
+    if (before == NULL)
+        list->buckets[i] = node->chain;
+    else
+        before->chain = node->chain;
+
+    if (list->tails[i] == node)
+        list->tails[i] = before;
+}
+
+static unsigned_t
+ali_hash(AssociativeList_t *list, void *key)
+{
+    return ds_hash_mix((uint64_t)list->K_interface->hash(key));
+}
+
+// Builds the key index with at least the given amount of buckets. If rehash
+// is false the nodes already have their hashes. The list is walked backwards
+// and every node is pushed to the front of its bucket so each bucket ends up
+// in the list order, and the first node pushed to a bucket is its tail. If the
+// buckets can't be allocated the list goes on without an index.
+static void
+ali_index_build(AssociativeList_t *list, integer_t capacity, bool rehash)
+{
+    integer_t size = ALI_INDEX_THRESHOLD;
+
+    while (size < capacity)
+        size *= 2;
+
+    ali_index_drop(list);
+
+    list->buckets = calloc((size_t)size * 2, sizeof(AssociativeListNode_t *));
+
+    if (!list->buckets)
+        return;
+
+    list->tails = list->buckets + size;
+    list->capacity = size;
+
+    for (AssociativeListNode_t *scan = list->tail; scan; scan = scan->prev)
+    {
+        if (rehash)
+            scan->hash = ali_hash(list, scan->key);
+
+        unsigned_t i = scan->hash & (unsigned_t)(size - 1);
+
+        if (list->buckets[i] == NULL)
+            list->tails[i] = scan;
+
+        scan->chain = list->buckets[i];
+        list->buckets[i] = scan;
+    }
+}
+
+static void
+ali_index_drop(AssociativeList_t *list)
+{
+    free(list->buckets);
+
+    list->buckets = NULL;
+    list->tails = NULL;
+    list->capacity = 0;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo AssociativeListIterator
+/// This iterator visits the key-value pairs from the head to the tail of the
+/// list and back. Its cursor is represented by a pointer to one of the list's
+/// nodes. Only values can be set through it since changing a key would
+/// invalidate the hash index.
+struct AssociativeListIterator_s
+{
+    /// \brief Target AssociativeList_s.
+    ///
+    /// Target AssociativeList_s. The iterator might need to use some
+    /// information provided by the list or change some of its data members.
+    struct AssociativeList_s *target;
+
+    /// \brief Current key-value pair.
+    ///
+    /// Points to the current node. The iterator is always initialized with the
+    /// cursor pointing to the head of the list.
+    struct AssociativeListNode_s *cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure. This is kept to prevent iteration on the target structure
+    /// that may have been modified and thus causing undefined behaviours or
+    /// run-time crashes.
+    integer_t target_id;
+};
+
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t ali_iter_size = sizeof(AssociativeListIterator_t);
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+ali_iter_target_modified(AssociativeListIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Allocates a new iterator positioned at the head of the target list.
+///
+/// \param[in] target The associative list to be iterated.
+///
+/// \return NULL if the list is empty or if the allocation failed, otherwise a
+/// new iterator.
+AssociativeListIterator_t *
+ali_iter_new(AssociativeList_t *target)
+{
+    if (ali_empty(target))
+        return NULL;
+
+    AssociativeListIterator_t *iter =
+        malloc(sizeof(AssociativeListIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    ali_iter_init(iter, target);
+
+    return iter;
+}
+
+/// Initializes an iterator allocated by the user, usually on the stack with
+/// \c ali_iter_size, positioned at the head of the target list.
+///
+/// \param[in,out] iter The iterator to be initialized.
+/// \param[in] target The associative list to be iterated.
+///
+/// \return False if the list is empty, otherwise true.
+bool
+ali_iter_init(AssociativeListIterator_t *iter, AssociativeList_t *target)
+{
+    if (ali_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->head;
+
+    return true;
+}
+
+/// Changes the target of an iterator and moves its cursor to the head.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new associative list to be iterated.
+void
+ali_iter_retarget(AssociativeListIterator_t *iter, AssociativeList_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->head;
+}
+
+/// Frees from memory an iterator created with ali_iter_new().
+///
+/// \param[in] iter The iterator to be freed.
+void
+ali_iter_free(AssociativeListIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor one pair towards the tail.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified or if the cursor is at the tail,
+/// otherwise true.
+bool
+ali_iter_next(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    if (!ali_iter_has_next(iter))
+        return false;
+
+    iter->cursor = iter->cursor->next;
+
+    return true;
+}
+
+/// Moves the cursor one pair towards the head.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified or if the cursor is at the head,
+/// otherwise true.
+bool
+ali_iter_prev(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    if (!ali_iter_has_prev(iter))
+        return false;
+
+    iter->cursor = iter->cursor->prev;
+
+    return true;
+}
+
+/// Moves the cursor to the head of the list.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+ali_iter_to_head(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->head;
+
+    return true;
+}
+
+/// Moves the cursor to the tail of the list.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+ali_iter_to_tail(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->tail;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is a pair after the cursor, otherwise false.
+bool
+ali_iter_has_next(AssociativeListIterator_t *iter)
+{
+    return iter->cursor->next != NULL;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is a pair before the cursor, otherwise false.
+bool
+ali_iter_has_prev(AssociativeListIterator_t *iter)
+{
+    return iter->cursor->prev != NULL;
+}
+
+/// Retrieves the key-value pair pointed by the cursor. Either output can be
+/// NULL if it is not needed.
+///
+/// \param[in] iter The iterator.
+/// \param[out] key The current key.
+/// \param[out] value The current value.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+ali_iter_get(AssociativeListIterator_t *iter, void **key, void **value)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    if (key)
+        *key = iter->cursor->key;
+
+    if (value)
+        *value = iter->cursor->value;
+
+    return true;
+}
+
+/// Replaces the value pointed by the cursor, freeing the old one.
+/// \par Interface Requirements
+/// - V_interface: free
+///
+/// \param[in] iter The iterator.
+/// \param[in] value The new value.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+ali_iter_set_value(AssociativeListIterator_t *iter, void *value)
+{
+    if (ali_iter_target_modified(iter))
+        return false;
+
+    iter->target->V_interface->free(iter->cursor->value);
+
+    iter->cursor->value = value;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the list was modified, otherwise the current key.
+void *
+ali_iter_peek_key(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return NULL;
+
+    return iter->cursor->key;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the list was modified, otherwise the current value.
+void *
+ali_iter_peek_value(AssociativeListIterator_t *iter)
+{
+    if (ali_iter_target_modified(iter))
+        return NULL;
+
+    return iter->cursor->value;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+ali_iter_target_modified(AssociativeListIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -161,6 +161,9 @@ static void
 bst_traversal_leaves(BinarySearchTreeNode_t *root, display_f function);
 
 
+static BinarySearchTreeNode_t *
+bst_build(BinarySearchTreeNode_t **nodes, integer_t first, integer_t last);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///
@@ -660,6 +663,143 @@ bst_traversal(BinarySearchTree_t *tree, int traversal_mode)
     printf("\n");
 }
 
+/// Saves the tree's keys in ascending order, each one encoded by the
+/// interface's codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] tree The binary search tree to be saved.
+/// \param[in] serial The stream where the tree is written to.
+///
+/// \return True if the tree was saved or false if writing failed.
+bool
+bst_serialize(BinarySearchTree_t *tree, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_BINARY_SEARCH_TREE, 0, tree->count))
+        return false;
+
+    BinarySearchTreeNode_t *node = tree->root;
+
+    while (node != NULL && node->left != NULL)
+        node = node->left;
+
+    // In-order traversal using the parent pointers
+    while (node != NULL)
+    {
+        if (!ser_write_element(serial, tree->interface->serialize, node->key))
+            return false;
+
+        if (node->right != NULL)
+        {
+            node = node->right;
+
+            while (node->left != NULL)
+                node = node->left;
+        }
+        else
+        {
+            while (node->parent != NULL && node == node->parent->right)
+                node = node->parent;
+
+            node = node->parent;
+        }
+    }
+
+    return true;
+}
+
+/// Loads keys saved with bst_serialize(). Since they are in order the tree is
+/// built with the smallest possible height, regardless of the shape it had
+/// when it was saved. Keys are only compared to check that they really are in
+/// ascending order.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - compare
+/// - free
+///
+/// \param[in] tree An empty binary search tree.
+/// \param[in] serial The stream where the tree is read from.
+///
+/// \return True if all keys were loaded. False if the tree is not empty, if
+/// the keys don't fit in the tree's limit, if they are not in ascending
+/// order, if the stream is not a valid BinarySearchTree_s or if reading failed,
+/// in which case the tree is left empty.
+bool
+bst_deserialize(BinarySearchTree_t *tree, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t size;
+
+    if (!bst_empty(tree))
+        return false;
+
+    if (!ser_read_header(serial, SER_BINARY_SEARCH_TREE, &layout, &size))
+        return false;
+
+    if (tree->limit > 0 && size > tree->limit)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    BinarySearchTreeNode_t **nodes = malloc(sizeof(BinarySearchTreeNode_t *) *
+                                            (size_t)size);
+
+    if (!nodes)
+        return false;
+
+    integer_t loaded = 0;
+    bool valid = true;
+
+    while (valid && loaded < size)
+    {
+        void *key;
+
+        valid = ser_read_element(serial, tree->interface->deserialize, &key)
+                && key != NULL;
+
+        if (!valid)
+            break;
+
+        nodes[loaded] = bst_new_node(key);
+
+        if (!nodes[loaded])
+        {
+            tree->interface->free(key);
+            break;
+        }
+
+        // Keys must be unique and in ascending order
+        if (loaded > 0 &&
+            tree->interface->compare(nodes[loaded - 1]->key, key) >= 0)
+            valid = false;
+
+        loaded++;
+    }
+
+    if (!valid || loaded < size)
+    {
+        for (integer_t i = 0; i < loaded; i++)
+            bst_free_node(nodes[i], tree->interface->free);
+
+        free(nodes);
+
+        return false;
+    }
+
+    tree->root = bst_build(nodes, 0, size - 1);
+    tree->root->parent = NULL;
+
+    tree->count = size;
+    tree->version_id++;
+
+    free(nodes);
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static BinarySearchTreeNode_t *
@@ -1003,6 +1143,29 @@ bst_traversal_leaves(BinarySearchTreeNode_t *root, display_f function)
     }
 }
 
+// Links the nodes between first and last, in order, into a balanced subtree
+// and returns its root
+static BinarySearchTreeNode_t *
+bst_build(BinarySearchTreeNode_t **nodes, integer_t first, integer_t last)
+{
+    if (first > last)
+        return NULL;
+
+    integer_t middle = first + (last - first) / 2;
+
+    BinarySearchTreeNode_t *node = nodes[middle];
+
+    node->left = bst_build(nodes, first, middle - 1);
+    node->right = bst_build(nodes, middle + 1, last);
+
+    if (node->left != NULL)
+        node->left->parent = node;
+    if (node->right != NULL)
+        node->right->parent = node;
+
+    return node;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 
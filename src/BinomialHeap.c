@@ -0,0 +1,680 @@
+/**
+ * @file BinomialHeap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "BinomialHeap.h"
+#include "NodePool.h"
+
+/// A binomial heap is a list of binomial trees with distinct degrees, sorted
+/// from the lowest to the highest degree. A binomial tree of degree \c k has
+/// <code> 2^k </code> nodes and is made of two trees of degree
+/// <code> k - 1 </code> where one is the leftmost child of the other's root.
+/// Like the bits of \c count, there are at most <code> log n </code> trees.
+///
+/// Two heaps are melded like two binary numbers are added: their root lists
+/// are merged by degree and trees of the same degree are linked, carrying to
+/// the next degree. Inserting an element melds a single node tree and
+/// removing the root melds its children back, so both take
+/// <code> O(log n) </code> time.
+///
+/// When an element gains priority it is swapped with its parent until the
+/// heap is fixed. So that handles stay valid, a handle is a
+/// BinomialHeapNode_s that holds the element and the tree node it currently
+/// occupies; the tree nodes swap handles instead of elements.
+///
+/// Handles and tree nodes come from two NodePool_s so inserting and removing
+/// elements rarely calls malloc() or free().
+///
+/// Just like Heap_s, the interface's \c compare function is used and its
+/// result is multiplied by the HeapKind, so in a MaxHeap the root is the
+/// greatest element and in a MinHeap the root is the lowest element.
+struct BinomialHeap_s
+{
+    /// \brief What kind of heap this is.
+    ///
+    ///  1 - Max-Heap
+    /// -1 - Min-Heap
+    enum HeapKind_e kind;
+
+    /// \brief The root of the tree with the lowest degree.
+    struct BinomialHeapTree_s *head;
+
+    /// \brief The root with the highest priority.
+    struct BinomialHeapTree_s *top;
+
+    /// \brief Current amount of elements in the heap.
+    integer_t count;
+
+    /// \brief Where handles are allocated from.
+    struct NodePool_s *handle_pool;
+
+    /// \brief Where tree nodes are allocated from.
+    struct NodePool_s *tree_pool;
+
+    /// \brief BinomialHeap_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A handle to an element of a BinomialHeap_s.
+struct BinomialHeapNode_s
+{
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief The tree node that currently holds this handle.
+    struct BinomialHeapTree_s *tree;
+};
+
+/// \brief A node of a binomial tree.
+///
+/// Implementation detail. The children of a node are kept from the highest
+/// to the lowest degree.
+struct BinomialHeapTree_s
+{
+    /// \brief The handle held by this node.
+    struct BinomialHeapNode_s *handle;
+
+    /// \brief The parent of this node or NULL if it is a root.
+    struct BinomialHeapTree_s *parent;
+
+    /// \brief The child of this node with the highest degree.
+    struct BinomialHeapTree_s *child;
+
+    /// \brief The next child of the parent or the next root.
+    struct BinomialHeapTree_s *sibling;
+
+    /// \brief Amount of children of this node.
+    integer_t degree;
+};
+
+typedef struct BinomialHeapTree_s BinomialHeapTree_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+bnh_better(BinomialHeap_t *heap, BinomialHeapTree_t *first,
+           BinomialHeapTree_t *second);
+
+static BinomialHeapTree_t *
+bnh_union(BinomialHeap_t *heap, BinomialHeapTree_t *first,
+          BinomialHeapTree_t *second);
+
+static void
+bnh_find_top(BinomialHeap_t *heap);
+
+static BinomialHeapTree_t *
+bnh_float_up(BinomialHeap_t *heap, BinomialHeapTree_t *tree, bool always);
+
+static void
+bnh_free_nodes(BinomialHeap_t *heap, bool elements);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty BinomialHeap_s.
+///
+/// \param[in] interface An interface with a compare function.
+/// \param[in] kind If it is a MaxHeap or a MinHeap.
+///
+/// \return A new BinomialHeap_s or NULL if the kind is not valid or if
+/// allocation failed.
+BinomialHeap_t *
+bnh_new(Interface_t *interface, HeapKind kind)
+{
+    if (!(kind == MaxHeap || kind == MinHeap))
+        return NULL;
+
+    BinomialHeap_t *heap = malloc(sizeof(BinomialHeap_t));
+
+    if (!heap)
+        return NULL;
+
+    heap->handle_pool = npl_new(sizeof(BinomialHeapNode_t));
+    heap->tree_pool = npl_new(sizeof(BinomialHeapTree_t));
+
+    if (!heap->handle_pool || !heap->tree_pool)
+    {
+        if (heap->handle_pool)
+            npl_free(heap->handle_pool);
+        if (heap->tree_pool)
+            npl_free(heap->tree_pool);
+
+        free(heap);
+        return NULL;
+    }
+
+    heap->kind = kind;
+    heap->head = NULL;
+    heap->top = NULL;
+    heap->count = 0;
+    heap->interface = interface;
+
+    return heap;
+}
+
+/// Frees the heap, all of its nodes and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+bnh_free(BinomialHeap_t *heap)
+{
+    bnh_free_nodes(heap, true);
+
+    npl_free(heap->handle_pool);
+    npl_free(heap->tree_pool);
+    free(heap);
+}
+
+/// Frees the heap and all of its nodes, leaving the elements intact.
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+bnh_free_shallow(BinomialHeap_t *heap)
+{
+    bnh_free_nodes(heap, false);
+
+    npl_free(heap->handle_pool);
+    npl_free(heap->tree_pool);
+    free(heap);
+}
+
+/// Frees every node and element, leaving the heap empty. All handles become
+/// invalid.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be erased.
+void
+bnh_erase(BinomialHeap_t *heap)
+{
+    bnh_free_nodes(heap, true);
+}
+
+/// Frees every node, leaving the heap empty and the elements intact. All
+/// handles become invalid.
+///
+/// \param[in] heap The heap to be erased.
+void
+bnh_erase_shallow(BinomialHeap_t *heap)
+{
+    bnh_free_nodes(heap, false);
+}
+
+/// \param[in] heap The target heap.
+/// \param[in] new_interface The new interface.
+void
+bnh_config(BinomialHeap_t *heap, Interface_t *new_interface)
+{
+    heap->interface = new_interface;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The amount of elements in the heap.
+integer_t
+bnh_count(BinomialHeap_t *heap)
+{
+    return heap->count;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return If the heap is a MaxHeap or a MinHeap.
+HeapKind
+bnh_kind(BinomialHeap_t *heap)
+{
+    return heap->kind;
+}
+
+/// \param[in] handle A handle returned by bnh_insert().
+///
+/// \return The element referenced by the handle.
+void *
+bnh_element(BinomialHeapNode_t *handle)
+{
+    return handle->data;
+}
+
+/// Inserts an element by melding a single node tree into the heap. A handle
+/// to the element can be retrieved to later change its priority or to
+/// remove it; it stays valid until the element leaves the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] element The element to be inserted.
+/// \param[out] handle A handle to the element. Can be NULL.
+///
+/// \return True if the element was inserted, false if allocation failed.
+bool
+bnh_insert(BinomialHeap_t *heap, void *element, BinomialHeapNode_t **handle)
+{
+    BinomialHeapNode_t *node = npl_alloc(heap->handle_pool);
+
+    if (!node)
+        return false;
+
+    BinomialHeapTree_t *tree = npl_alloc(heap->tree_pool);
+
+    if (!tree)
+    {
+        npl_release(heap->handle_pool, node);
+        return false;
+    }
+
+    node->data = element;
+    node->tree = tree;
+
+    tree->handle = node;
+    tree->parent = NULL;
+    tree->child = NULL;
+    tree->sibling = NULL;
+    tree->degree = 0;
+
+    if (!heap->top || bnh_better(heap, tree, heap->top))
+        heap->top = tree;
+
+    heap->head = bnh_union(heap, heap->head, tree);
+
+    // Linking can only move the top tree below another root if they are
+    // equal, so look for the root that now holds the top element
+    while (heap->top->parent)
+        heap->top = heap->top->parent;
+
+    heap->count++;
+
+    if (handle)
+        *handle = node;
+
+    return true;
+}
+
+/// Removes the root element and melds its children back into the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[out] result The element with the highest priority.
+///
+/// \return True if an element was removed, false if the heap is empty.
+bool
+bnh_remove(BinomialHeap_t *heap, void **result)
+{
+    if (bnh_empty(heap))
+        return false;
+
+    BinomialHeapTree_t *top = heap->top;
+
+    // Unlink the top tree from the root list
+    if (heap->head == top)
+    {
+        heap->head = top->sibling;
+    }
+    else
+    {
+        BinomialHeapTree_t *prev = heap->head;
+
+        while (prev->sibling != top)
+            prev = prev->sibling;
+
+        prev->sibling = top->sibling;
+    }
+
+    // The children are kept from the highest to the lowest degree and need
+    // to be reversed to become a root list
+    BinomialHeapTree_t *children = NULL;
+    BinomialHeapTree_t *child = top->child;
+
+    while (child)
+    {
+        BinomialHeapTree_t *next = child->sibling;
+
+        child->parent = NULL;
+        child->sibling = children;
+        children = child;
+
+        child = next;
+    }
+
+    heap->head = bnh_union(heap, heap->head, children);
+
+    bnh_find_top(heap);
+
+    heap->count--;
+
+    *result = top->handle->data;
+
+    npl_release(heap->handle_pool, top->handle);
+    npl_release(heap->tree_pool, top);
+
+    return true;
+}
+
+/// Removes any element of the heap given its handle. The element is swapped
+/// up to the root of its tree as if it had the highest priority and then
+/// removed as the top of the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+/// \param[out] result The element referenced by the handle.
+///
+/// \return True if the element was removed, false if the heap is empty.
+bool
+bnh_delete(BinomialHeap_t *heap, BinomialHeapNode_t *handle, void **result)
+{
+    if (bnh_empty(heap))
+        return false;
+
+    heap->top = bnh_float_up(heap, handle->tree, true);
+
+    return bnh_remove(heap, result);
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The element with the highest priority or NULL if the heap is
+/// empty.
+void *
+bnh_peek(BinomialHeap_t *heap)
+{
+    if (bnh_empty(heap))
+        return NULL;
+
+    return heap->top->handle->data;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return True if the heap is empty, otherwise false.
+bool
+bnh_empty(BinomialHeap_t *heap)
+{
+    return heap->count == 0;
+}
+
+/// Restores the heap after an element referenced by a handle gained
+/// priority, that is, it was decreased in a MinHeap or increased in a
+/// MaxHeap. The element is swapped with its parent while it is better than
+/// it, which takes <code> O(log n) </code> time. An element that lost
+/// priority must be removed with bnh_delete() and inserted again.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+///
+/// \return True if the operation was successful, false if the heap is
+/// empty.
+bool
+bnh_decrease_key(BinomialHeap_t *heap, BinomialHeapNode_t *handle)
+{
+    if (bnh_empty(heap))
+        return false;
+
+    BinomialHeapTree_t *tree = bnh_float_up(heap, handle->tree, false);
+
+    if (!tree->parent && bnh_better(heap, tree, heap->top))
+        heap->top = tree;
+
+    return true;
+}
+
+/// Moves every element of \c other into \c heap, leaving \c other empty.
+/// The handles to the elements of \c other stay valid and now belong to
+/// \c heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The heap that receives the elements.
+/// \param[in] other The heap to be emptied.
+///
+/// \return True if the heaps were melded, false if they are the same heap or
+/// if they are not of the same kind.
+bool
+bnh_meld(BinomialHeap_t *heap, BinomialHeap_t *other)
+{
+    if (heap == other || heap->kind != other->kind)
+        return false;
+
+    npl_merge(heap->handle_pool, other->handle_pool);
+    npl_merge(heap->tree_pool, other->tree_pool);
+
+    if (bnh_empty(other))
+        return true;
+
+    heap->head = bnh_union(heap, heap->head, other->head);
+    heap->count += other->count;
+
+    bnh_find_top(heap);
+
+    other->head = NULL;
+    other->top = NULL;
+    other->count = 0;
+
+    return true;
+}
+
+/// Displays every tree of the heap where each child is indented below its
+/// parent.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] heap The heap to be displayed.
+void
+bnh_display(BinomialHeap_t *heap)
+{
+    if (bnh_empty(heap))
+    {
+        printf("\nBinomial Heap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nBinomial Heap\n");
+
+    // Iterative pre-order traversal, climbing back through the parents
+    BinomialHeapTree_t *tree = heap->head;
+    integer_t depth = 0;
+
+    while (tree)
+    {
+        for (integer_t i = 0; i < depth; i++)
+            printf("|  ");
+
+        heap->interface->display(tree->handle->data);
+        printf("\n");
+
+        if (tree->child)
+        {
+            tree = tree->child;
+            depth++;
+
+            continue;
+        }
+
+        while (tree && !tree->sibling)
+        {
+            tree = tree->parent;
+            depth--;
+        }
+
+        if (tree)
+            tree = tree->sibling;
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Returns true if the first node has a higher priority than the second
+static bool
+bnh_better(BinomialHeap_t *heap, BinomialHeapTree_t *first,
+           BinomialHeapTree_t *second)
+{
+    return heap->interface->compare(first->handle->data,
+                                    second->handle->data) * heap->kind > 0;
+}
+
+// Melds two root lists and returns the new head. Trees of the same degree
+// are linked, the one with less priority becoming the first child of the
+// other.
+static BinomialHeapTree_t *
+bnh_union(BinomialHeap_t *heap, BinomialHeapTree_t *first,
+          BinomialHeapTree_t *second)
+{
+    // Merge both lists by degree
+    BinomialHeapTree_t *head = NULL;
+    BinomialHeapTree_t **tail = &head;
+
+    while (first && second)
+    {
+        if (first->degree <= second->degree)
+        {
+            *tail = first;
+            first = first->sibling;
+        }
+        else
+        {
+            *tail = second;
+            second = second->sibling;
+        }
+
+        tail = &(*tail)->sibling;
+    }
+
+    *tail = first ? first : second;
+
+    if (!head)
+        return NULL;
+
+    // Link trees of the same degree
+    BinomialHeapTree_t *prev = NULL;
+    BinomialHeapTree_t *tree = head;
+    BinomialHeapTree_t *next = tree->sibling;
+
+    while (next)
+    {
+        if (tree->degree != next->degree ||
+            (next->sibling && next->sibling->degree == tree->degree))
+        {
+            // Leave the first of three equal degrees in place
+            prev = tree;
+            tree = next;
+        }
+        else if (!bnh_better(heap, next, tree))
+        {
+            tree->sibling = next->sibling;
+
+            next->parent = tree;
+            next->sibling = tree->child;
+            tree->child = next;
+            tree->degree++;
+        }
+        else
+        {
+            if (prev)
+                prev->sibling = next;
+            else
+                head = next;
+
+            tree->parent = next;
+            tree->sibling = next->child;
+            next->child = tree;
+            next->degree++;
+
+            tree = next;
+        }
+
+        next = tree->sibling;
+    }
+
+    return head;
+}
+
+// Finds the root with the highest priority
+static void
+bnh_find_top(BinomialHeap_t *heap)
+{
+    heap->top = heap->head;
+
+    for (BinomialHeapTree_t *tree = heap->head; tree; tree = tree->sibling)
+    {
+        if (bnh_better(heap, tree, heap->top))
+            heap->top = tree;
+    }
+}
+
+// Swaps the handle of a tree node with its parent's while it is better than
+// it, or until the root when always is true. Returns the tree node where the
+// handle ended up.
+static BinomialHeapTree_t *
+bnh_float_up(BinomialHeap_t *heap, BinomialHeapTree_t *tree, bool always)
+{
+    while (tree->parent && (always || bnh_better(heap, tree, tree->parent)))
+    {
+        BinomialHeapTree_t *parent = tree->parent;
+        BinomialHeapNode_t *handle = tree->handle;
+
+        tree->handle = parent->handle;
+        tree->handle->tree = tree;
+
+        parent->handle = handle;
+        handle->tree = parent;
+
+        tree = parent;
+    }
+
+    return tree;
+}
+
+// Frees every element if asked to and gives all nodes back to the pools. The
+// children of each node are spliced right after it in the sibling list.
+static void
+bnh_free_nodes(BinomialHeap_t *heap, bool elements)
+{
+    if (elements)
+    {
+        BinomialHeapTree_t *tree = heap->head;
+
+        while (tree)
+        {
+            if (tree->child)
+            {
+                BinomialHeapTree_t *last = tree->child;
+
+                while (last->sibling)
+                    last = last->sibling;
+
+                last->sibling = tree->sibling;
+                tree->sibling = tree->child;
+            }
+
+            heap->interface->free(tree->handle->data);
+
+            tree = tree->sibling;
+        }
+    }
+
+    npl_clear(heap->handle_pool);
+    npl_clear(heap->tree_pool);
+
+    heap->head = NULL;
+    heap->top = NULL;
+    heap->count = 0;
+}
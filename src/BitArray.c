@@ -238,6 +238,8 @@ bit_resize(BitArray_t *bits, unsigned_t bit_size)
         // Reallocation failed
         if (!new_buffer)
             return false;
+
+        bits->buffer = new_buffer;
     }
     // if bits->size == words return true
 
@@ -948,6 +950,88 @@ bit_display(BitArray_t *bits)
     printf("%d ]\n", bit_get(bits, nbits - 1) ? 1 : 0);
 }
 
+/// Saves the amount of used bits followed by the words that store them.
+/// Bits past the used ones are saved as 0. See Serial.h for the format.
+///
+/// \param[in] bits The bit array to be saved.
+/// \param[in] serial The stream where the bit array is written to.
+///
+/// \return True if the bit array was saved or false if writing failed.
+bool
+bit_serialize(BitArray_t *bits, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_BIT_ARRAY, 0, (integer_t)bits->used_bits))
+        return false;
+
+    unsigned_t words = bit_buffer_index(bits->used_bits - 1) + 1;
+    unsigned_t trailing = bits->used_bits % bit_word_size;
+
+    for (unsigned_t i = 0; i < words; i++)
+    {
+        unsigned_t word = bits->buffer[i];
+
+        if (i == words - 1 && trailing != 0)
+            word &= ((unsigned_t)1 << trailing) - 1;
+
+        if (!ser_write_u64(serial, (uint64_t)word))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads a bit array saved with bit_serialize(), replacing the size and all
+/// the bits of the target bit array. The words are read into a new buffer
+/// so the bit array is only changed if everything was read.
+///
+/// \param[in] bits The bit array to be replaced.
+/// \param[in] serial The stream where the bit array is read from.
+///
+/// \return True if the bit array was loaded. False if the stream is not a
+/// valid BitArray_s, if reading failed or if allocation failed.
+bool
+bit_deserialize(BitArray_t *bits, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t used_bits;
+
+    if (!ser_read_header(serial, SER_BIT_ARRAY, &layout, &used_bits))
+        return false;
+
+    if (used_bits == 0)
+        return false;
+
+    unsigned_t words = bit_buffer_index((unsigned_t)used_bits - 1) + 1;
+
+    unsigned_t *buffer = malloc(sizeof(unsigned_t) * words);
+
+    if (!buffer)
+        return false;
+
+    for (unsigned_t i = 0; i < words; i++)
+    {
+        uint64_t word;
+
+        if (!ser_read_u64(serial, &word))
+        {
+            free(buffer);
+            return false;
+        }
+
+        buffer[i] = (unsigned_t)word;
+    }
+
+    free(bits->buffer);
+
+    bits->buffer = buffer;
+    bits->size = words;
+    bits->used_bits = (unsigned_t)used_bits;
+
+    bit_clear_unused_bits(bits);
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // Translates a bit index to a word index
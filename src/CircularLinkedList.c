@@ -154,6 +154,9 @@ static Status cll_free_node(CircularLinkedNode *node, cll_free_f free_f);
 
 static Status cll_free_node_shallow(CircularLinkedNode *node);
 
+static CircularLinkedNode cll_node_at(CircularLinkedList list,
+        integer_t position);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a CircularLinkedList_s structure.
@@ -836,6 +839,99 @@ Status cll_copy(CircularLinkedList list, CircularLinkedList *result)
     return DS_OK;
 }
 
+/// Moves the elements of \c src from position \c from to position \c to, both
+/// inclusive and counted forward from the cursor, into \c dst so that the
+/// first of them ends up at position \c dst_pos. The nodes are relinked, not
+/// copied, and the lengths of both lists are updated with the size of the
+/// range. Each position is reached walking from the cursor in whichever
+/// direction is shorter.
+///
+/// Inserting at position 0 makes the first moved element the new cursor of
+/// \c dst while inserting at its length leaves the cursor where it is; in
+/// both cases the elements end up right before the old cursor. If the cursor
+/// of \c src is moved then the element after the range becomes its cursor.
+///
+/// \param[in] dst The list to receive the elements.
+/// \param[in] dst_pos Position of \c dst where the elements are inserted.
+/// \param[in] src The list where the elements are taken from.
+/// \param[in] from Position of the first element to be moved.
+/// \param[in] to Position of the last element to be moved.
+///
+/// \return DS_ERR_FULL if \c dst has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same or if \c from is
+/// greater than \c to.
+/// \return DS_ERR_NEGATIVE_VALUE if any position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if \c to is greater than or equal to the
+/// length of \c src or if \c dst_pos is greater than the length of \c dst.
+/// \return DS_OK if all operations are successful.
+Status cll_splice(CircularLinkedList dst, integer_t dst_pos,
+        CircularLinkedList src, integer_t from, integer_t to)
+{
+    if (dst == NULL || src == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (dst == src || from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (dst_pos < 0 || from < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (to >= src->length || dst_pos > dst->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    integer_t count = to - from + 1;
+
+    if (dst->limit > 0 && dst->length + count > dst->limit)
+        return DS_ERR_FULL;
+
+    CircularLinkedNode first = cll_node_at(src, from);
+    CircularLinkedNode last = cll_node_at(src, to);
+
+    if (count == src->length)
+    {
+        src->cursor = NULL;
+    }
+    else
+    {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+
+        // The cursor is always at position 0
+        if (from == 0)
+            src->cursor = last->next;
+    }
+
+    if (cll_empty(dst))
+    {
+        first->prev = last;
+        last->next = first;
+
+        dst->cursor = first;
+    }
+    else
+    {
+        CircularLinkedNode at = dst->cursor;
+
+        if (dst_pos < dst->length)
+            at = cll_node_at(dst, dst_pos);
+
+        first->prev = at->prev;
+        last->next = at;
+
+        at->prev->next = first;
+        at->prev = last;
+
+        if (dst_pos == 0)
+            dst->cursor = first;
+    }
+
+    src->length -= count;
+    dst->length += count;
+
+    return DS_OK;
+}
+
 /// Iterates the list cursor forward the specified number of positions.
 ///
 /// \param cll The list to iterate the cursor.
@@ -1033,6 +1129,109 @@ Status cll_display_raw(CircularLinkedList list)
     return DS_OK;
 }
 
+/// Saves the list's elements starting at the cursor and following the \c next
+/// pointers, each one encoded by the given function. See Serial.h for the
+/// format.
+///
+/// \param[in] list The list to be saved.
+/// \param[in] function A function that encodes an element.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if writing to the stream failed.
+/// \return DS_OK if all operations were successful.
+Status cll_serialize(CircularLinkedList list, serialize_f function,
+                     Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!ser_write_header(serial, SER_CIRCULAR_LINKED_LIST, 0, list->length))
+        return DS_ERR_STREAM;
+
+    CircularLinkedNode scan = list->cursor;
+
+    for (integer_t i = 0; i < list->length; i++, scan = scan->next)
+    {
+        if (!ser_write_element(serial, function, scan->data))
+            return DS_ERR_STREAM;
+    }
+
+    return DS_OK;
+}
+
+/// Loads elements saved with cll_serialize() into an empty list. Elements are
+/// decoded by the given function and the cursor ends up at the same element
+/// it was when the list was saved. If anything fails the elements already
+/// loaded are freed with the list's default free function.
+///
+/// \param[in] list An empty list.
+/// \param[in] function A function that decodes an element.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return DS_ERR_ALLOC if node allocation failed.
+/// \return DS_ERR_FULL if the elements don't fit in the list's limit.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default free function is not set.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if reading from the stream failed or if it doesn't
+/// have a valid CircularLinkedList_s.
+/// \return DS_OK if all operations were successful.
+Status cll_deserialize(CircularLinkedList list, deserialize_f function,
+                       Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_free == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (!cll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    uint32_t layout;
+    integer_t length;
+
+    if (!ser_read_header(serial, SER_CIRCULAR_LINKED_LIST, &layout, &length))
+        return DS_ERR_STREAM;
+
+    if (list->limit > 0 && length > list->limit)
+        return DS_ERR_FULL;
+
+    Status st = DS_OK;
+
+    for (integer_t i = 0; i < length && st == DS_OK; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, function, &element))
+        {
+            st = DS_ERR_STREAM;
+            break;
+        }
+
+        // Inserting before the cursor appends to the end of the circle
+        st = cll_insert_before(list, element);
+
+        if (st != DS_OK)
+            list->v_free(element);
+    }
+
+    if (st != DS_OK)
+    {
+        void *element;
+
+        while (!cll_empty(list))
+        {
+            cll_remove_current(list, &element);
+
+            list->v_free(element);
+        }
+    }
+
+    return st;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static Status cll_make_node(CircularLinkedNode *node, void *value)
@@ -1076,6 +1275,27 @@ static Status cll_free_node_shallow(CircularLinkedNode *node)
     return DS_OK;
 }
 
+// Returns the node at a valid position counted forward from the cursor,
+// walking backwards instead when that is shorter
+static CircularLinkedNode cll_node_at(CircularLinkedList list,
+        integer_t position)
+{
+    CircularLinkedNode scan = list->cursor;
+
+    if (position <= list->length / 2)
+    {
+        for (integer_t i = 0; i < position; i++)
+            scan = scan->next;
+    }
+    else
+    {
+        for (integer_t i = list->length; i > position; i--)
+            scan = scan->prev;
+    }
+
+    return scan;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,711 @@
+/**
+ * @file ConcurrentHashMap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ConcurrentHashMap.h"
+#include "CoreHash.h"
+#include "ThreadPool.h"
+#include <pthread.h>
+
+/// \brief Initial capacity of every shard's table.
+#define CHM_INITIAL_CAPACITY 16
+
+/// \brief Assumed size of a cache line.
+#define CHM_CACHE_LINE 64
+
+/// A concurrent hash map splits its keys in a power of two amount of shards
+/// using the most significant bits of each key's hash. Every shard is an
+/// independent open-addressing table with linear probing and its own
+/// readers-writer lock, so operations on keys that live in different shards
+/// never contend with each other, and lookups on the same shard can run at
+/// the same time.
+///
+/// Since another thread may replace or remove a value at any moment, the map
+/// never hands out pointers to the elements it owns: chm_get() and
+/// chm_compute_if_absent() return copies made with the value interface while
+/// the shard is still locked.
+struct ConcurrentHashMap_s
+{
+    /// \brief Array of shards.
+    ///
+    /// Every shard is aligned to a cache line so that threads working on
+    /// neighbouring shards don't write to the same line.
+    struct ConcurrentHashMapShard_s *shards;
+
+    /// \brief Amount of shards.
+    ///
+    /// Always a power of two.
+    integer_t shard_count;
+
+    /// \brief Bits of the hash used to select a shard.
+    ///
+    /// The base-2 logarithm of \c shard_count.
+    integer_t shard_bits;
+
+    /// \brief ConcurrentHashMap_s key interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The key interface must have
+    /// a compare, a hash, a copy and a free function.
+    struct Interface_s *K_interface;
+
+    /// \brief ConcurrentHashMap_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The value interface must
+    /// have a copy and a free function.
+    struct Interface_s *V_interface;
+};
+
+/// \brief A ConcurrentHashMap_s table slot.
+///
+/// Implementation detail. An empty slot has a \c NULL key.
+struct ConcurrentHashMapEntry_s
+{
+    /// \brief This entry's key.
+    void *key;
+
+    /// \brief This entry's value.
+    void *value;
+
+    /// \brief The mixed hash of the key.
+    ///
+    /// Stored so that probing can skip most comparisons and so that the
+    /// table can grow without calling the hash function again.
+    unsigned_t hash;
+};
+
+/// \brief A ConcurrentHashMap_s shard.
+///
+/// Implementation detail. An open-addressing table protected by a
+/// readers-writer lock.
+struct ConcurrentHashMapShard_s
+{
+    /// \brief Protects every other member of the shard.
+    _Alignas(CHM_CACHE_LINE) pthread_rwlock_t lock;
+
+    /// \brief Table of slots.
+    struct ConcurrentHashMapEntry_s *entries;
+
+    /// \brief Amount of slots in the table.
+    ///
+    /// Always a power of two.
+    integer_t capacity;
+
+    /// \brief Amount of key-value pairs in the table.
+    integer_t count;
+};
+
+typedef struct ConcurrentHashMapEntry_s ConcurrentHashMapEntry_t;
+
+typedef struct ConcurrentHashMapShard_s ConcurrentHashMapShard_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+chm_hash(ConcurrentHashMap_t *map, void *key);
+
+static ConcurrentHashMapShard_t *
+chm_shard(ConcurrentHashMap_t *map, unsigned_t hash);
+
+static integer_t
+chm_find(ConcurrentHashMap_t *map, ConcurrentHashMapShard_t *shard,
+         void *key, unsigned_t hash);
+
+static bool
+chm_insert_new(ConcurrentHashMapShard_t *shard, void *key, void *value,
+               unsigned_t hash);
+
+static bool
+chm_grow(ConcurrentHashMapShard_t *shard);
+
+static void
+chm_delete_at(ConcurrentHashMapShard_t *shard, integer_t index);
+
+static void
+chm_clear(ConcurrentHashMap_t *map, ConcurrentHashMapShard_t *shard);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new ConcurrentHashMap_s with two interfaces, one for the keys and
+/// another for the values. The amount of shards is rounded up to a power of
+/// two; if it is 0 or negative a default based on the amount of processors is
+/// used. More shards means less contention at the cost of some memory.
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] shards Amount of independently locked tables.
+///
+/// \return A new ConcurrentHashMap_s or NULL if allocation failed.
+ConcurrentHashMap_t *
+chm_new(Interface_t *key_interface, Interface_t *value_interface,
+        integer_t shards)
+{
+    if (shards <= 0)
+        shards = tpl_hardware_threads() * 4;
+
+    integer_t shard_count = 1, shard_bits = 0;
+
+    while (shard_count < shards)
+    {
+        shard_count <<= 1;
+        shard_bits++;
+    }
+
+    ConcurrentHashMap_t *map = malloc(sizeof(ConcurrentHashMap_t));
+
+    if (!map)
+        return NULL;
+
+    size_t shards_size = sizeof(ConcurrentHashMapShard_t) * (size_t)shard_count;
+
+    map->shards = aligned_alloc(CHM_CACHE_LINE, shards_size);
+
+    if (!map->shards)
+    {
+        free(map);
+        return NULL;
+    }
+
+    for (integer_t i = 0; i < shard_count; i++)
+    {
+        ConcurrentHashMapShard_t *shard = &map->shards[i];
+
+        shard->entries = calloc(CHM_INITIAL_CAPACITY,
+                                sizeof(ConcurrentHashMapEntry_t));
+
+        if (!shard->entries || pthread_rwlock_init(&shard->lock, NULL) != 0)
+        {
+            free(shard->entries);
+
+            for (integer_t j = 0; j < i; j++)
+            {
+                pthread_rwlock_destroy(&map->shards[j].lock);
+                free(map->shards[j].entries);
+            }
+
+            free(map->shards);
+            free(map);
+
+            return NULL;
+        }
+
+        shard->capacity = CHM_INITIAL_CAPACITY;
+        shard->count = 0;
+    }
+
+    map->shard_count = shard_count;
+    map->shard_bits = shard_bits;
+
+    map->K_interface = key_interface;
+    map->V_interface = value_interface;
+
+    return map;
+}
+
+/// Frees the map and all of its keys and values. No other thread may be
+/// using the map.
+///
+/// \param[in] map The map to be freed from memory.
+void
+chm_free(ConcurrentHashMap_t *map)
+{
+    for (integer_t i = 0; i < map->shard_count; i++)
+    {
+        chm_clear(map, &map->shards[i]);
+
+        pthread_rwlock_destroy(&map->shards[i].lock);
+        free(map->shards[i].entries);
+    }
+
+    free(map->shards);
+    free(map);
+}
+
+/// Frees the map but leaves its keys and values intact. No other thread may
+/// be using the map.
+///
+/// \param[in] map The map to be freed from memory.
+void
+chm_free_shallow(ConcurrentHashMap_t *map)
+{
+    for (integer_t i = 0; i < map->shard_count; i++)
+    {
+        pthread_rwlock_destroy(&map->shards[i].lock);
+        free(map->shards[i].entries);
+    }
+
+    free(map->shards);
+    free(map);
+}
+
+/// Frees every key-value pair, leaving the map empty. Each shard is cleared
+/// under its own lock, so pairs inserted concurrently into an already cleared
+/// shard are kept.
+///
+/// \param[in] map The map to be erased.
+void
+chm_erase(ConcurrentHashMap_t *map)
+{
+    for (integer_t i = 0; i < map->shard_count; i++)
+    {
+        ConcurrentHashMapShard_t *shard = &map->shards[i];
+
+        pthread_rwlock_wrlock(&shard->lock);
+
+        chm_clear(map, shard);
+
+        pthread_rwlock_unlock(&shard->lock);
+    }
+}
+
+/// Counts the pairs of every shard. If other threads are modifying the map the
+/// result is only an approximation since the shards are visited one by one.
+///
+/// \param[in] map The target map.
+///
+/// \return The amount of key-value pairs in the map.
+integer_t
+chm_size(ConcurrentHashMap_t *map)
+{
+    integer_t size = 0;
+
+    for (integer_t i = 0; i < map->shard_count; i++)
+    {
+        ConcurrentHashMapShard_t *shard = &map->shards[i];
+
+        pthread_rwlock_rdlock(&shard->lock);
+
+        size += shard->count;
+
+        pthread_rwlock_unlock(&shard->lock);
+    }
+
+    return size;
+}
+
+/// \param[in] map The target map.
+///
+/// \return The amount of shards of the map.
+integer_t
+chm_shards(ConcurrentHashMap_t *map)
+{
+    return map->shard_count;
+}
+
+/// Searches for a key and, if found, retrieves a copy of its value made with
+/// the value interface's copy function. The caller owns the copy.
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be searched.
+/// \param[out] value The resulting copy of the value.
+///
+/// \return True if the key was found and the copy succeeded.
+bool
+chm_get(ConcurrentHashMap_t *map, void *key, void **value)
+{
+    *value = NULL;
+
+    unsigned_t hash = chm_hash(map, key);
+    ConcurrentHashMapShard_t *shard = chm_shard(map, hash);
+
+    pthread_rwlock_rdlock(&shard->lock);
+
+    integer_t index = chm_find(map, shard, key, hash);
+
+    if (index >= 0)
+        *value = map->V_interface->copy(shard->entries[index].value);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    return *value != NULL;
+}
+
+/// Maps a key to a value. The map takes ownership of both. If the key was
+/// already present its old value is freed and replaced, and the given key is
+/// freed since the map keeps the one it already had.
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value to be mapped to the key.
+///
+/// \return True if the pair was inserted or replaced, false if allocation
+/// failed, in which case the map did not take ownership of the pair.
+bool
+chm_put(ConcurrentHashMap_t *map, void *key, void *value)
+{
+    unsigned_t hash = chm_hash(map, key);
+    ConcurrentHashMapShard_t *shard = chm_shard(map, hash);
+
+    pthread_rwlock_wrlock(&shard->lock);
+
+    integer_t index = chm_find(map, shard, key, hash);
+
+    bool success = true;
+
+    if (index >= 0)
+    {
+        map->V_interface->free(shard->entries[index].value);
+        map->K_interface->free(key);
+
+        shard->entries[index].value = value;
+    }
+    else
+    {
+        success = chm_insert_new(shard, key, value, hash);
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    return success;
+}
+
+/// Removes a key from the map. The key is freed and its value is handed to
+/// the caller; if \c value is NULL the value is freed as well.
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value that was mapped to the key or NULL.
+///
+/// \return True if the key was found and removed.
+bool
+chm_remove(ConcurrentHashMap_t *map, void *key, void **value)
+{
+    if (value)
+        *value = NULL;
+
+    unsigned_t hash = chm_hash(map, key);
+    ConcurrentHashMapShard_t *shard = chm_shard(map, hash);
+
+    pthread_rwlock_wrlock(&shard->lock);
+
+    integer_t index = chm_find(map, shard, key, hash);
+
+    if (index >= 0)
+    {
+        ConcurrentHashMapEntry_t *entry = &shard->entries[index];
+
+        map->K_interface->free(entry->key);
+
+        if (value)
+            *value = entry->value;
+        else
+            map->V_interface->free(entry->value);
+
+        chm_delete_at(shard, index);
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    return index >= 0;
+}
+
+/// Looks up a key and, if it is absent, computes its value by calling
+/// <code> function(key, context) </code> and inserts a copy of the key mapped
+/// to the result. The function is called at most once per key even if many
+/// threads ask for the same missing key at the same time, since it runs while
+/// holding the shard's write lock; it must not access the map. The key itself
+/// is only borrowed. If \c value is not NULL it receives a copy of the value
+/// that is mapped to the key, computed or not.
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be searched.
+/// \param[in] function The function that creates a value for a missing key.
+/// \param[in] context A user context passed to the function.
+/// \param[out] value The resulting copy of the value.
+///
+/// \return False if the function returned NULL or if allocation failed.
+bool
+chm_compute_if_absent(ConcurrentHashMap_t *map, void *key, map_f function,
+                      void *context, void **value)
+{
+    if (value)
+        *value = NULL;
+
+    unsigned_t hash = chm_hash(map, key);
+    ConcurrentHashMapShard_t *shard = chm_shard(map, hash);
+
+    // Most calls hit an existing key, so try first with a shared lock
+    pthread_rwlock_rdlock(&shard->lock);
+
+    integer_t index = chm_find(map, shard, key, hash);
+
+    if (index >= 0)
+    {
+        if (value)
+            *value = map->V_interface->copy(shard->entries[index].value);
+
+        pthread_rwlock_unlock(&shard->lock);
+
+        return !value || *value;
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    pthread_rwlock_wrlock(&shard->lock);
+
+    // Another thread might have inserted the key in the meantime
+    index = chm_find(map, shard, key, hash);
+
+    void *result = NULL;
+
+    if (index >= 0)
+    {
+        result = shard->entries[index].value;
+    }
+    else
+    {
+        void *new_value = function(key, context);
+        void *new_key = new_value ? map->K_interface->copy(key) : NULL;
+
+        if (new_key && chm_insert_new(shard, new_key, new_value, hash))
+        {
+            result = new_value;
+        }
+        else if (new_value)
+        {
+            map->V_interface->free(new_value);
+
+            if (new_key)
+                map->K_interface->free(new_key);
+        }
+    }
+
+    if (result && value)
+        *value = map->V_interface->copy(result);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    return result && (!value || *value);
+}
+
+/// \param[in] map The target map.
+///
+/// \return True if the map has no key-value pairs.
+bool
+chm_empty(ConcurrentHashMap_t *map)
+{
+    return chm_size(map) == 0;
+}
+
+/// \param[in] map The target map.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is in the map.
+bool
+chm_contains_key(ConcurrentHashMap_t *map, void *key)
+{
+    unsigned_t hash = chm_hash(map, key);
+    ConcurrentHashMapShard_t *shard = chm_shard(map, hash);
+
+    pthread_rwlock_rdlock(&shard->lock);
+
+    integer_t index = chm_find(map, shard, key, hash);
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    return index >= 0;
+}
+
+/// Displays every key-value pair grouped by shard. Each shard is locked while
+/// it is displayed.
+///
+/// \param[in] map The map to be displayed in the console.
+void
+chm_display(ConcurrentHashMap_t *map)
+{
+    printf("\nConcurrentHashMap\n");
+
+    for (integer_t i = 0; i < map->shard_count; i++)
+    {
+        ConcurrentHashMapShard_t *shard = &map->shards[i];
+
+        pthread_rwlock_rdlock(&shard->lock);
+
+        for (integer_t j = 0; j < shard->capacity; j++)
+        {
+            ConcurrentHashMapEntry_t *entry = &shard->entries[j];
+
+            if (!entry->key)
+                continue;
+
+            map->K_interface->display(entry->key);
+
+            printf(" : ");
+
+            map->V_interface->display(entry->value);
+
+            printf("\n");
+        }
+
+        pthread_rwlock_unlock(&shard->lock);
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+chm_hash(ConcurrentHashMap_t *map, void *key)
+{
+    return ds_hash_mix((uint64_t)map->K_interface->hash(key));
+}
+
+static ConcurrentHashMapShard_t *
+chm_shard(ConcurrentHashMap_t *map, unsigned_t hash)
+{
+    if (map->shard_bits == 0)
+        return &map->shards[0];
+
+    return &map->shards[(uint64_t)hash >> (64 - map->shard_bits)];
+}
+
+// Returns the index of the slot with the given key or -1 if not found
+static integer_t
+chm_find(ConcurrentHashMap_t *map, ConcurrentHashMapShard_t *shard,
+         void *key, unsigned_t hash)
+{
+    integer_t mask = shard->capacity - 1;
+
+    integer_t i = (integer_t)(hash & (unsigned_t)mask);
+
+    for (;; i = (i + 1) & mask)
+    {
+        ConcurrentHashMapEntry_t *entry = &shard->entries[i];
+
+        if (!entry->key)
+            return -1;
+
+        if (entry->hash == hash &&
+            map->K_interface->compare(entry->key, key) == 0)
+            return i;
+    }
+}
+
+// Inserts a key that is known not to be in the shard
+static bool
+chm_insert_new(ConcurrentHashMapShard_t *shard, void *key, void *value,
+               unsigned_t hash)
+{
+    // Keep the load factor under 3/4
+    if ((shard->count + 1) * 4 > shard->capacity * 3)
+    {
+        if (!chm_grow(shard))
+            return false;
+    }
+
+    integer_t mask = shard->capacity - 1;
+    integer_t i = (integer_t)(hash & (unsigned_t)mask);
+
+    while (shard->entries[i].key)
+        i = (i + 1) & mask;
+
+    shard->entries[i].key = key;
+    shard->entries[i].value = value;
+    shard->entries[i].hash = hash;
+
+    shard->count++;
+
+    return true;
+}
+
+static bool
+chm_grow(ConcurrentHashMapShard_t *shard)
+{
+    integer_t new_capacity = shard->capacity * 2;
+
+    ConcurrentHashMapEntry_t *new_entries =
+            calloc((size_t)new_capacity, sizeof(ConcurrentHashMapEntry_t));
+
+    if (!new_entries)
+        return false;
+
+    integer_t mask = new_capacity - 1;
+
+    for (integer_t i = 0; i < shard->capacity; i++)
+    {
+        ConcurrentHashMapEntry_t *entry = &shard->entries[i];
+
+        if (!entry->key)
+            continue;
+
+        integer_t j = (integer_t)(entry->hash & (unsigned_t)mask);
+
+        while (new_entries[j].key)
+            j = (j + 1) & mask;
+
+        new_entries[j] = *entry;
+    }
+
+    free(shard->entries);
+
+    shard->entries = new_entries;
+    shard->capacity = new_capacity;
+
+    return true;
+}
+
+// Empties a slot using backward shift deletion so that no tombstones are
+// needed: every following entry of the same probe run that would become
+// unreachable is moved back into the hole.
+static void
+chm_delete_at(ConcurrentHashMapShard_t *shard, integer_t index)
+{
+    integer_t mask = shard->capacity - 1;
+    integer_t hole = index;
+    integer_t next = index;
+
+    for (;;)
+    {
+        next = (next + 1) & mask;
+
+        ConcurrentHashMapEntry_t *entry = &shard->entries[next];
+
+        if (!entry->key)
+            break;
+
+        integer_t home = (integer_t)(entry->hash & (unsigned_t)mask);
+
+        // The entry can only move back if its home slot is not cyclically
+        // inside (hole, next]
+        bool movable = hole <= next
+                       ? (home <= hole || home > next)
+                       : (home <= hole && home > next);
+
+        if (movable)
+        {
+            shard->entries[hole] = *entry;
+            hole = next;
+        }
+    }
+
+    shard->entries[hole].key = NULL;
+    shard->entries[hole].value = NULL;
+
+    shard->count--;
+}
+
+static void
+chm_clear(ConcurrentHashMap_t *map, ConcurrentHashMapShard_t *shard)
+{
+    for (integer_t i = 0; i < shard->capacity; i++)
+    {
+        ConcurrentHashMapEntry_t *entry = &shard->entries[i];
+
+        if (!entry->key)
+            continue;
+
+        map->K_interface->free(entry->key);
+        map->V_interface->free(entry->value);
+
+        entry->key = NULL;
+        entry->value = NULL;
+    }
+
+    shard->count = 0;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,378 @@
+/**
+ * @file ConcurrentStack.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ConcurrentStack.h"
+#include "Epoch.h"
+#include <stdatomic.h>
+
+/// \brief Assumed size of a cache line.
+#define CST_CACHE_LINE 64
+
+/// \brief Amount of slots in the elimination array.
+#define CST_ELIMINATION_SLOTS 8
+
+/// \brief How many times a push waits for a pop to take its offer.
+#define CST_ELIMINATION_SPINS 128
+
+/// A Treiber stack: a singly-linked list where both push and pop swing the
+/// \c top pointer with a compare-and-swap. Popped nodes are retired with
+/// epoch-based reclamation instead of being freed, so a thread that read a
+/// node can always safely read its \c below pointer, and a node's address
+/// can't be reused while any pop still holds it, which rules out the ABA
+/// problem.
+///
+/// Under contention the single \c top pointer becomes a bottleneck, so when a
+/// compare-and-swap fails the thread tries the elimination array first. A
+/// push and a pop that meet at the same slot cancel each other out without
+/// touching the stack at all.
+struct ConcurrentStack_s
+{
+    /// \brief The top of the stack.
+    _Alignas(CST_CACHE_LINE) _Atomic(struct ConcurrentStackNode_s *) top;
+
+    /// \brief Amount of elements in the stack.
+    ///
+    /// Updated after each operation, so it is only an approximation while
+    /// other threads are using the stack.
+    _Alignas(CST_CACHE_LINE) atomic_llong count;
+
+    /// \brief Elimination array.
+    ///
+    /// Each slot is empty, holds a node offered by a push or holds the
+    /// address of \c cst_taken when a pop took the offer.
+    struct ConcurrentStackSlot_s
+    {
+        _Alignas(CST_CACHE_LINE) _Atomic(struct ConcurrentStackNode_s *) node;
+    } elimination[CST_ELIMINATION_SLOTS];
+
+    /// \brief ConcurrentStack_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A ConcurrentStack_s node.
+///
+/// Implementation detail. A singly-linked node that points to the node below
+/// it.
+struct ConcurrentStackNode_s
+{
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief Node below this one or NULL if this is the bottom.
+    struct ConcurrentStackNode_s *below;
+};
+
+typedef struct ConcurrentStackNode_s ConcurrentStackNode_t;
+
+/// \brief Marks an elimination slot whose offer was taken.
+static ConcurrentStackNode_t cst_taken;
+
+/// \brief Per-thread state of the slot picker.
+static _Thread_local uint32_t cst_seed = 0;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct ConcurrentStackSlot_s *
+cst_slot(ConcurrentStack_t *stack);
+
+static bool
+cst_eliminate_push(ConcurrentStack_t *stack, ConcurrentStackNode_t *node);
+
+static bool
+cst_eliminate_pop(ConcurrentStack_t *stack, void **result);
+
+static void
+cst_free_nodes(ConcurrentStackNode_t *node, free_f function);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// stack to operate.
+///
+/// \return A new ConcurrentStack_s or NULL if allocation failed.
+ConcurrentStack_t *
+cst_new(Interface_t *interface)
+{
+    ConcurrentStack_t *stack = aligned_alloc(CST_CACHE_LINE,
+                                             sizeof(ConcurrentStack_t));
+
+    if (!stack)
+        return NULL;
+
+    atomic_init(&stack->top, NULL);
+    atomic_init(&stack->count, 0);
+
+    for (integer_t i = 0; i < CST_ELIMINATION_SLOTS; i++)
+        atomic_init(&stack->elimination[i].node, NULL);
+
+    stack->interface = interface;
+
+    return stack;
+}
+
+/// No other thread may be using the stack.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] stack The stack to be freed from memory.
+void
+cst_free(ConcurrentStack_t *stack)
+{
+    cst_free_nodes(atomic_load(&stack->top), stack->interface->free);
+
+    free(stack);
+}
+
+/// No other thread may be using the stack.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The stack to be freed from memory.
+void
+cst_free_shallow(ConcurrentStack_t *stack)
+{
+    cst_free_nodes(atomic_load(&stack->top), NULL);
+
+    free(stack);
+}
+
+/// Pops every element and frees it. Elements pushed concurrently might be
+/// freed too.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] stack The stack to be erased.
+void
+cst_erase(ConcurrentStack_t *stack)
+{
+    void *element;
+
+    while (cst_pop(stack, &element))
+        stack->interface->free(element);
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+/// \param[in] new_interface A new interface for the stack.
+void
+cst_config(ConcurrentStack_t *stack, Interface_t *new_interface)
+{
+    stack->interface = new_interface;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+///
+/// \return The amount of elements in the stack. While other threads are using
+/// the stack this is only an approximation.
+integer_t
+cst_count(ConcurrentStack_t *stack)
+{
+    long long count = atomic_load(&stack->count);
+
+    return count < 0 ? 0 : (integer_t)count;
+}
+
+/// Inserts an element at the top of the stack. Safe to call from any amount
+/// of threads at the same time.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+/// \param[in] element The element to be inserted.
+///
+/// \return True if the element was inserted or false if node allocation
+/// failed.
+bool
+cst_push(ConcurrentStack_t *stack, void *element)
+{
+    ConcurrentStackNode_t *node = malloc(sizeof(ConcurrentStackNode_t));
+
+    if (!node)
+        return false;
+
+    node->data = element;
+
+    // The node is not reachable by anyone yet, so no critical section is
+    // needed to push it
+    for (;;)
+    {
+        ConcurrentStackNode_t *top = atomic_load(&stack->top);
+
+        node->below = top;
+
+        if (atomic_compare_exchange_weak(&stack->top, &top, node))
+            break;
+
+        if (cst_eliminate_push(stack, node))
+            break;
+    }
+
+    atomic_fetch_add(&stack->count, 1);
+
+    return true;
+}
+
+/// Removes the element at the top of the stack. Safe to call from any amount
+/// of threads at the same time.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+/// \param[out] result The element removed from the stack.
+///
+/// \return True if an element was removed or false if the stack was empty.
+bool
+cst_pop(ConcurrentStack_t *stack, void **result)
+{
+    *result = NULL;
+
+    ebr_enter();
+
+    for (;;)
+    {
+        ConcurrentStackNode_t *top = atomic_load(&stack->top);
+
+        if (!top)
+        {
+            ebr_leave();
+            return false;
+        }
+
+        // Safe since top can't be freed while inside the critical section
+        ConcurrentStackNode_t *below = top->below;
+
+        if (atomic_compare_exchange_weak(&stack->top, &top, below))
+        {
+            *result = top->data;
+
+            ebr_retire(top, free);
+
+            break;
+        }
+
+        if (cst_eliminate_pop(stack, result))
+            break;
+    }
+
+    ebr_leave();
+
+    atomic_fetch_sub(&stack->count, 1);
+
+    return true;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] stack The target stack.
+///
+/// \return True if the stack had no elements at the moment it was checked.
+bool
+cst_empty(ConcurrentStack_t *stack)
+{
+    return atomic_load(&stack->top) == NULL;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static struct ConcurrentStackSlot_s *
+cst_slot(ConcurrentStack_t *stack)
+{
+    if (cst_seed == 0)
+        cst_seed = (uint32_t)(uintptr_t)&cst_seed | 1;
+
+    cst_seed ^= cst_seed << 13;
+    cst_seed ^= cst_seed >> 17;
+    cst_seed ^= cst_seed << 5;
+
+    return &stack->elimination[cst_seed % CST_ELIMINATION_SLOTS];
+}
+
+// Offers a node in a random slot and waits a little for a pop to take it
+static bool
+cst_eliminate_push(ConcurrentStack_t *stack, ConcurrentStackNode_t *node)
+{
+    struct ConcurrentStackSlot_s *slot = cst_slot(stack);
+
+    ConcurrentStackNode_t *expected = NULL;
+
+    if (!atomic_compare_exchange_strong(&slot->node, &expected, node))
+        return false;
+
+    for (integer_t i = 0; i < CST_ELIMINATION_SPINS; i++)
+    {
+        if (atomic_load_explicit(&slot->node, memory_order_relaxed) != node)
+            break;
+    }
+
+    // Withdraw the offer; if that fails a pop took the node
+    expected = node;
+
+    if (atomic_compare_exchange_strong(&slot->node, &expected, NULL))
+        return false;
+
+    atomic_store(&slot->node, NULL);
+
+    return true;
+}
+
+// Takes a node offered by a push in a random slot, if there is one. The node
+// never made it to the stack so it can be freed right away.
+static bool
+cst_eliminate_pop(ConcurrentStack_t *stack, void **result)
+{
+    struct ConcurrentStackSlot_s *slot = cst_slot(stack);
+
+    ConcurrentStackNode_t *node = atomic_load(&slot->node);
+
+    if (!node || node == &cst_taken)
+        return false;
+
+    if (!atomic_compare_exchange_strong(&slot->node, &node, &cst_taken))
+        return false;
+
+    *result = node->data;
+
+    free(node);
+
+    return true;
+}
+
+static void
+cst_free_nodes(ConcurrentStackNode_t *node, free_f function)
+{
+    while (node)
+    {
+        ConcurrentStackNode_t *below = node->below;
+
+        if (function)
+            function(node->data);
+
+        free(node);
+
+        node = below;
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
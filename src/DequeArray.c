@@ -869,6 +869,80 @@ dqa_display(DequeArray_t *deque, int display_mode)
     }
 }
 
+/// Saves the deque's elements from the front to the rear, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] deque The deque to be saved.
+/// \param[in] serial The stream where the deque is written to.
+///
+/// \return True if the deque was saved or false if writing failed.
+bool
+dqa_serialize(DequeArray_t *deque, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_DEQUE_ARRAY, 0, deque->count))
+        return false;
+
+    for (integer_t i = deque->front, j = 0;
+         j < deque->count;
+         i = (i + 1) % deque->capacity, j++)
+    {
+        if (!ser_write_element(serial, deque->interface->serialize,
+                               deque->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with dqa_serialize(), keeping the same front and
+/// rear.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] deque An empty deque.
+/// \param[in] serial The stream where the deque is read from.
+///
+/// \return True if all elements were loaded. False if the deque is not empty,
+/// if the stream is not a valid DequeArray_s, if reading failed or if the
+/// deque couldn't grow, in which case the deque is left empty.
+bool
+dqa_deserialize(DequeArray_t *deque, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!dqa_empty(deque))
+        return false;
+
+    if (!ser_read_header(serial, SER_DEQUE_ARRAY, &layout, &count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, deque->interface->deserialize, &element))
+        {
+            dqa_erase(deque);
+            return false;
+        }
+
+        if (!dqa_enqueue_rear(deque, element))
+        {
+            deque->interface->free(element);
+            dqa_erase(deque);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // This function reallocates the data buffer effectively increasing its
@@ -963,7 +1037,307 @@ static dqa_grow(DequeArray_t *deque)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo DequeArrayIterator
+/// This iterator can traverse the deque both ways. Its cursor is the position
+/// of the current element counted from the front, so it is translated to an
+/// index of the circular buffer on every access and it doesn't matter where
+/// in the buffer the elements actually are.
+struct DequeArrayIterator_s
+{
+    /// \brief Target DequeArray_s.
+    ///
+    /// Target DequeArray_s. The iterator might need to use some information
+    /// provided by the deque or change some of its data members.
+    struct DequeArray_s *target;
+
+    /// \brief Current element.
+    ///
+    /// Position of the current element. The iterator is always initialized
+    /// with 0, that is, the front of the deque.
+    integer_t cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure. This is kept to prevent iteration on the target structure
+    /// that may have been modified and thus causing undefined behaviours or
+    /// run-time crashes.
+    integer_t target_id;
+};
+
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t dqa_iter_size = sizeof(DequeArrayIterator_t);
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+dqa_iter_target_modified(DequeArrayIterator_t *iter);
+
+static void **
+dqa_iter_slot(DequeArrayIterator_t *iter, integer_t position);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Allocates a new iterator positioned at the front of the target deque.
+///
+/// \param[in] target The deque to be iterated.
+///
+/// \return NULL if the deque is empty or if the allocation failed, otherwise
+/// a new iterator.
+DequeArrayIterator_t *
+dqa_iter_new(DequeArray_t *target)
+{
+    if (dqa_empty(target))
+        return NULL;
+
+    DequeArrayIterator_t *iter = malloc(sizeof(DequeArrayIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    dqa_iter_init(iter, target);
+
+    return iter;
+}
+
+/// Initializes an iterator allocated by the user, usually on the stack with
+/// \c dqa_iter_size, positioned at the front of the target deque.
+///
+/// \param[in,out] iter The iterator to be initialized.
+/// \param[in] target The deque to be iterated.
+///
+/// \return False if the deque is empty, otherwise true.
+bool
+dqa_iter_init(DequeArrayIterator_t *iter, DequeArray_t *target)
+{
+    if (dqa_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Changes the target of an iterator and moves its cursor to the front.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new deque to be iterated.
+void
+dqa_iter_retarget(DequeArrayIterator_t *iter, DequeArray_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+}
+
+/// Frees from memory an iterator created with dqa_iter_new().
+///
+/// \param[in] iter The iterator to be freed.
+void
+dqa_iter_free(DequeArrayIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor one position towards the rear.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the deque was modified or if the cursor is at the rear,
+/// otherwise true.
+bool
+dqa_iter_next(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    if (!dqa_iter_has_next(iter))
+        return false;
+
+    iter->cursor++;
+
+    return true;
+}
+
+/// Moves the cursor one position towards the front.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the deque was modified or if the cursor is at the front,
+/// otherwise true.
+bool
+dqa_iter_prev(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    if (!dqa_iter_has_prev(iter))
+        return false;
+
+    iter->cursor--;
+
+    return true;
+}
+
+/// Moves the cursor to the front of the deque.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the deque was modified, otherwise true.
+bool
+dqa_iter_to_front(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Moves the cursor to the rear of the deque.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the deque was modified, otherwise true.
+bool
+dqa_iter_to_rear(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->count - 1;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element after the cursor, otherwise false.
+bool
+dqa_iter_has_next(DequeArrayIterator_t *iter)
+{
+    return iter->cursor < iter->target->count - 1;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element before the cursor, otherwise false.
+bool
+dqa_iter_has_prev(DequeArrayIterator_t *iter)
+{
+    return iter->cursor > 0;
+}
+
+/// Retrieves the element pointed by the cursor.
+///
+/// \param[in] iter The iterator.
+/// \param[out] result The current element.
+///
+/// \return False if the deque was modified, otherwise true.
+bool
+dqa_iter_get(DequeArrayIterator_t *iter, void **result)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    *result = *dqa_iter_slot(iter, iter->cursor);
+
+    return true;
+}
+
+/// Replaces the element pointed by the cursor, freeing the old one.
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] iter The iterator.
+/// \param[in] element The new element.
+///
+/// \return False if the deque was modified, otherwise true.
+bool
+dqa_iter_set(DequeArrayIterator_t *iter, void *element)
+{
+    if (dqa_iter_target_modified(iter))
+        return false;
+
+    void **slot = dqa_iter_slot(iter, iter->cursor);
+
+    iter->target->interface->free(*slot);
+
+    *slot = element;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the deque was modified or if there is no next element,
+/// otherwise the element after the cursor.
+void *
+dqa_iter_peek_next(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return NULL;
+
+    if (!dqa_iter_has_next(iter))
+        return NULL;
+
+    return *dqa_iter_slot(iter, iter->cursor + 1);
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the deque was modified, otherwise the current element.
+void *
+dqa_iter_peek(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return NULL;
+
+    return *dqa_iter_slot(iter, iter->cursor);
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the deque was modified or if there is no previous element,
+/// otherwise the element before the cursor.
+void *
+dqa_iter_peek_prev(DequeArrayIterator_t *iter)
+{
+    if (dqa_iter_target_modified(iter))
+        return NULL;
+
+    if (!dqa_iter_has_prev(iter))
+        return NULL;
+
+    return *dqa_iter_slot(iter, iter->cursor - 1);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+dqa_iter_target_modified(DequeArrayIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+// Returns the buffer slot of an element given its position from the front
+static void **
+dqa_iter_slot(DequeArrayIterator_t *iter, integer_t position)
+{
+    DequeArray_t *deque = iter->target;
+
+    integer_t index = deque->front + position;
+
+    if (index >= deque->capacity)
+        index -= deque->capacity;
+
+    return &deque->buffer[index];
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -117,6 +117,9 @@ dql_free_node(DequeListNode_t *node, free_f function);
 static void
 dql_free_node_shallow(DequeListNode_t *node);
 
+static DequeListNode_t *
+dql_node_at(DequeList_t *deque, integer_t position);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a new DequeList_s with a given interface that contains
@@ -716,7 +719,7 @@ dql_compare(DequeList_t *deque1, DequeList_t *deque2)
 }
 
 /// Appends \c deque2 at the rear of \c deque1, emptying deque2. Both deques
-/// need to have been initialized.
+/// need to have been initialized. The nodes are relinked in constant time.
 /// \par Interface Requirements
 /// - None
 ///
@@ -727,12 +730,14 @@ dql_compare(DequeList_t *deque1, DequeList_t *deque2)
 bool
 dql_append(DequeList_t *deque1, DequeList_t *deque2)
 {
-    /// \todo dql_append
-    return true;
+    if (dql_empty(deque2))
+        return deque1 != deque2;
+
+    return dql_splice(deque1, deque1->count, deque2, 0, deque2->count - 1);
 }
 
 /// Prepends \c deque2 at the front of \c deque1, emptying deque2. Both deques
-/// need to have been initialized.
+/// need to have been initialized. The nodes are relinked in constant time.
 /// \par Interface Requirements
 /// - None
 ///
@@ -743,7 +748,85 @@ dql_append(DequeList_t *deque1, DequeList_t *deque2)
 bool
 dql_prepend(DequeList_t *deque1, DequeList_t *deque2)
 {
-    /// \todo dql_prepend
+    if (dql_empty(deque2))
+        return deque1 != deque2;
+
+    return dql_splice(deque1, 0, deque2, 0, deque2->count - 1);
+}
+
+/// Moves the elements of \c src from position \c from to position \c to, both
+/// inclusive and counted from the front, into \c dst so that the first of
+/// them ends up at position \c dst_pos. The nodes are relinked, not copied,
+/// and the counts of both deques are updated with the size of the range, so
+/// the only walks are the ones to find the ends of the range and the
+/// insertion point, each starting from the closest end of its deque.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] dst Deque to receive the elements.
+/// \param[in] dst_pos Position of \c dst where the elements are inserted.
+/// \param[in] src Deque where the elements are taken from.
+/// \param[in] from Position of the first element to be moved.
+/// \param[in] to Position of the last element to be moved.
+///
+/// \return False if both deques are the same, if any position is out of
+/// range or if the elements don't fit in \c dst, otherwise true.
+bool
+dql_splice(DequeList_t *dst, integer_t dst_pos, DequeList_t *src,
+           integer_t from, integer_t to)
+{
+    if (dst == src || from < 0 || from > to || to >= src->count)
+        return false;
+
+    if (dst_pos < 0 || dst_pos > dst->count)
+        return false;
+
+    integer_t count = to - from + 1;
+
+    if (!dql_fits(dst, (unsigned_t)count))
+        return false;
+
+    DequeListNode_t *first = dql_node_at(src, from);
+    DequeListNode_t *last = dql_node_at(src, to);
+
+    // Nodes link to the rear with prev and to the front with next
+    if (first->next == NULL)
+        src->front = last->prev;
+    else
+        first->next->prev = last->prev;
+
+    if (last->prev == NULL)
+        src->rear = first->next;
+    else
+        last->prev->next = first->next;
+
+    // The range goes in front of this node or at the rear if NULL
+    DequeListNode_t *behind = NULL;
+
+    if (dst_pos < dst->count)
+        behind = dql_node_at(dst, dst_pos);
+
+    DequeListNode_t *ahead = behind == NULL ? dst->rear : behind->next;
+
+    first->next = ahead;
+    last->prev = behind;
+
+    if (ahead == NULL)
+        dst->front = first;
+    else
+        ahead->prev = first;
+
+    if (behind == NULL)
+        dst->rear = last;
+    else
+        behind->next = last;
+
+    src->count -= count;
+    dst->count += count;
+
+    src->version_id++;
+    dst->version_id++;
+
     return true;
 }
 
@@ -852,6 +935,79 @@ dql_display(DequeList_t *deque, int display_mode)
     }
 }
 
+/// Saves the deque's elements from the front to the rear, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] deque The deque to be saved.
+/// \param[in] serial The stream where the deque is written to.
+///
+/// \return True if the deque was saved or false if writing failed.
+bool
+dql_serialize(DequeList_t *deque, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_DEQUE_LIST, 0, deque->count))
+        return false;
+
+    for (DequeListNode_t *scan = deque->front; scan != NULL; scan = scan->prev)
+    {
+        if (!ser_write_element(serial, deque->interface->serialize,
+                               scan->data))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with dql_serialize(), keeping the same front.
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] deque An empty deque.
+/// \param[in] serial The stream where the deque is read from.
+///
+/// \return True if all elements were loaded. False if the deque is not empty,
+/// if the elements don't fit in the deque's limit, if the stream is not a
+/// valid DequeList_s or if reading failed, in which case the deque is left
+/// empty.
+bool
+dql_deserialize(DequeList_t *deque, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!dql_empty(deque))
+        return false;
+
+    if (!ser_read_header(serial, SER_DEQUE_LIST, &layout, &count))
+        return false;
+
+    if (!dql_fits(deque, (unsigned_t)count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, deque->interface->deserialize, &element))
+        {
+            dql_erase(deque);
+            return false;
+        }
+
+        if (!dql_enqueue_rear(deque, element))
+        {
+            deque->interface->free(element);
+            dql_erase(deque);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static DequeListNode_t *
@@ -882,6 +1038,31 @@ dql_free_node_shallow(DequeListNode_t *node)
     free(node);
 }
 
+// Returns the node at a valid position counted from the front, walking from
+// whichever end is closest
+static DequeListNode_t *
+dql_node_at(DequeList_t *deque, integer_t position)
+{
+    DequeListNode_t *scan;
+
+    if (position < deque->count / 2)
+    {
+        scan = deque->front;
+
+        for (integer_t i = 0; i < position; i++)
+            scan = scan->prev;
+    }
+    else
+    {
+        scan = deque->rear;
+
+        for (integer_t i = deque->count - 1; i > position; i--)
+            scan = scan->next;
+    }
+
+    return scan;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -889,7 +1070,8 @@ dql_free_node_shallow(DequeListNode_t *node)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// This is a DequeList_s iterator and its cursor is represented by pointing to
-/// the current node in the deque.
+/// the current node in the deque. Iterating forward goes from the front to the
+/// rear, which means following the \c prev pointer of each node.
 struct DequeListIterator_s
 {
     /// \brief Target DequeList_s.
@@ -913,6 +1095,10 @@ struct DequeListIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t dql_iter_size = sizeof(DequeListIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool
@@ -942,6 +1128,24 @@ dql_iter_new(DequeList_t *target)
     return iter;
 }
 
+///
+/// \param[in,out] iter
+/// \param[in] target
+///
+/// \return
+bool
+dql_iter_init(DequeListIterator_t *iter, DequeList_t *target)
+{
+    if (dql_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->front;
+
+    return true;
+}
+
 ///
 /// \param[in] iter
 /// \param[in] target
@@ -973,7 +1177,7 @@ dql_iter_next(DequeListIterator_t *iter)
     if (!dql_iter_has_next(iter))
         return false;
 
-    iter->cursor = iter->cursor->next;
+    iter->cursor = iter->cursor->prev;
 
     return true;
 }
@@ -991,7 +1195,7 @@ dql_iter_prev(DequeListIterator_t *iter)
     if (!dql_iter_has_prev(iter))
         return false;
 
-    iter->cursor = iter->cursor->prev;
+    iter->cursor = iter->cursor->next;
 
     return true;
 }
@@ -1033,7 +1237,7 @@ dql_iter_to_rear(DequeListIterator_t *iter)
 bool
 dql_iter_has_next(DequeListIterator_t *iter)
 {
-    return iter->cursor->next != NULL;
+    return iter->cursor->prev != NULL;
 }
 
 ///
@@ -1043,7 +1247,7 @@ dql_iter_has_next(DequeListIterator_t *iter)
 bool
 dql_iter_has_prev(DequeListIterator_t *iter)
 {
-    return iter->cursor->prev != NULL;
+    return iter->cursor->next != NULL;
 }
 
 ///
@@ -1093,7 +1297,7 @@ dql_iter_peek_next(DequeListIterator_t *iter)
     if (!dql_iter_has_next(iter))
         return NULL;
 
-    return iter->cursor->next->data;
+    return iter->cursor->prev->data;
 }
 
 ///
@@ -1122,7 +1326,7 @@ dql_iter_peek_prev(DequeListIterator_t *iter)
     if (!dql_iter_has_prev(iter))
         return NULL;
 
-    return iter->cursor->prev->data;
+    return iter->cursor->next->data;
 }
 
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
@@ -28,7 +28,6 @@
 ///
 /// Located in the file DoublyLinkedList.c
 ///
-/// \todo Add Link and Unlink functions
 /// \todo Add support to negative index searches
 struct DoublyLinkedList_s
 {
@@ -91,6 +90,19 @@ struct DoublyLinkedList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief The node found by the last positional lookup.
+    ///
+    /// Positional lookups start from here when it is closer than the
+    /// head or the tail. It is only valid while \c cursor_id equals
+    /// \c version_id, so any structural modification discards it.
+    struct DoublyLinkedNode_s *cursor;
+
+    /// \brief Position of the \c cursor node.
+    integer_t cursor_position;
+
+    /// \brief The \c version_id from when the \c cursor was set.
+    integer_t cursor_id;
 };
 
 /// \brief A DoublyLinkedList_s node.
@@ -136,6 +148,12 @@ static Status dll_free_node_shallow(DoublyLinkedNode *node);
 
 static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, integer_t position);
 
+static DoublyLinkedNode dll_cut_run(DoublyLinkedList list,
+        DoublyLinkedNode *run);
+
+static DoublyLinkedNode dll_merge_runs(DoublyLinkedList list,
+        DoublyLinkedNode left, DoublyLinkedNode right);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a DoublyLinkedList_s structure.
@@ -162,6 +180,10 @@ Status dll_init(DoublyLinkedList *list)
     (*list)->head = NULL;
     (*list)->tail = NULL;
 
+    (*list)->cursor = NULL;
+    (*list)->cursor_position = 0;
+    (*list)->cursor_id = 0;
+
     (*list)->v_compare = NULL;
     (*list)->v_copy = NULL;
     (*list)->v_display = NULL;
@@ -198,6 +220,10 @@ Status dll_create(DoublyLinkedList *list, dll_compare_f compare_f,
     (*list)->head = NULL;
     (*list)->tail = NULL;
 
+    (*list)->cursor = NULL;
+    (*list)->cursor_position = 0;
+    (*list)->cursor_id = 0;
+
     (*list)->v_compare = compare_f;
     (*list)->v_copy = copy_f;
     (*list)->v_display = display_f;
@@ -684,6 +710,11 @@ Status dll_insert_at(DoublyLinkedList list, void *element, integer_t position)
         list->length++;
         list->version_id++;
 
+        // Still valid, and the next insertion is likely to be around it
+        list->cursor = node;
+        list->cursor_position = position;
+        list->cursor_id = list->version_id;
+
         return DS_OK;
     }
 }
@@ -846,11 +877,18 @@ Status dll_remove_at(DoublyLinkedList list, void **result, integer_t position)
 
         *result = node->data;
 
+        // Its successor takes its position
+        DoublyLinkedNode next = node->next;
+
         dll_free_node_shallow(&node);
 
         list->length--;
         list->version_id++;
 
+        list->cursor = next;
+        list->cursor_position = position;
+        list->cursor_id = list->version_id;
+
         if (dll_empty(list))
         {
             list->head = NULL;
@@ -1167,6 +1205,90 @@ Status dll_reverse(DoublyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Sorts a DoublyLinkedList_s.
+///
+/// Sorts the list with a bottom-up merge sort using the default compare
+/// function. Only the \c next and \c prev pointers of the nodes are changed, so
+/// nothing is allocated and the elements stay where they are in memory. The
+/// sort is stable, equal elements keep their relative order.
+///
+/// The list is first split into the runs that are already in order, and the
+/// ones in strictly descending order are reversed. Runs are then merged in
+/// pairs of about the same size, so an already sorted list takes a single
+/// O(n) pass and any list takes at most O(n log n).
+///
+/// \param[in] list DoublyLinkedList_s reference to be sorted.
+///
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
+/// \return DS_ERR_NULL_POINTER if list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status dll_sort(DoublyLinkedList list)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (list->length < 2)
+        return DS_OK;
+
+    // pending[i] is a sorted chain made of about 2^i runs, so a slot is
+    // never needed past the 64th
+    DoublyLinkedNode pending[64] = { NULL };
+    DoublyLinkedNode scan = list->head, run, sorted;
+
+    integer_t top = 0;
+
+    while (scan != NULL)
+    {
+        run = scan;
+        scan = dll_cut_run(list, &run);
+
+        // Add one like a binary counter, merging on every carry. Older chains
+        // go first to keep the sort stable.
+        integer_t i = 0;
+
+        for (; pending[i] != NULL; i++)
+        {
+            run = dll_merge_runs(list, pending[i], run);
+
+            pending[i] = NULL;
+        }
+
+        pending[i] = run;
+
+        if (i >= top)
+            top = i + 1;
+    }
+
+    sorted = NULL;
+
+    for (integer_t i = 0; i < top; i++)
+    {
+        if (pending[i] != NULL)
+            sorted = sorted == NULL ? pending[i]
+                                    : dll_merge_runs(list, pending[i], sorted);
+    }
+
+    // Only the next pointers were kept, so rebuild the prev ones
+    DoublyLinkedNode prev = NULL;
+
+    for (DoublyLinkedNode scan = sorted; scan != NULL; scan = scan->next)
+    {
+        scan->prev = prev;
+
+        prev = scan;
+    }
+
+    list->head = sorted;
+    list->tail = prev;
+
+    list->version_id++;
+
+    return DS_OK;
+}
+
 /// \brief Makes a copy of the specified DoublyLinkedList_s.
 ///
 /// Makes an exact copy of a list, copying each element using the default copy
@@ -1270,56 +1392,215 @@ Status dll_to_array(DoublyLinkedList list, void ***result, integer_t *length)
 
 /// \brief Appends list2 at the end of list1.
 ///
-/// \param list1
-/// \param list2
+/// Moves every node of list2 to the end of list1 in constant time, leaving
+/// list2 empty. See dll_splice().
+///
+/// \param[in] list1 DoublyLinkedList_s to receive the elements.
+/// \param[in] list2 DoublyLinkedList_s where the elements are taken from.
 ///
-/// \return
+/// \return DS_ERR_FULL if list1 has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same.
+/// \return DS_ERR_INVALID_OPERATION if list2 is empty.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_OK if all operations are successful.
 Status dll_link(DoublyLinkedList list1, DoublyLinkedList list2)
 {
-    /// \todo dll_link
-    return DS_OK;
+    if (list1 == NULL || list2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (dll_empty(list2))
+        return DS_ERR_INVALID_OPERATION;
+
+    return dll_splice(list1, list1->length, list2, 0, list2->length - 1);
 }
 
 /// \brief Links list2 at the specified position of list1.
 ///
-/// \param list1
-/// \param list2
-/// \param position
+/// Moves every node of list2 into list1 so that its first element ends up at
+/// the given position, leaving list2 empty. See dll_splice().
+///
+/// \param[in] list1 DoublyLinkedList_s to receive the elements.
+/// \param[in] list2 DoublyLinkedList_s where the elements are taken from.
+/// \param[in] position Position of list1 where the elements are inserted.
 ///
-/// \return
+/// \return DS_ERR_FULL if list1 has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same.
+/// \return DS_ERR_INVALID_OPERATION if list2 is empty.
+/// \return DS_ERR_NEGATIVE_VALUE if position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position is greater than the length of
+/// list1.
+/// \return DS_OK if all operations are successful.
 Status dll_link_at(DoublyLinkedList list1, DoublyLinkedList list2,
         integer_t position)
 {
-    /// \todo dll_link_at
-    return DS_OK;
+    if (list1 == NULL || list2 == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (dll_empty(list2))
+        return DS_ERR_INVALID_OPERATION;
+
+    return dll_splice(list1, position, list2, 0, list2->length - 1);
 }
 
 /// \brief Unlinks elements from the specified position to the end.
 ///
-/// \param list
-/// \param result
-/// \param position
+/// Moves every node of the list from the given position to its end into
+/// result, which must be empty. See dll_splice().
 ///
-/// \return
+/// \param[in] list DoublyLinkedList_s where the elements are taken from.
+/// \param[in] result An empty DoublyLinkedList_s to receive the elements.
+/// \param[in] position Position of the first element to be moved.
+///
+/// \return DS_ERR_FULL if result has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty.
+/// \return DS_ERR_NEGATIVE_VALUE if position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position is greater than or equal to the
+/// length of the list.
+/// \return DS_OK if all operations are successful.
 Status dll_unlink(DoublyLinkedList list, DoublyLinkedList result,
         integer_t position)
 {
-    /// \todo dll_unlink
-    return DS_OK;
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!dll_empty(result))
+        return DS_ERR_INVALID_OPERATION;
+
+    if (position >= list->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    return dll_splice(result, 0, list, position, list->length - 1);
 }
 
 /// \brief Unlinks elements from a given position to another.
 ///
-/// \param list
-/// \param result
-/// \param position1
-/// \param position2
-///
-/// \return
+/// Moves the nodes of the list from position1 to position2, both inclusive,
+/// into result, which must be empty. See dll_splice().
+///
+/// \param[in] list DoublyLinkedList_s where the elements are taken from.
+/// \param[in] result An empty DoublyLinkedList_s to receive the elements.
+/// \param[in] position1 Position of the first element to be moved.
+/// \param[in] position2 Position of the last element to be moved.
+///
+/// \return DS_ERR_FULL if result has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same or if
+/// position1 is greater than position2.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty.
+/// \return DS_ERR_NEGATIVE_VALUE if position1 is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position2 is greater than or equal to the
+/// length of the list.
+/// \return DS_OK if all operations are successful.
 Status dll_unlink_at(DoublyLinkedList list, DoublyLinkedList result,
         integer_t position1, integer_t position2)
 {
-    /// \todo dll_unlink_at
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!dll_empty(result))
+        return DS_ERR_INVALID_OPERATION;
+
+    return dll_splice(result, 0, list, position1, position2);
+}
+
+/// \brief Moves a range of elements from one list to another.
+///
+/// Moves the elements of \c src from position \c from to position \c to, both
+/// inclusive, into \c dst so that the first of them ends up at position
+/// \c dst_pos. The nodes are relinked, not copied, and the lengths of both
+/// lists are updated with the size of the range, so the only walks are the
+/// ones to find the ends of the range and the insertion point, each starting
+/// from the closest end of its list. Ranges and insertion points at either
+/// end of a list are found in constant time.
+///
+/// \param[in] dst DoublyLinkedList_s to receive the elements.
+/// \param[in] dst_pos Position of \c dst where the elements are inserted.
+/// \param[in] src DoublyLinkedList_s where the elements are taken from.
+/// \param[in] from Position of the first element to be moved.
+/// \param[in] to Position of the last element to be moved.
+///
+/// \return DS_ERR_FULL if \c dst has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same or if \c from is
+/// greater than \c to.
+/// \return DS_ERR_NEGATIVE_VALUE if any position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if \c to is greater than or equal to the
+/// length of \c src or if \c dst_pos is greater than the length of \c dst.
+/// \return DS_OK if all operations are successful.
+Status dll_splice(DoublyLinkedList dst, integer_t dst_pos,
+        DoublyLinkedList src, integer_t from, integer_t to)
+{
+    if (dst == NULL || src == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (dst == src || from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (dst_pos < 0 || from < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (to >= src->length || dst_pos > dst->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    integer_t count = to - from + 1;
+
+    if (dst->limit > 0 && dst->length + count > dst->limit)
+        return DS_ERR_FULL;
+
+    DoublyLinkedNode first, last, next = NULL;
+
+    Status st = dll_get_node_at(src, &first, from);
+
+    if (st != DS_OK)
+        return st;
+
+    st = dll_get_node_at(src, &last, to);
+
+    if (st != DS_OK)
+        return st;
+
+    // The range goes right before this node or at the tail if NULL
+    if (dst_pos < dst->length)
+    {
+        st = dll_get_node_at(dst, &next, dst_pos);
+
+        if (st != DS_OK)
+            return st;
+    }
+
+    if (first->prev == NULL)
+        src->head = last->next;
+    else
+        first->prev->next = last->next;
+
+    if (last->next == NULL)
+        src->tail = first->prev;
+    else
+        last->next->prev = first->prev;
+
+    DoublyLinkedNode prev = next == NULL ? dst->tail : next->prev;
+
+    first->prev = prev;
+    last->next = next;
+
+    if (prev == NULL)
+        dst->head = first;
+    else
+        prev->next = first;
+
+    if (next == NULL)
+        dst->tail = last;
+    else
+        next->prev = last;
+
+    src->length -= count;
+    dst->length += count;
+
+    src->version_id++;
+    dst->version_id++;
+
     return DS_OK;
 }
 
@@ -1450,6 +1731,108 @@ Status dll_display_raw(DoublyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Saves the list's elements to a stream.
+///
+/// Saves the list's elements from the head to the tail, each one encoded by
+/// the given function. See Serial.h for the format.
+///
+/// \param[in] list The list to be saved.
+/// \param[in] function A function that encodes an element.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if writing to the stream failed.
+/// \return DS_OK if all operations were successful.
+Status dll_serialize(DoublyLinkedList list, serialize_f function,
+                     Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!ser_write_header(serial, SER_DOUBLY_LINKED_LIST, 0, list->length))
+        return DS_ERR_STREAM;
+
+    for (DoublyLinkedNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        if (!ser_write_element(serial, function, scan->data))
+            return DS_ERR_STREAM;
+    }
+
+    return DS_OK;
+}
+
+/// \brief Loads elements saved with dll_serialize() into an empty list.
+///
+/// Elements are decoded by the given function and inserted at the tail, so
+/// the list ends up in the same order it was saved. If anything fails the
+/// elements already loaded are freed with the list's default free function.
+///
+/// \param[in] list An empty list.
+/// \param[in] function A function that decodes an element.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return DS_ERR_ALLOC if node allocation failed.
+/// \return DS_ERR_FULL if the elements don't fit in the list's limit.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default free function is not set.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if reading from the stream failed or if it doesn't
+/// have a valid DoublyLinkedList_s.
+/// \return DS_OK if all operations were successful.
+Status dll_deserialize(DoublyLinkedList list, deserialize_f function,
+                       Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_free == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (!dll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    uint32_t layout;
+    integer_t length;
+
+    if (!ser_read_header(serial, SER_DOUBLY_LINKED_LIST, &layout, &length))
+        return DS_ERR_STREAM;
+
+    if (list->limit > 0 && length > list->limit)
+        return DS_ERR_FULL;
+
+    Status st = DS_OK;
+
+    for (integer_t i = 0; i < length && st == DS_OK; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, function, &element))
+        {
+            st = DS_ERR_STREAM;
+            break;
+        }
+
+        st = dll_insert_tail(list, element);
+
+        if (st != DS_OK)
+            list->v_free(element);
+    }
+
+    if (st != DS_OK)
+    {
+        void *element;
+
+        while (!dll_empty(list))
+        {
+            dll_remove_head(list, &element);
+
+            list->v_free(element);
+        }
+    }
+
+    return st;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 /// \brief Builds a new DoublyLinkedNode_s.
@@ -1524,7 +1907,8 @@ static Status dll_free_node_shallow(DoublyLinkedNode *node)
 /// \brief Gets a node from a specific position.
 ///
 /// Implementation detail. Searches for a node in O(n / 2) where the search starts
-/// at the head or tail of the list.
+/// at the head or tail of the list, or at the node of the last lookup if it is
+/// closer. Looking up positions in order is then O(1) each.
 ///
 /// \param[in] list DoublyLinkedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1539,10 +1923,10 @@ static Status dll_free_node_shallow(DoublyLinkedNode *node)
 /// \return DS_OK if all operations are successful.
 static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, integer_t position)
 {
-    // This function effectively searches for a given node. If the position is
-    // greater than the list length the search will begin at the end of the list,
-    // reducing the amount of iterations needed. This effectively reduces searches
-    // to O(n / 2) iterations.
+    // This function effectively searches for a given node. The search starts
+    // at whichever is closest to the position: the head, the tail or the node
+    // of the last lookup. Looking up positions in order then takes only one
+    // step each.
     *result = NULL;
 
     if (list == NULL)
@@ -1557,32 +1941,144 @@ static Status dll_get_node_at(DoublyLinkedList list, DoublyLinkedNode *result, i
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    if (position <= list->length / 2)
+    integer_t i = 0;
+    integer_t distance = position;
+
+    (*result) = list->head;
+
+    if (list->length - 1 - position < distance)
     {
-        (*result) = list->head;
+        (*result) = list->tail;
 
-        for (integer_t i = 0; i < position; i++)
+        i = list->length - 1;
+        distance = i - position;
+    }
+
+    if (list->cursor != NULL && list->cursor_id == list->version_id)
+    {
+        integer_t from_cursor = list->cursor_position - position;
+
+        if (from_cursor < 0)
+            from_cursor = -from_cursor;
+
+        if (from_cursor < distance)
         {
-            if ((*result) == NULL)
-                return DS_ERR_ITER;
+            (*result) = list->cursor;
 
-            (*result) = (*result)->next;
+            i = list->cursor_position;
         }
     }
-    else
+
+    for (; i < position; i++)
     {
-        (*result) = list->tail;
+        if ((*result) == NULL)
+            return DS_ERR_ITER;
+
+        (*result) = (*result)->next;
+    }
+
+    for (; i > position; i--)
+    {
+        if ((*result) == NULL)
+            return DS_ERR_ITER;
+
+        (*result) = (*result)->prev;
+    }
+
+    list->cursor = *result;
+    list->cursor_position = position;
+    list->cursor_id = list->version_id;
 
-        for (integer_t i = list->length - 1; i > position; i--)
+    return DS_OK;
+}
+
+/// \brief Cuts the run of ordered nodes at the start of a chain.
+///
+/// Implementation detail. The run goes on while each element is less than or
+/// equal to the next one. If it starts with a strictly descending pair it
+/// goes on while elements keep strictly descending, and is then reversed,
+/// which doesn't break the sort's stability. Only \c next pointers are used.
+///
+/// \param[in] list DoublyLinkedList_s with the compare function.
+/// \param[in,out] run The first node of the chain and then the first node of
+/// the run, which ends with a \c NULL.
+///
+/// \return The rest of the chain after the run.
+static DoublyLinkedNode dll_cut_run(DoublyLinkedList list,
+        DoublyLinkedNode *run)
+{
+    DoublyLinkedNode last = *run, next = last->next;
+
+    if (next == NULL)
+        return NULL;
+
+    if (list->v_compare(last->data, next->data) <= 0)
+    {
+        while (next != NULL && list->v_compare(last->data, next->data) <= 0)
         {
-            if ((*result) == NULL)
-                return DS_ERR_ITER;
+            last = next;
+            next = next->next;
+        }
+
+        last->next = NULL;
+
+        return next;
+    }
+
+    // A descending run, reversed while it is found
+    DoublyLinkedNode head = *run;
+
+    head->next = NULL;
+
+    while (next != NULL && list->v_compare(last->data, next->data) > 0)
+    {
+        last = next;
+        next = next->next;
+
+        last->next = head;
+        head = last;
+    }
+
+    *run = head;
 
-            (*result) = (*result)->prev;
+    return next;
+}
+
+/// \brief Merges two sorted chains of nodes.
+///
+/// Implementation detail. Both chains end with a \c NULL and only their
+/// \c next pointers are used. On equal elements the ones from \c left come
+/// first.
+///
+/// \param[in] list DoublyLinkedList_s with the compare function.
+/// \param[in] left The chain with the elements that came first.
+/// \param[in] right The chain with the elements that came after.
+///
+/// \return The first node of the merged chain.
+static DoublyLinkedNode dll_merge_runs(DoublyLinkedList list,
+        DoublyLinkedNode left, DoublyLinkedNode right)
+{
+    DoublyLinkedNode head = NULL, *last = &head;
+
+    while (left != NULL && right != NULL)
+    {
+        if (list->v_compare(left->data, right->data) <= 0)
+        {
+            *last = left;
+            left = left->next;
+        }
+        else
+        {
+            *last = right;
+            right = right->next;
         }
+
+        last = &(*last)->next;
     }
 
-    return DS_OK;
+    *last = left != NULL ? left : right;
+
+    return head;
 }
 
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -74,8 +74,52 @@ dar_grow(DynamicArray_t *array, integer_t required_size);
 static void
 dar_quicksort(DynamicArray_t *array, void **buffer, integer_t size);
 
+static void
+dar_for_each_range(integer_t from, integer_t to, integer_t chunk,
+                   void *context);
+
+static void
+dar_map_range(integer_t from, integer_t to, integer_t chunk, void *context);
+
+static void
+dar_filter_count_range(integer_t from, integer_t to, integer_t chunk,
+                       void *context);
+
+static void
+dar_filter_copy_range(integer_t from, integer_t to, integer_t chunk,
+                      void *context);
+
+static void
+dar_reduce_range(integer_t from, integer_t to, integer_t chunk, void *context);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
+/// \brief Shared state of a parallel operation.
+///
+/// Implementation detail. Used as the context of tpl_parallel_for() by the
+/// parallel functions. Each chunk only writes to its own positions of
+/// \c result, \c mask, \c offsets and \c partials.
+struct DynamicArrayParallel_s
+{
+    DynamicArray_t *array;
+    DynamicArray_t *result;
+    foreach_f foreach;
+    map_f map;
+    predicate_f predicate;
+    reduce_f reduce;
+    void *context;
+
+    /// Which elements passed the predicate.
+    bool *mask;
+
+    /// Amount of matches of each chunk and later where each chunk starts.
+    integer_t *offsets;
+
+    /// One accumulator per chunk, each one \c result_size bytes long.
+    char *partials;
+    integer_t result_size;
+};
+
 /// Initializes a DynamicArray_s with an initial capacity of 32 and a growth
 /// rate of 200, that is, twice the size after each growth. This function does
 /// not sets any default functions. If you don't set them later you won't be
@@ -1043,6 +1087,265 @@ dar_sort(DynamicArray_t *array)
     array->version_id++;
 }
 
+/// Calls \c function for every element of the array, from the first to the
+/// last one. The function may change the element it receives but it must
+/// not change the array itself.
+///
+/// \param[in] array The target array.
+/// \param[in] function Function applied to each element.
+/// \param[in] context User context passed to \c function.
+void
+dar_for_each(DynamicArray_t *array, foreach_f function, void *context)
+{
+    for (integer_t i = 0; i < array->size; i++)
+        function(array->buffer[i], context);
+}
+
+/// Creates a new array where each element is the result of \c function on
+/// the element at the same position of the original array.
+///
+/// \param[in] array The target array.
+/// \param[in] interface Interface of the resulting array or NULL to use the
+/// same interface of \c array.
+/// \param[in] function Function that creates a new element from an existing
+/// one.
+/// \param[in] context User context passed to \c function.
+///
+/// \return A new DynamicArray_s or NULL if allocation failed.
+DynamicArray_t *
+dar_map(DynamicArray_t *array, Interface_t *interface, map_f function,
+        void *context)
+{
+    Interface_t *result_interface = interface ? interface : array->interface;
+
+    DynamicArray_t *result = dar_create(result_interface,
+            array->size > 0 ? array->size : 1, array->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    for (integer_t i = 0; i < array->size; i++)
+        result->buffer[i] = function(array->buffer[i], context);
+
+    result->size = array->size;
+
+    return result;
+}
+
+/// Creates a new array with a copy of every element that passes the test
+/// given by \c predicate, keeping their relative order.
+///
+/// \param[in] array The target array.
+/// \param[in] predicate The test applied to each element.
+/// \param[in] context User context passed to \c predicate.
+///
+/// \return A new DynamicArray_s or NULL if allocation failed.
+DynamicArray_t *
+dar_filter(DynamicArray_t *array, predicate_f predicate, void *context)
+{
+    DynamicArray_t *result = dar_create(array->interface,
+            array->size > 0 ? array->size : 1, array->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    for (integer_t i = 0; i < array->size; i++)
+    {
+        if (predicate(array->buffer[i], context))
+        {
+            result->buffer[result->size++] =
+                    array->interface->copy(array->buffer[i]);
+        }
+    }
+
+    return result;
+}
+
+/// Folds every element of the array, from the first to the last one, into
+/// \c result using \c function.
+///
+/// \param[in] array The target array.
+/// \param[in,out] result The accumulator, already initialized.
+/// \param[in] function Function that folds an element into the accumulator.
+/// \param[in] context User context passed to \c function.
+void
+dar_reduce(DynamicArray_t *array, void *result, reduce_f function,
+           void *context)
+{
+    for (integer_t i = 0; i < array->size; i++)
+        function(result, array->buffer[i], context);
+}
+
+/// Parallel version of dar_for_each(). The array is split in chunks that are
+/// processed by the threads of \c pool, so elements are not visited in
+/// order and \c function must be safe to be called concurrently.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] function Function applied to each element.
+/// \param[in] context User context passed to \c function.
+void
+dar_parallel_for_each(DynamicArray_t *array, ThreadPool_t *pool,
+                      foreach_f function, void *context)
+{
+    struct DynamicArrayParallel_s state = { .array = array,
+                                            .foreach = function,
+                                            .context = context };
+
+    tpl_parallel_for(pool, 0, array->size, 0, dar_for_each_range, &state);
+}
+
+/// Parallel version of dar_map(). Each element of the result is still placed
+/// at the same position of its original element.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] interface Interface of the resulting array or NULL to use the
+/// same interface of \c array.
+/// \param[in] function Function that creates a new element from an existing
+/// one. It must be safe to be called concurrently.
+/// \param[in] context User context passed to \c function.
+///
+/// \return A new DynamicArray_s or NULL if allocation failed.
+DynamicArray_t *
+dar_parallel_map(DynamicArray_t *array, ThreadPool_t *pool,
+                 Interface_t *interface, map_f function, void *context)
+{
+    Interface_t *result_interface = interface ? interface : array->interface;
+
+    DynamicArray_t *result = dar_create(result_interface,
+            array->size > 0 ? array->size : 1, array->growth_rate);
+
+    if (!result)
+        return NULL;
+
+    struct DynamicArrayParallel_s state = { .array = array,
+                                            .result = result,
+                                            .map = function,
+                                            .context = context };
+
+    tpl_parallel_for(pool, 0, array->size, 0, dar_map_range, &state);
+
+    result->size = array->size;
+
+    return result;
+}
+
+/// Parallel version of dar_filter(). It works in two passes: first each
+/// chunk tests its elements and counts how many passed, then, knowing where
+/// each chunk starts in the result, all chunks copy their elements. The
+/// relative order of the elements is kept.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in] predicate The test applied to each element. It must be safe to
+/// be called concurrently.
+/// \param[in] context User context passed to \c predicate.
+///
+/// \return A new DynamicArray_s or NULL if allocation failed.
+DynamicArray_t *
+dar_parallel_filter(DynamicArray_t *array, ThreadPool_t *pool,
+                    predicate_f predicate, void *context)
+{
+    integer_t chunks = tpl_chunks(pool, 0, array->size, 0);
+
+    bool *mask = malloc(sizeof(bool) * (size_t)(array->size + 1));
+    integer_t *offsets = calloc((size_t)(chunks + 1), sizeof(integer_t));
+
+    if (!mask || !offsets)
+    {
+        free(mask);
+        free(offsets);
+        return NULL;
+    }
+
+    struct DynamicArrayParallel_s state = { .array = array,
+                                            .predicate = predicate,
+                                            .context = context,
+                                            .mask = mask,
+                                            .offsets = offsets };
+
+    tpl_parallel_for(pool, 0, array->size, 0, dar_filter_count_range, &state);
+
+    // Exclusive prefix sum of how many elements passed in each chunk
+    integer_t total = 0;
+    for (integer_t c = 0; c < chunks; c++)
+    {
+        integer_t count = offsets[c];
+        offsets[c] = total;
+        total += count;
+    }
+
+    DynamicArray_t *result = dar_create(array->interface,
+            total > 0 ? total : 1, array->growth_rate);
+
+    if (result)
+    {
+        state.result = result;
+
+        tpl_parallel_for(pool, 0, array->size, 0, dar_filter_copy_range,
+                         &state);
+
+        result->size = total;
+    }
+
+    free(mask);
+    free(offsets);
+
+    return result;
+}
+
+/// Parallel version of dar_reduce(). Each chunk is folded into its own copy
+/// of the initial value of \c result and then all partial results are
+/// combined into \c result, in chunk order, using \c combine. Because of
+/// that the initial value of \c result must be the identity of the
+/// reduction (like 0 for a sum) and both \c function and \c combine must
+/// form an associative operation.
+///
+/// \param[in] array The target array.
+/// \param[in] pool The thread pool that processes the chunks.
+/// \param[in,out] result The accumulator, initialized with the identity
+/// value.
+/// \param[in] result_size The size in bytes of the accumulator.
+/// \param[in] function Function that folds an element into an accumulator.
+/// \param[in] combine Function that combines two accumulators.
+/// \param[in] context User context passed to \c function and \c combine.
+///
+/// \return True if the reduction was done or false if allocation failed.
+bool
+dar_parallel_reduce(DynamicArray_t *array, ThreadPool_t *pool, void *result,
+                    integer_t result_size, reduce_f function,
+                    combine_f combine, void *context)
+{
+    integer_t chunks = tpl_chunks(pool, 0, array->size, 0);
+
+    if (chunks == 0)
+        return true;
+
+    char *partials = malloc((size_t)(result_size * chunks));
+
+    if (!partials)
+        return false;
+
+    for (integer_t c = 0; c < chunks; c++)
+        memcpy(partials + c * result_size, result, (size_t)result_size);
+
+    struct DynamicArrayParallel_s state = { .array = array,
+                                            .reduce = function,
+                                            .context = context,
+                                            .partials = partials,
+                                            .result_size = result_size };
+
+    tpl_parallel_for(pool, 0, array->size, 0, dar_reduce_range, &state);
+
+    for (integer_t c = 0; c < chunks; c++)
+        combine(result, partials + c * result_size, context);
+
+    free(partials);
+
+    return true;
+}
+
 ///
 /// \param[in] array
 /// \param[in] display_mode
@@ -1089,6 +1392,78 @@ dar_display(DynamicArray_t *array, int display_mode)
     }
 }
 
+/// Saves the array's elements in order, each one encoded by the interface's
+/// codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] array The array to be saved.
+/// \param[in] serial The stream where the array is written to.
+///
+/// \return True if the array was saved or false if writing failed.
+bool
+dar_serialize(DynamicArray_t *array, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_DYNAMIC_ARRAY, 0, array->size))
+        return false;
+
+    for (integer_t i = 0; i < array->size; i++)
+    {
+        if (!ser_write_element(serial, array->interface->serialize,
+                               array->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with dar_serialize(). The buffer is grown only once
+/// to fit all elements.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] array An empty array.
+/// \param[in] serial The stream where the array is read from.
+///
+/// \return True if all elements were loaded. False if the array is not empty,
+/// if its capacity is locked and too small, if the stream is not a valid
+/// DynamicArray_s or if reading failed, in which case the array is left
+/// empty.
+bool
+dar_deserialize(DynamicArray_t *array, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!dar_empty(array))
+        return false;
+
+    if (!ser_read_header(serial, SER_DYNAMIC_ARRAY, &layout, &count))
+        return false;
+
+    if (array->capacity < count && !dar_grow(array, count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (!ser_read_element(serial, array->interface->deserialize,
+                              &array->buffer[i]))
+        {
+            dar_erase(array);
+            return false;
+        }
+
+        array->size++;
+    }
+
+    array->version_id++;
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 bool
@@ -1158,6 +1533,77 @@ dar_quicksort(DynamicArray_t *array, void **buffer, integer_t size)
     dar_quicksort(array, buffer + i, size - i);
 }
 
+static void
+dar_for_each_range(integer_t from, integer_t to, integer_t chunk,
+                   void *context)
+{
+    struct DynamicArrayParallel_s *state = context;
+
+    (void)chunk;
+
+    for (integer_t i = from; i < to; i++)
+        state->foreach(state->array->buffer[i], state->context);
+}
+
+static void
+dar_map_range(integer_t from, integer_t to, integer_t chunk, void *context)
+{
+    struct DynamicArrayParallel_s *state = context;
+
+    (void)chunk;
+
+    for (integer_t i = from; i < to; i++)
+        state->result->buffer[i] = state->map(state->array->buffer[i],
+                                              state->context);
+}
+
+static void
+dar_filter_count_range(integer_t from, integer_t to, integer_t chunk,
+                       void *context)
+{
+    struct DynamicArrayParallel_s *state = context;
+
+    integer_t count = 0;
+
+    for (integer_t i = from; i < to; i++)
+    {
+        state->mask[i] = state->predicate(state->array->buffer[i],
+                                          state->context);
+
+        if (state->mask[i])
+            count++;
+    }
+
+    state->offsets[chunk] = count;
+}
+
+static void
+dar_filter_copy_range(integer_t from, integer_t to, integer_t chunk,
+                      void *context)
+{
+    struct DynamicArrayParallel_s *state = context;
+
+    integer_t j = state->offsets[chunk];
+
+    for (integer_t i = from; i < to; i++)
+    {
+        if (state->mask[i])
+            state->result->buffer[j++] =
+                    state->array->interface->copy(state->array->buffer[i]);
+    }
+}
+
+static void
+dar_reduce_range(integer_t from, integer_t to, integer_t chunk, void *context)
+{
+    struct DynamicArrayParallel_s *state = context;
+
+    void *partial = state->partials + chunk * state->result_size;
+
+    for (integer_t i = from; i < to; i++)
+        state->reduce(partial, state->array->buffer[i], state->context);
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1188,6 +1634,10 @@ struct DynamicArrayIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t dar_iter_size = sizeof(DynamicArrayIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool dar_iter_target_modified(DynamicArrayIterator_t *iter);
@@ -1213,6 +1663,24 @@ dar_iter_new(DynamicArray_t *target)
     return iter;
 }
 
+///
+/// \param[in,out] iter
+/// \param[in] target
+///
+/// \return
+bool
+dar_iter_init(DynamicArrayIterator_t *iter, DynamicArray_t *target)
+{
+    if (dar_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
 ///
 /// \param[in] iter
 /// \param[in] target
@@ -1259,7 +1727,7 @@ dar_iter_prev(DynamicArrayIterator_t *iter)
     if (dar_iter_target_modified(iter))
         return false;
 
-    if (!dar_iter_has_next(iter))
+    if (!dar_iter_has_prev(iter))
         return false;
 
     iter->cursor--;
@@ -0,0 +1,712 @@
+/**
+ * @file ExternalSort.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ExternalSort.h"
+#include "DynamicArray.h"
+#include "Heap.h"
+#include <unistd.h>
+
+/// An ExternalSort_s sorts more elements than fit in memory. Elements are
+/// added one by one with exs_add() and kept in a DynamicArray_s until the
+/// memory budget is reached; then that run is sorted with dar_sort(), saved
+/// to a temporary file and freed. After exs_finish() the runs are merged and
+/// exs_next() gives back every element in ascending order.
+///
+/// The merge keeps one cursor per run in a MinHeap ordered by each cursor's
+/// current element, so taking an element costs O(log k) comparisons for k
+/// runs. Every cursor reads its run through a buffered stream of
+/// \c SER_CHUNK bytes, so if there are more runs than the memory budget can
+/// buffer at once they are first merged into bigger runs, \c fan_in at a
+/// time.
+///
+/// The memory used by the elements themselves is estimated by the size of
+/// their encoding plus a pointer each, since that's the only size the
+/// interface knows about. Elements are written to the runs with the
+/// interface's codec, so any type that can be serialized can be sorted.
+///
+/// If nothing was spilled by the time exs_finish() is called the elements
+/// are just sorted in memory and no file is ever created.
+///
+/// \par Functions
+/// Located in the file ExternalSort.c
+struct ExternalSort_s
+{
+    /// \brief Elements of the current run.
+    DynamicArray_t *run;
+
+    /// \brief Estimated bytes used by the current run.
+    size_t used;
+
+    /// \brief Memory budget in bytes.
+    size_t memory;
+
+    /// \brief Maximum amount of runs merged at once.
+    integer_t fan_in;
+
+    /// \brief Next element of \c run taken by exs_next() when nothing was
+    /// spilled.
+    integer_t position;
+
+    /// \brief Runs spilled to temporary files, in the order they were made.
+    struct ExternalSortRun_s *runs;
+
+    /// \brief Amount of runs.
+    integer_t runs_count;
+
+    /// \brief Capacity of \c runs.
+    integer_t runs_capacity;
+
+    /// \brief Cursors of the merge in progress, ordered by their element.
+    Heap_t *heap;
+
+    /// \brief Cursors of the merge in progress.
+    struct ExternalSortCursor_s *cursors;
+
+    /// \brief Amount of cursors.
+    integer_t cursors_count;
+
+    /// \brief Interface of \c heap, that compares two cursors.
+    Interface_t *cursor_interface;
+
+    /// \brief Amount of elements added.
+    integer_t count;
+
+    /// \brief If exs_finish() was called.
+    bool finished;
+
+    /// \brief Set by the first operation that fails.
+    bool failed;
+
+    /// \brief ExternalSort_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A sorted run saved to a temporary file.
+///
+/// Implementation detail.
+struct ExternalSortRun_s
+{
+    /// \brief The temporary file, deleted when closed.
+    FILE *file;
+
+    /// \brief Amount of elements in the run.
+    integer_t count;
+};
+
+/// \brief Reads a run during a merge.
+///
+/// Implementation detail.
+struct ExternalSortCursor_s
+{
+    /// \brief The sorter, to reach the element compare function.
+    ExternalSort_t *sorter;
+
+    /// \brief Stream over the run's file.
+    Serial_t *serial;
+
+    /// \brief Elements not read yet.
+    integer_t left;
+
+    /// \brief Current element or NULL if it was taken.
+    void *element;
+};
+
+typedef struct ExternalSortCursor_s ExternalSortCursor_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static int
+exs_cursor_compare(const void *cursor1, const void *cursor2);
+
+static bool
+exs_cursor_advance(ExternalSortCursor_t *cursor);
+
+static bool
+exs_spill(ExternalSort_t *sorter);
+
+static bool
+exs_merge_open(ExternalSort_t *sorter, integer_t amount);
+
+static bool
+exs_merge_next(ExternalSort_t *sorter, void **result);
+
+static void
+exs_merge_close(ExternalSort_t *sorter);
+
+static bool
+exs_merge_runs(ExternalSort_t *sorter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// A budget smaller than two stream buffers still works but every merge will
+/// have only two runs.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] interface An interface defining all necessary functions for the
+/// sorter to operate.
+/// \param[in] memory Memory budget in bytes.
+///
+/// \return A new ExternalSort_s or NULL if allocation failed.
+ExternalSort_t *
+exs_new(Interface_t *interface, size_t memory)
+{
+    ExternalSort_t *sorter = malloc(sizeof(ExternalSort_t));
+
+    if (!sorter)
+        return NULL;
+
+    sorter->run = dar_new(interface);
+    sorter->cursor_interface = interface_new(exs_cursor_compare, NULL, NULL,
+                                             NULL, NULL, NULL);
+
+    if (!sorter->run || !sorter->cursor_interface)
+    {
+        if (sorter->run)
+            dar_free_shallow(sorter->run);
+        if (sorter->cursor_interface)
+            interface_free(sorter->cursor_interface);
+
+        free(sorter);
+
+        return NULL;
+    }
+
+    sorter->used = 0;
+    sorter->memory = memory;
+    sorter->fan_in = (integer_t)(memory / SER_CHUNK);
+    sorter->position = 0;
+    sorter->runs = NULL;
+    sorter->runs_count = 0;
+    sorter->runs_capacity = 0;
+    sorter->heap = NULL;
+    sorter->cursors = NULL;
+    sorter->cursors_count = 0;
+    sorter->count = 0;
+    sorter->finished = false;
+    sorter->failed = false;
+    sorter->interface = interface;
+
+    if (sorter->fan_in < 2)
+        sorter->fan_in = 2;
+
+    return sorter;
+}
+
+/// Elements that were not taken with exs_next() are freed and the temporary
+/// files are deleted.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] sorter The sorter to be freed from memory.
+void
+exs_free(ExternalSort_t *sorter)
+{
+    if (sorter->heap)
+        exs_merge_close(sorter);
+
+    for (integer_t i = 0; i < sorter->runs_count; i++)
+        fclose(sorter->runs[i].file);
+
+    for (integer_t i = sorter->position; i < dar_size(sorter->run); i++)
+        sorter->interface->free(dar_get(sorter->run, i));
+
+    dar_free_shallow(sorter->run);
+    interface_free(sorter->cursor_interface);
+
+    free(sorter->runs);
+    free(sorter);
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] sorter The target sorter.
+///
+/// \return The amount of elements added to the sorter.
+integer_t
+exs_count(ExternalSort_t *sorter)
+{
+    return sorter->count;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] sorter The target sorter.
+///
+/// \return The amount of runs currently saved in temporary files.
+integer_t
+exs_runs(ExternalSort_t *sorter)
+{
+    return sorter->runs_count;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] sorter The target sorter.
+///
+/// \return True if any operation failed. A failed sorter refuses every
+/// further operation.
+bool
+exs_failed(ExternalSort_t *sorter)
+{
+    return sorter->failed;
+}
+
+/// The sorter takes ownership of the element. If adding it would go past the
+/// memory budget the current run is sorted and saved to a temporary file
+/// first.
+///
+/// \par Interface Requirements
+/// - compare
+/// - serialize
+/// - free
+///
+/// \param[in] sorter The target sorter.
+/// \param[in] element The element to be sorted. Must not be NULL.
+///
+/// \return True if the element was added. False if exs_finish() was already
+/// called or if the sorter failed, in which case the element still belongs to
+/// the caller.
+bool
+exs_add(ExternalSort_t *sorter, void *element)
+{
+    if (sorter->finished || sorter->failed || element == NULL)
+        return false;
+
+    size_t size = sorter->interface->serialize(element, NULL, 0) +
+                  sizeof(void *);
+
+    if (!dar_empty(sorter->run) && sorter->used + size > sorter->memory)
+    {
+        if (!exs_spill(sorter))
+            return false;
+    }
+
+    if (!dar_insert_back(sorter->run, element))
+    {
+        sorter->failed = true;
+        return false;
+    }
+
+    sorter->used += size;
+    sorter->count++;
+
+    return true;
+}
+
+/// No element can be added after this. If runs were spilled the last one is
+/// spilled too and, while there are more runs than \c fan_in, the oldest runs
+/// are merged into bigger ones.
+///
+/// \par Interface Requirements
+/// - compare
+/// - serialize
+/// - deserialize
+/// - free
+///
+/// \param[in] sorter The target sorter.
+///
+/// \return True if the elements are ready to be taken with exs_next().
+bool
+exs_finish(ExternalSort_t *sorter)
+{
+    if (sorter->finished || sorter->failed)
+        return false;
+
+    sorter->finished = true;
+
+    if (sorter->runs_count == 0)
+    {
+        dar_sort(sorter->run);
+
+        return true;
+    }
+
+    if (!dar_empty(sorter->run) && !exs_spill(sorter))
+        return false;
+
+    while (sorter->runs_count > sorter->fan_in)
+    {
+        if (!exs_merge_runs(sorter))
+            return false;
+    }
+
+    return exs_merge_open(sorter, sorter->runs_count);
+}
+
+/// The caller takes ownership of the element.
+///
+/// \par Interface Requirements
+/// - compare
+/// - deserialize
+///
+/// \param[in] sorter The target sorter.
+/// \param[out] result The next element in ascending order.
+///
+/// \return True if an element was taken. False if every element was already
+/// taken, if exs_finish() was not called or if reading a run failed, which
+/// can be told apart with exs_failed().
+bool
+exs_next(ExternalSort_t *sorter, void **result)
+{
+    *result = NULL;
+
+    if (!sorter->finished || sorter->failed)
+        return false;
+
+    if (sorter->heap)
+        return exs_merge_next(sorter, result);
+
+    if (sorter->position == dar_size(sorter->run))
+        return false;
+
+    *result = dar_get(sorter->run, sorter->position++);
+
+    return true;
+}
+
+/// Reads a DynamicArray_s saved with dar_serialize() and writes its elements
+/// sorted in the same format, so the output can be loaded with
+/// dar_deserialize() or sorted again. Only \c memory bytes worth of elements
+/// are kept in memory at a time.
+///
+/// \par Interface Requirements
+/// - compare
+/// - serialize
+/// - deserialize
+/// - free
+///
+/// \param[in] input The stream with the elements to be sorted.
+/// \param[in] output The stream where the sorted elements are written to.
+/// \param[in] interface The element's interface.
+/// \param[in] memory Memory budget in bytes.
+///
+/// \return True if every element was sorted and written. False if the input
+/// is not a valid DynamicArray_s or has NULL elements, or if allocation or
+/// any stream operation failed.
+bool
+exs_sort(Serial_t *input, Serial_t *output, Interface_t *interface,
+         size_t memory)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!ser_read_header(input, SER_DYNAMIC_ARRAY, &layout, &count))
+        return false;
+
+    ExternalSort_t *sorter = exs_new(interface, memory);
+
+    if (!sorter)
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(input, interface->deserialize, &element))
+            goto error;
+
+        if (!exs_add(sorter, element))
+        {
+            if (element)
+                interface->free(element);
+
+            goto error;
+        }
+    }
+
+    if (!exs_finish(sorter))
+        goto error;
+
+    if (!ser_write_header(output, SER_DYNAMIC_ARRAY, 0, count))
+        goto error;
+
+    void *element;
+    integer_t written = 0;
+
+    while (exs_next(sorter, &element))
+    {
+        bool success = ser_write_element(output, interface->serialize,
+                                         element);
+
+        interface->free(element);
+
+        if (!success)
+            goto error;
+
+        written++;
+    }
+
+    if (written != count)
+        goto error;
+
+    exs_free(sorter);
+
+    return true;
+
+    error:
+    exs_free(sorter);
+    return false;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Orders cursors by their current element
+static int
+exs_cursor_compare(const void *cursor1, const void *cursor2)
+{
+    const ExternalSortCursor_t *c1 = cursor1;
+    const ExternalSortCursor_t *c2 = cursor2;
+
+    return c1->sorter->interface->compare(c1->element, c2->element);
+}
+
+// Reads the next element of a cursor's run. Returns false if the run ended
+// or if reading failed, which also fails the sorter.
+static bool
+exs_cursor_advance(ExternalSortCursor_t *cursor)
+{
+    cursor->element = NULL;
+
+    if (cursor->left == 0)
+        return false;
+
+    cursor->left--;
+
+    deserialize_f deserialize = cursor->sorter->interface->deserialize;
+
+    if (!ser_read_element(cursor->serial, deserialize, &cursor->element) ||
+        cursor->element == NULL)
+    {
+        cursor->sorter->failed = true;
+        return false;
+    }
+
+    return true;
+}
+
+// Sorts the current run, writes it to a new temporary file and frees its
+// elements
+static bool
+exs_spill(ExternalSort_t *sorter)
+{
+    if (sorter->runs_count == sorter->runs_capacity)
+    {
+        integer_t capacity = sorter->runs_capacity * 2 + 4;
+
+        struct ExternalSortRun_s *runs = realloc(sorter->runs,
+                sizeof(struct ExternalSortRun_s) * (size_t)capacity);
+
+        if (!runs)
+        {
+            sorter->failed = true;
+            return false;
+        }
+
+        sorter->runs = runs;
+        sorter->runs_capacity = capacity;
+    }
+
+    dar_sort(sorter->run);
+
+    FILE *file = tmpfile();
+    Serial_t *serial = file ? ser_new_fd(fileno(file)) : NULL;
+
+    if (!serial)
+    {
+        if (file)
+            fclose(file);
+
+        sorter->failed = true;
+        return false;
+    }
+
+    serialize_f serialize = sorter->interface->serialize;
+    integer_t count = dar_size(sorter->run);
+
+    for (integer_t i = 0; i < count; i++)
+        ser_write_element(serial, serialize, dar_get(sorter->run, i));
+
+    // Write failures are sticky so they are only checked once here
+    if (!ser_free(serial))
+    {
+        fclose(file);
+
+        sorter->failed = true;
+        return false;
+    }
+
+    sorter->runs[sorter->runs_count].file = file;
+    sorter->runs[sorter->runs_count].count = count;
+    sorter->runs_count++;
+
+    dar_erase(sorter->run);
+    sorter->used = 0;
+
+    return true;
+}
+
+// Starts merging the first runs. Every run is read from the start.
+static bool
+exs_merge_open(ExternalSort_t *sorter, integer_t amount)
+{
+    sorter->heap = hep_create(sorter->cursor_interface, amount, 200, MinHeap);
+    sorter->cursors = malloc(sizeof(ExternalSortCursor_t) * (size_t)amount);
+    sorter->cursors_count = 0;
+
+    if (!sorter->heap || !sorter->cursors)
+    {
+        exs_merge_close(sorter);
+
+        sorter->failed = true;
+        return false;
+    }
+
+    for (integer_t i = 0; i < amount; i++)
+    {
+        int fd = fileno(sorter->runs[i].file);
+
+        ExternalSortCursor_t *cursor = &sorter->cursors[i];
+
+        cursor->sorter = sorter;
+        cursor->left = sorter->runs[i].count;
+        cursor->element = NULL;
+        cursor->serial = lseek(fd, 0, SEEK_SET) == 0 ? ser_new_fd(fd) : NULL;
+
+        if (!cursor->serial)
+        {
+            exs_merge_close(sorter);
+
+            sorter->failed = true;
+            return false;
+        }
+
+        sorter->cursors_count++;
+
+        if (exs_cursor_advance(cursor))
+            hep_insert(sorter->heap, cursor);
+        else if (sorter->failed)
+        {
+            exs_merge_close(sorter);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Takes the smallest element among all cursors and advances its cursor
+static bool
+exs_merge_next(ExternalSort_t *sorter, void **result)
+{
+    ExternalSortCursor_t *cursor;
+
+    if (!hep_remove(sorter->heap, (void **)&cursor))
+        return false;
+
+    *result = cursor->element;
+
+    if (exs_cursor_advance(cursor))
+        hep_insert(sorter->heap, cursor);
+
+    return true;
+}
+
+// Closes every cursor, freeing the elements they still hold
+static void
+exs_merge_close(ExternalSort_t *sorter)
+{
+    for (integer_t i = 0; i < sorter->cursors_count; i++)
+    {
+        if (sorter->cursors[i].element)
+            sorter->interface->free(sorter->cursors[i].element);
+
+        ser_free(sorter->cursors[i].serial);
+    }
+
+    if (sorter->heap)
+        hep_free_shallow(sorter->heap);
+
+    free(sorter->cursors);
+
+    sorter->heap = NULL;
+    sorter->cursors = NULL;
+    sorter->cursors_count = 0;
+}
+
+// Merges the oldest fan_in runs into a new run at the end
+static bool
+exs_merge_runs(ExternalSort_t *sorter)
+{
+    integer_t amount = sorter->fan_in;
+
+    if (!exs_merge_open(sorter, amount))
+        return false;
+
+    FILE *file = tmpfile();
+    Serial_t *serial = file ? ser_new_fd(fileno(file)) : NULL;
+
+    if (!serial)
+    {
+        if (file)
+            fclose(file);
+
+        exs_merge_close(sorter);
+
+        sorter->failed = true;
+        return false;
+    }
+
+    serialize_f serialize = sorter->interface->serialize;
+    integer_t count = 0;
+    void *element;
+
+    while (exs_merge_next(sorter, &element))
+    {
+        ser_write_element(serial, serialize, element);
+
+        sorter->interface->free(element);
+
+        count++;
+    }
+
+    exs_merge_close(sorter);
+
+    if (!ser_free(serial) || sorter->failed)
+    {
+        fclose(file);
+
+        sorter->failed = true;
+        return false;
+    }
+
+    for (integer_t i = 0; i < amount; i++)
+        fclose(sorter->runs[i].file);
+
+    sorter->runs_count -= amount;
+
+    memmove(sorter->runs, sorter->runs + amount,
+            sizeof(struct ExternalSortRun_s) * (size_t)sorter->runs_count);
+
+    // There is always room since at least two runs were just removed
+    sorter->runs[sorter->runs_count].file = file;
+    sorter->runs[sorter->runs_count].count = count;
+    sorter->runs_count++;
+
+    return true;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,717 @@
+/**
+ * @file FibonacciHeap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "FibonacciHeap.h"
+#include "NodePool.h"
+
+/// \brief Bound on the degree of any node.
+///
+/// A node of degree \c d has at least <code> F(d + 2) </code> descendants, so
+/// with at most <code> 2^63 </code> elements no degree reaches 92.
+#define FBH_MAX_DEGREE 96
+
+/// A Fibonacci heap is a collection of heap-ordered trees whose roots are
+/// kept in a circular doubly-linked list, with \c root pointing to the one
+/// with the highest priority. Every list of children is also circular.
+///
+/// Inserting an element and melding two heaps only add roots to the list, in
+/// constant time. Removing the root moves its children to the root list and
+/// then consolidates it, linking roots of the same degree until every degree
+/// appears once, which takes <code> O(log n) </code> amortized time.
+///
+/// When an element gains priority through its handle (decrease-key in a
+/// MinHeap) and becomes better than its parent, it is cut and moved to the
+/// root list. A parent that loses a second child is cut as well (a cascading
+/// cut), which keeps the trees bushy enough for the degree bound and makes
+/// decrease-key take <code> O(1) </code> amortized time.
+///
+/// Nodes come from a NodePool_s so inserting and removing elements rarely
+/// calls malloc() or free(). Melding two heaps also moves the nodes of the
+/// other pool.
+///
+/// Just like Heap_s, the interface's \c compare function is used and its
+/// result is multiplied by the HeapKind, so in a MaxHeap the root is the
+/// greatest element and in a MinHeap the root is the lowest element.
+struct FibonacciHeap_s
+{
+    /// \brief What kind of heap this is.
+    ///
+    ///  1 - Max-Heap
+    /// -1 - Min-Heap
+    enum HeapKind_e kind;
+
+    /// \brief The root with the highest priority.
+    struct FibonacciHeapNode_s *root;
+
+    /// \brief Current amount of elements in the heap.
+    integer_t count;
+
+    /// \brief Where nodes are allocated from.
+    struct NodePool_s *pool;
+
+    /// \brief FibonacciHeap_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A FibonacciHeap_s node.
+///
+/// Implementation detail. Siblings are kept in a circular doubly-linked
+/// list.
+struct FibonacciHeapNode_s
+{
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief The parent of this node or NULL if it is a root.
+    struct FibonacciHeapNode_s *parent;
+
+    /// \brief Any of the children of this node.
+    struct FibonacciHeapNode_s *child;
+
+    /// \brief The left sibling of this node.
+    struct FibonacciHeapNode_s *left;
+
+    /// \brief The right sibling of this node.
+    struct FibonacciHeapNode_s *right;
+
+    /// \brief Amount of children of this node.
+    integer_t degree;
+
+    /// \brief If this node lost a child since it became a child itself.
+    bool marked;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+fbh_better(FibonacciHeap_t *heap, FibonacciHeapNode_t *first,
+           FibonacciHeapNode_t *second);
+
+static void
+fbh_splice(FibonacciHeapNode_t *first, FibonacciHeapNode_t *second);
+
+static void
+fbh_cut(FibonacciHeap_t *heap, FibonacciHeapNode_t *node);
+
+static void
+fbh_cascading_cut(FibonacciHeap_t *heap, FibonacciHeapNode_t *node);
+
+static void
+fbh_consolidate(FibonacciHeap_t *heap);
+
+static void
+fbh_free_nodes(FibonacciHeap_t *heap, bool elements);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty FibonacciHeap_s.
+///
+/// \param[in] interface An interface with a compare function.
+/// \param[in] kind If it is a MaxHeap or a MinHeap.
+///
+/// \return A new FibonacciHeap_s or NULL if the kind is not valid or if
+/// allocation failed.
+FibonacciHeap_t *
+fbh_new(Interface_t *interface, HeapKind kind)
+{
+    if (!(kind == MaxHeap || kind == MinHeap))
+        return NULL;
+
+    FibonacciHeap_t *heap = malloc(sizeof(FibonacciHeap_t));
+
+    if (!heap)
+        return NULL;
+
+    heap->pool = npl_new(sizeof(FibonacciHeapNode_t));
+
+    if (!heap->pool)
+    {
+        free(heap);
+        return NULL;
+    }
+
+    heap->kind = kind;
+    heap->root = NULL;
+    heap->count = 0;
+    heap->interface = interface;
+
+    return heap;
+}
+
+/// Frees the heap, all of its nodes and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+fbh_free(FibonacciHeap_t *heap)
+{
+    fbh_free_nodes(heap, true);
+
+    npl_free(heap->pool);
+    free(heap);
+}
+
+/// Frees the heap and all of its nodes, leaving the elements intact.
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+fbh_free_shallow(FibonacciHeap_t *heap)
+{
+    fbh_free_nodes(heap, false);
+
+    npl_free(heap->pool);
+    free(heap);
+}
+
+/// Frees every node and element, leaving the heap empty. All handles become
+/// invalid.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be erased.
+void
+fbh_erase(FibonacciHeap_t *heap)
+{
+    fbh_free_nodes(heap, true);
+}
+
+/// Frees every node, leaving the heap empty and the elements intact. All
+/// handles become invalid.
+///
+/// \param[in] heap The heap to be erased.
+void
+fbh_erase_shallow(FibonacciHeap_t *heap)
+{
+    fbh_free_nodes(heap, false);
+}
+
+/// \param[in] heap The target heap.
+/// \param[in] new_interface The new interface.
+void
+fbh_config(FibonacciHeap_t *heap, Interface_t *new_interface)
+{
+    heap->interface = new_interface;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The amount of elements in the heap.
+integer_t
+fbh_count(FibonacciHeap_t *heap)
+{
+    return heap->count;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return If the heap is a MaxHeap or a MinHeap.
+HeapKind
+fbh_kind(FibonacciHeap_t *heap)
+{
+    return heap->kind;
+}
+
+/// \param[in] handle A handle returned by fbh_insert().
+///
+/// \return The element referenced by the handle.
+void *
+fbh_element(FibonacciHeapNode_t *handle)
+{
+    return handle->data;
+}
+
+/// Inserts an element in constant time by adding a new root to the root
+/// list. A handle to the element can be retrieved to later change its
+/// priority or to remove it; it stays valid until the element leaves the
+/// heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] element The element to be inserted.
+/// \param[out] handle A handle to the element. Can be NULL.
+///
+/// \return True if the element was inserted, false if allocation failed.
+bool
+fbh_insert(FibonacciHeap_t *heap, void *element, FibonacciHeapNode_t **handle)
+{
+    FibonacciHeapNode_t *node = npl_alloc(heap->pool);
+
+    if (!node)
+        return false;
+
+    node->data = element;
+    node->parent = NULL;
+    node->child = NULL;
+    node->left = node;
+    node->right = node;
+    node->degree = 0;
+    node->marked = false;
+
+    if (heap->root)
+    {
+        fbh_splice(heap->root, node);
+
+        if (fbh_better(heap, node, heap->root))
+            heap->root = node;
+    }
+    else
+    {
+        heap->root = node;
+    }
+
+    heap->count++;
+
+    if (handle)
+        *handle = node;
+
+    return true;
+}
+
+/// Removes the root element, moves its children to the root list and
+/// consolidates the root list.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[out] result The element with the highest priority.
+///
+/// \return True if an element was removed, false if the heap is empty.
+bool
+fbh_remove(FibonacciHeap_t *heap, void **result)
+{
+    if (fbh_empty(heap))
+        return false;
+
+    FibonacciHeapNode_t *root = heap->root;
+
+    *result = root->data;
+
+    if (root->child)
+    {
+        FibonacciHeapNode_t *child = root->child;
+
+        do
+        {
+            child->parent = NULL;
+            child = child->right;
+        } while (child != root->child);
+
+        fbh_splice(root, root->child);
+    }
+
+    if (root->right == root)
+    {
+        heap->root = NULL;
+    }
+    else
+    {
+        root->left->right = root->right;
+        root->right->left = root->left;
+
+        heap->root = root->right;
+
+        fbh_consolidate(heap);
+    }
+
+    heap->count--;
+
+    npl_release(heap->pool, root);
+
+    return true;
+}
+
+/// Removes any element of the heap given its handle. The node is cut from
+/// its parent as if it had the highest priority and then removed as the
+/// root.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+/// \param[out] result The element referenced by the handle.
+///
+/// \return True if the element was removed, false if the heap is empty.
+bool
+fbh_delete(FibonacciHeap_t *heap, FibonacciHeapNode_t *handle, void **result)
+{
+    if (fbh_empty(heap))
+        return false;
+
+    FibonacciHeapNode_t *parent = handle->parent;
+
+    if (parent)
+    {
+        fbh_cut(heap, handle);
+        fbh_cascading_cut(heap, parent);
+    }
+
+    heap->root = handle;
+
+    return fbh_remove(heap, result);
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The element with the highest priority or NULL if the heap is
+/// empty.
+void *
+fbh_peek(FibonacciHeap_t *heap)
+{
+    if (fbh_empty(heap))
+        return NULL;
+
+    return heap->root->data;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return True if the heap is empty, otherwise false.
+bool
+fbh_empty(FibonacciHeap_t *heap)
+{
+    return heap->count == 0;
+}
+
+/// Restores the heap after an element referenced by a handle gained
+/// priority, that is, it was decreased in a MinHeap or increased in a
+/// MaxHeap. If the element is now better than its parent it is cut to the
+/// root list in constant amortized time. An element that lost priority must
+/// be removed with fbh_delete() and inserted again.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+///
+/// \return True if the operation was successful, false if the heap is
+/// empty.
+bool
+fbh_decrease_key(FibonacciHeap_t *heap, FibonacciHeapNode_t *handle)
+{
+    if (fbh_empty(heap))
+        return false;
+
+    FibonacciHeapNode_t *parent = handle->parent;
+
+    if (parent && fbh_better(heap, handle, parent))
+    {
+        fbh_cut(heap, handle);
+        fbh_cascading_cut(heap, parent);
+    }
+
+    if (fbh_better(heap, handle, heap->root))
+        heap->root = handle;
+
+    return true;
+}
+
+/// Moves every element of \c other into \c heap in constant time, leaving
+/// \c other empty. The handles to the elements of \c other stay valid and
+/// now belong to \c heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The heap that receives the elements.
+/// \param[in] other The heap to be emptied.
+///
+/// \return True if the heaps were melded, false if they are the same heap or
+/// if they are not of the same kind.
+bool
+fbh_meld(FibonacciHeap_t *heap, FibonacciHeap_t *other)
+{
+    if (heap == other || heap->kind != other->kind)
+        return false;
+
+    npl_merge(heap->pool, other->pool);
+
+    if (fbh_empty(other))
+        return true;
+
+    if (heap->root)
+    {
+        fbh_splice(heap->root, other->root);
+
+        if (fbh_better(heap, other->root, heap->root))
+            heap->root = other->root;
+    }
+    else
+    {
+        heap->root = other->root;
+    }
+
+    heap->count += other->count;
+
+    other->root = NULL;
+    other->count = 0;
+
+    return true;
+}
+
+/// Displays every tree of the heap where each child is indented below its
+/// parent.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] heap The heap to be displayed.
+void
+fbh_display(FibonacciHeap_t *heap)
+{
+    if (fbh_empty(heap))
+    {
+        printf("\nFibonacci Heap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nFibonacci Heap\n");
+
+    // Iterative pre-order traversal, climbing back through the parents
+    FibonacciHeapNode_t *node = heap->root;
+    integer_t depth = 0;
+
+    while (node)
+    {
+        for (integer_t i = 0; i < depth; i++)
+            printf("|  ");
+
+        heap->interface->display(node->data);
+        printf("\n");
+
+        if (node->child)
+        {
+            node = node->child;
+            depth++;
+
+            continue;
+        }
+
+        while (node)
+        {
+            FibonacciHeapNode_t *first =
+                    node->parent ? node->parent->child : heap->root;
+
+            if (node->right != first)
+            {
+                node = node->right;
+                break;
+            }
+
+            node = node->parent;
+            depth--;
+        }
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Returns true if the first node has a higher priority than the second
+static bool
+fbh_better(FibonacciHeap_t *heap, FibonacciHeapNode_t *first,
+           FibonacciHeapNode_t *second)
+{
+    return heap->interface->compare(first->data, second->data) *
+           heap->kind > 0;
+}
+
+// Joins two circular lists into a single one
+static void
+fbh_splice(FibonacciHeapNode_t *first, FibonacciHeapNode_t *second)
+{
+    FibonacciHeapNode_t *first_right = first->right;
+    FibonacciHeapNode_t *second_left = second->left;
+
+    first->right = second;
+    second->left = first;
+
+    second_left->right = first_right;
+    first_right->left = second_left;
+}
+
+// Moves a node with a parent to the root list
+static void
+fbh_cut(FibonacciHeap_t *heap, FibonacciHeapNode_t *node)
+{
+    FibonacciHeapNode_t *parent = node->parent;
+
+    if (node->right == node)
+    {
+        parent->child = NULL;
+    }
+    else
+    {
+        node->left->right = node->right;
+        node->right->left = node->left;
+
+        if (parent->child == node)
+            parent->child = node->right;
+    }
+
+    parent->degree--;
+
+    node->parent = NULL;
+    node->marked = false;
+    node->left = node;
+    node->right = node;
+
+    fbh_splice(heap->root, node);
+}
+
+// Cuts the ancestors of a node that already lost a child, marking the first
+// one that didn't
+static void
+fbh_cascading_cut(FibonacciHeap_t *heap, FibonacciHeapNode_t *node)
+{
+    FibonacciHeapNode_t *parent = node->parent;
+
+    while (parent)
+    {
+        if (!node->marked)
+        {
+            node->marked = true;
+            return;
+        }
+
+        fbh_cut(heap, node);
+
+        node = parent;
+        parent = node->parent;
+    }
+}
+
+// Links roots of the same degree until every degree appears once and finds
+// the new root with the highest priority
+static void
+fbh_consolidate(FibonacciHeap_t *heap)
+{
+    FibonacciHeapNode_t *degrees[FBH_MAX_DEGREE] = { NULL };
+    integer_t max_degree = 0;
+
+    // Break the circular root list so it can be consumed from its start
+    FibonacciHeapNode_t *node = heap->root;
+
+    node->left->right = NULL;
+
+    while (node)
+    {
+        FibonacciHeapNode_t *tree = node;
+
+        node = node->right;
+
+        tree->left = tree;
+        tree->right = tree;
+
+        integer_t degree = tree->degree;
+
+        while (degrees[degree])
+        {
+            FibonacciHeapNode_t *other = degrees[degree];
+
+            if (fbh_better(heap, other, tree))
+            {
+                FibonacciHeapNode_t *temp = tree;
+                tree = other;
+                other = temp;
+            }
+
+            // Link the other tree below this one
+            other->parent = tree;
+            other->marked = false;
+
+            if (tree->child)
+                fbh_splice(tree->child, other);
+            else
+                tree->child = other;
+
+            tree->degree++;
+
+            degrees[degree] = NULL;
+            degree++;
+        }
+
+        degrees[degree] = tree;
+
+        if (degree > max_degree)
+            max_degree = degree;
+    }
+
+    heap->root = NULL;
+
+    for (integer_t i = 0; i <= max_degree; i++)
+    {
+        if (!degrees[i])
+            continue;
+
+        if (!heap->root)
+        {
+            heap->root = degrees[i];
+        }
+        else
+        {
+            fbh_splice(heap->root, degrees[i]);
+
+            if (fbh_better(heap, degrees[i], heap->root))
+                heap->root = degrees[i];
+        }
+    }
+}
+
+// Frees every element if asked to and gives all nodes back to the pool. The
+// nodes are visited through a stack threaded in their parent pointers.
+static void
+fbh_free_nodes(FibonacciHeap_t *heap, bool elements)
+{
+    if (elements && heap->root)
+    {
+        FibonacciHeapNode_t *stack = NULL;
+        FibonacciHeapNode_t *node = heap->root;
+
+        do
+        {
+            node->parent = stack;
+            stack = node;
+            node = node->right;
+        } while (node != heap->root);
+
+        while (stack)
+        {
+            node = stack;
+            stack = node->parent;
+
+            FibonacciHeapNode_t *child = node->child;
+
+            if (child)
+            {
+                do
+                {
+                    child->parent = stack;
+                    stack = child;
+                    child = child->right;
+                } while (child != node->child);
+            }
+
+            heap->interface->free(node->data);
+        }
+    }
+
+    npl_clear(heap->pool);
+
+    heap->root = NULL;
+    heap->count = 0;
+}
@@ -346,12 +346,14 @@ hep_insert(Heap_t *heap, void *element)
     {
         heap->buffer[heap->count] = element;
         heap->count++;
+        heap->version_id++;
 
         return true;
     }
 
     heap->buffer[C] = element;
     heap->count++;
+    heap->version_id++;
 
     if (!hep_float_up(heap, C))
         return false;
@@ -377,6 +379,7 @@ hep_remove(Heap_t *heap, void **result)
     heap->buffer[heap->count - 1] = NULL;
 
     heap->count--;
+    heap->version_id++;
 
     if (!hep_float_down(heap, 0))
         return false;
@@ -424,6 +427,8 @@ hep_full(Heap_t *heap)
 bool
 hep_heapify(Heap_t *heap)
 {
+    heap->version_id++;
+
     return hep_float_down(heap, 0);
 }
 
@@ -528,6 +533,95 @@ hep_display(Heap_t *heap, int display_mode)
     }
 }
 
+/// Saves the heap's buffer as it is, together with the heap's kind, so that
+/// it can be loaded without moving any element. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] heap The heap to be saved.
+/// \param[in] serial The stream where the heap is written to.
+///
+/// \return True if the heap was saved or false if writing failed.
+bool
+hep_serialize(Heap_t *heap, Serial_t *serial)
+{
+    uint32_t layout = heap->kind == MaxHeap ? 1 : 2;
+
+    if (!ser_write_header(serial, SER_HEAP, layout, heap->count))
+        return false;
+
+    for (integer_t i = 0; i < heap->count; i++)
+    {
+        if (!ser_write_element(serial, heap->interface->serialize,
+                               heap->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with hep_serialize(). If the heap has the same kind
+/// as the one that was saved the elements are already in heap order and
+/// nothing is compared; otherwise the heap is built bottom-up in linear time.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+/// - compare (only if the kinds differ)
+///
+/// \param[in] heap An empty heap.
+/// \param[in] serial The stream where the heap is read from.
+///
+/// \return True if all elements were loaded. False if the heap is not empty,
+/// if the stream is not a valid Heap_s, if reading failed or if the heap
+/// couldn't grow, in which case the heap is left empty.
+bool
+hep_deserialize(Heap_t *heap, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!hep_empty(heap))
+        return false;
+
+    if (!ser_read_header(serial, SER_HEAP, &layout, &count))
+        return false;
+
+    if (layout != 1 && layout != 2)
+        return false;
+
+    while (heap->capacity < count)
+    {
+        if (!hep_grow(heap))
+            return false;
+    }
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        if (!ser_read_element(serial, heap->interface->deserialize,
+                              &heap->buffer[i]))
+        {
+            hep_erase(heap);
+            return false;
+        }
+
+        heap->count++;
+    }
+
+    HeapKind kind = layout == 1 ? MaxHeap : MinHeap;
+
+    if (kind != heap->kind)
+    {
+        for (integer_t i = heap->count / 2 - 1; i >= 0; i--)
+            hep_float_down(heap, i);
+    }
+
+    heap->version_id++;
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // Parent
@@ -693,7 +787,268 @@ hep_display_tree(Heap_t *heap, integer_t index, integer_t height)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo HeapIterator
+/// This iterator visits the elements in the order they are laid out in the
+/// heap's buffer, that is, level by level starting at the root. It is meant
+/// for scans that don't care about order, so there is no way to set an
+/// element through it since that could break the heap property. Its cursor
+/// is the index of the current element.
+struct HeapIterator_s
+{
+    /// \brief Target Heap_s.
+    ///
+    /// Target Heap_s. The iterator might need to use some information
+    /// provided by the heap or change some of its data members.
+    struct Heap_s *target;
+
+    /// \brief Current element.
+    ///
+    /// Index of the current element. The iterator is always initialized with
+    /// 0, that is, the root of the heap.
+    integer_t cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure. This is kept to prevent iteration on the target structure
+    /// that may have been modified and thus causing undefined behaviours or
+    /// run-time crashes.
+    integer_t target_id;
+};
+
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t hep_iter_size = sizeof(HeapIterator_t);
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+hep_iter_target_modified(HeapIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Allocates a new iterator positioned at the root of the target heap.
+///
+/// \param[in] target The heap to be iterated.
+///
+/// \return NULL if the heap is empty or if the allocation failed, otherwise a
+/// new iterator.
+HeapIterator_t *
+hep_iter_new(Heap_t *target)
+{
+    if (hep_empty(target))
+        return NULL;
+
+    HeapIterator_t *iter = malloc(sizeof(HeapIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    hep_iter_init(iter, target);
+
+    return iter;
+}
+
+/// Initializes an iterator allocated by the user, usually on the stack with
+/// \c hep_iter_size, positioned at the root of the target heap.
+///
+/// \param[in,out] iter The iterator to be initialized.
+/// \param[in] target The heap to be iterated.
+///
+/// \return False if the heap is empty, otherwise true.
+bool
+hep_iter_init(HeapIterator_t *iter, Heap_t *target)
+{
+    if (hep_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Changes the target of an iterator and moves its cursor to the root.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new heap to be iterated.
+void
+hep_iter_retarget(HeapIterator_t *iter, Heap_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+}
+
+/// Frees from memory an iterator created with hep_iter_new().
+///
+/// \param[in] iter The iterator to be freed.
+void
+hep_iter_free(HeapIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor to the next index of the buffer.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the heap was modified or if the cursor is at the last
+/// element, otherwise true.
+bool
+hep_iter_next(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return false;
+
+    if (!hep_iter_has_next(iter))
+        return false;
+
+    iter->cursor++;
+
+    return true;
+}
+
+/// Moves the cursor to the previous index of the buffer.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the heap was modified or if the cursor is at the root,
+/// otherwise true.
+bool
+hep_iter_prev(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return false;
+
+    if (!hep_iter_has_prev(iter))
+        return false;
+
+    iter->cursor--;
+
+    return true;
+}
+
+/// Moves the cursor to the root of the heap.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the heap was modified, otherwise true.
+bool
+hep_iter_to_start(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Moves the cursor to the last element of the heap's buffer.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the heap was modified, otherwise true.
+bool
+hep_iter_to_end(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->count - 1;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element after the cursor, otherwise false.
+bool
+hep_iter_has_next(HeapIterator_t *iter)
+{
+    return iter->cursor < iter->target->count - 1;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element before the cursor, otherwise false.
+bool
+hep_iter_has_prev(HeapIterator_t *iter)
+{
+    return iter->cursor > 0;
+}
+
+/// Retrieves the element pointed by the cursor.
+///
+/// \param[in] iter The iterator.
+/// \param[out] result The current element.
+///
+/// \return False if the heap was modified, otherwise true.
+bool
+hep_iter_get(HeapIterator_t *iter, void **result)
+{
+    if (hep_iter_target_modified(iter))
+        return false;
+
+    *result = iter->target->buffer[iter->cursor];
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the heap was modified or if there is no next element,
+/// otherwise the element after the cursor.
+void *
+hep_iter_peek_next(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return NULL;
+
+    if (!hep_iter_has_next(iter))
+        return NULL;
+
+    return iter->target->buffer[iter->cursor + 1];
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the heap was modified, otherwise the current element.
+void *
+hep_iter_peek(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return NULL;
+
+    return iter->target->buffer[iter->cursor];
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the heap was modified or if there is no previous element,
+/// otherwise the element before the cursor.
+void *
+hep_iter_peek_prev(HeapIterator_t *iter)
+{
+    if (hep_iter_target_modified(iter))
+        return NULL;
+
+    if (!hep_iter_has_prev(iter))
+        return NULL;
+
+    return iter->target->buffer[iter->cursor - 1];
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+hep_iter_target_modified(HeapIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -0,0 +1,865 @@
+/**
+ * @file IntervalTree.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "IntervalTree.h"
+#include <inttypes.h>
+
+/// An interval tree is a red-black tree of closed intervals
+/// <code> [low, high] </code> ordered by their start. Each node is augmented
+/// with the highest end of every interval in its subtree, \c max. Insertions,
+/// removals and rotations only change the subtrees of the nodes on a single
+/// path, so \c max is kept up to date in <code> O(log n) </code> time and
+/// the tree keeps every property and bound of a RedBlackTree_s.
+///
+/// \par Overlap queries
+/// Two intervals <code> [a, b] </code> and <code> [c, d] </code> overlap if
+/// <code> a <= d </code> and <code> c <= b </code>. A query for
+/// <code> [low, high] </code> skips every subtree whose \c max is lower than
+/// \c low, since none of its intervals reach the query, and every right
+/// subtree of a node that starts after \c high, since its intervals start
+/// even later. Every visited subtree that is not skipped has an interval
+/// ending at or after \c low, so the cost depends on the amount of results
+/// \c k: at most <code> O(log n) </code> nodes are visited for each result
+/// and a query with no results visits <code> O(log n) </code> nodes.
+/// Results are visited in order.
+///
+/// \par Functions
+/// Located in the file IntervalTree.c
+struct IntervalTree_s
+{
+    /// \brief Tree size.
+    ///
+    /// Interval tree's current amount of intervals.
+    integer_t size;
+
+    /// \brief The tree's root.
+    ///
+    /// The root node of the interval tree.
+    struct IntervalTreeNode_s *root;
+
+    /// \brief IntervalTree_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The compare function orders
+    /// elements with the same interval and finds an element to be removed.
+    struct Interface_s *interface;
+};
+
+/// \brief An IntervalTree_s node.
+///
+/// Implementation detail. A red-black tree node with an interval and the
+/// highest end of the intervals in its subtree.
+struct IntervalTreeNode_s
+{
+    /// \brief Start of the interval.
+    int64_t low;
+
+    /// \brief End of the interval.
+    int64_t high;
+
+    /// \brief The highest end of every interval in this subtree.
+    int64_t max;
+
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief States if the node is black or not.
+    ///
+    /// If true, the node is black, if false, the node is red.
+    bool color;
+
+    /// \brief A pointer to its right child.
+    struct IntervalTreeNode_s *right;
+
+    /// \brief A pointer to its left child.
+    struct IntervalTreeNode_s *left;
+
+    /// \brief Pointer to parent node.
+    ///
+    /// Pointer to parent node or NULL if this is the root node.
+    struct IntervalTreeNode_s *parent;
+};
+
+/// \brief A type for an interval tree node.
+///
+/// Defines a type to a <code> struct IntervalTreeNode_s </code>.
+typedef struct IntervalTreeNode_s IntervalTreeNode_t;
+
+static const bool BLACK = true;
+static const bool RED = false;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static IntervalTreeNode_t *
+ivt_new_node(int64_t low, int64_t high, void *element);
+
+static void
+ivt_free_tree(IntervalTree_t *tree, bool elements);
+
+static int
+ivt_compare(IntervalTree_t *tree, IntervalTreeNode_t *node, int64_t low,
+            int64_t high, void *element);
+
+static IntervalTreeNode_t *
+ivt_find(IntervalTree_t *tree, int64_t low, int64_t high, void *element);
+
+static void
+ivt_update(IntervalTreeNode_t *node);
+
+static void
+ivt_rotate_left(IntervalTree_t *tree, IntervalTreeNode_t *X);
+
+static void
+ivt_rotate_right(IntervalTree_t *tree, IntervalTreeNode_t *X);
+
+static void
+ivt_insert_fixup(IntervalTree_t *tree, IntervalTreeNode_t *Z);
+
+static void
+ivt_remove_fixup(IntervalTree_t *tree, IntervalTreeNode_t *X,
+                 IntervalTreeNode_t *P);
+
+static bool
+ivt_color(IntervalTreeNode_t *node);
+
+static bool
+ivt_overlap_node(IntervalTreeNode_t *node, int64_t low, int64_t high,
+                 foreach_f function, void *context, DynamicArray_t *result,
+                 integer_t *count);
+
+static void
+ivt_display_node(IntervalTree_t *tree, IntervalTreeNode_t *node);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty IntervalTree_s.
+///
+/// \param[in] interface An interface with a compare, a free and a display
+/// function.
+///
+/// \return A new IntervalTree_s or NULL if allocation failed.
+IntervalTree_t *
+ivt_new(Interface_t *interface)
+{
+    IntervalTree_t *tree = malloc(sizeof(IntervalTree_t));
+
+    if (!tree)
+        return NULL;
+
+    tree->size = 0;
+    tree->root = NULL;
+    tree->interface = interface;
+
+    return tree;
+}
+
+/// Frees the tree and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] tree The tree to be freed from memory.
+void
+ivt_free(IntervalTree_t *tree)
+{
+    ivt_free_tree(tree, true);
+
+    free(tree);
+}
+
+/// Frees the tree, leaving the elements intact.
+///
+/// \param[in] tree The tree to be freed from memory.
+void
+ivt_free_shallow(IntervalTree_t *tree)
+{
+    ivt_free_tree(tree, false);
+
+    free(tree);
+}
+
+/// Frees every element, leaving the tree empty.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] tree The tree to be erased.
+void
+ivt_erase(IntervalTree_t *tree)
+{
+    ivt_free_tree(tree, true);
+}
+
+/// Removes every interval, leaving the elements intact.
+///
+/// \param[in] tree The tree to be erased.
+void
+ivt_erase_shallow(IntervalTree_t *tree)
+{
+    ivt_free_tree(tree, false);
+}
+
+/// \param[in] tree The target tree.
+/// \param[in] new_interface The new interface.
+void
+ivt_config(IntervalTree_t *tree, Interface_t *new_interface)
+{
+    tree->interface = new_interface;
+}
+
+/// \param[in] tree The target tree.
+///
+/// \return The amount of intervals in the tree.
+integer_t
+ivt_size(IntervalTree_t *tree)
+{
+    return tree->size;
+}
+
+/// Returns the smallest interval that contains every interval of the tree.
+///
+/// \param[in] tree The target tree.
+/// \param[out] low The lowest start of all intervals.
+/// \param[out] high The highest end of all intervals.
+///
+/// \return True if the operation was successful, false if the tree is
+/// empty.
+bool
+ivt_span(IntervalTree_t *tree, int64_t *low, int64_t *high)
+{
+    if (ivt_empty(tree))
+        return false;
+
+    IntervalTreeNode_t *scan = tree->root;
+
+    while (scan->left != NULL)
+        scan = scan->left;
+
+    *low = scan->low;
+    *high = tree->root->max;
+
+    return true;
+}
+
+/// Adds an element with an interval to the tree. Intervals are ordered by
+/// their start, then by their end and then by their element. The same
+/// interval can be added many times.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The target tree.
+/// \param[in] low The start of the interval.
+/// \param[in] high The end of the interval, included.
+/// \param[in] element The element to be added.
+///
+/// \return True if the element was added, false if \c low is greater than
+/// \c high or if allocation failed.
+bool
+ivt_insert(IntervalTree_t *tree, int64_t low, int64_t high, void *element)
+{
+    if (low > high)
+        return false;
+
+    IntervalTreeNode_t *node = ivt_new_node(low, high, element);
+
+    if (!node)
+        return false;
+
+    IntervalTreeNode_t *parent = NULL;
+    IntervalTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        parent = scan;
+
+        // The new interval is in every subtree on its way down
+        if (scan->max < high)
+            scan->max = high;
+
+        if (ivt_compare(tree, scan, low, high, element) > 0)
+            scan = scan->left;
+        else
+            scan = scan->right;
+    }
+
+    node->parent = parent;
+
+    if (parent == NULL)
+        tree->root = node;
+    else if (ivt_compare(tree, parent, low, high, element) > 0)
+        parent->left = node;
+    else
+        parent->right = node;
+
+    ivt_insert_fixup(tree, node);
+
+    tree->size++;
+
+    return true;
+}
+
+/// Removes an element with a given interval from the tree.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The target tree.
+/// \param[in] low The start of the interval.
+/// \param[in] high The end of the interval.
+/// \param[in] element The element to be removed has to match this element.
+/// \param[out] result The removed element. Can be NULL.
+///
+/// \return True if the element was removed, false if it was not found.
+bool
+ivt_remove(IntervalTree_t *tree, int64_t low, int64_t high, void *element,
+           void **result)
+{
+    IntervalTreeNode_t *Z = ivt_find(tree, low, high, element);
+
+    if (Z == NULL)
+        return false;
+
+    if (result)
+        *result = Z->data;
+
+    // Y is the node that leaves the tree, either Z or its successor
+    IntervalTreeNode_t *Y = Z;
+
+    if (Z->left != NULL && Z->right != NULL)
+    {
+        Y = Z->right;
+
+        while (Y->left != NULL)
+            Y = Y->left;
+
+        Z->low = Y->low;
+        Z->high = Y->high;
+        Z->data = Y->data;
+    }
+
+    IntervalTreeNode_t *X = Y->left != NULL ? Y->left : Y->right;
+    IntervalTreeNode_t *P = Y->parent;
+
+    if (X != NULL)
+        X->parent = P;
+
+    if (P == NULL)
+        tree->root = X;
+    else if (Y == P->left)
+        P->left = X;
+    else
+        P->right = X;
+
+    // Every subtree that lost Y, including the one of Z, is on this path
+    for (IntervalTreeNode_t *scan = P; scan != NULL; scan = scan->parent)
+        ivt_update(scan);
+
+    if (Y->color == BLACK)
+        ivt_remove_fixup(tree, X, P);
+
+    free(Y);
+
+    tree->size--;
+
+    return true;
+}
+
+/// \param[in] tree The target tree.
+///
+/// \return True if the tree is empty, otherwise false.
+bool
+ivt_empty(IntervalTree_t *tree)
+{
+    return tree->size == 0;
+}
+
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] tree The target tree.
+/// \param[in] low The start of the interval.
+/// \param[in] high The end of the interval.
+/// \param[in] element The element to be searched for.
+///
+/// \return True if the tree has the element with the given interval,
+/// otherwise false.
+bool
+ivt_contains(IntervalTree_t *tree, int64_t low, int64_t high, void *element)
+{
+    return ivt_find(tree, low, high, element) != NULL;
+}
+
+/// Visits, in order, every element whose interval overlaps
+/// <code> [low, high] </code>, that is, every interval that starts at or
+/// before \c high and ends at or after \c low. The tree must not be changed
+/// by the function.
+///
+/// \param[in] tree The target tree.
+/// \param[in] low The start of the query.
+/// \param[in] high The end of the query, included.
+/// \param[in] function A function that receives each element and the
+/// context.
+/// \param[in] context A context passed to the function. Can be NULL.
+///
+/// \return The amount of elements visited.
+integer_t
+ivt_overlap(IntervalTree_t *tree, int64_t low, int64_t high,
+            foreach_f function, void *context)
+{
+    integer_t count = 0;
+
+    if (low <= high)
+        ivt_overlap_node(tree->root, low, high, function, context, NULL,
+                         &count);
+
+    return count;
+}
+
+/// Appends, in order, every element whose interval overlaps
+/// <code> [low, high] </code> to the end of an array.
+///
+/// The elements are not copied, so the array points at elements that are
+/// still owned by the tree. Free it with dar_free_shallow(); dar_free()
+/// would free the tree's elements and the tree would free them again.
+///
+/// \param[in] tree The target tree.
+/// \param[in] low The start of the query.
+/// \param[in] high The end of the query, included.
+/// \param[in] result The array where the elements are appended.
+///
+/// \return True if the operation was successful, false if the array could
+/// not grow. In that case the elements appended so far are kept.
+bool
+ivt_overlap_array(IntervalTree_t *tree, int64_t low, int64_t high,
+                  DynamicArray_t *result)
+{
+    integer_t count = 0;
+
+    if (low > high)
+        return true;
+
+    return ivt_overlap_node(tree->root, low, high, NULL, NULL, result,
+                            &count);
+}
+
+/// Visits, in order, every element whose interval contains a point. The
+/// tree must not be changed by the function.
+///
+/// \param[in] tree The target tree.
+/// \param[in] point The point to be searched for.
+/// \param[in] function A function that receives each element and the
+/// context.
+/// \param[in] context A context passed to the function. Can be NULL.
+///
+/// \return The amount of elements visited.
+integer_t
+ivt_stab(IntervalTree_t *tree, int64_t point, foreach_f function,
+         void *context)
+{
+    return ivt_overlap(tree, point, point, function, context);
+}
+
+/// Displays every interval and its element in order.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] tree The tree to be displayed.
+void
+ivt_display(IntervalTree_t *tree)
+{
+    if (ivt_empty(tree))
+    {
+        printf("\nInterval Tree\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nInterval Tree\n");
+
+    ivt_display_node(tree, tree->root);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static IntervalTreeNode_t *
+ivt_new_node(int64_t low, int64_t high, void *element)
+{
+    IntervalTreeNode_t *node = malloc(sizeof(IntervalTreeNode_t));
+
+    if (!node)
+        return NULL;
+
+    // All new nodes are red
+    node->color = RED;
+    node->low = low;
+    node->high = high;
+    node->max = high;
+    node->data = element;
+
+    node->parent = NULL;
+    node->left = NULL;
+    node->right = NULL;
+
+    return node;
+}
+
+// Frees every node from the leaves up, freeing the elements if asked to
+static void
+ivt_free_tree(IntervalTree_t *tree, bool elements)
+{
+    IntervalTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        if (scan->left != NULL)
+        {
+            scan = scan->left;
+        }
+        else if (scan->right != NULL)
+        {
+            scan = scan->right;
+        }
+        else
+        {
+            IntervalTreeNode_t *parent = scan->parent;
+
+            if (parent != NULL)
+            {
+                if (parent->left == scan)
+                    parent->left = NULL;
+                else
+                    parent->right = NULL;
+            }
+
+            if (elements)
+                tree->interface->free(scan->data);
+
+            free(scan);
+
+            scan = parent;
+        }
+    }
+
+    tree->root = NULL;
+    tree->size = 0;
+}
+
+// Compares the interval and element of a node with the given ones
+static int
+ivt_compare(IntervalTree_t *tree, IntervalTreeNode_t *node, int64_t low,
+            int64_t high, void *element)
+{
+    if (node->low != low)
+        return node->low > low ? 1 : -1;
+
+    if (node->high != high)
+        return node->high > high ? 1 : -1;
+
+    return tree->interface->compare(node->data, element);
+}
+
+static IntervalTreeNode_t *
+ivt_find(IntervalTree_t *tree, int64_t low, int64_t high, void *element)
+{
+    IntervalTreeNode_t *scan = tree->root;
+
+    while (scan != NULL)
+    {
+        int comparison = ivt_compare(tree, scan, low, high, element);
+
+        if (comparison > 0)
+            scan = scan->left;
+        else if (comparison < 0)
+            scan = scan->right;
+        else
+            return scan;
+    }
+
+    return NULL;
+}
+
+// Recomputes the highest end of the subtree of a node from its children
+static void
+ivt_update(IntervalTreeNode_t *node)
+{
+    int64_t max = node->high;
+
+    if (node->left != NULL && node->left->max > max)
+        max = node->left->max;
+
+    if (node->right != NULL && node->right->max > max)
+        max = node->right->max;
+
+    node->max = max;
+}
+
+// Y takes the place of X and keeps the same subtree, so Y gets the max of X
+// and only X has to be updated
+static void
+ivt_rotate_left(IntervalTree_t *tree, IntervalTreeNode_t *X)
+{
+    IntervalTreeNode_t *Y = X->right;
+
+    X->right = Y->left;
+
+    if (Y->left != NULL)
+        Y->left->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->left)
+        X->parent->left = Y;
+    else
+        X->parent->right = Y;
+
+    Y->left = X;
+    X->parent = Y;
+
+    Y->max = X->max;
+    ivt_update(X);
+}
+
+static void
+ivt_rotate_right(IntervalTree_t *tree, IntervalTreeNode_t *X)
+{
+    IntervalTreeNode_t *Y = X->left;
+
+    X->left = Y->right;
+
+    if (Y->right != NULL)
+        Y->right->parent = X;
+
+    Y->parent = X->parent;
+
+    if (X->parent == NULL)
+        tree->root = Y;
+    else if (X == X->parent->left)
+        X->parent->left = Y;
+    else
+        X->parent->right = Y;
+
+    Y->right = X;
+    X->parent = Y;
+
+    Y->max = X->max;
+    ivt_update(X);
+}
+
+static void
+ivt_insert_fixup(IntervalTree_t *tree, IntervalTreeNode_t *Z)
+{
+    IntervalTreeNode_t *Y;
+
+    while (ivt_color(Z->parent) == RED)
+    {
+        if (Z->parent == Z->parent->parent->left)
+        {
+            // Uncle
+            Y = Z->parent->parent->right;
+
+            if (ivt_color(Y) == RED)
+            {
+                Z->parent->color = BLACK;
+                Y->color = BLACK;
+                Z->parent->parent->color = RED;
+                Z = Z->parent->parent;
+            }
+            else
+            {
+                if (Z == Z->parent->right)
+                {
+                    Z = Z->parent;
+                    ivt_rotate_left(tree, Z);
+                }
+
+                Z->parent->color = BLACK;
+                Z->parent->parent->color = RED;
+                ivt_rotate_right(tree, Z->parent->parent);
+            }
+        }
+        else /* if Z->parent == Z->parent->parent->right */
+        {
+            // Uncle
+            Y = Z->parent->parent->left;
+
+            if (ivt_color(Y) == RED)
+            {
+                Z->parent->color = BLACK;
+                Y->color = BLACK;
+                Z->parent->parent->color = RED;
+                Z = Z->parent->parent;
+            }
+            else
+            {
+                if (Z == Z->parent->left)
+                {
+                    Z = Z->parent;
+                    ivt_rotate_right(tree, Z);
+                }
+
+                Z->parent->color = BLACK;
+                Z->parent->parent->color = RED;
+                ivt_rotate_left(tree, Z->parent->parent);
+            }
+        }
+    }
+
+    tree->root->color = BLACK;
+}
+
+// X took the place of a removed black node and may be NULL, so its parent P
+// is tracked separately
+static void
+ivt_remove_fixup(IntervalTree_t *tree, IntervalTreeNode_t *X,
+                 IntervalTreeNode_t *P)
+{
+    IntervalTreeNode_t *W;
+
+    while (X != tree->root && ivt_color(X) == BLACK)
+    {
+        if (X == P->left)
+        {
+            W = P->right;
+
+            if (ivt_color(W) == RED)
+            {
+                W->color = BLACK;
+                P->color = RED;
+                ivt_rotate_left(tree, P);
+                W = P->right;
+            }
+
+            if (ivt_color(W->left) == BLACK && ivt_color(W->right) == BLACK)
+            {
+                W->color = RED;
+                X = P;
+                P = X->parent;
+            }
+            else
+            {
+                if (ivt_color(W->right) == BLACK)
+                {
+                    W->left->color = BLACK;
+                    W->color = RED;
+                    ivt_rotate_right(tree, W);
+                    W = P->right;
+                }
+
+                W->color = P->color;
+                P->color = BLACK;
+                W->right->color = BLACK;
+                ivt_rotate_left(tree, P);
+                X = tree->root;
+            }
+        }
+        else /* if X == P->right */
+        {
+            W = P->left;
+
+            if (ivt_color(W) == RED)
+            {
+                W->color = BLACK;
+                P->color = RED;
+                ivt_rotate_right(tree, P);
+                W = P->left;
+            }
+
+            if (ivt_color(W->left) == BLACK && ivt_color(W->right) == BLACK)
+            {
+                W->color = RED;
+                X = P;
+                P = X->parent;
+            }
+            else
+            {
+                if (ivt_color(W->left) == BLACK)
+                {
+                    W->right->color = BLACK;
+                    W->color = RED;
+                    ivt_rotate_left(tree, W);
+                    W = P->left;
+                }
+
+                W->color = P->color;
+                P->color = BLACK;
+                W->left->color = BLACK;
+                ivt_rotate_right(tree, P);
+                X = tree->root;
+            }
+        }
+    }
+
+    if (X != NULL)
+        X->color = BLACK;
+}
+
+static bool
+ivt_color(IntervalTreeNode_t *node)
+{
+    if (node == NULL)
+        return BLACK;
+
+    return node->color;
+}
+
+// Visits in order the intervals of a subtree that overlap [low, high],
+// either calling a function or appending to an array. Returns false if the
+// array could not grow.
+static bool
+ivt_overlap_node(IntervalTreeNode_t *node, int64_t low, int64_t high,
+                 foreach_f function, void *context, DynamicArray_t *result,
+                 integer_t *count)
+{
+    while (node != NULL && node->max >= low)
+    {
+        if (!ivt_overlap_node(node->left, low, high, function, context,
+                              result, count))
+            return false;
+
+        // This node and its whole right subtree start after the query
+        if (node->low > high)
+            return true;
+
+        if (node->high >= low)
+        {
+            if (result)
+            {
+                if (!dar_insert_back(result, node->data))
+                    return false;
+            }
+            else
+            {
+                function(node->data, context);
+            }
+
+            (*count)++;
+        }
+
+        node = node->right;
+    }
+
+    return true;
+}
+
+static void
+ivt_display_node(IntervalTree_t *tree, IntervalTreeNode_t *node)
+{
+    if (node == NULL)
+        return;
+
+    ivt_display_node(tree, node->left);
+
+    printf("[%" PRId64 ", %" PRId64 "] : ", node->low, node->high);
+    tree->interface->display(node->data);
+    printf("\n");
+
+    ivt_display_node(tree, node->right);
+}
@@ -0,0 +1,774 @@
+/**
+ * @file LRUCache.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "LRUCache.h"
+#include "CoreHash.h"
+
+/// \brief Initial amount of buckets in the index.
+#define LRU_INITIAL_BUCKETS 16
+
+/// \brief The segment where new pairs go.
+#define LRU_PROBATION 0
+
+/// \brief The segment of pairs that were used more than once.
+#define LRU_PROTECTED 1
+
+/// \brief A list of LRUCache_s nodes.
+///
+/// Implementation detail. A doubly-linked list ordered from the most to the
+/// least recently used node.
+struct LRUCacheSegment_s
+{
+    /// \brief The most recently used node of the segment.
+    struct LRUCacheNode_s *head;
+
+    /// \brief The least recently used node of the segment.
+    struct LRUCacheNode_s *tail;
+
+    /// \brief Total weight of the pairs in the segment.
+    integer_t weight;
+};
+
+/// An LRU cache maps keys to values and holds at most a certain total weight
+/// of pairs. If either interface has a \c size function a pair weighs the
+/// size of its key plus the size of its value and the capacity is a budget of
+/// bytes; otherwise every pair weighs 1 and the capacity is an amount of
+/// pairs. When a new pair doesn't fit, the pairs that were used the longest
+/// time ago are evicted and freed with the interfaces' \c free functions.
+///
+/// The pairs are kept in doubly-linked lists ordered from the most to the
+/// least recently used and are found through a chained hash index, so
+/// lru_get(), lru_put() and every eviction take constant time on average.
+///
+/// With \c LRU_PLAIN there is a single list. With \c LRU_SEGMENTED new pairs
+/// go to a probation list and only move to a protected list when they are
+/// used again; the protected list holds at most four fifths of the capacity
+/// and its least recently used pairs fall back to probation. Pairs are evicted
+/// from probation first, so a scan over many keys that are used only once
+/// can't flush the pairs that are used often.
+struct LRUCache_s
+{
+    /// \brief Probation and protected lists.
+    ///
+    /// Only the probation list is used with \c LRU_PLAIN.
+    struct LRUCacheSegment_s segments[2];
+
+    /// \brief Index buckets.
+    ///
+    /// Each bucket chains the nodes whose keys fall into it.
+    struct LRUCacheNode_s **buckets;
+
+    /// \brief Amount of buckets.
+    ///
+    /// Always a power of two.
+    integer_t bucket_count;
+
+    /// \brief Amount of key-value pairs in the cache.
+    integer_t count;
+
+    /// \brief Maximum total weight of the pairs.
+    integer_t capacity;
+
+    /// \brief Eviction policy.
+    LRUPolicy policy;
+
+    /// \brief Amount of lru_get() calls that found their key.
+    integer_t hits;
+
+    /// \brief Amount of lru_get() calls that did not find their key.
+    integer_t misses;
+
+    /// \brief Amount of pairs evicted to make room.
+    integer_t evictions;
+
+    /// \brief LRUCache_s key interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The key interface must have
+    /// a compare, a hash and a free function.
+    struct Interface_s *K_interface;
+
+    /// \brief LRUCache_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The value interface must
+    /// have a free function.
+    struct Interface_s *V_interface;
+};
+
+/// \brief An LRUCache_s node.
+///
+/// Implementation detail. A node is linked in one of the segments and in one
+/// of the index buckets.
+struct LRUCacheNode_s
+{
+    /// \brief This node's key.
+    void *key;
+
+    /// \brief This node's value.
+    void *value;
+
+    /// \brief The weight of the pair.
+    integer_t weight;
+
+    /// \brief The mixed hash of the key.
+    unsigned_t hash;
+
+    /// \brief The segment the node is in.
+    int segment;
+
+    /// \brief The next more recently used node in the segment.
+    struct LRUCacheNode_s *prev;
+
+    /// \brief The next less recently used node in the segment.
+    struct LRUCacheNode_s *next;
+
+    /// \brief Next node in the same bucket.
+    struct LRUCacheNode_s *chain;
+};
+
+typedef struct LRUCacheSegment_s LRUCacheSegment_t;
+
+typedef struct LRUCacheNode_s LRUCacheNode_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+lru_hash(LRUCache_t *cache, void *key);
+
+static integer_t
+lru_weigh(LRUCache_t *cache, void *key, void *value);
+
+static LRUCacheNode_t *
+lru_find(LRUCache_t *cache, void *key, unsigned_t hash);
+
+static void
+lru_link(LRUCache_t *cache, LRUCacheNode_t *node, int segment);
+
+static void
+lru_unlink(LRUCache_t *cache, LRUCacheNode_t *node);
+
+static void
+lru_touch(LRUCache_t *cache, LRUCacheNode_t *node);
+
+static void
+lru_evict(LRUCache_t *cache, integer_t weight);
+
+static void
+lru_detach(LRUCache_t *cache, LRUCacheNode_t *node);
+
+static void
+lru_delete(LRUCache_t *cache, LRUCacheNode_t *node);
+
+static void
+lru_index_grow(LRUCache_t *cache);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new LRUCache_s with two interfaces, one for the keys and another
+/// for the values. If either interface has a \c size function the capacity
+/// is a budget of bytes, otherwise it is an amount of pairs.
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+/// \param[in] capacity Maximum total weight of the pairs.
+/// \param[in] policy Which pairs are evicted first.
+///
+/// \return A new LRUCache_s or NULL if the capacity is not positive or if
+/// allocation failed.
+LRUCache_t *
+lru_new(Interface_t *key_interface, Interface_t *value_interface,
+        integer_t capacity, LRUPolicy policy)
+{
+    if (capacity <= 0)
+        return NULL;
+
+    LRUCache_t *cache = malloc(sizeof(LRUCache_t));
+
+    if (!cache)
+        return NULL;
+
+    cache->buckets = calloc(LRU_INITIAL_BUCKETS, sizeof(LRUCacheNode_t *));
+
+    if (!cache->buckets)
+    {
+        free(cache);
+        return NULL;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        cache->segments[i].head = NULL;
+        cache->segments[i].tail = NULL;
+        cache->segments[i].weight = 0;
+    }
+
+    cache->bucket_count = LRU_INITIAL_BUCKETS;
+    cache->count = 0;
+    cache->capacity = capacity;
+    cache->policy = policy;
+
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+
+    cache->K_interface = key_interface;
+    cache->V_interface = value_interface;
+
+    return cache;
+}
+
+/// Frees the cache and all of its keys and values.
+///
+/// \param[in] cache The cache to be freed from memory.
+void
+lru_free(LRUCache_t *cache)
+{
+    lru_erase(cache);
+
+    free(cache->buckets);
+    free(cache);
+}
+
+/// Frees every key-value pair, leaving the cache empty. The counters are
+/// kept.
+///
+/// \param[in] cache The cache to be erased.
+void
+lru_erase(LRUCache_t *cache)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        while (cache->segments[i].head)
+            lru_delete(cache, cache->segments[i].head);
+    }
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return The amount of key-value pairs in the cache.
+integer_t
+lru_count(LRUCache_t *cache)
+{
+    return cache->count;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return The total weight of the pairs in the cache.
+integer_t
+lru_weight(LRUCache_t *cache)
+{
+    return cache->segments[LRU_PROBATION].weight +
+           cache->segments[LRU_PROTECTED].weight;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return The maximum total weight of the pairs in the cache.
+integer_t
+lru_capacity(LRUCache_t *cache)
+{
+    return cache->capacity;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return The eviction policy of the cache.
+LRUPolicy
+lru_policy(LRUCache_t *cache)
+{
+    return cache->policy;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return How many times lru_get() found its key.
+integer_t
+lru_hits(LRUCache_t *cache)
+{
+    return cache->hits;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return How many times lru_get() did not find its key.
+integer_t
+lru_misses(LRUCache_t *cache)
+{
+    return cache->misses;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return How many pairs were evicted to make room for others.
+integer_t
+lru_evictions(LRUCache_t *cache)
+{
+    return cache->evictions;
+}
+
+/// Searches for a key, counting a hit or a miss, and marks the pair as the
+/// most recently used. The cache keeps the ownership of the value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to the key or NULL if the key was not found.
+void *
+lru_get(LRUCache_t *cache, void *key)
+{
+    LRUCacheNode_t *node = lru_find(cache, key, lru_hash(cache, key));
+
+    if (!node)
+    {
+        cache->misses++;
+        return NULL;
+    }
+
+    cache->hits++;
+
+    lru_touch(cache, node);
+
+    return node->value;
+}
+
+/// Searches for a key without counting it or changing the order of the
+/// pairs. The cache keeps the ownership of the value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to the key or NULL if the key was not found.
+void *
+lru_peek(LRUCache_t *cache, void *key)
+{
+    LRUCacheNode_t *node = lru_find(cache, key, lru_hash(cache, key));
+
+    return node ? node->value : NULL;
+}
+
+/// Sets a new capacity. If the pairs weigh more than the new capacity the
+/// least recently used ones are evicted.
+///
+/// \par Interface Requirements
+/// - K_interface: free
+/// - V_interface: free
+///
+/// \param[in] cache The target cache.
+/// \param[in] capacity The new maximum total weight of the pairs.
+///
+/// \return False if the capacity is not positive, otherwise true.
+bool
+lru_set_capacity(LRUCache_t *cache, integer_t capacity)
+{
+    if (capacity <= 0)
+        return false;
+
+    cache->capacity = capacity;
+
+    lru_evict(cache, capacity);
+
+    return true;
+}
+
+/// Maps a key to a value and marks the pair as the most recently used. If
+/// the key is already in the cache its value is freed and replaced, and the
+/// new key is freed unless it is the same pointer as the stored one.
+/// Otherwise the least recently used pairs are evicted until the new pair
+/// fits. The cache takes the ownership of both the key and the value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash, free
+/// - V_interface: free
+/// - K_interface: size (optional)
+/// - V_interface: size (optional)
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value mapped to the key.
+///
+/// \return False if the pair alone weighs more than the capacity or if
+/// allocation failed, in which case the caller keeps the ownership of both.
+bool
+lru_put(LRUCache_t *cache, void *key, void *value)
+{
+    integer_t weight = lru_weigh(cache, key, value);
+
+    if (weight > cache->capacity)
+        return false;
+
+    unsigned_t hash = lru_hash(cache, key);
+
+    LRUCacheNode_t *node = lru_find(cache, key, hash);
+
+    if (node)
+    {
+        if (key != node->key)
+            cache->K_interface->free(key);
+
+        if (value != node->value)
+            cache->V_interface->free(node->value);
+
+        cache->segments[node->segment].weight += weight - node->weight;
+
+        node->value = value;
+        node->weight = weight;
+
+        lru_touch(cache, node);
+
+        // The pair is now the most recently used so it is evicted last
+        lru_evict(cache, cache->capacity);
+
+        return true;
+    }
+
+    node = malloc(sizeof(LRUCacheNode_t));
+
+    if (!node)
+        return false;
+
+    lru_evict(cache, cache->capacity - weight);
+
+    node->key = key;
+    node->value = value;
+    node->weight = weight;
+    node->hash = hash;
+
+    LRUCacheNode_t **bucket =
+            &cache->buckets[hash & (unsigned_t)(cache->bucket_count - 1)];
+
+    node->chain = *bucket;
+    *bucket = node;
+
+    lru_link(cache, node, LRU_PROBATION);
+
+    cache->count++;
+
+    if (cache->count > cache->bucket_count)
+        lru_index_grow(cache);
+
+    return true;
+}
+
+/// Removes a key from the cache, freeing it and handing out its value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash, free
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value that was mapped to the key.
+///
+/// \return True if the key was found and removed.
+bool
+lru_remove(LRUCache_t *cache, void *key, void **value)
+{
+    *value = NULL;
+
+    LRUCacheNode_t *node = lru_find(cache, key, lru_hash(cache, key));
+
+    if (!node)
+        return false;
+
+    *value = node->value;
+
+    lru_detach(cache, node);
+
+    cache->K_interface->free(node->key);
+    free(node);
+
+    return true;
+}
+
+/// Removes a key from the cache, freeing both the key and its value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash, free
+/// - V_interface: free
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be removed.
+///
+/// \return True if the key was found and removed.
+bool
+lru_pop(LRUCache_t *cache, void *key)
+{
+    LRUCacheNode_t *node = lru_find(cache, key, lru_hash(cache, key));
+
+    if (!node)
+        return false;
+
+    lru_delete(cache, node);
+
+    return true;
+}
+
+/// \param[in] cache The target cache.
+///
+/// \return True if the cache has no key-value pairs.
+bool
+lru_empty(LRUCache_t *cache)
+{
+    return cache->count == 0;
+}
+
+/// Searches for a key without counting it or changing the order of the
+/// pairs.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] cache The target cache.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is in the cache.
+bool
+lru_contains_key(LRUCache_t *cache, void *key)
+{
+    return lru_find(cache, key, lru_hash(cache, key)) != NULL;
+}
+
+/// Displays the pairs from the most to the least recently used. With
+/// \c LRU_SEGMENTED the protected pairs are displayed first.
+///
+/// \param[in] cache The cache to be displayed.
+void
+lru_display(LRUCache_t *cache)
+{
+    if (lru_empty(cache))
+    {
+        printf("\nLRUCache\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nLRUCache\n");
+
+    for (int i = LRU_PROTECTED; i >= LRU_PROBATION; i--)
+    {
+        LRUCacheNode_t *scan = cache->segments[i].head;
+
+        for (; scan; scan = scan->next)
+        {
+            cache->K_interface->display(scan->key);
+
+            printf(" : ");
+
+            cache->V_interface->display(scan->value);
+
+            printf("\n");
+        }
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+lru_hash(LRUCache_t *cache, void *key)
+{
+    return ds_hash_mix((uint64_t)cache->K_interface->hash(key));
+}
+
+// A pair weighs the size of its key and value or 1 if there is no way to
+// measure them
+static integer_t
+lru_weigh(LRUCache_t *cache, void *key, void *value)
+{
+    size_f key_size = cache->K_interface->size;
+    size_f value_size = cache->V_interface->size;
+
+    if (!key_size && !value_size)
+        return 1;
+
+    size_t size = 0;
+
+    if (key_size)
+        size += key_size(key);
+
+    if (value_size)
+        size += value_size(value);
+
+    return (integer_t)size;
+}
+
+static LRUCacheNode_t *
+lru_find(LRUCache_t *cache, void *key, unsigned_t hash)
+{
+    LRUCacheNode_t *scan =
+            cache->buckets[hash & (unsigned_t)(cache->bucket_count - 1)];
+
+    while (scan != NULL)
+    {
+        if (scan->hash == hash &&
+            cache->K_interface->compare(key, scan->key) == 0)
+            return scan;
+
+        scan = scan->chain;
+    }
+
+    return NULL;
+}
+
+// Makes a node the most recently used of a segment
+static void
+lru_link(LRUCache_t *cache, LRUCacheNode_t *node, int segment)
+{
+    LRUCacheSegment_t *list = &cache->segments[segment];
+
+    node->segment = segment;
+    node->prev = NULL;
+    node->next = list->head;
+
+    if (list->head)
+        list->head->prev = node;
+    else
+        list->tail = node;
+
+    list->head = node;
+    list->weight += node->weight;
+}
+
+// Takes a node out of its segment
+static void
+lru_unlink(LRUCache_t *cache, LRUCacheNode_t *node)
+{
+    LRUCacheSegment_t *list = &cache->segments[node->segment];
+
+    if (node->prev)
+        node->prev->next = node->next;
+    else
+        list->head = node->next;
+
+    if (node->next)
+        node->next->prev = node->prev;
+    else
+        list->tail = node->prev;
+
+    list->weight -= node->weight;
+}
+
+// Marks a node as used. With the segmented policy it is moved to the
+// protected segment, whose least recently used nodes go back to probation if
+// it grows past four fifths of the capacity.
+static void
+lru_touch(LRUCache_t *cache, LRUCacheNode_t *node)
+{
+    lru_unlink(cache, node);
+
+    if (cache->policy == LRU_PLAIN)
+    {
+        lru_link(cache, node, LRU_PROBATION);
+        return;
+    }
+
+    lru_link(cache, node, LRU_PROTECTED);
+
+    LRUCacheSegment_t *protected = &cache->segments[LRU_PROTECTED];
+
+    integer_t limit = cache->capacity - cache->capacity / 5;
+
+    while (protected->weight > limit && protected->tail != node)
+    {
+        LRUCacheNode_t *demoted = protected->tail;
+
+        lru_unlink(cache, demoted);
+        lru_link(cache, demoted, LRU_PROBATION);
+    }
+}
+
+// Evicts the least recently used nodes, the ones in probation first, until
+// the total weight is at most the given one
+static void
+lru_evict(LRUCache_t *cache, integer_t weight)
+{
+    while (cache->count > 0 && lru_weight(cache) > weight)
+    {
+        LRUCacheNode_t *victim = cache->segments[LRU_PROBATION].tail;
+
+        if (!victim)
+            victim = cache->segments[LRU_PROTECTED].tail;
+
+        lru_delete(cache, victim);
+
+        cache->evictions++;
+    }
+}
+
+// Takes a node out of its segment and out of the index
+static void
+lru_detach(LRUCache_t *cache, LRUCacheNode_t *node)
+{
+    lru_unlink(cache, node);
+
+    LRUCacheNode_t **link =
+            &cache->buckets[node->hash & (unsigned_t)(cache->bucket_count - 1)];
+
+    while (*link != node)
+        link = &(*link)->chain;
+
+    *link = node->chain;
+
+    cache->count--;
+}
+
+// Takes a node out of the cache and frees it with its key and value
+static void
+lru_delete(LRUCache_t *cache, LRUCacheNode_t *node)
+{
+    lru_detach(cache, node);
+
+    cache->K_interface->free(node->key);
+    cache->V_interface->free(node->value);
+
+    free(node);
+}
+
+// Doubles the amount of buckets. If that fails the cache keeps working with
+// longer chains.
+static void
+lru_index_grow(LRUCache_t *cache)
+{
+    integer_t bucket_count = cache->bucket_count * 2;
+
+    LRUCacheNode_t **buckets =
+            calloc((size_t)bucket_count, sizeof(LRUCacheNode_t *));
+
+    if (!buckets)
+        return;
+
+    for (integer_t i = 0; i < cache->bucket_count; i++)
+    {
+        LRUCacheNode_t *scan = cache->buckets[i];
+
+        while (scan)
+        {
+            LRUCacheNode_t *next = scan->chain;
+
+            LRUCacheNode_t **bucket =
+                    &buckets[scan->hash & (unsigned_t)(bucket_count - 1)];
+
+            scan->chain = *bucket;
+            *bucket = scan;
+
+            scan = next;
+        }
+    }
+
+    free(cache->buckets);
+
+    cache->buckets = buckets;
+    cache->bucket_count = bucket_count;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,1017 @@
+/**
+ * @file LogQueue.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "LogQueue.h"
+#include "QueueList.h"
+#include "Serial.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// \brief Default amount of elements kept in memory.
+#define LGQ_WINDOW 4096
+
+/// \brief Default size of a segment before a new one is started.
+#define LGQ_SEGMENT_SIZE (64 * 1024 * 1024)
+
+/// \brief Default amount of operations between two syncs.
+#define LGQ_BATCH 1024
+
+/// \brief Bytes before each record: its size and its checksum.
+#define LGQ_RECORD_HEADER 8
+
+/// A LogQueue_s is a FIFO queue whose elements are kept in an append-only
+/// log on disk, so that they survive a crash or a restart. Every element
+/// enqueued gets a sequence number, starting from zero, and is appended to
+/// the log as a record made of the size of its encoding, a checksum of the
+/// encoding and the encoding itself, produced by the interface's codec. All
+/// numbers are little-endian.
+///
+/// The log is split into segment files named after the sequence number of
+/// their first record, so whole segments can be deleted once all of their
+/// elements were dequeued. Dequeues only move the \c head sequence number in
+/// memory; it is saved to a small checkpoint file, replaced atomically with a
+/// rename.
+///
+/// Writes are buffered and made durable by lgq_sync(), which flushes the
+/// segment, calls fdatasync and then saves the checkpoint. It is called
+/// every \c batch operations (group commit) and by lgq_close(). After a
+/// crash every element enqueued before the last sync is still there, and
+/// every element dequeued after the last sync is delivered again, so the
+/// queue is at-least-once. A record that was only partially written is
+/// detected by its checksum and cut from the log when it is opened.
+///
+/// Only a window of at most \c window elements is kept decoded in memory, in
+/// a QueueList_s. Elements enqueued while the window is full only go to the
+/// log and are read back in order once the window empties.
+///
+/// \par Functions
+/// Located in the file LogQueue.c
+struct LogQueue_s
+{
+    /// \brief Directory that holds the segments and the checkpoint.
+    char *directory;
+
+    /// \brief Buffer where file names are formatted.
+    char *path;
+
+    /// \brief Elements from \c head up to \c loaded, decoded.
+    QueueList_t *window;
+
+    /// \brief Maximum amount of elements in \c window.
+    integer_t window_size;
+
+    /// \brief Sequence number of the front element.
+    uint64_t head;
+
+    /// \brief Sequence number after the last element in \c window.
+    uint64_t loaded;
+
+    /// \brief Sequence number of the next element enqueued.
+    uint64_t tail;
+
+    /// \brief Value of \c head saved in the checkpoint.
+    uint64_t checkpoint;
+
+    /// \brief Sequence number of the first record of each segment.
+    uint64_t *segments;
+
+    /// \brief Amount of segments.
+    integer_t segments_count;
+
+    /// \brief Capacity of \c segments.
+    integer_t segments_capacity;
+
+    /// \brief Size in bytes after which a new segment is started.
+    size_t segment_size;
+
+    /// \brief Bytes in the last segment.
+    size_t written;
+
+    /// \brief File descriptor of the last segment.
+    int writer_fd;
+
+    /// \brief Buffered stream that appends to the last segment.
+    Serial_t *writer;
+
+    /// \brief File descriptor of the segment being read or -1.
+    int reader_fd;
+
+    /// \brief Buffered stream that reads records into \c window.
+    Serial_t *reader;
+
+    /// \brief Index in \c segments of the segment being read.
+    integer_t reader_segment;
+
+    /// \brief Sequence number of the next record read by \c reader.
+    uint64_t reader_sequence;
+
+    /// \brief Buffer where records are encoded and decoded.
+    unsigned char *scratch;
+
+    /// \brief Capacity of \c scratch.
+    size_t scratch_size;
+
+    /// \brief Amount of operations between two syncs or 0 to only sync when
+    /// lgq_sync() is called.
+    integer_t batch;
+
+    /// \brief Operations since the last sync.
+    integer_t pending;
+
+    /// \brief Set by the first operation on the log that fails.
+    bool failed;
+
+    /// \brief LogQueue_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static uint32_t
+lgq_checksum(const unsigned char *data, size_t size);
+
+static void
+lgq_put_u32(unsigned char *buffer, uint32_t value);
+
+static uint32_t
+lgq_get_u32(const unsigned char *buffer);
+
+static const char *
+lgq_path(LogQueue_t *queue, const char *name, uint64_t sequence);
+
+static bool
+lgq_reserve(LogQueue_t *queue, size_t size);
+
+static bool
+lgq_sync_directory(LogQueue_t *queue);
+
+static int
+lgq_compare_sequence(const void *sequence1, const void *sequence2);
+
+static bool
+lgq_scan(LogQueue_t *queue);
+
+static bool
+lgq_add_segment(LogQueue_t *queue, uint64_t first);
+
+static uint64_t
+lgq_read_checkpoint(LogQueue_t *queue);
+
+static bool
+lgq_write_checkpoint(LogQueue_t *queue);
+
+static bool
+lgq_read_record(LogQueue_t *queue, Serial_t *serial, size_t *available,
+                void **result);
+
+static bool
+lgq_recover(LogQueue_t *queue);
+
+static bool
+lgq_open_writer(LogQueue_t *queue, bool create);
+
+static bool
+lgq_rotate(LogQueue_t *queue);
+
+static void
+lgq_close_reader(LogQueue_t *queue);
+
+static bool
+lgq_seek(LogQueue_t *queue, uint64_t sequence);
+
+static bool
+lgq_refill(LogQueue_t *queue);
+
+static void
+lgq_free(LogQueue_t *queue);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Keeps 4096 elements in memory, starts a new segment every 64 MiB and
+/// syncs every 1024 operations.
+///
+/// \par Interface Requirements
+/// - serialize
+/// - deserialize
+/// - free
+///
+/// \param[in] directory Directory of the log. Created if it doesn't exist.
+/// \param[in] interface An interface defining all necessary functions for the
+/// queue to operate.
+///
+/// \return The queue as it was at its last sync or NULL if the log couldn't
+/// be opened.
+LogQueue_t *
+lgq_open(const char *directory, Interface_t *interface)
+{
+    return lgq_create(directory, interface, LGQ_WINDOW, LGQ_SEGMENT_SIZE,
+                      LGQ_BATCH);
+}
+
+/// If the directory already has a log its elements are loaded lazily; only
+/// the last segment is read to find where its last complete record ends.
+///
+/// \par Interface Requirements
+/// - serialize
+/// - deserialize
+/// - free
+///
+/// \param[in] directory Directory of the log. Created if it doesn't exist.
+/// \param[in] interface An interface defining all necessary functions for the
+/// queue to operate.
+/// \param[in] window Maximum amount of elements kept in memory.
+/// \param[in] segment_size Size in bytes after which a new segment is
+/// started.
+/// \param[in] batch Amount of operations between two automatic syncs or 0 to
+/// only sync on lgq_sync() and lgq_close().
+///
+/// \return The queue as it was at its last sync or NULL if the parameters are
+/// invalid or if the log couldn't be opened.
+LogQueue_t *
+lgq_create(const char *directory, Interface_t *interface, integer_t window,
+           size_t segment_size, integer_t batch)
+{
+    if (window < 1 || segment_size < 1 || batch < 0)
+        return NULL;
+
+    if (mkdir(directory, 0755) != 0 && errno != EEXIST)
+        return NULL;
+
+    LogQueue_t *queue = malloc(sizeof(LogQueue_t));
+
+    if (!queue)
+        return NULL;
+
+    size_t length = strlen(directory);
+
+    queue->directory = malloc(length + 1);
+    queue->path = malloc(length + 32);
+    queue->window = qli_new(interface);
+
+    queue->window_size = window;
+    queue->head = 0;
+    queue->loaded = 0;
+    queue->tail = 0;
+    queue->checkpoint = 0;
+    queue->segments = NULL;
+    queue->segments_count = 0;
+    queue->segments_capacity = 0;
+    queue->segment_size = segment_size;
+    queue->written = 0;
+    queue->writer_fd = -1;
+    queue->writer = NULL;
+    queue->reader_fd = -1;
+    queue->reader = NULL;
+    queue->reader_segment = 0;
+    queue->reader_sequence = 0;
+    queue->scratch = NULL;
+    queue->scratch_size = 0;
+    queue->batch = batch;
+    queue->pending = 0;
+    queue->failed = false;
+    queue->interface = interface;
+
+    if (!queue->directory || !queue->path || !queue->window)
+    {
+        lgq_free(queue);
+        return NULL;
+    }
+
+    strcpy(queue->directory, directory);
+
+    if (!lgq_scan(queue))
+    {
+        lgq_free(queue);
+        return NULL;
+    }
+
+    queue->checkpoint = lgq_read_checkpoint(queue);
+
+    if (queue->segments_count == 0)
+    {
+        // A new log starts where the checkpoint says, if there is one
+        if (!lgq_add_segment(queue, queue->checkpoint) ||
+            !lgq_open_writer(queue, true))
+        {
+            lgq_free(queue);
+            return NULL;
+        }
+
+        queue->tail = queue->checkpoint;
+    }
+    else if (!lgq_recover(queue) || !lgq_open_writer(queue, false))
+    {
+        lgq_free(queue);
+        return NULL;
+    }
+
+    queue->head = queue->checkpoint;
+
+    if (queue->head < queue->segments[0])
+        queue->head = queue->segments[0];
+    if (queue->head > queue->tail)
+        queue->head = queue->tail;
+
+    queue->loaded = queue->head;
+
+    return queue;
+}
+
+/// Elements still in the queue are kept in the log and will be there the
+/// next time it is opened.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] queue The queue to be closed.
+///
+/// \return True if the last sync succeeded.
+bool
+lgq_close(LogQueue_t *queue)
+{
+    bool synced = lgq_sync(queue);
+
+    lgq_free(queue);
+
+    return synced;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return The amount of elements in the queue, both in memory and on disk.
+integer_t
+lgq_count(LogQueue_t *queue)
+{
+    return (integer_t)(queue->tail - queue->head);
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return The amount of segment files in the log.
+integer_t
+lgq_segments(LogQueue_t *queue)
+{
+    return queue->segments_count;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return True if an operation on the log failed. A failed queue refuses
+/// every further operation.
+bool
+lgq_failed(LogQueue_t *queue)
+{
+    return queue->failed;
+}
+
+/// The element is appended to the log right away but it is only durable
+/// after the next sync. The queue takes ownership of the element; if the
+/// window is full it is freed and decoded again from the log when it gets
+/// near the front.
+///
+/// \par Interface Requirements
+/// - serialize
+/// - free
+///
+/// \param[in] queue The target queue.
+/// \param[in] element The element to be inserted. Must not be NULL.
+///
+/// \return True if the element was appended. False if it couldn't be encoded
+/// or if the queue failed, in which case the element still belongs to the
+/// caller.
+bool
+lgq_enqueue(LogQueue_t *queue, void *element)
+{
+    if (queue->failed || element == NULL)
+        return false;
+
+    size_t size = queue->interface->serialize(element, NULL, 0);
+
+    if (size >= SER_NULL || !lgq_reserve(queue, LGQ_RECORD_HEADER + size))
+        return false;
+
+    unsigned char *payload = queue->scratch + LGQ_RECORD_HEADER;
+
+    if (queue->interface->serialize(element, payload, size) != size)
+        return false;
+
+    lgq_put_u32(queue->scratch, (uint32_t)size);
+    lgq_put_u32(queue->scratch + 4, lgq_checksum(payload, size));
+
+    size += LGQ_RECORD_HEADER;
+
+    if (queue->written > 0 && queue->written + size > queue->segment_size)
+    {
+        if (!lgq_rotate(queue))
+            return false;
+    }
+
+    if (!ser_write(queue->writer, queue->scratch, size))
+    {
+        queue->failed = true;
+        return false;
+    }
+
+    queue->written += size;
+
+    // Only elements right after the window can go straight into it
+    if (queue->loaded == queue->tail &&
+        qli_count(queue->window) < queue->window_size &&
+        qli_enqueue(queue->window, element))
+    {
+        queue->loaded++;
+    }
+    else
+        queue->interface->free(element);
+
+    queue->tail++;
+
+    if (queue->batch > 0 && ++queue->pending >= queue->batch)
+        lgq_sync(queue);
+
+    return true;
+}
+
+/// The element is only removed from the log for good after the next sync;
+/// if the process crashes before that it will be dequeued again.
+///
+/// \par Interface Requirements
+/// - deserialize
+///
+/// \param[in] queue The target queue.
+/// \param[out] result The element at the front of the queue.
+///
+/// \return True if an element was removed. False if the queue is empty or if
+/// reading from the log failed.
+bool
+lgq_dequeue(LogQueue_t *queue, void **result)
+{
+    *result = NULL;
+
+    if (queue->failed || queue->head == queue->tail)
+        return false;
+
+    if (qli_empty(queue->window) && !lgq_refill(queue))
+        return false;
+
+    if (!qli_dequeue(queue->window, result))
+        return false;
+
+    queue->head++;
+
+    if (queue->batch > 0 && ++queue->pending >= queue->batch)
+        lgq_sync(queue);
+
+    return true;
+}
+
+/// Flushes the last segment and calls fdatasync on it, then saves the
+/// position of the front element in the checkpoint and deletes every segment
+/// whose elements were all dequeued. Called automatically every \c batch
+/// operations.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return True if everything done so far is durable.
+bool
+lgq_sync(LogQueue_t *queue)
+{
+    if (queue->failed)
+        return false;
+
+    queue->pending = 0;
+
+    if (!ser_flush(queue->writer) || fdatasync(queue->writer_fd) != 0)
+    {
+        queue->failed = true;
+        return false;
+    }
+
+    if (queue->head == queue->checkpoint)
+        return true;
+
+    if (!lgq_write_checkpoint(queue))
+    {
+        queue->failed = true;
+        return false;
+    }
+
+    while (queue->segments_count > 1 &&
+           queue->segments[1] <= queue->checkpoint)
+    {
+        if (queue->reader && queue->reader_segment == 0)
+            lgq_close_reader(queue);
+
+        unlink(lgq_path(queue, NULL, queue->segments[0]));
+
+        queue->segments_count--;
+        queue->reader_segment--;
+
+        memmove(queue->segments, queue->segments + 1,
+                sizeof(uint64_t) * (size_t)queue->segments_count);
+    }
+
+    return true;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] queue The target queue.
+///
+/// \return True if the queue has no elements.
+bool
+lgq_empty(LogQueue_t *queue)
+{
+    return queue->head == queue->tail;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// FNV-1a
+static uint32_t
+lgq_checksum(const unsigned char *data, size_t size)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static void
+lgq_put_u32(unsigned char *buffer, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        buffer[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint32_t
+lgq_get_u32(const unsigned char *buffer)
+{
+    uint32_t value = 0;
+
+    for (int i = 0; i < 4; i++)
+        value |= (uint32_t)buffer[i] << (8 * i);
+
+    return value;
+}
+
+// Formats the path of a file in the log's directory. With no name it is the
+// segment that starts at the given sequence number.
+static const char *
+lgq_path(LogQueue_t *queue, const char *name, uint64_t sequence)
+{
+    if (name)
+        sprintf(queue->path, "%s/%s", queue->directory, name);
+    else
+        sprintf(queue->path, "%s/%020" PRIu64 ".log", queue->directory,
+                sequence);
+
+    return queue->path;
+}
+
+static bool
+lgq_reserve(LogQueue_t *queue, size_t size)
+{
+    if (size <= queue->scratch_size)
+        return true;
+
+    unsigned char *scratch = realloc(queue->scratch, size);
+
+    if (!scratch)
+        return false;
+
+    queue->scratch = scratch;
+    queue->scratch_size = size;
+
+    return true;
+}
+
+// Makes file creations, deletions and renames durable
+static bool
+lgq_sync_directory(LogQueue_t *queue)
+{
+    int fd = open(queue->directory, O_RDONLY | O_DIRECTORY);
+
+    if (fd < 0)
+        return false;
+
+    bool synced = fsync(fd) == 0;
+
+    close(fd);
+
+    return synced;
+}
+
+static int
+lgq_compare_sequence(const void *sequence1, const void *sequence2)
+{
+    uint64_t s1 = *(const uint64_t *)sequence1;
+    uint64_t s2 = *(const uint64_t *)sequence2;
+
+    return (s1 > s2) - (s1 < s2);
+}
+
+// Finds every segment in the directory
+static bool
+lgq_scan(LogQueue_t *queue)
+{
+    DIR *directory = opendir(queue->directory);
+
+    if (!directory)
+        return false;
+
+    struct dirent *entry;
+
+    while ((entry = readdir(directory)) != NULL)
+    {
+        char *end;
+        uint64_t first = strtoull(entry->d_name, &end, 10);
+
+        if (end == entry->d_name || strcmp(end, ".log") != 0)
+            continue;
+
+        if (!lgq_add_segment(queue, first))
+        {
+            closedir(directory);
+            return false;
+        }
+    }
+
+    closedir(directory);
+
+    if (queue->segments_count > 1)
+        qsort(queue->segments, (size_t)queue->segments_count,
+              sizeof(uint64_t), lgq_compare_sequence);
+
+    return true;
+}
+
+static bool
+lgq_add_segment(LogQueue_t *queue, uint64_t first)
+{
+    if (queue->segments_count == queue->segments_capacity)
+    {
+        integer_t capacity = queue->segments_capacity * 2 + 8;
+
+        uint64_t *segments = realloc(queue->segments,
+                                     sizeof(uint64_t) * (size_t)capacity);
+
+        if (!segments)
+            return false;
+
+        queue->segments = segments;
+        queue->segments_capacity = capacity;
+    }
+
+    queue->segments[queue->segments_count++] = first;
+
+    return true;
+}
+
+// Returns the saved head or 0 if there is no valid checkpoint
+static uint64_t
+lgq_read_checkpoint(LogQueue_t *queue)
+{
+    int fd = open(lgq_path(queue, "checkpoint", 0), O_RDONLY);
+
+    if (fd < 0)
+        return 0;
+
+    unsigned char buffer[12];
+
+    bool complete = read(fd, buffer, sizeof(buffer)) == sizeof(buffer);
+
+    close(fd);
+
+    if (!complete || lgq_get_u32(buffer + 8) != lgq_checksum(buffer, 8))
+        return 0;
+
+    return (uint64_t)lgq_get_u32(buffer) |
+           (uint64_t)lgq_get_u32(buffer + 4) << 32;
+}
+
+// Writes the checkpoint to a temporary file and renames it over the old one
+static bool
+lgq_write_checkpoint(LogQueue_t *queue)
+{
+    unsigned char buffer[12];
+
+    lgq_put_u32(buffer, (uint32_t)queue->head);
+    lgq_put_u32(buffer + 4, (uint32_t)(queue->head >> 32));
+    lgq_put_u32(buffer + 8, lgq_checksum(buffer, 8));
+
+    int fd = open(lgq_path(queue, "checkpoint.tmp", 0),
+                  O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+        return false;
+
+    bool written = write(fd, buffer, sizeof(buffer)) == sizeof(buffer) &&
+                   fdatasync(fd) == 0;
+
+    close(fd);
+
+    if (!written)
+        return false;
+
+    // lgq_path() reuses the same buffer
+    char *temporary = strdup(lgq_path(queue, "checkpoint.tmp", 0));
+
+    if (!temporary)
+        return false;
+
+    bool renamed = rename(temporary, lgq_path(queue, "checkpoint", 0)) == 0;
+
+    free(temporary);
+
+    if (!renamed || !lgq_sync_directory(queue))
+        return false;
+
+    queue->checkpoint = queue->head;
+
+    return true;
+}
+
+// Reads one record and checks its checksum. If result is NULL the record is
+// only skipped. If available is not NULL it has the bytes left in the file,
+// which are decremented by the size of the record; records that would go
+// past them are torn.
+static bool
+lgq_read_record(LogQueue_t *queue, Serial_t *serial, size_t *available,
+                void **result)
+{
+    unsigned char header[LGQ_RECORD_HEADER];
+
+    size_t limit = available ? *available : SIZE_MAX;
+
+    if (limit < LGQ_RECORD_HEADER ||
+        !ser_read(serial, header, LGQ_RECORD_HEADER))
+        return false;
+
+    size_t size = lgq_get_u32(header);
+
+    if (size > limit - LGQ_RECORD_HEADER || !lgq_reserve(queue, size))
+        return false;
+
+    if (!ser_read(serial, queue->scratch, size) ||
+        lgq_checksum(queue->scratch, size) != lgq_get_u32(header + 4))
+        return false;
+
+    if (available)
+        *available -= LGQ_RECORD_HEADER + size;
+
+    if (result)
+    {
+        *result = queue->interface->deserialize(queue->scratch, size);
+
+        return *result != NULL;
+    }
+
+    return true;
+}
+
+// Counts the complete records of the last segment and cuts anything after
+// them, which is what's left of a write interrupted by a crash
+static bool
+lgq_recover(LogQueue_t *queue)
+{
+    uint64_t first = queue->segments[queue->segments_count - 1];
+
+    int fd = open(lgq_path(queue, NULL, first), O_RDWR);
+
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+
+    Serial_t *serial = fstat(fd, &info) == 0 ? ser_new_fd(fd) : NULL;
+
+    if (!serial)
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)info.st_size, left = size;
+    uint64_t count = 0;
+
+    while (lgq_read_record(queue, serial, &left, NULL))
+        count++;
+
+    ser_free(serial);
+
+    size_t valid = size - left;
+
+    bool truncated = valid == size || ftruncate(fd, (off_t)valid) == 0;
+
+    close(fd);
+
+    queue->tail = first + count;
+    queue->written = valid;
+
+    return truncated;
+}
+
+// Opens the last segment for appending
+static bool
+lgq_open_writer(LogQueue_t *queue, bool create)
+{
+    uint64_t first = queue->segments[queue->segments_count - 1];
+
+    int flags = O_WRONLY | O_APPEND | (create ? O_CREAT | O_EXCL : 0);
+
+    queue->writer_fd = open(lgq_path(queue, NULL, first), flags, 0644);
+
+    if (queue->writer_fd < 0)
+        return false;
+
+    queue->writer = ser_new_fd(queue->writer_fd);
+
+    if (!queue->writer)
+        return false;
+
+    return !create || lgq_sync_directory(queue);
+}
+
+// Makes the last segment durable and starts a new one at the tail
+static bool
+lgq_rotate(LogQueue_t *queue)
+{
+    bool synced = ser_free(queue->writer) && fdatasync(queue->writer_fd) == 0;
+
+    close(queue->writer_fd);
+
+    queue->writer = NULL;
+    queue->writer_fd = -1;
+
+    if (!synced || !lgq_add_segment(queue, queue->tail) ||
+        !lgq_open_writer(queue, true))
+    {
+        queue->failed = true;
+        return false;
+    }
+
+    queue->written = 0;
+
+    return true;
+}
+
+static void
+lgq_close_reader(LogQueue_t *queue)
+{
+    if (queue->reader)
+        ser_free(queue->reader);
+
+    if (queue->reader_fd >= 0)
+        close(queue->reader_fd);
+
+    queue->reader = NULL;
+    queue->reader_fd = -1;
+}
+
+// Opens the segment that has the given record and skips to it
+static bool
+lgq_seek(LogQueue_t *queue, uint64_t sequence)
+{
+    lgq_close_reader(queue);
+
+    integer_t index = queue->segments_count - 1;
+
+    while (index > 0 && queue->segments[index] > sequence)
+        index--;
+
+    queue->reader_fd = open(lgq_path(queue, NULL, queue->segments[index]),
+                            O_RDONLY);
+
+    if (queue->reader_fd < 0)
+        return false;
+
+    queue->reader = ser_new_fd(queue->reader_fd);
+
+    if (!queue->reader)
+        return false;
+
+    queue->reader_segment = index;
+    queue->reader_sequence = queue->segments[index];
+
+    for (; queue->reader_sequence < sequence; queue->reader_sequence++)
+    {
+        if (!lgq_read_record(queue, queue->reader, NULL, NULL))
+            return false;
+    }
+
+    return true;
+}
+
+// Decodes the next records of the log into the empty window
+static bool
+lgq_refill(LogQueue_t *queue)
+{
+    // The reader must see everything that was appended so far
+    if (!ser_flush(queue->writer))
+    {
+        queue->failed = true;
+        return false;
+    }
+
+    if (!queue->reader || queue->reader_sequence != queue->loaded)
+    {
+        if (!lgq_seek(queue, queue->loaded))
+        {
+            queue->failed = true;
+            return false;
+        }
+    }
+
+    while (qli_count(queue->window) < queue->window_size &&
+           queue->loaded < queue->tail)
+    {
+        integer_t next = queue->reader_segment + 1;
+
+        if (next < queue->segments_count &&
+            queue->reader_sequence == queue->segments[next])
+        {
+            if (!lgq_seek(queue, queue->reader_sequence))
+            {
+                queue->failed = true;
+                return false;
+            }
+        }
+
+        void *element;
+
+        if (!lgq_read_record(queue, queue->reader, NULL, &element))
+        {
+            queue->failed = true;
+            return false;
+        }
+
+        if (!qli_enqueue(queue->window, element))
+        {
+            queue->interface->free(element);
+
+            // The reader already passed this record
+            lgq_close_reader(queue);
+
+            break;
+        }
+
+        queue->reader_sequence++;
+        queue->loaded++;
+    }
+
+    return !qli_empty(queue->window);
+}
+
+static void
+lgq_free(LogQueue_t *queue)
+{
+    lgq_close_reader(queue);
+
+    if (queue->writer)
+        ser_free(queue->writer);
+
+    if (queue->writer_fd >= 0)
+        close(queue->writer_fd);
+
+    if (queue->window)
+        qli_free(queue->window);
+
+    free(queue->directory);
+    free(queue->path);
+    free(queue->segments);
+    free(queue->scratch);
+    free(queue);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,405 @@
+/**
+ * @file MappedArray.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "MappedArray.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// A MappedArray_s is a read-only view over a file made of fixed-size
+/// records, like a table of int64_t keys. The file is mapped into memory with
+/// mmap, so opening it costs the same whatever its size: nothing is read or
+/// copied until a record is touched and each record is used in place, without
+/// any allocation. Pages are shared with the page cache and with any other
+/// process that maps the same file.
+///
+/// Records are passed to the interface's compare function as pointers into
+/// the mapping, so functions like compare_int64_t() work directly on a file
+/// of int64_t.
+///
+/// When the records are in ascending order mar_contains(), mar_lower_bound(),
+/// mar_index_first() and mar_index_last() do a binary search in place. Use
+/// mar_sorted() once to check a file that comes from an untrusted source.
+///
+/// Since binary searches jump all around the file, the kernel's default read
+/// ahead mostly wastes I/O on them; call mar_advise() with \c MAR_RANDOM
+/// before a batch of lookups or with \c MAR_SEQUENTIAL before a full scan.
+///
+/// \par Functions
+/// Located in the file MappedArray.c
+struct MappedArray_s
+{
+    /// \brief Start of the mapping.
+    ///
+    /// NULL if the file is empty, since empty files can't be mapped.
+    const char *data;
+
+    /// \brief Size of the mapping in bytes.
+    size_t size;
+
+    /// \brief Size of each record in bytes.
+    size_t element_size;
+
+    /// \brief Amount of records in the file.
+    integer_t count;
+
+    /// \brief MappedArray_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+mar_search(MappedArray_t *array, const void *key, bool upper);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Maps a file that contains only records of \c element_size bytes each, one
+/// after the other. The file is closed right away; the mapping stays valid
+/// until mar_close() is called. The file must not be truncated while it is
+/// mapped.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] path Path to the file.
+/// \param[in] element_size Size in bytes of each record.
+/// \param[in] interface An interface defining all necessary functions for the
+/// array to operate.
+///
+/// \return A new MappedArray_s or NULL if the file couldn't be mapped or if
+/// its size is not a multiple of \c element_size.
+MappedArray_t *
+mar_open(const char *path, size_t element_size, Interface_t *interface)
+{
+    if (element_size == 0)
+        return NULL;
+
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return NULL;
+
+    struct stat info;
+
+    if (fstat(fd, &info) != 0 || info.st_size < 0 ||
+        (size_t)info.st_size % element_size != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    MappedArray_t *array = malloc(sizeof(MappedArray_t));
+
+    if (!array)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    array->data = NULL;
+    array->size = (size_t)info.st_size;
+    array->element_size = element_size;
+    array->count = (integer_t)(array->size / element_size);
+    array->interface = interface;
+
+    if (array->size > 0)
+    {
+        void *data = mmap(NULL, array->size, PROT_READ, MAP_SHARED, fd, 0);
+
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            free(array);
+            return NULL;
+        }
+
+        array->data = data;
+    }
+
+    close(fd);
+
+    return array;
+}
+
+/// Records returned by mar_get() or mar_data() can't be used after this.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The array to be closed.
+///
+/// \return True if the file was unmapped or false if munmap failed.
+bool
+mar_close(MappedArray_t *array)
+{
+    bool unmapped = true;
+
+    if (array->data)
+        unmapped = munmap((void *)array->data, array->size) == 0;
+
+    free(array);
+
+    return unmapped;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+/// \param[in] new_interface A new interface for the array.
+void
+mar_config(MappedArray_t *array, Interface_t *new_interface)
+{
+    array->interface = new_interface;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+///
+/// \return The amount of records in the file.
+integer_t
+mar_count(MappedArray_t *array)
+{
+    return array->count;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+///
+/// \return The size in bytes of each record.
+size_t
+mar_element_size(MappedArray_t *array)
+{
+    return array->element_size;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+///
+/// \return The first byte of the mapped file or NULL if the file is empty.
+const void *
+mar_data(MappedArray_t *array)
+{
+    return array->data;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+/// \param[in] index Index of the record.
+///
+/// \return A pointer to the record inside the mapping or NULL if the index is
+/// out of bounds.
+const void *
+mar_get(MappedArray_t *array, integer_t index)
+{
+    if (index < 0 || index >= array->count)
+        return NULL;
+
+    return array->data + (size_t)index * array->element_size;
+}
+
+/// Wraps madvise(). The advice covers the whole file and can be changed at
+/// any time, for example to \c MAR_SEQUENTIAL for a full scan and then back
+/// to \c MAR_RANDOM for lookups.
+///
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+/// \param[in] access How the records are going to be accessed.
+///
+/// \return True if the advice was given or false if madvise failed.
+bool
+mar_advise(MappedArray_t *array, MappedAccess access)
+{
+    if (!array->data)
+        return true;
+
+    int advice;
+
+    switch (access)
+    {
+        case MAR_SEQUENTIAL:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case MAR_RANDOM:
+            advice = MADV_RANDOM;
+            break;
+        case MAR_WILLNEED:
+            advice = MADV_WILLNEED;
+            break;
+        default:
+            advice = MADV_NORMAL;
+            break;
+    }
+
+    return madvise((void *)array->data, array->size, advice) == 0;
+}
+
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] array The target array.
+///
+/// \return True if the file has no records.
+bool
+mar_empty(MappedArray_t *array)
+{
+    return array->count == 0;
+}
+
+/// Reads the whole file once, so it is worth calling mar_advise() with
+/// \c MAR_SEQUENTIAL before it for big files.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array The target array.
+///
+/// \return True if every record is smaller than or equal to the next one.
+bool
+mar_sorted(MappedArray_t *array)
+{
+    for (integer_t i = 1; i < array->count; i++)
+    {
+        const char *record = array->data + (size_t)i * array->element_size;
+
+        if (array->interface->compare(record - array->element_size,
+                                      record) > 0)
+            return false;
+    }
+
+    return true;
+}
+
+/// The records must be in ascending order.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array The target array.
+/// \param[in] key The key to be searched.
+///
+/// \return True if a record equal to the key was found.
+bool
+mar_contains(MappedArray_t *array, const void *key)
+{
+    return mar_index_first(array, key) >= 0;
+}
+
+/// The records must be in ascending order.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array The target array.
+/// \param[in] key The key to be searched.
+///
+/// \return The index of the first record that is not smaller than the key or
+/// the amount of records if there is none.
+integer_t
+mar_lower_bound(MappedArray_t *array, const void *key)
+{
+    return mar_search(array, key, false);
+}
+
+/// The records must be in ascending order.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array The target array.
+/// \param[in] key The key to be searched.
+///
+/// \return The index of the first record equal to the key or -1 if there is
+/// none.
+integer_t
+mar_index_first(MappedArray_t *array, const void *key)
+{
+    integer_t index = mar_search(array, key, false);
+
+    if (index == array->count ||
+        array->interface->compare(mar_get(array, index), key) != 0)
+        return -1;
+
+    return index;
+}
+
+/// The records must be in ascending order.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] array The target array.
+/// \param[in] key The key to be searched.
+///
+/// \return The index of the last record equal to the key or -1 if there is
+/// none.
+integer_t
+mar_index_last(MappedArray_t *array, const void *key)
+{
+    integer_t index = mar_search(array, key, true) - 1;
+
+    if (index < 0 ||
+        array->interface->compare(mar_get(array, index), key) != 0)
+        return -1;
+
+    return index;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Returns the first index whose record is not smaller than the key, or with
+// upper set, the first one bigger than the key. The loop has no branch on
+// the comparison so that it doesn't stall on mispredictions, which matter
+// as much as cache misses on big files.
+static integer_t
+mar_search(MappedArray_t *array, const void *key, bool upper)
+{
+    if (array->count == 0)
+        return 0;
+
+    // Records equal to the key count as smaller for the upper bound
+    int limit = upper ? 1 : 0;
+
+    compare_f compare = array->interface->compare;
+    size_t element_size = array->element_size;
+
+    const char *base = array->data;
+    integer_t length = array->count;
+
+    while (length > 1)
+    {
+        integer_t half = length / 2;
+
+        const char *middle = base + (size_t)half * element_size;
+
+        base = compare(middle, key) < limit ? middle : base;
+
+        length -= half;
+    }
+
+    integer_t index = (integer_t)((size_t)(base - array->data) / element_size);
+
+    return compare(base, key) < limit ? index + 1 : index;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,619 @@
+/**
+ * @file PairingHeap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "PairingHeap.h"
+
+/// A pairing heap is a heap-ordered multi-way tree where every node keeps
+/// its first child and its siblings in a linked list. Two heaps are joined
+/// by making the root with less priority the first child of the other root,
+/// which takes a single comparison, so inserting an element or melding two
+/// heaps takes constant time.
+///
+/// All the work is done when the root is removed. Its children are linked in
+/// pairs from left to right and the resulting trees are then linked from
+/// right to left into a single tree. This two-pass strategy takes
+/// <code> O(log n) </code> amortized time and keeps the tree shallow.
+///
+/// Every element lives in its own node, so the node can be handed back as a
+/// handle. With a handle an element can be moved up after it gained
+/// priority (decrease-key in a MinHeap), moved anywhere after it changed in
+/// any way or removed from the middle of the heap.
+///
+/// Just like Heap_s, the interface's \c compare function is used and its
+/// result is multiplied by the HeapKind, so in a MaxHeap the root is the
+/// greatest element and in a MinHeap the root is the lowest element.
+struct PairingHeap_s
+{
+    /// \brief What kind of heap this is.
+    ///
+    ///  1 - Max-Heap
+    /// -1 - Min-Heap
+    enum HeapKind_e kind;
+
+    /// \brief The node with the highest priority.
+    struct PairingHeapNode_s *root;
+
+    /// \brief Current amount of elements in the heap.
+    integer_t count;
+
+    /// \brief PairingHeap_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type.
+    struct Interface_s *interface;
+};
+
+/// \brief A PairingHeap_s node.
+///
+/// Implementation detail. The first node of a sibling list points back to
+/// its parent; every other node points back to its left sibling.
+struct PairingHeapNode_s
+{
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief The first child of this node.
+    struct PairingHeapNode_s *child;
+
+    /// \brief The right sibling of this node.
+    struct PairingHeapNode_s *next;
+
+    /// \brief The left sibling or, if this is the first child, the parent.
+    struct PairingHeapNode_s *prev;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static PairingHeapNode_t *
+pqh_link(PairingHeap_t *heap, PairingHeapNode_t *first,
+         PairingHeapNode_t *second);
+
+static void
+pqh_cut(PairingHeapNode_t *node);
+
+static PairingHeapNode_t *
+pqh_merge_pairs(PairingHeap_t *heap, PairingHeapNode_t *first);
+
+static PairingHeapNode_t *
+pqh_parent(PairingHeapNode_t *node);
+
+static void
+pqh_free_nodes(PairingHeap_t *heap, bool elements);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty PairingHeap_s.
+///
+/// \param[in] interface An interface with a compare function.
+/// \param[in] kind If it is a MaxHeap or a MinHeap.
+///
+/// \return A new PairingHeap_s or NULL if the kind is not valid or if
+/// allocation failed.
+PairingHeap_t *
+pqh_new(Interface_t *interface, HeapKind kind)
+{
+    if (!(kind == MaxHeap || kind == MinHeap))
+        return NULL;
+
+    PairingHeap_t *heap = malloc(sizeof(PairingHeap_t));
+
+    if (!heap)
+        return NULL;
+
+    heap->kind = kind;
+    heap->root = NULL;
+    heap->count = 0;
+    heap->interface = interface;
+
+    return heap;
+}
+
+/// Frees the heap, all of its nodes and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+pqh_free(PairingHeap_t *heap)
+{
+    pqh_free_nodes(heap, true);
+
+    free(heap);
+}
+
+/// Frees the heap and all of its nodes, leaving the elements intact.
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+pqh_free_shallow(PairingHeap_t *heap)
+{
+    pqh_free_nodes(heap, false);
+
+    free(heap);
+}
+
+/// Frees every node and element, leaving the heap empty. All handles become
+/// invalid.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be erased.
+void
+pqh_erase(PairingHeap_t *heap)
+{
+    pqh_free_nodes(heap, true);
+}
+
+/// Frees every node, leaving the heap empty and the elements intact. All
+/// handles become invalid.
+///
+/// \param[in] heap The heap to be erased.
+void
+pqh_erase_shallow(PairingHeap_t *heap)
+{
+    pqh_free_nodes(heap, false);
+}
+
+/// \param[in] heap The target heap.
+/// \param[in] new_interface The new interface.
+void
+pqh_config(PairingHeap_t *heap, Interface_t *new_interface)
+{
+    heap->interface = new_interface;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The amount of elements in the heap.
+integer_t
+pqh_count(PairingHeap_t *heap)
+{
+    return heap->count;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return If the heap is a MaxHeap or a MinHeap.
+HeapKind
+pqh_kind(PairingHeap_t *heap)
+{
+    return heap->kind;
+}
+
+/// \param[in] handle A handle returned by pqh_insert().
+///
+/// \return The element referenced by the handle.
+void *
+pqh_element(PairingHeapNode_t *handle)
+{
+    return handle->data;
+}
+
+/// Inserts an element in constant time by linking a new single node tree
+/// with the root. A handle to the element can be retrieved to later change
+/// its priority or to remove it; it stays valid until the element leaves
+/// the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] element The element to be inserted.
+/// \param[out] handle A handle to the element. Can be NULL.
+///
+/// \return True if the element was inserted, false if allocation failed.
+bool
+pqh_insert(PairingHeap_t *heap, void *element, PairingHeapNode_t **handle)
+{
+    PairingHeapNode_t *node = malloc(sizeof(PairingHeapNode_t));
+
+    if (!node)
+        return false;
+
+    node->data = element;
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+
+    if (heap->root)
+        heap->root = pqh_link(heap, heap->root, node);
+    else
+        heap->root = node;
+
+    heap->count++;
+
+    if (handle)
+        *handle = node;
+
+    return true;
+}
+
+/// Removes the root element and links its children with the two-pass
+/// strategy.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[out] result The element with the highest priority.
+///
+/// \return True if an element was removed, false if the heap is empty.
+bool
+pqh_remove(PairingHeap_t *heap, void **result)
+{
+    if (pqh_empty(heap))
+        return false;
+
+    PairingHeapNode_t *root = heap->root;
+
+    *result = root->data;
+
+    heap->root = pqh_merge_pairs(heap, root->child);
+    heap->count--;
+
+    free(root);
+
+    return true;
+}
+
+/// Removes any element of the heap given its handle. The subtree of the
+/// element is cut from the tree, its root is removed and what is left is
+/// linked back with the root of the heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+/// \param[out] result The element referenced by the handle.
+///
+/// \return True if the element was removed, false if the heap is empty.
+bool
+pqh_delete(PairingHeap_t *heap, PairingHeapNode_t *handle, void **result)
+{
+    if (handle == heap->root)
+        return pqh_remove(heap, result);
+
+    if (pqh_empty(heap))
+        return false;
+
+    *result = handle->data;
+
+    pqh_cut(handle);
+
+    PairingHeapNode_t *rest = pqh_merge_pairs(heap, handle->child);
+
+    if (rest)
+        heap->root = pqh_link(heap, heap->root, rest);
+
+    heap->count--;
+
+    free(handle);
+
+    return true;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The element with the highest priority or NULL if the heap is
+/// empty.
+void *
+pqh_peek(PairingHeap_t *heap)
+{
+    if (pqh_empty(heap))
+        return NULL;
+
+    return heap->root->data;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return True if the heap is empty, otherwise false.
+bool
+pqh_empty(PairingHeap_t *heap)
+{
+    return heap->count == 0;
+}
+
+/// Restores the heap after an element referenced by a handle gained
+/// priority, that is, it was decreased in a MinHeap or increased in a
+/// MaxHeap. The subtree of the element is cut and linked with the root in
+/// constant time. If the element lost priority use pqh_update() instead.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+///
+/// \return True if the operation was successful, false if the heap is
+/// empty.
+bool
+pqh_decrease_key(PairingHeap_t *heap, PairingHeapNode_t *handle)
+{
+    if (pqh_empty(heap))
+        return false;
+
+    if (handle == heap->root)
+        return true;
+
+    pqh_cut(handle);
+
+    heap->root = pqh_link(heap, heap->root, handle);
+
+    return true;
+}
+
+/// Restores the heap after an element referenced by a handle was changed in
+/// any way. The node is taken out of the tree, its children are linked in
+/// its place and the node is then linked back with the root.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The target heap.
+/// \param[in] handle A handle to an element of this heap.
+///
+/// \return True if the operation was successful, false if the heap is
+/// empty.
+bool
+pqh_update(PairingHeap_t *heap, PairingHeapNode_t *handle)
+{
+    if (pqh_empty(heap))
+        return false;
+
+    PairingHeapNode_t *rest = pqh_merge_pairs(heap, handle->child);
+
+    handle->child = NULL;
+
+    if (handle == heap->root)
+    {
+        heap->root = rest ? pqh_link(heap, rest, handle) : handle;
+
+        return true;
+    }
+
+    pqh_cut(handle);
+
+    if (rest)
+        heap->root = pqh_link(heap, heap->root, rest);
+
+    heap->root = pqh_link(heap, heap->root, handle);
+
+    return true;
+}
+
+/// Moves every element of \c other into \c heap in constant time, leaving
+/// \c other empty. The handles to the elements of \c other stay valid and
+/// now belong to \c heap.
+///
+/// \par Interface Requirements
+/// - compare
+///
+/// \param[in] heap The heap that receives the elements.
+/// \param[in] other The heap to be emptied.
+///
+/// \return True if the heaps were melded, false if they are the same heap or
+/// if they are not of the same kind.
+bool
+pqh_meld(PairingHeap_t *heap, PairingHeap_t *other)
+{
+    if (heap == other || heap->kind != other->kind)
+        return false;
+
+    if (pqh_empty(other))
+        return true;
+
+    if (heap->root)
+        heap->root = pqh_link(heap, heap->root, other->root);
+    else
+        heap->root = other->root;
+
+    heap->count += other->count;
+
+    other->root = NULL;
+    other->count = 0;
+
+    return true;
+}
+
+/// Displays the heap as a tree where each child is indented below its
+/// parent.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] heap The heap to be displayed.
+void
+pqh_display(PairingHeap_t *heap)
+{
+    if (pqh_empty(heap))
+    {
+        printf("\nPairing Heap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nPairing Heap\n");
+
+    // Iterative pre-order traversal, climbing back through the prev links
+    PairingHeapNode_t *node = heap->root;
+    integer_t depth = 0;
+
+    while (node)
+    {
+        for (integer_t i = 0; i < depth; i++)
+            printf("|  ");
+
+        heap->interface->display(node->data);
+        printf("\n");
+
+        if (node->child)
+        {
+            node = node->child;
+            depth++;
+
+            continue;
+        }
+
+        while (node && !node->next)
+        {
+            node = pqh_parent(node);
+            depth--;
+        }
+
+        if (node)
+            node = node->next;
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Links two trees whose roots have no siblings. The root with less priority
+// becomes the first child of the other one, which is returned. On a tie the
+// first root stays on top.
+static PairingHeapNode_t *
+pqh_link(PairingHeap_t *heap, PairingHeapNode_t *first,
+         PairingHeapNode_t *second)
+{
+    if (heap->interface->compare(second->data, first->data) * heap->kind > 0)
+    {
+        PairingHeapNode_t *temp = first;
+        first = second;
+        second = temp;
+    }
+
+    second->prev = first;
+    second->next = first->child;
+
+    if (first->child)
+        first->child->prev = second;
+
+    first->child = second;
+
+    return first;
+}
+
+// Unlinks a node that is not the root, together with its subtree, from its
+// parent and siblings
+static void
+pqh_cut(PairingHeapNode_t *node)
+{
+    if (node->prev->child == node)
+        node->prev->child = node->next;
+    else
+        node->prev->next = node->next;
+
+    if (node->next)
+        node->next->prev = node->prev;
+
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+// Links a list of siblings into a single tree with the two-pass strategy and
+// returns its root. The trees of the first pass are chained through prev.
+static PairingHeapNode_t *
+pqh_merge_pairs(PairingHeap_t *heap, PairingHeapNode_t *first)
+{
+    if (!first)
+        return NULL;
+
+    PairingHeapNode_t *pairs = NULL;
+
+    // First pass: link pairs from left to right
+    while (first)
+    {
+        PairingHeapNode_t *a = first;
+        PairingHeapNode_t *b = first->next;
+
+        a->next = NULL;
+
+        if (b)
+        {
+            first = b->next;
+
+            a->prev = NULL;
+            b->prev = NULL;
+            b->next = NULL;
+
+            a = pqh_link(heap, a, b);
+        }
+        else
+        {
+            first = NULL;
+        }
+
+        a->prev = pairs;
+        pairs = a;
+    }
+
+    // Second pass: link the trees from right to left
+    PairingHeapNode_t *root = pairs;
+
+    pairs = pairs->prev;
+    root->prev = NULL;
+
+    while (pairs)
+    {
+        PairingHeapNode_t *next = pairs->prev;
+
+        pairs->prev = NULL;
+
+        root = pqh_link(heap, root, pairs);
+
+        pairs = next;
+    }
+
+    return root;
+}
+
+// Returns the parent of a node or NULL if it is the root
+static PairingHeapNode_t *
+pqh_parent(PairingHeapNode_t *node)
+{
+    while (node->prev && node->prev->child != node)
+        node = node->prev;
+
+    return node->prev;
+}
+
+// Frees every node without recursion by splicing the children of each node
+// right after it in the sibling list
+static void
+pqh_free_nodes(PairingHeap_t *heap, bool elements)
+{
+    PairingHeapNode_t *node = heap->root;
+
+    while (node)
+    {
+        if (node->child)
+        {
+            PairingHeapNode_t *last = node->child;
+
+            while (last->next)
+                last = last->next;
+
+            last->next = node->next;
+            node->next = node->child;
+        }
+
+        PairingHeapNode_t *next = node->next;
+
+        if (elements)
+            heap->interface->free(node->data);
+
+        free(node);
+
+        node = next;
+    }
+
+    heap->root = NULL;
+    heap->count = 0;
+}
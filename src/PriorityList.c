@@ -631,6 +631,99 @@ pli_display(PriorityList_t *plist, int display_mode)
     }
 }
 
+/// Saves the list's elements from the front, the one with the highest
+/// priority, to the back. Each element is encoded by the interface's codec.
+/// See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] plist The priority list to be saved.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return True if the list was saved or false if writing failed.
+bool
+pli_serialize(PriorityList_t *plist, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_PRIORITY_LIST, 0, plist->count))
+        return false;
+
+    for (PriorityListNode_t *scan = plist->front; scan; scan = scan->next)
+    {
+        if (!ser_write_element(serial, plist->interface->serialize,
+                               scan->data))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with pli_serialize(). Since they were saved in
+/// priority order each node is linked after the previous one, without
+/// comparing priorities.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] plist An empty priority list.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return True if all elements were loaded. False if the list is not empty,
+/// if the elements don't fit in the list's limit, if the stream is not a
+/// valid PriorityList_s or if reading failed, in which case the list is left
+/// empty.
+bool
+pli_deserialize(PriorityList_t *plist, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!pli_empty(plist))
+        return false;
+
+    if (!ser_read_header(serial, SER_PRIORITY_LIST, &layout, &count))
+        return false;
+
+    if (plist->limit > 0 && count > plist->limit)
+        return false;
+
+    PriorityListNode_t *back = NULL;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, plist->interface->deserialize, &element))
+        {
+            pli_erase(plist);
+            return false;
+        }
+
+        PriorityListNode_t *node = pli_new_node(element);
+
+        if (!node)
+        {
+            plist->interface->free(element);
+            pli_erase(plist);
+            return false;
+        }
+
+        if (back == NULL)
+            plist->front = node;
+        else
+            back->next = node;
+
+        back = node;
+
+        plist->count++;
+    }
+
+    plist->version_id++;
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static PriorityListNode_t *
@@ -666,7 +759,206 @@ pli_free_node_shallow(PriorityListNode_t *node)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo PriorityListIterator
+/// This iterator is a forward-only iterator that visits the elements from the
+/// highest to the lowest priority. There is no way to set an element through
+/// it since that could break the ordering of the list. Its cursor is
+/// represented by a pointer to one of the list's nodes.
+struct PriorityListIterator_s
+{
+    /// \brief Target PriorityList_s.
+    ///
+    /// Target PriorityList_s. The iterator might need to use some information
+    /// provided by the list or change some of its data members.
+    struct PriorityList_s *target;
+
+    /// \brief Current element.
+    ///
+    /// Points to the current node. The iterator is always initialized with the
+    /// cursor pointing to the front of the list.
+    struct PriorityListNode_s *cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure. This is kept to prevent iteration on the target structure
+    /// that may have been modified and thus causing undefined behaviours or
+    /// run-time crashes.
+    integer_t target_id;
+};
+
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t pli_iter_size = sizeof(PriorityListIterator_t);
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+pli_iter_target_modified(PriorityListIterator_t *iter);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Allocates a new iterator positioned at the front of the target list.
+///
+/// \param[in] target The priority list to be iterated.
+///
+/// \return NULL if the list is empty or if the allocation failed, otherwise a
+/// new iterator.
+PriorityListIterator_t *
+pli_iter_new(PriorityList_t *target)
+{
+    if (pli_empty(target))
+        return NULL;
+
+    PriorityListIterator_t *iter = malloc(sizeof(PriorityListIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    pli_iter_init(iter, target);
+
+    return iter;
+}
+
+/// Initializes an iterator allocated by the user, usually on the stack with
+/// \c pli_iter_size, positioned at the front of the target list.
+///
+/// \param[in,out] iter The iterator to be initialized.
+/// \param[in] target The priority list to be iterated.
+///
+/// \return False if the list is empty, otherwise true.
+bool
+pli_iter_init(PriorityListIterator_t *iter, PriorityList_t *target)
+{
+    if (pli_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->front;
+
+    return true;
+}
+
+/// Changes the target of an iterator and moves its cursor to the front.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new priority list to be iterated.
+void
+pli_iter_retarget(PriorityListIterator_t *iter, PriorityList_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->front;
+}
+
+/// Frees from memory an iterator created with pli_iter_new().
+///
+/// \param[in] iter The iterator to be freed.
+void
+pli_iter_free(PriorityListIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor to the next element with a lower or equal priority.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified or if the cursor is at the last
+/// element, otherwise true.
+bool
+pli_iter_next(PriorityListIterator_t *iter)
+{
+    if (pli_iter_target_modified(iter))
+        return false;
+
+    if (!pli_iter_has_next(iter))
+        return false;
+
+    iter->cursor = iter->cursor->next;
+
+    return true;
+}
+
+/// Moves the cursor to the element with the highest priority.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+pli_iter_to_front(PriorityListIterator_t *iter)
+{
+    if (pli_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->front;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element after the cursor, otherwise false.
+bool
+pli_iter_has_next(PriorityListIterator_t *iter)
+{
+    return iter->cursor->next != NULL;
+}
+
+/// Retrieves the element pointed by the cursor.
+///
+/// \param[in] iter The iterator.
+/// \param[out] result The current element.
+///
+/// \return False if the list was modified, otherwise true.
+bool
+pli_iter_get(PriorityListIterator_t *iter, void **result)
+{
+    if (pli_iter_target_modified(iter))
+        return false;
+
+    *result = iter->cursor->data;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the list was modified or if there is no next element,
+/// otherwise the element after the cursor.
+void *
+pli_iter_peek_next(PriorityListIterator_t *iter)
+{
+    if (pli_iter_target_modified(iter))
+        return NULL;
+
+    if (!pli_iter_has_next(iter))
+        return NULL;
+
+    return iter->cursor->next->data;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the list was modified, otherwise the current element.
+void *
+pli_iter_peek(PriorityListIterator_t *iter)
+{
+    if (pli_iter_target_modified(iter))
+        return NULL;
+
+    return iter->cursor->data;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+pli_iter_target_modified(PriorityListIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
@@ -812,6 +812,79 @@ qar_display(QueueArray_t *queue, int display_mode)
     }
 }
 
+/// Saves the queue's elements from the front to the rear, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] queue The queue to be saved.
+/// \param[in] serial The stream where the queue is written to.
+///
+/// \return True if the queue was saved or false if writing failed.
+bool
+qar_serialize(QueueArray_t *queue, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_QUEUE_ARRAY, 0, queue->count))
+        return false;
+
+    for (integer_t i = queue->front, j = 0;
+         j < queue->count;
+         i = (i + 1) % queue->capacity, j++)
+    {
+        if (!ser_write_element(serial, queue->interface->serialize,
+                               queue->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with qar_serialize(), keeping the same front.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] queue An empty queue.
+/// \param[in] serial The stream where the queue is read from.
+///
+/// \return True if all elements were loaded. False if the queue is not empty,
+/// if the stream is not a valid QueueArray_s, if reading failed or if the
+/// queue couldn't grow, in which case the queue is left empty.
+bool
+qar_deserialize(QueueArray_t *queue, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!qar_empty(queue))
+        return false;
+
+    if (!ser_read_header(serial, SER_QUEUE_ARRAY, &layout, &count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, queue->interface->deserialize, &element))
+        {
+            qar_erase(queue);
+            return false;
+        }
+
+        if (!qar_enqueue(queue, element))
+        {
+            queue->interface->free(element);
+            qar_erase(queue);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // This function reallocates the data buffer effectively increasing its
@@ -904,7 +977,307 @@ static qar_grow(QueueArray_t *queue)
 ////////////////////////////////////////////////////////////////// Iterator ///
 ///////////////////////////////////////////////////////////////////////////////
 
-/// \todo QueueArrayIterator
+/// This iterator can traverse the queue both ways. Its cursor is the position
+/// of the current element counted from the front, so it is translated to an
+/// index of the circular buffer on every access and it doesn't matter where
+/// in the buffer the elements actually are.
+struct QueueArrayIterator_s
+{
+    /// \brief Target QueueArray_s.
+    ///
+    /// Target QueueArray_s. The iterator might need to use some information
+    /// provided by the queue or change some of its data members.
+    struct QueueArray_s *target;
+
+    /// \brief Current element.
+    ///
+    /// Position of the current element. The iterator is always initialized
+    /// with 0, that is, the front of the queue.
+    integer_t cursor;
+
+    /// \brief Target version ID.
+    ///
+    /// When the iterator is initialized it stores the version_id of the target
+    /// structure. This is kept to prevent iteration on the target structure
+    /// that may have been modified and thus causing undefined behaviours or
+    /// run-time crashes.
+    integer_t target_id;
+};
+
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t qar_iter_size = sizeof(QueueArrayIterator_t);
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+qar_iter_target_modified(QueueArrayIterator_t *iter);
+
+static void **
+qar_iter_slot(QueueArrayIterator_t *iter, integer_t position);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Allocates a new iterator positioned at the front of the target queue.
+///
+/// \param[in] target The queue to be iterated.
+///
+/// \return NULL if the queue is empty or if the allocation failed, otherwise
+/// a new iterator.
+QueueArrayIterator_t *
+qar_iter_new(QueueArray_t *target)
+{
+    if (qar_empty(target))
+        return NULL;
+
+    QueueArrayIterator_t *iter = malloc(sizeof(QueueArrayIterator_t));
+
+    if (!iter)
+        return NULL;
+
+    qar_iter_init(iter, target);
+
+    return iter;
+}
+
+/// Initializes an iterator allocated by the user, usually on the stack with
+/// \c qar_iter_size, positioned at the front of the target queue.
+///
+/// \param[in,out] iter The iterator to be initialized.
+/// \param[in] target The queue to be iterated.
+///
+/// \return False if the queue is empty, otherwise true.
+bool
+qar_iter_init(QueueArrayIterator_t *iter, QueueArray_t *target)
+{
+    if (qar_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Changes the target of an iterator and moves its cursor to the front.
+///
+/// \param[in] iter The iterator to be retargeted.
+/// \param[in] target The new queue to be iterated.
+void
+qar_iter_retarget(QueueArrayIterator_t *iter, QueueArray_t *target)
+{
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+}
+
+/// Frees from memory an iterator created with qar_iter_new().
+///
+/// \param[in] iter The iterator to be freed.
+void
+qar_iter_free(QueueArrayIterator_t *iter)
+{
+    free(iter);
+}
+
+/// Moves the cursor one position towards the rear.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the queue was modified or if the cursor is at the rear,
+/// otherwise true.
+bool
+qar_iter_next(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    if (!qar_iter_has_next(iter))
+        return false;
+
+    iter->cursor++;
+
+    return true;
+}
+
+/// Moves the cursor one position towards the front.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the queue was modified or if the cursor is at the front,
+/// otherwise true.
+bool
+qar_iter_prev(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    if (!qar_iter_has_prev(iter))
+        return false;
+
+    iter->cursor--;
+
+    return true;
+}
+
+/// Moves the cursor to the front of the queue.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the queue was modified, otherwise true.
+bool
+qar_iter_to_front(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = 0;
+
+    return true;
+}
+
+/// Moves the cursor to the rear of the queue.
+///
+/// \param[in] iter The iterator.
+///
+/// \return False if the queue was modified, otherwise true.
+bool
+qar_iter_to_rear(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    iter->cursor = iter->target->count - 1;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element after the cursor, otherwise false.
+bool
+qar_iter_has_next(QueueArrayIterator_t *iter)
+{
+    return iter->cursor < iter->target->count - 1;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return True if there is an element before the cursor, otherwise false.
+bool
+qar_iter_has_prev(QueueArrayIterator_t *iter)
+{
+    return iter->cursor > 0;
+}
+
+/// Retrieves the element pointed by the cursor.
+///
+/// \param[in] iter The iterator.
+/// \param[out] result The current element.
+///
+/// \return False if the queue was modified, otherwise true.
+bool
+qar_iter_get(QueueArrayIterator_t *iter, void **result)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    *result = *qar_iter_slot(iter, iter->cursor);
+
+    return true;
+}
+
+/// Replaces the element pointed by the cursor, freeing the old one.
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] iter The iterator.
+/// \param[in] element The new element.
+///
+/// \return False if the queue was modified, otherwise true.
+bool
+qar_iter_set(QueueArrayIterator_t *iter, void *element)
+{
+    if (qar_iter_target_modified(iter))
+        return false;
+
+    void **slot = qar_iter_slot(iter, iter->cursor);
+
+    iter->target->interface->free(*slot);
+
+    *slot = element;
+
+    return true;
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the queue was modified or if there is no next element,
+/// otherwise the element after the cursor.
+void *
+qar_iter_peek_next(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return NULL;
+
+    if (!qar_iter_has_next(iter))
+        return NULL;
+
+    return *qar_iter_slot(iter, iter->cursor + 1);
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the queue was modified, otherwise the current element.
+void *
+qar_iter_peek(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return NULL;
+
+    return *qar_iter_slot(iter, iter->cursor);
+}
+
+/// \param[in] iter The iterator.
+///
+/// \return NULL if the queue was modified or if there is no previous element,
+/// otherwise the element before the cursor.
+void *
+qar_iter_peek_prev(QueueArrayIterator_t *iter)
+{
+    if (qar_iter_target_modified(iter))
+        return NULL;
+
+    if (!qar_iter_has_prev(iter))
+        return NULL;
+
+    return *qar_iter_slot(iter, iter->cursor - 1);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+qar_iter_target_modified(QueueArrayIterator_t *iter)
+{
+    return iter->target_id != iter->target->version_id;
+}
+
+// Returns the buffer slot of an element given its position from the front
+static void **
+qar_iter_slot(QueueArrayIterator_t *iter, integer_t position)
+{
+    QueueArray_t *queue = iter->target;
+
+    integer_t index = queue->front + position;
+
+    if (index >= queue->capacity)
+        index -= queue->capacity;
+
+    return &queue->buffer[index];
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////// Wrapper ///
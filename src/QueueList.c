@@ -143,6 +143,9 @@ qli_free_node(QueueListNode_t *node, free_f function);
 static void
 qli_free_node_shallow(QueueListNode_t *node);
 
+static QueueListNode_t *
+qli_node_at(QueueList_t *queue, integer_t position);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a new QueueList_s with a given interface that contains
@@ -689,7 +692,7 @@ qli_compare(QueueList_t *queue1, QueueList_t *queue2)
 }
 
 /// Appends \c queue2 at the rear of \c queue1, emptying queue2. Both queues
-/// need to have been initialized.
+/// need to have been initialized. The nodes are relinked in constant time.
 /// \par Interface Requirements
 /// - None
 ///
@@ -700,7 +703,84 @@ qli_compare(QueueList_t *queue1, QueueList_t *queue2)
 bool
 qli_append(QueueList_t *queue1, QueueList_t *queue2)
 {
-    /// \todo qli_append
+    if (qli_empty(queue2))
+        return queue1 != queue2;
+
+    return qli_splice(queue1, queue1->count, queue2, 0, queue2->count - 1);
+}
+
+/// Moves the elements of \c src from position \c from to position \c to, both
+/// inclusive and counted from the front, into \c dst so that the first of
+/// them ends up at position \c dst_pos. The nodes are relinked, not copied,
+/// and the counts of both queues are updated with the size of the range.
+/// Since the nodes only link towards the rear, positions are reached by
+/// walking from the front, except for the rear itself which is reached
+/// directly.
+/// \par Interface Requirements
+/// - None
+///
+/// \param[in] dst Queue to receive the elements.
+/// \param[in] dst_pos Position of \c dst where the elements are inserted.
+/// \param[in] src Queue where the elements are taken from.
+/// \param[in] from Position of the first element to be moved.
+/// \param[in] to Position of the last element to be moved.
+///
+/// \return False if both queues are the same, if any position is out of
+/// range or if the elements don't fit in \c dst, otherwise true.
+bool
+qli_splice(QueueList_t *dst, integer_t dst_pos, QueueList_t *src,
+           integer_t from, integer_t to)
+{
+    if (dst == src || from < 0 || from > to || to >= src->count)
+        return false;
+
+    if (dst_pos < 0 || dst_pos > dst->count)
+        return false;
+
+    integer_t count = to - from + 1;
+
+    if (!qli_fits(dst, (unsigned_t)count))
+        return false;
+
+    // Nodes link to the rear with prev
+    QueueListNode_t *before = from == 0 ? NULL : qli_node_at(src, from - 1);
+    QueueListNode_t *first = before == NULL ? src->front : before->prev;
+    QueueListNode_t *last = qli_node_at(src, to);
+
+    if (before == NULL)
+        src->front = last->prev;
+    else
+        before->prev = last->prev;
+
+    if (last == src->rear)
+        src->rear = before;
+
+    // The range goes behind this node or at the front if NULL
+    QueueListNode_t *after = NULL;
+
+    if (dst_pos > 0)
+        after = qli_node_at(dst, dst_pos - 1);
+
+    if (after == NULL)
+    {
+        last->prev = dst->front;
+        dst->front = first;
+    }
+    else
+    {
+        last->prev = after->prev;
+        after->prev = first;
+    }
+
+    if (last->prev == NULL)
+        dst->rear = last;
+
+    src->count -= count;
+    dst->count += count;
+
+    src->version_id++;
+    dst->version_id++;
+
     return true;
 }
 
@@ -809,6 +889,79 @@ qli_display(QueueList_t *queue, int display_mode)
     }
 }
 
+/// Saves the queue's elements from the front to the rear, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] queue The queue to be saved.
+/// \param[in] serial The stream where the queue is written to.
+///
+/// \return True if the queue was saved or false if writing failed.
+bool
+qli_serialize(QueueList_t *queue, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_QUEUE_LIST, 0, queue->count))
+        return false;
+
+    for (QueueListNode_t *scan = queue->front; scan != NULL; scan = scan->prev)
+    {
+        if (!ser_write_element(serial, queue->interface->serialize,
+                               scan->data))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with qli_serialize(), keeping the same front.
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] queue An empty queue.
+/// \param[in] serial The stream where the queue is read from.
+///
+/// \return True if all elements were loaded. False if the queue is not empty,
+/// if the elements don't fit in the queue's limit, if the stream is not a
+/// valid QueueList_s or if reading failed, in which case the queue is left
+/// empty.
+bool
+qli_deserialize(QueueList_t *queue, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!qli_empty(queue))
+        return false;
+
+    if (!ser_read_header(serial, SER_QUEUE_LIST, &layout, &count))
+        return false;
+
+    if (!qli_fits(queue, (unsigned_t)count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, queue->interface->deserialize, &element))
+        {
+            qli_erase(queue);
+            return false;
+        }
+
+        if (!qli_enqueue(queue, element))
+        {
+            queue->interface->free(element);
+            qli_erase(queue);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static QueueListNode_t *
@@ -838,6 +991,21 @@ qli_free_node_shallow(QueueListNode_t *node)
     free(node);
 }
 
+// Returns the node at a valid position counted from the front
+static QueueListNode_t *
+qli_node_at(QueueList_t *queue, integer_t position)
+{
+    if (position == queue->count - 1)
+        return queue->rear;
+
+    QueueListNode_t *scan = queue->front;
+
+    for (integer_t i = 0; i < position; i++)
+        scan = scan->prev;
+
+    return scan;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -869,6 +1037,10 @@ struct QueueListIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t qli_iter_size = sizeof(QueueListIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool
@@ -0,0 +1,488 @@
+/**
+ * @file RadixHeap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "RadixHeap.h"
+#include <inttypes.h>
+
+/// \brief Amount of buckets, one for the last removed key and one for each
+/// bit of a key.
+#define RXH_BUCKETS 65
+
+/// \brief Initial capacity of a bucket.
+#define RXH_INITIAL_CAPACITY 8
+
+/// \brief An element and its key.
+struct RadixHeapEntry_s
+{
+    /// \brief The key of the element.
+    uint64_t key;
+
+    /// \brief Data pointer.
+    void *data;
+};
+
+/// \brief A RadixHeap_s bucket.
+///
+/// Implementation detail. An unordered buffer of entries.
+struct RadixHeapBucket_s
+{
+    /// \brief Buffer of entries.
+    struct RadixHeapEntry_s *buffer;
+
+    /// \brief Amount of entries in the buffer.
+    integer_t count;
+
+    /// \brief Size of the buffer.
+    integer_t capacity;
+};
+
+/// A radix heap is a min-heap for unsigned integer keys that only works if
+/// the keys removed never decrease, which is the case of event simulations
+/// and of Dijkstra's algorithm with non-negative weights. An element can
+/// only be inserted with a key not lower than the last removed key.
+///
+/// Elements are kept in unordered buckets according to the highest bit
+/// where their key differs from the last removed key, \c last:
+/// - Bucket 0 : keys equal to \c last
+/// - Bucket i : keys whose highest bit that differs from \c last is
+///   <code> i - 1 </code>
+///
+/// Inserting an element is a XOR and a count of leading zeros away from its
+/// bucket. When bucket 0 is empty, the first non-empty bucket is found and
+/// its lowest key becomes \c last. Every key of that bucket now differs from
+/// \c last at a lower bit, so the bucket is spread over lower buckets and
+/// bucket 0 is no longer empty. Since an element only ever moves down, there
+/// are at most 64 moves per element and an element costs
+/// <code> O(log C) </code> amortized, where \c C is the largest difference
+/// between a key and \c last.
+///
+/// No element comparisons happen beyond the scan of the bucket that is
+/// spread, and every bucket is a contiguous buffer, so the heap makes far
+/// fewer calls through the interface and far fewer cache misses than a
+/// comparison-based heap.
+struct RadixHeap_s
+{
+    /// \brief Buckets of entries.
+    struct RadixHeapBucket_s buckets[RXH_BUCKETS];
+
+    /// \brief Bit <code> i - 1 </code> is set if bucket \c i is not empty.
+    uint64_t mask;
+
+    /// \brief The key of the last removed or peeked element.
+    uint64_t last;
+
+    /// \brief Current amount of elements in the heap.
+    integer_t count;
+
+    /// \brief RadixHeap_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. Keys are compared directly,
+    /// so the interface only needs a free and a display function.
+    struct Interface_s *interface;
+};
+
+typedef struct RadixHeapEntry_s RadixHeapEntry_t;
+
+typedef struct RadixHeapBucket_s RadixHeapBucket_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static integer_t
+rxh_bucket_of(uint64_t key, uint64_t last);
+
+static bool
+rxh_reserve(RadixHeapBucket_t *bucket, integer_t amount);
+
+static bool
+rxh_settle(RadixHeap_t *heap);
+
+static void
+rxh_clear(RadixHeap_t *heap, bool elements);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty RadixHeap_s. Buckets only allocate their buffers
+/// once they receive their first element.
+///
+/// \param[in] interface An interface with a free and a display function.
+///
+/// \return A new RadixHeap_s or NULL if allocation failed.
+RadixHeap_t *
+rxh_new(Interface_t *interface)
+{
+    RadixHeap_t *heap = malloc(sizeof(RadixHeap_t));
+
+    if (!heap)
+        return NULL;
+
+    for (integer_t i = 0; i < RXH_BUCKETS; i++)
+    {
+        heap->buckets[i].buffer = NULL;
+        heap->buckets[i].count = 0;
+        heap->buckets[i].capacity = 0;
+    }
+
+    heap->mask = 0;
+    heap->last = 0;
+    heap->count = 0;
+    heap->interface = interface;
+
+    return heap;
+}
+
+/// Frees the heap and all of its elements.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+rxh_free(RadixHeap_t *heap)
+{
+    rxh_clear(heap, true);
+
+    for (integer_t i = 0; i < RXH_BUCKETS; i++)
+        free(heap->buckets[i].buffer);
+
+    free(heap);
+}
+
+/// Frees the heap, leaving the elements intact.
+///
+/// \param[in] heap The heap to be freed from memory.
+void
+rxh_free_shallow(RadixHeap_t *heap)
+{
+    for (integer_t i = 0; i < RXH_BUCKETS; i++)
+        free(heap->buckets[i].buffer);
+
+    free(heap);
+}
+
+/// Frees every element, leaving the heap empty. The buckets keep their
+/// buffers and any key can be inserted again.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] heap The heap to be erased.
+void
+rxh_erase(RadixHeap_t *heap)
+{
+    rxh_clear(heap, true);
+}
+
+/// Removes every element, leaving them intact. The buckets keep their
+/// buffers and any key can be inserted again.
+///
+/// \param[in] heap The heap to be erased.
+void
+rxh_erase_shallow(RadixHeap_t *heap)
+{
+    rxh_clear(heap, false);
+}
+
+/// \param[in] heap The target heap.
+/// \param[in] new_interface The new interface.
+void
+rxh_config(RadixHeap_t *heap, Interface_t *new_interface)
+{
+    heap->interface = new_interface;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The amount of elements in the heap.
+integer_t
+rxh_count(RadixHeap_t *heap)
+{
+    return heap->count;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return The key of the last removed or peeked element, which is the
+/// lowest key that can still be inserted, or 0 if there is none since the
+/// heap was created or erased.
+uint64_t
+rxh_last(RadixHeap_t *heap)
+{
+    return heap->last;
+}
+
+/// Inserts an element in constant time.
+///
+/// \param[in] heap The target heap.
+/// \param[in] key The key of the element.
+/// \param[in] element The element to be inserted.
+///
+/// \return True if the element was inserted, false if the key is lower than
+/// the last removed key or if allocation failed.
+bool
+rxh_insert(RadixHeap_t *heap, uint64_t key, void *element)
+{
+    if (key < heap->last)
+        return false;
+
+    integer_t index = rxh_bucket_of(key, heap->last);
+    RadixHeapBucket_t *bucket = &heap->buckets[index];
+
+    if (!rxh_reserve(bucket, 1))
+        return false;
+
+    bucket->buffer[bucket->count].key = key;
+    bucket->buffer[bucket->count].data = element;
+    bucket->count++;
+
+    if (index > 0)
+        heap->mask |= UINT64_C(1) << (index - 1);
+
+    heap->count++;
+
+    return true;
+}
+
+/// Removes an element with the lowest key. Elements with the same key are
+/// not removed in any particular order.
+///
+/// \param[in] heap The target heap.
+/// \param[out] key The key of the removed element. Can be NULL.
+/// \param[out] result The removed element.
+///
+/// \return True if an element was removed, false if the heap is empty or
+/// if allocation failed.
+bool
+rxh_remove(RadixHeap_t *heap, uint64_t *key, void **result)
+{
+    if (rxh_empty(heap))
+        return false;
+
+    if (!rxh_settle(heap))
+        return false;
+
+    RadixHeapBucket_t *bucket = &heap->buckets[0];
+
+    bucket->count--;
+
+    if (key)
+        *key = bucket->buffer[bucket->count].key;
+
+    *result = bucket->buffer[bucket->count].data;
+
+    heap->count--;
+
+    return true;
+}
+
+/// Returns an element with the lowest key. Like rxh_remove(), this makes
+/// its key the lowest key that can be inserted.
+///
+/// \param[in] heap The target heap.
+/// \param[out] key The key of the element. Can be NULL.
+///
+/// \return An element with the lowest key or NULL if the heap is empty or
+/// if allocation failed.
+void *
+rxh_peek(RadixHeap_t *heap, uint64_t *key)
+{
+    if (rxh_empty(heap))
+        return NULL;
+
+    if (!rxh_settle(heap))
+        return NULL;
+
+    RadixHeapBucket_t *bucket = &heap->buckets[0];
+
+    if (key)
+        *key = bucket->buffer[bucket->count - 1].key;
+
+    return bucket->buffer[bucket->count - 1].data;
+}
+
+/// \param[in] heap The target heap.
+///
+/// \return True if the heap is empty, otherwise false.
+bool
+rxh_empty(RadixHeap_t *heap)
+{
+    return heap->count == 0;
+}
+
+/// Displays every non-empty bucket and its elements with their keys.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] heap The heap to be displayed.
+void
+rxh_display(RadixHeap_t *heap)
+{
+    if (rxh_empty(heap))
+    {
+        printf("\nRadix Heap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nRadix Heap (last key %" PRIu64 ")\n", heap->last);
+
+    for (integer_t i = 0; i < RXH_BUCKETS; i++)
+    {
+        RadixHeapBucket_t *bucket = &heap->buckets[i];
+
+        if (bucket->count == 0)
+            continue;
+
+        printf("%2" PRIdMAX " : [ ", i);
+
+        for (integer_t j = 0; j < bucket->count; j++)
+        {
+            printf("%" PRIu64 ":", bucket->buffer[j].key);
+            heap->interface->display(bucket->buffer[j].data);
+            printf(j < bucket->count - 1 ? ", " : " ");
+        }
+
+        printf("]\n");
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Returns the bucket of a key given the last removed key, which is one past
+// the index of the highest bit where they differ
+static integer_t
+rxh_bucket_of(uint64_t key, uint64_t last)
+{
+    uint64_t diff = key ^ last;
+
+    if (diff == 0)
+        return 0;
+
+#if defined(__GNUC__)
+    return 64 - __builtin_clzll(diff);
+#else
+    integer_t bucket = 0;
+
+    while (diff)
+    {
+        diff >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+#endif
+}
+
+// Makes room for more entries in a bucket
+static bool
+rxh_reserve(RadixHeapBucket_t *bucket, integer_t amount)
+{
+    if (bucket->count + amount <= bucket->capacity)
+        return true;
+
+    integer_t capacity = bucket->capacity ? bucket->capacity
+                                          : RXH_INITIAL_CAPACITY;
+
+    while (capacity < bucket->count + amount)
+        capacity *= 2;
+
+    RadixHeapEntry_t *buffer = realloc(bucket->buffer,
+            sizeof(RadixHeapEntry_t) * (size_t)capacity);
+
+    if (!buffer)
+        return false;
+
+    bucket->buffer = buffer;
+    bucket->capacity = capacity;
+
+    return true;
+}
+
+// Makes sure bucket 0 is not empty by spreading the first non-empty bucket
+// over the lower ones. The heap must not be empty. Room is made in the lower
+// buckets before anything moves, so if allocation fails the heap is left as
+// it was.
+static bool
+rxh_settle(RadixHeap_t *heap)
+{
+    if (heap->buckets[0].count > 0)
+        return true;
+
+    integer_t index = 1;
+
+#if defined(__GNUC__)
+    index += __builtin_ctzll(heap->mask);
+#else
+    while (!(heap->mask & (UINT64_C(1) << (index - 1))))
+        index++;
+#endif
+
+    RadixHeapBucket_t *bucket = &heap->buckets[index];
+
+    uint64_t last = bucket->buffer[0].key;
+
+    for (integer_t i = 1; i < bucket->count; i++)
+    {
+        if (bucket->buffer[i].key < last)
+            last = bucket->buffer[i].key;
+    }
+
+    // Every key differs from the new last key at a lower bit, so it goes to
+    // a lower bucket
+    integer_t amounts[RXH_BUCKETS] = { 0 };
+
+    for (integer_t i = 0; i < bucket->count; i++)
+        amounts[rxh_bucket_of(bucket->buffer[i].key, last)]++;
+
+    for (integer_t i = 0; i < index; i++)
+    {
+        if (amounts[i] > 0 && !rxh_reserve(&heap->buckets[i], amounts[i]))
+            return false;
+    }
+
+    for (integer_t i = 0; i < bucket->count; i++)
+    {
+        RadixHeapEntry_t *entry = &bucket->buffer[i];
+        integer_t target = rxh_bucket_of(entry->key, last);
+        RadixHeapBucket_t *B = &heap->buckets[target];
+
+        B->buffer[B->count++] = *entry;
+
+        if (target > 0)
+            heap->mask |= UINT64_C(1) << (target - 1);
+    }
+
+    bucket->count = 0;
+
+    heap->mask &= ~(UINT64_C(1) << (index - 1));
+    heap->last = last;
+
+    return true;
+}
+
+// Empties every bucket, freeing the elements if asked to
+static void
+rxh_clear(RadixHeap_t *heap, bool elements)
+{
+    for (integer_t i = 0; i < RXH_BUCKETS; i++)
+    {
+        RadixHeapBucket_t *bucket = &heap->buckets[i];
+
+        if (elements)
+        {
+            for (integer_t j = 0; j < bucket->count; j++)
+                heap->interface->free(bucket->buffer[j].data);
+        }
+
+        bucket->count = 0;
+    }
+
+    heap->mask = 0;
+    heap->last = 0;
+    heap->count = 0;
+}
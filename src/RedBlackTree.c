@@ -7,6 +7,9 @@
  */
 
 #include "RedBlackTree.h"
+#include "Epoch.h"
+#include "Sync.h"
+#include <stdatomic.h>
 
 /// A red-black tree is a binary search tree where each node has a color, which
 /// can be either \c RED or \c BLACK. By constraining the node colors on any
@@ -197,6 +200,10 @@ rbt_traversal_postorder(RedBlackTreeNode_t *root, display_f function);
 static void
 rbt_traversal_leaves(RedBlackTreeNode_t *root, display_f function);
 
+static RedBlackTreeNode_t *
+rbt_build(RedBlackTreeNode_t **nodes, integer_t first, integer_t last,
+          integer_t depth, integer_t red_depth);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// Initializes a new RedBlackTree_s with \c size, \c limit, and \c version_id
@@ -718,6 +725,151 @@ rbt_traversal(RedBlackTree_t *tree, int traversal_mode)
     printf("\n");
 }
 
+/// Saves the tree's keys in ascending order, each one encoded by the
+/// interface's codec. See Serial.h for the format.
+///
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] tree The red-black tree to be saved.
+/// \param[in] serial The stream where the tree is written to.
+///
+/// \return True if the tree was saved or false if writing failed.
+bool
+rbt_serialize(RedBlackTree_t *tree, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_RED_BLACK_TREE, 0, tree->size))
+        return false;
+
+    RedBlackTreeNode_t *node = tree->root;
+
+    while (node != NULL && node->left != NULL)
+        node = node->left;
+
+    // In-order traversal using the parent pointers
+    while (node != NULL)
+    {
+        if (!ser_write_element(serial, tree->interface->serialize, node->key))
+            return false;
+
+        if (node->right != NULL)
+        {
+            node = node->right;
+
+            while (node->left != NULL)
+                node = node->left;
+        }
+        else
+        {
+            while (node->parent != NULL && node == node->parent->right)
+                node = node->parent;
+
+            node = node->parent;
+        }
+    }
+
+    return true;
+}
+
+/// Loads keys saved with rbt_serialize(). Since they are in order the tree is
+/// built already balanced, with every level complete except possibly the
+/// last one whose nodes are colored red, so no rotation or recoloring is
+/// made. Keys are only compared to check that they really are in
+/// ascending order.
+///
+/// \par Interface Requirements
+/// - deserialize
+/// - compare
+/// - free
+///
+/// \param[in] tree An empty red-black tree.
+/// \param[in] serial The stream where the tree is read from.
+///
+/// \return True if all keys were loaded. False if the tree is not empty, if
+/// the keys don't fit in the tree's limit, if they are not in ascending
+/// order, if the stream is not a valid RedBlackTree_s or if reading failed,
+/// in which case the tree is left empty.
+bool
+rbt_deserialize(RedBlackTree_t *tree, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t size;
+
+    if (!rbt_empty(tree))
+        return false;
+
+    if (!ser_read_header(serial, SER_RED_BLACK_TREE, &layout, &size))
+        return false;
+
+    if (tree->limit > 0 && size > tree->limit)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    RedBlackTreeNode_t **nodes = malloc(sizeof(RedBlackTreeNode_t *) *
+                                        (size_t)size);
+
+    if (!nodes)
+        return false;
+
+    integer_t loaded = 0;
+    bool valid = true;
+
+    while (valid && loaded < size)
+    {
+        void *key;
+
+        valid = ser_read_element(serial, tree->interface->deserialize, &key)
+                && key != NULL;
+
+        if (!valid)
+            break;
+
+        nodes[loaded] = rbt_new_node(key);
+
+        if (!nodes[loaded])
+        {
+            tree->interface->free(key);
+            break;
+        }
+
+        // Keys must be unique and in ascending order
+        if (loaded > 0 &&
+            tree->interface->compare(nodes[loaded - 1]->key, key) >= 0)
+            valid = false;
+
+        loaded++;
+    }
+
+    if (!valid || loaded < size)
+    {
+        for (integer_t i = 0; i < loaded; i++)
+            rbt_free_node(nodes[i], tree->interface->free);
+
+        free(nodes);
+
+        return false;
+    }
+
+    // Only the deepest level, if it is not the root, is colored red so that
+    // every path has the same amount of black nodes
+    integer_t red_depth = 0;
+
+    for (integer_t n = size; n > 1; n /= 2)
+        red_depth++;
+
+    tree->root = rbt_build(nodes, 0, size - 1, 0, red_depth);
+    tree->root->parent = NULL;
+
+    tree->size = size;
+    tree->version_id++;
+
+    free(nodes);
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static RedBlackTreeNode_t *
@@ -1332,6 +1484,32 @@ rbt_traversal_leaves(RedBlackTreeNode_t *root, display_f function)
     }
 }
 
+// Links the nodes between first and last, in order, into a balanced subtree
+// and returns its root
+static RedBlackTreeNode_t *
+rbt_build(RedBlackTreeNode_t **nodes, integer_t first, integer_t last,
+          integer_t depth, integer_t red_depth)
+{
+    if (first > last)
+        return NULL;
+
+    integer_t middle = first + (last - first) / 2;
+
+    RedBlackTreeNode_t *node = nodes[middle];
+
+    node->left = rbt_build(nodes, first, middle - 1, depth + 1, red_depth);
+    node->right = rbt_build(nodes, middle + 1, last, depth + 1, red_depth);
+
+    if (node->left != NULL)
+        node->left->parent = node;
+    if (node->right != NULL)
+        node->right->parent = node;
+
+    node->color = depth == red_depth && depth > 0 ? RED : BLACK;
+
+    return node;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1345,3 +1523,421 @@ rbt_traversal_leaves(RedBlackTreeNode_t *root, display_f function)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// \todo RedBlackTreeWrapper
+
+///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////// Sync ///
+///////////////////////////////////////////////////////////////////////////////
+
+/// In \c SYNC_RWLOCK mode every operation runs on a single tree while holding
+/// a writer-preferring readers-writer lock.
+///
+/// In \c SYNC_RCU mode the published tree is never modified. A writer makes a
+/// copy of its nodes, which still point to the same elements, applies the
+/// change to the copy and publishes it with an atomic pointer swap. Readers
+/// run inside an epoch-based reclamation critical section and read whichever
+/// tree is published, so they never wait for anything. The old nodes, and the
+/// element of a removal, are retired with ebr_retire() and freed once every
+/// reader that could have seen them is gone, so writers don't wait either.
+/// Writes cost <code> O(n) </code> and are serialized, which suits
+/// read-mostly data.
+struct RedBlackTreeSync_s
+{
+    /// \brief How the tree is protected.
+    SyncMode mode;
+
+    /// \brief The published tree.
+    ///
+    /// Only replaced in \c SYNC_RCU mode.
+    RedBlackTree_t *_Atomic tree;
+
+    /// \brief Protects the tree in \c SYNC_RWLOCK mode.
+    RWLock_t lock;
+
+    /// \brief Serializes writers in \c SYNC_RCU mode.
+    pthread_mutex_t writer;
+
+    /// \brief The user's interface.
+    struct Interface_s *interface;
+
+    /// \brief The interface of published trees in \c SYNC_RCU mode.
+    ///
+    /// A copy of the user's interface with a free function that does nothing,
+    /// so that removing from a copy does not free an element that older
+    /// versions still reference.
+    struct Interface_s shared_interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+rbt_sync_keep(void *element);
+
+static RedBlackTree_t *
+rbt_sync_clone(RedBlackTreeSync_t *sync, RedBlackTree_t *tree);
+
+static RedBlackTreeNode_t *
+rbt_sync_clone_node(RedBlackTreeNode_t *node, RedBlackTreeNode_t *parent,
+                    bool *success);
+
+static void
+rbt_sync_publish(RedBlackTreeSync_t *sync, RedBlackTree_t *old_tree,
+                 RedBlackTree_t *new_tree);
+
+static void
+rbt_sync_free_version(void *tree);
+
+static RedBlackTree_t *
+rbt_sync_read_lock(RedBlackTreeSync_t *sync);
+
+static void
+rbt_sync_read_unlock(RedBlackTreeSync_t *sync);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// \par Interface Requirements
+/// - compare
+/// - copy (for rbt_sync_max() and rbt_sync_min())
+/// - free
+///
+/// \param interface An interface for the elements of the tree.
+/// \param mode How the wrapper protects the tree.
+///
+/// \return A new RedBlackTreeSync_s or NULL if allocation failed.
+RedBlackTreeSync_t *
+rbt_sync_new(Interface_t *interface, SyncMode mode)
+{
+    RedBlackTreeSync_t *sync = malloc(sizeof(RedBlackTreeSync_t));
+
+    if (!sync)
+        return NULL;
+
+    sync->mode = mode;
+    sync->interface = interface;
+    sync->shared_interface = *interface;
+    sync->shared_interface.free = rbt_sync_keep;
+
+    RedBlackTree_t *tree = rbt_new(mode == SYNC_RCU ? &sync->shared_interface
+                                                : interface);
+
+    if (!tree)
+    {
+        free(sync);
+        return NULL;
+    }
+
+    atomic_init(&sync->tree, tree);
+
+    if (!rwl_init(&sync->lock))
+    {
+        rbt_free(tree);
+        free(sync);
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&sync->writer, NULL) != 0)
+    {
+        rwl_destroy(&sync->lock);
+        rbt_free(tree);
+        free(sync);
+        return NULL;
+    }
+
+    return sync;
+}
+
+/// No other thread may be using the wrapper.
+///
+/// \param sync The wrapper to be freed from memory.
+void
+rbt_sync_free(RedBlackTreeSync_t *sync)
+{
+    RedBlackTree_t *tree = atomic_load(&sync->tree);
+
+    rbt_config(tree, sync->interface);
+    rbt_free(tree);
+
+    pthread_mutex_destroy(&sync->writer);
+    rwl_destroy(&sync->lock);
+
+    free(sync);
+}
+
+/// \param sync The target wrapper.
+///
+/// \return The mode the wrapper was created with.
+SyncMode
+rbt_sync_mode(RedBlackTreeSync_t *sync)
+{
+    return sync->mode;
+}
+
+/// \param sync The target wrapper.
+///
+/// \return The amount of elements in the tree.
+integer_t
+rbt_sync_size(RedBlackTreeSync_t *sync)
+{
+    RedBlackTree_t *tree = rbt_sync_read_lock(sync);
+
+    integer_t size = rbt_size(tree);
+
+    rbt_sync_read_unlock(sync);
+
+    return size;
+}
+
+/// \param sync The target wrapper.
+/// \param element The element to be added. The tree takes its ownership only
+/// if the insertion succeeds.
+///
+/// \return True if the element was added to the tree.
+/// \return False if the element is already present, if the tree is full or if
+/// any allocations failed.
+bool
+rbt_sync_insert(RedBlackTreeSync_t *sync, void *element)
+{
+    if (sync->mode == SYNC_RWLOCK)
+    {
+        rwl_write_lock(&sync->lock);
+
+        bool success = rbt_insert(atomic_load(&sync->tree), element);
+
+        rwl_write_unlock(&sync->lock);
+
+        return success;
+    }
+
+    pthread_mutex_lock(&sync->writer);
+
+    RedBlackTree_t *tree = atomic_load(&sync->tree);
+
+    // Avoid copying the whole tree for nothing
+    if (rbt_full(tree) || rbt_contains(tree, element))
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    RedBlackTree_t *copy = rbt_sync_clone(sync, tree);
+
+    if (!copy || !rbt_insert(copy, element))
+    {
+        if (copy)
+            rbt_free_shallow(copy);
+
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    rbt_sync_publish(sync, tree, copy);
+
+    pthread_mutex_unlock(&sync->writer);
+
+    return true;
+}
+
+/// \param sync The target wrapper.
+/// \param element The element to be removed has to match this element.
+///
+/// \return True if the element was removed.
+/// \return False if the element was not found or if any allocations failed.
+bool
+rbt_sync_remove(RedBlackTreeSync_t *sync, void *element)
+{
+    if (sync->mode == SYNC_RWLOCK)
+    {
+        rwl_write_lock(&sync->lock);
+
+        bool success = rbt_remove(atomic_load(&sync->tree), element);
+
+        rwl_write_unlock(&sync->lock);
+
+        return success;
+    }
+
+    pthread_mutex_lock(&sync->writer);
+
+    RedBlackTree_t *tree = atomic_load(&sync->tree);
+    RedBlackTreeNode_t *node = rbt_find(tree, element);
+
+    if (!node)
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    // The element itself can only be freed after a grace period
+    void *removed = node->key;
+
+    RedBlackTree_t *copy = rbt_sync_clone(sync, tree);
+
+    if (!copy)
+    {
+        pthread_mutex_unlock(&sync->writer);
+        return false;
+    }
+
+    rbt_remove(copy, element);
+
+    rbt_sync_publish(sync, tree, copy);
+
+    ebr_retire_element(sync->interface, removed);
+
+    pthread_mutex_unlock(&sync->writer);
+
+    return true;
+}
+
+/// In \c SYNC_RCU mode this function never blocks.
+///
+/// \param sync The target wrapper.
+/// \param element The element to be searched.
+///
+/// \return True if the element is in the tree.
+bool
+rbt_sync_contains(RedBlackTreeSync_t *sync, void *element)
+{
+    RedBlackTree_t *tree = rbt_sync_read_lock(sync);
+
+    bool found = rbt_contains(tree, element);
+
+    rbt_sync_read_unlock(sync);
+
+    return found;
+}
+
+/// The element is copied while the tree is protected since another thread
+/// could remove and free it right after. In \c SYNC_RCU mode this function
+/// never blocks.
+///
+/// \param sync The target wrapper.
+///
+/// \return A copy of the maximum element, owned by the caller, or NULL if the
+/// tree is empty.
+void *
+rbt_sync_max(RedBlackTreeSync_t *sync)
+{
+    RedBlackTree_t *tree = rbt_sync_read_lock(sync);
+
+    void *element = rbt_max(tree);
+    void *result = element ? sync->interface->copy(element) : NULL;
+
+    rbt_sync_read_unlock(sync);
+
+    return result;
+}
+
+/// The element is copied while the tree is protected since another thread
+/// could remove and free it right after. In \c SYNC_RCU mode this function
+/// never blocks.
+///
+/// \param sync The target wrapper.
+///
+/// \return A copy of the minimum element, owned by the caller, or NULL if the
+/// tree is empty.
+void *
+rbt_sync_min(RedBlackTreeSync_t *sync)
+{
+    RedBlackTree_t *tree = rbt_sync_read_lock(sync);
+
+    void *element = rbt_min(tree);
+    void *result = element ? sync->interface->copy(element) : NULL;
+
+    rbt_sync_read_unlock(sync);
+
+    return result;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+rbt_sync_keep(void *element)
+{
+    (void)element;
+}
+
+// Copies the nodes of a tree; the elements are shared
+static RedBlackTree_t *
+rbt_sync_clone(RedBlackTreeSync_t *sync, RedBlackTree_t *tree)
+{
+    RedBlackTree_t *copy = rbt_new(&sync->shared_interface);
+
+    if (!copy)
+        return NULL;
+
+    bool success = true;
+
+    copy->root = rbt_sync_clone_node(tree->root, NULL, &success);
+    copy->size = tree->size;
+    copy->limit = tree->limit;
+
+    if (!success)
+    {
+        rbt_free_shallow(copy);
+        return NULL;
+    }
+
+    return copy;
+}
+
+static RedBlackTreeNode_t *
+rbt_sync_clone_node(RedBlackTreeNode_t *node, RedBlackTreeNode_t *parent,
+                    bool *success)
+{
+    if (!node || !*success)
+        return NULL;
+
+    RedBlackTreeNode_t *copy = malloc(sizeof(RedBlackTreeNode_t));
+
+    if (!copy)
+    {
+        *success = false;
+        return NULL;
+    }
+
+    *copy = *node;
+
+    copy->parent = parent;
+    copy->left = rbt_sync_clone_node(node->left, copy, success);
+    copy->right = rbt_sync_clone_node(node->right, copy, success);
+
+    return copy;
+}
+
+// Makes a new version visible and retires the old one
+static void
+rbt_sync_publish(RedBlackTreeSync_t *sync, RedBlackTree_t *old_tree,
+                 RedBlackTree_t *new_tree)
+{
+    atomic_store(&sync->tree, new_tree);
+
+    ebr_retire(old_tree, rbt_sync_free_version);
+}
+
+static void
+rbt_sync_free_version(void *tree)
+{
+    rbt_free_shallow(tree);
+}
+
+static RedBlackTree_t *
+rbt_sync_read_lock(RedBlackTreeSync_t *sync)
+{
+    if (sync->mode == SYNC_RWLOCK)
+        rwl_read_lock(&sync->lock);
+    else
+        ebr_enter();
+
+    return atomic_load(&sync->tree);
+}
+
+static void
+rbt_sync_read_unlock(RedBlackTreeSync_t *sync)
+{
+    if (sync->mode == SYNC_RWLOCK)
+        rwl_read_unlock(&sync->lock);
+    else
+        ebr_leave();
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -92,6 +92,19 @@ struct SinglyLinkedList_s
     /// as the structure's version id, that is, there have been no structural
     /// modifications (except for those done by the iterator itself).
     integer_t version_id;
+
+    /// \brief The node found by the last positional lookup.
+    ///
+    /// Positional lookups at or after it start from here instead of from the
+    /// head. It is only valid while \c cursor_id equals \c version_id, so any
+    /// structural modification discards it.
+    struct SinglyLinkedNode_s *cursor;
+
+    /// \brief Position of the \c cursor node.
+    integer_t cursor_position;
+
+    /// \brief The \c version_id from when the \c cursor was set.
+    integer_t cursor_id;
 };
 
 /// \brief A SinglyLinkedList_s node.
@@ -132,6 +145,12 @@ static Status sll_free_node_shallow(SinglyLinkedNode *node);
 static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result,
         integer_t position);
 
+static SinglyLinkedNode sll_cut_run(SinglyLinkedList list,
+        SinglyLinkedNode *run);
+
+static SinglyLinkedNode sll_merge_runs(SinglyLinkedList list,
+        SinglyLinkedNode left, SinglyLinkedNode right);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a SinglyLinkedList_s structure.
@@ -159,6 +178,10 @@ Status sll_init(SinglyLinkedList *list)
     (*list)->head = NULL;
     (*list)->tail = NULL;
 
+    (*list)->cursor = NULL;
+    (*list)->cursor_position = 0;
+    (*list)->cursor_id = 0;
+
     (*list)->v_compare = NULL;
     (*list)->v_copy = NULL;
     (*list)->v_display = NULL;
@@ -195,6 +218,10 @@ Status sll_create(SinglyLinkedList *list, sll_compare_f compare_f,
     (*list)->head = NULL;
     (*list)->tail = NULL;
 
+    (*list)->cursor = NULL;
+    (*list)->cursor_position = 0;
+    (*list)->cursor_id = 0;
+
     (*list)->v_compare = compare_f;
     (*list)->v_copy = copy_f;
     (*list)->v_display = display_f;
@@ -681,6 +708,11 @@ Status sll_insert_at(SinglyLinkedList list, void *element, integer_t position)
         list->length++;
         list->version_id++;
 
+        // Still valid, and the next insertion is likely to go after it
+        list->cursor = node;
+        list->cursor_position = position;
+        list->cursor_id = list->version_id;
+
         return DS_OK;
     }
 }
@@ -845,6 +877,11 @@ Status sll_remove_at(SinglyLinkedList list, void **result, integer_t position)
         list->length--;
         list->version_id++;
 
+        // The node before the one removed didn't move
+        list->cursor = prev;
+        list->cursor_position = position - 1;
+        list->cursor_id = list->version_id;
+
         if (sll_empty(list))
         {
             list->head = NULL;
@@ -1165,6 +1202,85 @@ Status sll_reverse(SinglyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Sorts a SinglyLinkedList_s.
+///
+/// Sorts the list with a bottom-up merge sort using the default compare
+/// function. Only the \c next pointers of the nodes are changed, so
+/// nothing is allocated and the elements stay where they are in memory. The
+/// sort is stable, equal elements keep their relative order.
+///
+/// The list is first split into the runs that are already in order, and the
+/// ones in strictly descending order are reversed. Runs are then merged in
+/// pairs of about the same size, so an already sorted list takes a single
+/// O(n) pass and any list takes at most O(n log n).
+///
+/// \param[in] list SinglyLinkedList_s reference to be sorted.
+///
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
+/// \return DS_ERR_NULL_POINTER if list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sll_sort(SinglyLinkedList list)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (list->length < 2)
+        return DS_OK;
+
+    // pending[i] is a sorted chain made of about 2^i runs, so a slot is
+    // never needed past the 64th
+    SinglyLinkedNode pending[64] = { NULL };
+    SinglyLinkedNode scan = list->head, run, sorted;
+
+    integer_t top = 0;
+
+    while (scan != NULL)
+    {
+        run = scan;
+        scan = sll_cut_run(list, &run);
+
+        // Add one like a binary counter, merging on every carry. Older chains
+        // go first to keep the sort stable.
+        integer_t i = 0;
+
+        for (; pending[i] != NULL; i++)
+        {
+            run = sll_merge_runs(list, pending[i], run);
+
+            pending[i] = NULL;
+        }
+
+        pending[i] = run;
+
+        if (i >= top)
+            top = i + 1;
+    }
+
+    sorted = NULL;
+
+    for (integer_t i = 0; i < top; i++)
+    {
+        if (pending[i] != NULL)
+            sorted = sorted == NULL ? pending[i]
+                                    : sll_merge_runs(list, pending[i], sorted);
+    }
+
+    SinglyLinkedNode tail = sorted;
+
+    while (tail->next != NULL)
+        tail = tail->next;
+
+    list->head = sorted;
+    list->tail = tail;
+
+    list->version_id++;
+
+    return DS_OK;
+}
+
 /// \brief Makes a copy of the specified SinglyLinkedList_s.
 ///
 /// Makes an exact copy of a list, copying each element using the default copy
@@ -1294,7 +1410,7 @@ Status sll_link(SinglyLinkedList list1, SinglyLinkedList list2)
         list1->tail->next = list2->head;
         list1->tail = list2->tail;
 
-        list2->length += list2->length;
+        list1->length += list2->length;
     }
 
     list2->head = NULL;
@@ -1302,6 +1418,9 @@ Status sll_link(SinglyLinkedList list1, SinglyLinkedList list2)
 
     list2->length = 0;
 
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
@@ -1354,22 +1473,32 @@ Status sll_link_at(SinglyLinkedList list1, SinglyLinkedList list2,
     list1->length += list2->length;
     list2->length = 0;
 
+    list1->version_id++;
+    list2->version_id++;
+
     return DS_OK;
 }
 
 /// \brief Unlinks elements from the specified position to the end.
 ///
-/// \param list
-/// \param result
-/// \param position
+/// Moves every node of the list from the given position to its end into
+/// result, which must be empty. See sll_splice().
 ///
-/// \return
+/// \param[in] list SinglyLinkedList_s where the elements are taken from.
+/// \param[in] result An empty SinglyLinkedList_s to receive the elements.
+/// \param[in] position Position of the first element to be moved.
 ///
-/// \todo revise sll_unlink
+/// \return DS_ERR_FULL if result has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty.
+/// \return DS_ERR_NEGATIVE_VALUE if position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position is greater than or equal to the
+/// length of the list.
+/// \return DS_OK if all operations are successful.
 Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
         integer_t position)
 {
-    if (list == NULL)
+    if (list == NULL || result == NULL)
         return DS_ERR_NULL_POINTER;
 
     if (!sll_empty(result))
@@ -1378,54 +1507,140 @@ Status sll_unlink(SinglyLinkedList list, SinglyLinkedList result,
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
-    integer_t len = sll_length(list);
+    return sll_splice(result, 0, list, position, list->length - 1);
+}
 
-    if (position == 0)
+/// \brief Unlinks elements from a given position to another.
+///
+/// Moves the nodes of the list from position1 to position2, both inclusive,
+/// into result, which must be empty. See sll_splice().
+///
+/// \param[in] list SinglyLinkedList_s where the elements are taken from.
+/// \param[in] result An empty SinglyLinkedList_s to receive the elements.
+/// \param[in] position1 Position of the first element to be moved.
+/// \param[in] position2 Position of the last element to be moved.
+///
+/// \return DS_ERR_FULL if result has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same or if
+/// position1 is greater than position2.
+/// \return DS_ERR_INVALID_OPERATION if result is not empty.
+/// \return DS_ERR_NEGATIVE_VALUE if position1 is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if position2 is greater than or equal to the
+/// length of the list.
+/// \return DS_OK if all operations are successful.
+Status sll_unlink_at(SinglyLinkedList list, SinglyLinkedList result,
+        integer_t position1, integer_t position2)
+{
+    if (list == NULL || result == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!sll_empty(result))
+        return DS_ERR_INVALID_OPERATION;
+
+    return sll_splice(result, 0, list, position1, position2);
+}
+
+/// \brief Moves a range of elements from one list to another.
+///
+/// Moves the elements of \c src from position \c from to position \c to, both
+/// inclusive, into \c dst so that the first of them ends up at position
+/// \c dst_pos. The nodes are relinked, not copied, and the lengths of both
+/// lists are updated with the size of the range, so the only walks are the
+/// ones to find the ends of the range and the insertion point. Moving a whole
+/// list or inserting at the head or at the tail of \c dst doesn't walk at
+/// all.
+///
+/// \param[in] dst SinglyLinkedList_s to receive the elements.
+/// \param[in] dst_pos Position of \c dst where the elements are inserted.
+/// \param[in] src SinglyLinkedList_s where the elements are taken from.
+/// \param[in] from Position of the first element to be moved.
+/// \param[in] to Position of the last element to be moved.
+///
+/// \return DS_ERR_FULL if \c dst has a limit and the elements don't fit.
+/// \return DS_ERR_INVALID_ARGUMENT if both lists are the same or if \c from is
+/// greater than \c to.
+/// \return DS_ERR_NEGATIVE_VALUE if any position is negative.
+/// \return DS_ERR_NULL_POINTER if either list references to \c NULL.
+/// \return DS_ERR_OUT_OF_RANGE if \c to is greater than or equal to the
+/// length of \c src or if \c dst_pos is greater than the length of \c dst.
+/// \return DS_OK if all operations are successful.
+Status sll_splice(SinglyLinkedList dst, integer_t dst_pos,
+        SinglyLinkedList src, integer_t from, integer_t to)
+{
+    if (dst == NULL || src == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (dst == src || from > to)
+        return DS_ERR_INVALID_ARGUMENT;
+
+    if (dst_pos < 0 || from < 0)
+        return DS_ERR_NEGATIVE_VALUE;
+
+    if (to >= src->length || dst_pos > dst->length)
+        return DS_ERR_OUT_OF_RANGE;
+
+    integer_t count = to - from + 1;
+
+    if (dst->limit > 0 && dst->length + count > dst->limit)
+        return DS_ERR_FULL;
+
+    SinglyLinkedNode before = NULL, first = src->head, last, prev = NULL;
+
+    Status st;
+
+    // The lookup of the last node goes on from the first one
+    if (from > 0)
     {
-        result->head = list->head;
-        result->tail = list->tail;
+        st = sll_get_node_at(src, &before, from - 1);
 
-        result->length = list->length;
+        if (st != DS_OK)
+            return st;
 
-        result->tail = NULL;
-        result->head = NULL;
+        first = before->next;
     }
-    else
-    {
-        SinglyLinkedNode prev;
 
-        Status st = sll_get_node_at(list, &prev, position - 1);
+    st = sll_get_node_at(src, &last, to);
+
+    if (st != DS_OK)
+        return st;
+
+    if (dst_pos > 0)
+    {
+        st = sll_get_node_at(dst, &prev, dst_pos - 1);
 
         if (st != DS_OK)
             return st;
+    }
 
-        result->head = prev->next;
-        result->tail = list->tail;
+    if (before == NULL)
+        src->head = last->next;
+    else
+        before->next = last->next;
 
-        list->tail = prev;
+    if (last == src->tail)
+        src->tail = before;
 
-        prev->next = NULL;
+    if (prev == NULL)
+    {
+        last->next = dst->head;
+        dst->head = first;
+    }
+    else
+    {
+        last->next = prev->next;
+        prev->next = first;
     }
 
-    list->length = position;
+    if (prev == dst->tail)
+        dst->tail = last;
 
-    result->length = len - position;
+    src->length -= count;
+    dst->length += count;
 
-    return DS_OK;
-}
+    src->version_id++;
+    dst->version_id++;
 
-/// \brief Unlinks elements from a given position to another.
-///
-/// \param list
-/// \param result
-/// \param position1
-/// \param position2
-///
-/// \return
-Status sll_unlink_at(SinglyLinkedList list, SinglyLinkedList result,
-        integer_t position1, integer_t position2)
-{
-    /// \todo sll_unlink_at
     return DS_OK;
 }
 
@@ -1556,6 +1771,108 @@ Status sll_display_raw(SinglyLinkedList list)
     return DS_OK;
 }
 
+/// \brief Saves the list's elements to a stream.
+///
+/// Saves the list's elements from the head to the tail, each one encoded by
+/// the given function. See Serial.h for the format.
+///
+/// \param[in] list The list to be saved.
+/// \param[in] function A function that encodes an element.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if writing to the stream failed.
+/// \return DS_OK if all operations were successful.
+Status sll_serialize(SinglyLinkedList list, serialize_f function,
+                     Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (!ser_write_header(serial, SER_SINGLY_LINKED_LIST, 0, list->length))
+        return DS_ERR_STREAM;
+
+    for (SinglyLinkedNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        if (!ser_write_element(serial, function, scan->data))
+            return DS_ERR_STREAM;
+    }
+
+    return DS_OK;
+}
+
+/// \brief Loads elements saved with sll_serialize() into an empty list.
+///
+/// Elements are decoded by the given function and inserted at the tail, so
+/// the list ends up in the same order it was saved. If anything fails the
+/// elements already loaded are freed with the list's default free function.
+///
+/// \param[in] list An empty list.
+/// \param[in] function A function that decodes an element.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return DS_ERR_ALLOC if node allocation failed.
+/// \return DS_ERR_FULL if the elements don't fit in the list's limit.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default free function is not set.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if reading from the stream failed or if it doesn't
+/// have a valid SinglyLinkedList_s.
+/// \return DS_OK if all operations were successful.
+Status sll_deserialize(SinglyLinkedList list, deserialize_f function,
+                       Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_free == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (!sll_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    uint32_t layout;
+    integer_t length;
+
+    if (!ser_read_header(serial, SER_SINGLY_LINKED_LIST, &layout, &length))
+        return DS_ERR_STREAM;
+
+    if (list->limit > 0 && length > list->limit)
+        return DS_ERR_FULL;
+
+    Status st = DS_OK;
+
+    for (integer_t i = 0; i < length && st == DS_OK; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, function, &element))
+        {
+            st = DS_ERR_STREAM;
+            break;
+        }
+
+        st = sll_insert_tail(list, element);
+
+        if (st != DS_OK)
+            list->v_free(element);
+    }
+
+    if (st != DS_OK)
+    {
+        void *element;
+
+        while (!sll_empty(list))
+        {
+            sll_remove_head(list, &element);
+
+            list->v_free(element);
+        }
+    }
+
+    return st;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 /// \brief Builds a new SinglyLinkedNode_s.
@@ -1629,7 +1946,8 @@ static Status sll_free_node_shallow(SinglyLinkedNode *node)
 /// \brief Gets a node from a specific position.
 ///
 /// Implementation detail. Searches for a node in O(n) where the search starts
-/// at the head of the list.
+/// at the head of the list, or at the node of the last lookup if it is not
+/// after the position. Looking up positions in order is then O(1) each.
 ///
 /// \param[in] list SinglyLinkedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1658,9 +1976,27 @@ static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result, i
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
+    if (position == list->length - 1)
+    {
+        (*result) = list->tail;
+
+        return DS_OK;
+    }
+
+    integer_t i = 0;
+
     (*result) = list->head;
 
-    for (integer_t i = 0; i < position; i++)
+    // Loops that go through positions in order only take one step each
+    if (list->cursor != NULL && list->cursor_id == list->version_id &&
+        list->cursor_position <= position)
+    {
+        (*result) = list->cursor;
+
+        i = list->cursor_position;
+    }
+
+    for (; i < position; i++)
     {
         if ((*result) == NULL)
             return DS_ERR_ITER;
@@ -1668,9 +2004,102 @@ static Status sll_get_node_at(SinglyLinkedList list, SinglyLinkedNode *result, i
         (*result) = (*result)->next;
     }
 
+    list->cursor = *result;
+    list->cursor_position = position;
+    list->cursor_id = list->version_id;
+
     return DS_OK;
 }
 
+/// \brief Cuts the run of ordered nodes at the start of a chain.
+///
+/// Implementation detail. The run goes on while each element is less than or
+/// equal to the next one. If it starts with a strictly descending pair it
+/// goes on while elements keep strictly descending, and is then reversed,
+/// which doesn't break the sort's stability. Only \c next pointers are used.
+///
+/// \param[in] list SinglyLinkedList_s with the compare function.
+/// \param[in,out] run The first node of the chain and then the first node of
+/// the run, which ends with a \c NULL.
+///
+/// \return The rest of the chain after the run.
+static SinglyLinkedNode sll_cut_run(SinglyLinkedList list,
+        SinglyLinkedNode *run)
+{
+    SinglyLinkedNode last = *run, next = last->next;
+
+    if (next == NULL)
+        return NULL;
+
+    if (list->v_compare(last->data, next->data) <= 0)
+    {
+        while (next != NULL && list->v_compare(last->data, next->data) <= 0)
+        {
+            last = next;
+            next = next->next;
+        }
+
+        last->next = NULL;
+
+        return next;
+    }
+
+    // A descending run, reversed while it is found
+    SinglyLinkedNode head = *run;
+
+    head->next = NULL;
+
+    while (next != NULL && list->v_compare(last->data, next->data) > 0)
+    {
+        last = next;
+        next = next->next;
+
+        last->next = head;
+        head = last;
+    }
+
+    *run = head;
+
+    return next;
+}
+
+/// \brief Merges two sorted chains of nodes.
+///
+/// Implementation detail. Both chains end with a \c NULL and only their
+/// \c next pointers are used. On equal elements the ones from \c left come
+/// first.
+///
+/// \param[in] list SinglyLinkedList_s with the compare function.
+/// \param[in] left The chain with the elements that came first.
+/// \param[in] right The chain with the elements that came after.
+///
+/// \return The first node of the merged chain.
+static SinglyLinkedNode sll_merge_runs(SinglyLinkedList list,
+        SinglyLinkedNode left, SinglyLinkedNode right)
+{
+    SinglyLinkedNode head = NULL, *last = &head;
+
+    while (left != NULL && right != NULL)
+    {
+        if (list->v_compare(left->data, right->data) <= 0)
+        {
+            *last = left;
+            left = left->next;
+        }
+        else
+        {
+            *last = right;
+            right = right->next;
+        }
+
+        last = &(*last)->next;
+    }
+
+    *last = left != NULL ? left : right;
+
+    return head;
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,603 @@
+/**
+ * @file SortedHashMap.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "SortedHashMap.h"
+#include "CoreHash.h"
+
+/// \brief Initial amount of slots in the index.
+#define SHM_INITIAL_CAPACITY 8
+
+/// \brief An index slot that was never used.
+#define SHM_EMPTY (-1)
+
+/// \brief An index slot whose entry was removed.
+#define SHM_DUMMY (-2)
+
+/// \brief Amount of entries that fit in an index with \c capacity slots.
+///
+/// Keeping the entries at two thirds of the slots bounds the probe length.
+#define SHM_USABLE(capacity) ((capacity) * 2 / 3)
+
+/// A sorted hash map keeps its key-value pairs in a dense array of entries, in
+/// the order they were inserted, and finds them through a separate index: an
+/// open-addressing table with linear probing whose slots only hold positions
+/// in the entry array. Since the index slots are small and the entries have
+/// no empty gaps, the map needs much less memory than a table of full entries
+/// or a node per pair, and iterating in insertion order is just a walk over
+/// the entry array.
+///
+/// Removing a pair leaves a tombstone in the entry array and a dummy slot in
+/// the index, so no other entry moves. When the entry array is full it is
+/// compacted, dropping the tombstones, and the index is rebuilt with a size
+/// fit for the pairs that are left; the relative order of the pairs is kept.
+struct SortedHashMap_s
+{
+    /// \brief Array of entries in insertion order.
+    ///
+    /// Its length is \c SHM_USABLE(capacity). Only the first \c used entries
+    /// have been filled and removed ones have a \c NULL key.
+    struct SortedHashMapEntry_s *entries;
+
+    /// \brief The index.
+    ///
+    /// Each slot is either \c SHM_EMPTY, \c SHM_DUMMY or the position of an
+    /// entry in the entry array.
+    integer_t *indices;
+
+    /// \brief Amount of slots in the index.
+    ///
+    /// Always a power of two.
+    integer_t capacity;
+
+    /// \brief Amount of entries used, including the tombstones.
+    integer_t used;
+
+    /// \brief Amount of key-value pairs in the map.
+    integer_t size;
+
+    /// \brief SortedHashMap_s key interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The key interface must have
+    /// a compare, a hash and a free function.
+    struct Interface_s *K_interface;
+
+    /// \brief SortedHashMap_s value interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. The value interface must
+    /// have a free function.
+    struct Interface_s *V_interface;
+};
+
+/// \brief A SortedHashMap_s entry.
+///
+/// Implementation detail. A removed entry has a \c NULL key.
+struct SortedHashMapEntry_s
+{
+    /// \brief This entry's key.
+    void *key;
+
+    /// \brief This entry's value.
+    void *value;
+
+    /// \brief The mixed hash of the key.
+    ///
+    /// Stored so that probing can skip most comparisons and so that the
+    /// index can be rebuilt without calling the hash function again.
+    unsigned_t hash;
+};
+
+typedef struct SortedHashMapEntry_s SortedHashMapEntry_t;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+shm_hash(SortedHashMap_t *map, void *key);
+
+static integer_t
+shm_find(SortedHashMap_t *map, void *key, unsigned_t hash);
+
+static integer_t
+shm_free_slot(SortedHashMap_t *map, unsigned_t hash);
+
+static bool
+shm_resize(SortedHashMap_t *map);
+
+static void
+shm_reindex(SortedHashMap_t *map);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new SortedHashMap_s with two interfaces, one for the keys and
+/// another for the values.
+///
+/// \param[in] key_interface Key interface.
+/// \param[in] value_interface Value interface.
+///
+/// \return A new SortedHashMap_s or NULL if allocation failed.
+SortedHashMap_t *
+shm_new(Interface_t *key_interface, Interface_t *value_interface)
+{
+    SortedHashMap_t *map = malloc(sizeof(SortedHashMap_t));
+
+    if (!map)
+        return NULL;
+
+    map->entries = malloc(sizeof(SortedHashMapEntry_t) *
+                          SHM_USABLE(SHM_INITIAL_CAPACITY));
+    map->indices = malloc(sizeof(integer_t) * SHM_INITIAL_CAPACITY);
+
+    if (!map->entries || !map->indices)
+    {
+        free(map->entries);
+        free(map->indices);
+        free(map);
+
+        return NULL;
+    }
+
+    map->capacity = SHM_INITIAL_CAPACITY;
+    map->used = 0;
+    map->size = 0;
+
+    for (integer_t i = 0; i < map->capacity; i++)
+        map->indices[i] = SHM_EMPTY;
+
+    map->K_interface = key_interface;
+    map->V_interface = value_interface;
+
+    return map;
+}
+
+/// Frees the map and all of its keys and values.
+///
+/// \param[in] map The map to be freed from memory.
+void
+shm_free(SortedHashMap_t *map)
+{
+    shm_erase(map);
+
+    free(map->entries);
+    free(map->indices);
+    free(map);
+}
+
+/// Frees the map but leaves its keys and values intact.
+///
+/// \param[in] map The map to be freed from memory.
+void
+shm_free_shallow(SortedHashMap_t *map)
+{
+    free(map->entries);
+    free(map->indices);
+    free(map);
+}
+
+/// Frees every key-value pair, leaving the map empty. The map keeps its
+/// current capacity.
+///
+/// \param[in] map The map to be erased.
+void
+shm_erase(SortedHashMap_t *map)
+{
+    for (integer_t i = 0; i < map->used; i++)
+    {
+        SortedHashMapEntry_t *entry = &map->entries[i];
+
+        if (!entry->key)
+            continue;
+
+        map->K_interface->free(entry->key);
+        map->V_interface->free(entry->value);
+    }
+
+    for (integer_t i = 0; i < map->capacity; i++)
+        map->indices[i] = SHM_EMPTY;
+
+    map->used = 0;
+    map->size = 0;
+}
+
+/// Sets new interfaces for the map. A \c NULL interface is left unchanged. If
+/// the key interface changes the stored hashes are computed again.
+///
+/// \param[in] map The target map.
+/// \param[in] key_interface The new key interface.
+/// \param[in] value_interface The new value interface.
+void
+shm_config(SortedHashMap_t *map, Interface_t *key_interface,
+           Interface_t *value_interface)
+{
+    if (key_interface)
+    {
+        map->K_interface = key_interface;
+
+        for (integer_t i = 0; i < map->used; i++)
+        {
+            if (map->entries[i].key)
+                map->entries[i].hash = shm_hash(map, map->entries[i].key);
+        }
+
+        shm_reindex(map);
+    }
+
+    if (value_interface)
+        map->V_interface = value_interface;
+}
+
+/// \param[in] map The target map.
+///
+/// \return The amount of key-value pairs in the map.
+integer_t
+shm_size(SortedHashMap_t *map)
+{
+    return map->size;
+}
+
+/// Returns how many entries the map has room for. Tombstones left by removed
+/// pairs also take up room until the map is compacted.
+///
+/// \param[in] map The target map.
+///
+/// \return The amount of entries the map can hold without growing.
+integer_t
+shm_capacity(SortedHashMap_t *map)
+{
+    return SHM_USABLE(map->capacity);
+}
+
+/// Searches for a key and returns its value. The map keeps the ownership of
+/// the value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be searched.
+///
+/// \return The value mapped to the key or NULL if the key was not found.
+void *
+shm_get(SortedHashMap_t *map, void *key)
+{
+    integer_t slot = shm_find(map, key, shm_hash(map, key));
+
+    if (slot < 0)
+        return NULL;
+
+    return map->entries[map->indices[slot]].value;
+}
+
+/// Inserts a new key-value pair after every other pair. The map takes the
+/// ownership of both. If the entry array is full it is compacted and, if
+/// needed, grown.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be inserted.
+/// \param[in] value The value mapped to the key.
+///
+/// \return False if the key is \c NULL, if it is already in the map or if
+/// allocation failed.
+bool
+shm_insert(SortedHashMap_t *map, void *key, void *value)
+{
+    if (!key)
+        return false;
+
+    unsigned_t hash = shm_hash(map, key);
+
+    if (shm_find(map, key, hash) >= 0)
+        return false;
+
+    if (map->used == SHM_USABLE(map->capacity))
+    {
+        if (!shm_resize(map))
+            return false;
+    }
+
+    integer_t slot = shm_free_slot(map, hash);
+
+    SortedHashMapEntry_t *entry = &map->entries[map->used];
+
+    entry->key = key;
+    entry->value = value;
+    entry->hash = hash;
+
+    map->indices[slot] = map->used;
+
+    map->used++;
+    map->size++;
+
+    return true;
+}
+
+/// Removes a key from the map, freeing it and handing out its value. The
+/// order of the remaining pairs is kept. When few pairs are left the map is
+/// compacted into a smaller one.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash, free
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be removed.
+/// \param[out] value The value that was mapped to the key.
+///
+/// \return True if the key was found and removed.
+bool
+shm_remove(SortedHashMap_t *map, void *key, void **value)
+{
+    *value = NULL;
+
+    integer_t slot = shm_find(map, key, shm_hash(map, key));
+
+    if (slot < 0)
+        return false;
+
+    SortedHashMapEntry_t *entry = &map->entries[map->indices[slot]];
+
+    *value = entry->value;
+
+    map->K_interface->free(entry->key);
+
+    entry->key = NULL;
+    entry->value = NULL;
+
+    map->indices[slot] = SHM_DUMMY;
+
+    map->size--;
+
+    // Shrinking is optional so the map stays as it is if it fails
+    if (map->capacity > SHM_INITIAL_CAPACITY &&
+        map->size * 8 < SHM_USABLE(map->capacity))
+        shm_resize(map);
+
+    return true;
+}
+
+/// Removes a key from the map, freeing both the key and its value.
+///
+/// \par Interface Requirements
+/// - K_interface: compare, hash, free
+/// - V_interface: free
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be removed.
+///
+/// \return True if the key was found and removed.
+bool
+shm_pop(SortedHashMap_t *map, void *key)
+{
+    void *value;
+
+    if (!shm_remove(map, key, &value))
+        return false;
+
+    map->V_interface->free(value);
+
+    return true;
+}
+
+/// \param[in] map The target map.
+///
+/// \return True if the map has no key-value pairs.
+bool
+shm_empty(SortedHashMap_t *map)
+{
+    return map->size == 0;
+}
+
+/// \par Interface Requirements
+/// - K_interface: compare, hash
+///
+/// \param[in] map The target map.
+/// \param[in] key The key to be searched.
+///
+/// \return True if the key is in the map.
+bool
+shm_contains_key(SortedHashMap_t *map, void *key)
+{
+    return shm_find(map, key, shm_hash(map, key)) >= 0;
+}
+
+/// Creates two arrays of shm_size() elements, one with copies of the keys and
+/// the other with copies of the values, both in insertion order. The caller
+/// owns the arrays and their elements.
+///
+/// \par Interface Requirements
+/// - K_interface: copy
+/// - V_interface: copy
+///
+/// \param[in] map The target map.
+/// \param[out] K_array The resulting array of keys.
+/// \param[out] V_array The resulting array of values.
+///
+/// \return False if the map is empty or if allocation failed, in which case
+/// both arrays are \c NULL.
+bool
+shm_to_arrays(SortedHashMap_t *map, void ***K_array, void ***V_array)
+{
+    *K_array = NULL;
+    *V_array = NULL;
+
+    if (shm_empty(map))
+        return false;
+
+    void **keys = malloc(sizeof(void *) * (size_t)map->size);
+    void **values = malloc(sizeof(void *) * (size_t)map->size);
+
+    if (!keys || !values)
+    {
+        free(keys);
+        free(values);
+
+        return false;
+    }
+
+    integer_t length = 0;
+
+    for (integer_t i = 0; i < map->used; i++)
+    {
+        SortedHashMapEntry_t *entry = &map->entries[i];
+
+        if (!entry->key)
+            continue;
+
+        keys[length] = map->K_interface->copy(entry->key);
+        values[length] = map->V_interface->copy(entry->value);
+
+        length++;
+    }
+
+    *K_array = keys;
+    *V_array = values;
+
+    return true;
+}
+
+/// Displays the map's pairs in insertion order.
+///
+/// \param[in] map The map to be displayed.
+void
+shm_display(SortedHashMap_t *map)
+{
+    if (shm_empty(map))
+    {
+        printf("\nSortedHashMap\n[ empty ]\n");
+        return;
+    }
+
+    printf("\nSortedHashMap\n");
+
+    for (integer_t i = 0; i < map->used; i++)
+    {
+        SortedHashMapEntry_t *entry = &map->entries[i];
+
+        if (!entry->key)
+            continue;
+
+        map->K_interface->display(entry->key);
+
+        printf(" : ");
+
+        map->V_interface->display(entry->value);
+
+        printf("\n");
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static unsigned_t
+shm_hash(SortedHashMap_t *map, void *key)
+{
+    return ds_hash_mix((uint64_t)map->K_interface->hash(key));
+}
+
+// Returns the index slot of the given key or -1 if not found. Probing always
+// ends because at most two thirds of the slots are ever taken.
+static integer_t
+shm_find(SortedHashMap_t *map, void *key, unsigned_t hash)
+{
+    integer_t mask = map->capacity - 1;
+
+    integer_t i = (integer_t)(hash & (unsigned_t)mask);
+
+    for (;; i = (i + 1) & mask)
+    {
+        integer_t index = map->indices[i];
+
+        if (index == SHM_EMPTY)
+            return -1;
+
+        if (index == SHM_DUMMY)
+            continue;
+
+        SortedHashMapEntry_t *entry = &map->entries[index];
+
+        if (entry->hash == hash &&
+            map->K_interface->compare(key, entry->key) == 0)
+            return i;
+    }
+}
+
+// Returns the first slot where a key that is not in the map can go
+static integer_t
+shm_free_slot(SortedHashMap_t *map, unsigned_t hash)
+{
+    integer_t mask = map->capacity - 1;
+    integer_t i = (integer_t)(hash & (unsigned_t)mask);
+
+    while (map->indices[i] >= 0)
+        i = (i + 1) & mask;
+
+    return i;
+}
+
+// Moves the pairs to new arrays without tombstones, keeping their order, and
+// sized so that the pairs fill at most half of the entries.
+static bool
+shm_resize(SortedHashMap_t *map)
+{
+    integer_t capacity = SHM_INITIAL_CAPACITY;
+
+    while (SHM_USABLE(capacity) < map->size * 2)
+        capacity *= 2;
+
+    size_t length = (size_t)SHM_USABLE(capacity);
+
+    SortedHashMapEntry_t *entries =
+            malloc(sizeof(SortedHashMapEntry_t) * length);
+    integer_t *indices = malloc(sizeof(integer_t) * (size_t)capacity);
+
+    if (!entries || !indices)
+    {
+        free(entries);
+        free(indices);
+
+        return false;
+    }
+
+    integer_t used = 0;
+
+    for (integer_t i = 0; i < map->used; i++)
+    {
+        if (map->entries[i].key)
+            entries[used++] = map->entries[i];
+    }
+
+    free(map->entries);
+    free(map->indices);
+
+    map->entries = entries;
+    map->indices = indices;
+    map->capacity = capacity;
+    map->used = used;
+
+    shm_reindex(map);
+
+    return true;
+}
+
+// Rebuilds the index from the entry array
+static void
+shm_reindex(SortedHashMap_t *map)
+{
+    for (integer_t i = 0; i < map->capacity; i++)
+        map->indices[i] = SHM_EMPTY;
+
+    for (integer_t i = 0; i < map->used; i++)
+    {
+        if (map->entries[i].key)
+            map->indices[shm_free_slot(map, map->entries[i].hash)] = i;
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
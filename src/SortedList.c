@@ -37,6 +37,14 @@
 /// sli_erase(). This will keep all default functions and all elements will be
 /// removed from the list and freed from memory.
 ///
+/// Positional access and key searches walk the list from its head. For long
+/// lists an optional skip index can be turned on with sli_set_indexed(). It
+/// keeps a few extra forward and backward links with span counters over the
+/// nodes, so sli_get(), sli_remove(), sli_insert(), sli_index_first(),
+/// sli_index_last() and sli_contains() take O(log n) expected time. Operations
+/// that relink the whole list, like sli_merge() or sli_reverse(), rebuild the
+/// index in O(n).
+///
 /// The list maintains a version id that keeps track of structural changes done
 /// to the list. This prevents any iterators from working the moment the list
 /// structure is changed. It works to prevent any undefined behaviour or
@@ -54,9 +62,11 @@
 /// - sli_set_v_free()
 /// - sli_set_limit()
 /// - sli_set_order()
+/// - sli_set_indexed()
 /// - sli_length()
 /// - sli_limit()
 /// - sli_order()
+/// - sli_indexed()
 /// - sli_get()
 /// - sli_insert()
 /// - sli_insert_all()
@@ -138,6 +148,11 @@ struct SortedList_s
     /// A function that completely frees an element from memory.
     sli_free_f v_free;
 
+    /// \brief Optional skip index.
+    ///
+    /// Header of the skip index or \c NULL if the list is not indexed.
+    struct SortedListIndex_s *index;
+
     /// \brief A version id to keep track of modifications.
     ///
     /// This version id is used by the iterator to check if the structure was
@@ -168,6 +183,12 @@ struct SortedListNode_s
     ///
     /// Previous node on the list or \c NULL if this is the head node.
     struct SortedListNode_s *prev;
+
+    /// \brief Skip index levels of this node.
+    ///
+    /// Only a fraction of the nodes of an indexed list have a tower, the rest
+    /// and every node of a list that is not indexed have it as \c NULL.
+    struct SortedListTower_s *tower;
 };
 
 /// \brief A type for a sorted list node.
@@ -180,6 +201,68 @@ typedef struct SortedListNode_s SortedListNode_t;
 /// Defines a pointer type to a <code> struct SortedListNode_s </code>.
 typedef struct SortedListNode_s *SortedListNode;
 
+/// \brief Maximum amount of skip index levels.
+///
+/// Each level has a quarter of the towers of the level below, so this is
+/// enough for far more elements than fit in memory.
+#define SLI_INDEX_LEVELS 24
+
+/// \brief A link of the skip index.
+///
+/// Implementation detail. At a given level, points to the next and previous
+/// towers that are at least that tall. A \c NULL \c prev means the index
+/// header and a \c NULL \c next means the end of the list.
+struct SortedListLink_s
+{
+    /// \brief Next tower at this level.
+    struct SortedListTower_s *next;
+
+    /// \brief Previous tower at this level.
+    struct SortedListTower_s *prev;
+
+    /// \brief Amount of nodes from here to \c next.
+    ///
+    /// The distance between both positions in the list. If \c next is the end
+    /// of the list its position is taken as the list's length.
+    integer_t span;
+};
+
+/// \brief The skip index levels of a SortedListNode_s.
+///
+/// Implementation detail. The level 0 of the index is the list itself, so a
+/// tower with height \c h holds the levels 1 to \c h.
+struct SortedListTower_s
+{
+    /// \brief The node that owns this tower.
+    struct SortedListNode_s *node;
+
+    /// \brief Amount of levels in this tower.
+    integer_t height;
+
+    /// \brief One link per level.
+    struct SortedListLink_s link[];
+};
+
+/// \brief The header of a skip index.
+///
+/// Implementation detail. Sits before the list's head, at position -1.
+struct SortedListIndex_s
+{
+    /// \brief Amount of levels in use.
+    integer_t levels;
+
+    /// \brief State of the generator of tower heights.
+    uint64_t state;
+
+    /// \brief First link of each level.
+    struct SortedListLink_s link[SLI_INDEX_LEVELS];
+};
+
+/// \brief A pointer type for a skip index tower.
+///
+/// Defines a pointer type to a <code> struct SortedListTower_s </code>.
+typedef struct SortedListTower_s *SortedListTower;
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static Status sli_make_node(SortedListNode *node, void *element);
@@ -193,6 +276,30 @@ static Status sli_get_node_at(SortedList list, SortedListNode *result,
 
 static Status sli_insert_tail(SortedList list, void *element);
 
+static void sli_merge_chain(SortedList list, SortedListNode chain,
+        integer_t length);
+
+static void **sli_sort_array(SortedList list, void **elements, void **buffer,
+        integer_t count);
+
+static bool sli_in_order(SortedList list, void *first, void *second);
+
+static struct SortedListLink_s *sli_link(SortedList list,
+        SortedListTower tower, integer_t level);
+
+static integer_t sli_index_height(SortedList list);
+
+static SortedListNode sli_index_seek(SortedList list, void *key, bool equal,
+        SortedListTower *update, integer_t *rank, integer_t *position);
+
+static void sli_index_insert(SortedList list, SortedListNode node);
+
+static void sli_index_remove(SortedList list, SortedListNode node);
+
+static void sli_index_strip(SortedList list);
+
+static void sli_index_build(SortedList list);
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 /// \brief Initializes a SortedList_s structure.
@@ -227,6 +334,8 @@ Status sli_init(SortedList *list)
     (*list)->v_display = NULL;
     (*list)->v_free = NULL;
 
+    (*list)->index = NULL;
+
     return DS_OK;
 }
 
@@ -266,6 +375,8 @@ Status sli_create(SortedList *list, SortOrder order, sli_compare_f compare_f,
     (*list)->v_display = display_f;
     (*list)->v_free = free_f;
 
+    (*list)->index = NULL;
+
     return DS_OK;
 }
 
@@ -304,6 +415,7 @@ Status sli_free(SortedList *list)
         prev = (*list)->head;
     }
 
+    free((*list)->index);
     free(*list);
 
     (*list) = NULL;
@@ -342,6 +454,7 @@ Status sli_free_shallow(SortedList *list)
         prev = (*list)->head;
     }
 
+    free((*list)->index);
     free(*list);
 
     (*list) = NULL;
@@ -374,12 +487,24 @@ Status sli_erase(SortedList *list)
     if (st !=  DS_OK)
         return st;
 
+    if ((*list)->index != NULL)
+    {
+        st = sli_set_indexed(new_list, true);
+
+        if (st != DS_OK)
+        {
+            free(new_list);
+
+            return st;
+        }
+    }
+
     st = sli_free(list);
 
     // Probably didn't set the free function...
     if (st !=  DS_OK)
     {
-        free(new_list);
+        sli_free_shallow(&new_list);
 
         return st;
     }
@@ -529,6 +654,53 @@ Status sli_set_order(SortedList list, SortOrder order)
     return DS_OK;
 }
 
+/// \brief Turns the skip index of a SortedList_s on or off.
+///
+/// An indexed list keeps extra links over its nodes so that positional access
+/// and key searches take O(log n) expected time instead of O(n). On average
+/// it costs a third of a tower per node, each tower having two pointers and a
+/// span counter per level. Turning it on builds the index in O(n) and turning
+/// it off frees it. Iterators are not affected either way.
+///
+/// \param[in] list SortedList_s reference.
+/// \param[in] indexed True to build the index, false to free it.
+///
+/// \return DS_ERR_ALLOC if the index allocation failed.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_OK if all operations are successful.
+Status sli_set_indexed(SortedList list, bool indexed)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (indexed == (list->index != NULL))
+        return DS_OK;
+
+    if (!indexed)
+    {
+        sli_index_strip(list);
+
+        free(list->index);
+
+        list->index = NULL;
+
+        return DS_OK;
+    }
+
+    list->index = malloc(sizeof(struct SortedListIndex_s));
+
+    if (!list->index)
+        return DS_ERR_ALLOC;
+
+    // Any odd seed will do for the height generator
+    list->index->levels = 0;
+    list->index->state = ((uint64_t)(uintptr_t)list << 1) | 1;
+
+    sli_index_build(list);
+
+    return DS_OK;
+}
+
 /// \brief Returns the SortedList_s's length.
 ///
 /// Returns the list's current length or -1 if the list references to \c NULL.
@@ -578,6 +750,22 @@ SortOrder sli_order(SortedList list)
     return list->order;
 }
 
+/// \brief Tells if a SortedList_s has a skip index.
+///
+/// Returns true if the skip index was turned on with sli_set_indexed().
+///
+/// \param[in] list SortedList_s reference.
+///
+/// \return False if the list references to \c NULL or is not indexed.
+/// \return True if the list is indexed.
+bool sli_indexed(SortedList list)
+{
+    if (list == NULL)
+        return false;
+
+    return list->index != NULL;
+}
+
 /// \brief Returns a copy of an element at a given position.
 ///
 /// This function is zero-based and returns a copy of the element located at
@@ -628,7 +816,8 @@ Status sli_get(SortedList list, void **result, integer_t index)
 /// \brief Inserts an element to the specified SortedList_s.
 ///
 /// Inserts an element according to the sort order specified by the list. This
-/// function can take up to O(n) to add an element in its correct position.
+/// function can take up to O(n) to add an element in its correct position, or
+/// O(log n) expected if the list is indexed.
 ///
 /// \param[in] list SortedList_s reference where the element is to be inserted.
 /// \param[in] element Element to be inserted in the list.
@@ -657,8 +846,13 @@ Status sli_insert(SortedList list, void *element)
     if (st != DS_OK)
         return st;
 
+    // Search for its position through the index.
+    if (list->index != NULL)
+    {
+        sli_index_insert(list, node);
+    }
     // First node.
-    if (sli_empty(list))
+    else if (sli_empty(list))
     {
         list->head = node;
         list->tail = node;
@@ -769,12 +963,20 @@ Status sli_insert(SortedList list, void *element)
 /// \brief Inserts an array of elements to the specified SortedList_s.
 ///
 /// Inserts an array of void pointers into the list, with a size of \c count.
+/// The elements are sorted apart from the list with a merge sort and then
+/// merged into it in a single pass, taking O(k log k + n) instead of the
+/// O(k * n) of inserting them one by one. If the list has a limit and the new
+/// elements don't fit, none of them are inserted.
 ///
 /// \param[in] list SortedList_s reference where all elements are to be
 /// inserted.
 /// \param[in] elements Elements to be inserted in the list.
 /// \param[in] count Amount of elements to be inserted.
 ///
+/// \return DS_ERR_ALLOC if node or buffer allocation failed.
+/// \return DS_ERR_FULL if \c limit is set and there is no room for all the
+/// elements.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare function is not set.
 /// \return DS_ERR_NEGATIVE_VALUE if count parameter is negative.
 /// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
 /// \return DS_OK if all operations are successful.
@@ -786,16 +988,60 @@ Status sli_insert_all(SortedList list, void **elements, integer_t count)
     if (count < 0)
         return DS_ERR_NEGATIVE_VALUE;
 
-    Status st;
+    if (list->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (count == 0)
+        return DS_OK;
+
+    if (list->limit > 0 && list->length + count > list->limit)
+        return DS_ERR_FULL;
+
+    // The first half holds the sorted elements and the second is scratch
+    void **buffer = malloc(sizeof(void*) * (size_t)count * 2);
+
+    if (!buffer)
+        return DS_ERR_ALLOC;
+
+    memcpy(buffer, elements, sizeof(void*) * (size_t)count);
+
+    void **sorted = sli_sort_array(list, buffer, buffer + count, count);
+
+    // Chain the new nodes through their next pointers only
+    SortedListNode chain = NULL, last = NULL, node;
 
     for (integer_t i = 0; i < count; i++)
     {
-        st = sli_insert(list, elements[i]);
+        Status st = sli_make_node(&node, sorted[i]);
 
         if (st != DS_OK)
+        {
+            while (chain != NULL)
+            {
+                node = chain->next;
+
+                free(chain);
+
+                chain = node;
+            }
+
+            free(buffer);
+
             return st;
+        }
+
+        if (last == NULL)
+            chain = node;
+        else
+            last->next = node;
+
+        last = node;
     }
 
+    free(buffer);
+
+    sli_merge_chain(list, chain, count);
+
     return DS_OK;
 }
 
@@ -873,6 +1119,8 @@ Status sli_remove(SortedList list, void **result, integer_t position)
         *result = node->data;
     }
 
+    sli_index_remove(list, node);
+
     free(node);
 
     list->length--;
@@ -924,6 +1172,8 @@ Status sli_remove_max(SortedList list, void **result)
         if (list->tail != NULL)
             list->tail->next = NULL;
 
+        sli_index_remove(list, node);
+
         free(node);
     }
     // Remove from head.
@@ -938,6 +1188,8 @@ Status sli_remove_max(SortedList list, void **result)
         if (list->head != NULL)
             list->head->prev = NULL;
 
+        sli_index_remove(list, node);
+
         free(node);
     }
 
@@ -990,6 +1242,8 @@ Status sli_remove_min(SortedList list, void **result)
         if (list->head != NULL)
             list->head->prev = NULL;
 
+        sli_index_remove(list, node);
+
         free(node);
     }
     // Remove from tail.
@@ -1004,6 +1258,8 @@ Status sli_remove_min(SortedList list, void **result)
         if (list->tail != NULL)
             list->tail->next = NULL;
 
+        sli_index_remove(list, node);
+
         free(node);
     }
 
@@ -1128,6 +1384,23 @@ integer_t sli_index_first(SortedList list, void *key)
     if (list->v_compare == NULL)
         return -3;
 
+    if (list->index != NULL)
+    {
+        SortedListTower update[SLI_INDEX_LEVELS];
+        integer_t rank[SLI_INDEX_LEVELS], position;
+
+        // The last node that comes before the key
+        SortedListNode node = sli_index_seek(list, key, false, update, rank,
+                &position);
+
+        node = node == NULL ? list->head : node->next;
+
+        if (node != NULL && list->v_compare(node->data, key) == 0)
+            return position + 1;
+
+        return -1;
+    }
+
     SortedListNode scan = list->head;
 
     integer_t index = 0;
@@ -1166,6 +1439,21 @@ integer_t sli_index_last(SortedList list, void *key)
     if (list->v_compare == NULL)
         return -3;
 
+    if (list->index != NULL)
+    {
+        SortedListTower update[SLI_INDEX_LEVELS];
+        integer_t rank[SLI_INDEX_LEVELS], position;
+
+        // The last node that comes before the key or is equal to it
+        SortedListNode node = sli_index_seek(list, key, true, update, rank,
+                &position);
+
+        if (node != NULL && list->v_compare(node->data, key) == 0)
+            return position;
+
+        return -1;
+    }
+
     SortedListNode scan = list->tail;
 
     integer_t index = 0;
@@ -1197,6 +1485,9 @@ integer_t sli_index_last(SortedList list, void *key)
 /// \return False if the element is not present in the list.
 bool sli_contains(SortedList list, void *key)
 {
+    if (list->index != NULL)
+        return sli_index_first(list, key) >= 0;
+
     SortedListNode scan = list->head;
 
     while (scan != NULL)
@@ -1255,6 +1546,8 @@ Status sli_reverse(SortedList list)
     // If list length is 1 then just by doing this will do the trick
     list->order = (list->order == ASCENDING) ? DESCENDING : ASCENDING;
 
+    sli_index_build(list);
+
     list->version_id++;
 
     return DS_OK;
@@ -1310,6 +1603,9 @@ Status sli_copy(SortedList list, SortedList *result)
         scan = scan->next;
     }
 
+    if (list->index != NULL)
+        return sli_set_indexed(*result, true);
+
     return DS_OK;
 }
 
@@ -1363,35 +1659,91 @@ Status sli_to_array(SortedList list, void ***result, integer_t *length)
 
 /// \brief Merge two SortedList_s.
 ///
-/// Removes all elements from list2 and inserts them into list1.
+/// Removes all elements from list2 and inserts them into list1. The nodes of
+/// list2 are relinked into list1 in a single pass, so this takes O(n + m) and
+/// allocates nothing when both lists share the same compare function. If
+/// list2 is sorted in the opposite order it is walked from its tail. If the
+/// compare functions differ the elements of list2 are first sorted by list1's
+/// compare function, taking O(m log m) and a buffer of 2 * m pointers.
+/// Elements of list1 come before equal elements of list2.
 ///
 /// \param[in] list1 SortedList_s where elements are added to.
 /// \param[in] list2 SortedList_s where elements are removed from.
 ///
+/// \return DS_ERR_ALLOC if the sorting buffer allocation failed.
+/// \return DS_ERR_FULL if list1 has a limit and there is no room for all the
+/// elements of list2.
+/// \return DS_ERR_INCOMPLETE_TYPE if list1 has no default compare function.
 /// \return DS_ERR_NULL_POINTER if either list1 or list2 references are
 /// \c NULL.
+/// \return DS_OK if all operations are successful.
 Status sli_merge(SortedList list1, SortedList list2)
 {
     if (list1 == NULL || list2 == NULL)
         return DS_ERR_NULL_POINTER;
 
-    Status st;
+    if (sli_empty(list2) || list1 == list2)
+        return DS_OK;
+
+    if (list1->v_compare == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
 
-    void *result;
+    if (list1->limit > 0 && list1->length + list2->length > list1->limit)
+        return DS_ERR_FULL;
+
+    SortedListNode chain = list2->head;
 
-    while (!sli_empty(list2))
+    // The order of list2 means nothing to list1, so its elements are sorted
+    // again and moved around its nodes
+    if (list2->v_compare != list1->v_compare)
     {
-        st = sli_remove(list2, &result, 0);
+        void **buffer = malloc(sizeof(void*) * (size_t)list2->length * 2);
 
-        if (st != DS_OK)
-            return st;
+        if (!buffer)
+            return DS_ERR_ALLOC;
 
-        st = sli_insert(list1, result);
+        integer_t i = 0;
 
-        if (st != DS_OK)
-            return st;
+        for (SortedListNode node = chain; node != NULL; node = node->next)
+            buffer[i++] = node->data;
+
+        void **sorted = sli_sort_array(list1, buffer, buffer + i, i);
+
+        i = 0;
+
+        for (SortedListNode node = chain; node != NULL; node = node->next)
+            node->data = sorted[i++];
+
+        free(buffer);
+    }
+
+    // The towers of list2 are meaningless in list1
+    sli_index_strip(list2);
+
+    // Turn the chain around so it follows the order of list1
+    if (list2->v_compare == list1->v_compare && list2->order != list1->order)
+    {
+        SortedListNode node = list2->tail;
+
+        chain = node;
+
+        while (node != NULL)
+        {
+            node->next = node->prev;
+
+            node = node->next;
+        }
     }
 
+    integer_t length = list2->length;
+
+    list2->head = NULL;
+    list2->tail = NULL;
+    list2->length = 0;
+    list2->version_id++;
+
+    sli_merge_chain(list1, chain, length);
+
     return DS_OK;
 }
 
@@ -1434,6 +1786,14 @@ Status sli_unlink(SortedList list, SortedList *result, integer_t position)
 
     (*result)->limit = list->limit;
 
+    if (list->index != NULL)
+    {
+        st = sli_set_indexed(*result, true);
+
+        if (st != DS_OK)
+            return st;
+    }
+
     SortedListNode node, new_tail;
 
     // Special case
@@ -1475,6 +1835,10 @@ Status sli_unlink(SortedList list, SortedList *result, integer_t position)
         list->length = position;
     }
 
+    // Each half has towers linked to the other one
+    sli_index_build(list);
+    sli_index_build(*result);
+
     list->version_id++;
 
     return DS_OK;
@@ -1528,6 +1892,14 @@ Status sli_sublist(SortedList list, SortedList *result, integer_t start,
 
     (*result)->limit = list->limit;
 
+    if (list->index != NULL)
+    {
+        st = sli_set_indexed(*result, true);
+
+        if (st != DS_OK)
+            return st;
+    }
+
     SortedListNode node;
 
     // Remove only one node
@@ -1627,6 +1999,10 @@ Status sli_sublist(SortedList list, SortedList *result, integer_t start,
 
     list->length -= (*result)->length;
 
+    // Both lists have towers linked to the other one
+    sli_index_build(list);
+    sli_index_build(*result);
+
     list->version_id++;
 
     return DS_OK;
@@ -1759,6 +2135,149 @@ Status sli_display_raw(SortedList list)
     return DS_OK;
 }
 
+/// \brief Saves the list's elements to a stream.
+///
+/// Saves the list's elements from the head to the tail together with the
+/// list's order, each one encoded by the given function. See Serial.h for the
+/// format.
+///
+/// \param[in] list The list to be saved.
+/// \param[in] function A function that encodes an element.
+/// \param[in] serial The stream where the list is written to.
+///
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if writing to the stream failed.
+/// \return DS_OK if all operations were successful.
+Status sli_serialize(SortedList list, serialize_f function, Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    uint32_t layout = list->order == ASCENDING ? 1 : 2;
+
+    if (!ser_write_header(serial, SER_SORTED_LIST, layout, list->length))
+        return DS_ERR_STREAM;
+
+    for (SortedListNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        if (!ser_write_element(serial, function, scan->data))
+            return DS_ERR_STREAM;
+    }
+
+    return DS_OK;
+}
+
+/// \brief Loads elements saved with sli_serialize() into an empty list.
+///
+/// Since elements were saved in order each one is appended to the tail
+/// instead of searching for its position; they are only compared to check
+/// that they really are sorted. If the list has the opposite order of the
+/// one that was saved it is reversed at the end. If anything fails the
+/// elements already loaded are freed with the list's default free function.
+///
+/// \param[in] list An empty list.
+/// \param[in] function A function that decodes an element.
+/// \param[in] serial The stream where the list is read from.
+///
+/// \return DS_ERR_ALLOC if node allocation failed.
+/// \return DS_ERR_FULL if the elements don't fit in the list's limit.
+/// \return DS_ERR_INCOMPLETE_TYPE if a default compare or free function is not
+/// set.
+/// \return DS_ERR_INVALID_OPERATION if the list is not empty.
+/// \return DS_ERR_NULL_POINTER if the list references to \c NULL.
+/// \return DS_ERR_STREAM if reading from the stream failed or if it doesn't
+/// have a valid SortedList_s.
+/// \return DS_OK if all operations were successful.
+Status sli_deserialize(SortedList list, deserialize_f function,
+                       Serial_t *serial)
+{
+    if (list == NULL)
+        return DS_ERR_NULL_POINTER;
+
+    if (list->v_compare == NULL || list->v_free == NULL)
+        return DS_ERR_INCOMPLETE_TYPE;
+
+    if (!sli_empty(list))
+        return DS_ERR_INVALID_OPERATION;
+
+    uint32_t layout;
+    integer_t length;
+
+    if (!ser_read_header(serial, SER_SORTED_LIST, &layout, &length))
+        return DS_ERR_STREAM;
+
+    if (layout != 1 && layout != 2)
+        return DS_ERR_STREAM;
+
+    if (list->limit > 0 && length > list->limit)
+        return DS_ERR_FULL;
+
+    SortOrder order = layout == 1 ? ASCENDING : DESCENDING;
+
+    // The index is built once at the end instead of after every element
+    struct SortedListIndex_s *index = list->index;
+
+    list->index = NULL;
+
+    Status st = DS_OK;
+
+    for (integer_t i = 0; i < length && st == DS_OK; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, function, &element))
+        {
+            st = DS_ERR_STREAM;
+            break;
+        }
+
+        if (!sli_empty(list) &&
+            list->v_compare(list->tail->data, element) * order > 0)
+        {
+            list->v_free(element);
+            st = DS_ERR_STREAM;
+            break;
+        }
+
+        st = sli_insert_tail(list, element);
+
+        if (st != DS_OK)
+            list->v_free(element);
+    }
+
+    if (st != DS_OK)
+    {
+        void *element;
+
+        while (!sli_empty(list))
+        {
+            sli_remove_max(list, &element);
+
+            list->v_free(element);
+        }
+
+        list->index = index;
+
+        return st;
+    }
+
+    list->index = index;
+
+    // sli_reverse() also flips the order back to the list's own
+    if (list->order != order)
+    {
+        list->order = order;
+
+        st = sli_reverse(list);
+    }
+    else
+        sli_index_build(list);
+
+    list->version_id++;
+
+    return st;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 /// \brief Builds a new SortedListNode_s.
@@ -1783,6 +2302,8 @@ static Status sli_make_node(SortedListNode *node, void *element)
     (*node)->next = NULL;
     (*node)->prev = NULL;
 
+    (*node)->tower = NULL;
+
     return DS_OK;
 }
 
@@ -1803,6 +2324,7 @@ static Status sli_free_node(SortedListNode *node, sli_free_f free_f)
 
     free_f((*node)->data);
 
+    free((*node)->tower);
     free(*node);
 
     *node = NULL;
@@ -1824,6 +2346,7 @@ static Status sli_free_node_shallow(SortedListNode *node)
     if (*node == NULL)
         return DS_ERR_NULL_POINTER;
 
+    free((*node)->tower);
     free(*node);
 
     *node = NULL;
@@ -1835,7 +2358,8 @@ static Status sli_free_node_shallow(SortedListNode *node)
 ///
 /// Implementation detail. Searches for a node in O(n / 2), the search starts
 /// at the tail pointer if position is greater than half the list's length,
-/// otherwise it starts at the head pointer.
+/// otherwise it starts at the head pointer. If the list is indexed it takes
+/// O(log n) expected instead.
 ///
 /// \param[in] list SortedList_s to search for the node.
 /// \param[out] result Resulting node.
@@ -1869,8 +2393,41 @@ static Status sli_get_node_at(SortedList list, SortedListNode *result,
     if (position >= list->length)
         return DS_ERR_OUT_OF_RANGE;
 
+    // Skip through the index and walk the few nodes that are left
+    if (list->index != NULL)
+    {
+        SortedListTower tower = NULL;
+
+        integer_t rank = -1;
+
+        for (integer_t level = list->index->levels - 1; level >= 0; level--)
+        {
+            struct SortedListLink_s *link = sli_link(list, tower, level);
+
+            while (link->next != NULL && rank + link->span <= position)
+            {
+                rank += link->span;
+
+                tower = link->next;
+
+                link = &tower->link[level];
+            }
+        }
+
+        if (tower == NULL)
+        {
+            (*result) = list->head;
+
+            rank = 0;
+        }
+        else
+            (*result) = tower->node;
+
+        for (; rank < position; rank++)
+            (*result) = (*result)->next;
+    }
     // Start looking for the node at the start of the list
-    if (position <= list->length / 2)
+    else if (position <= list->length / 2)
     {
         (*result) = list->head;
 
@@ -1945,6 +2502,500 @@ static Status sli_insert_tail(SortedList list, void *element)
     return DS_OK;
 }
 
+/// \brief Merges a chain of sorted nodes into the list.
+///
+/// Implementation detail. The chain is linked only through its \c next
+/// pointers and must already be sorted by the list's compare function and in
+/// its order. Both sequences are walked once and every \c prev pointer is
+/// rebuilt along the way.
+///
+/// \param[in] list SortedList_s to receive the nodes.
+/// \param[in] chain First node of the chain.
+/// \param[in] length Amount of nodes in the chain.
+static void sli_merge_chain(SortedList list, SortedListNode chain,
+        integer_t length)
+{
+    SortedListNode left = list->head, right = chain;
+    SortedListNode head = NULL, tail = NULL, node;
+
+    while (left != NULL || right != NULL)
+    {
+        if (right == NULL ||
+            (left != NULL && sli_in_order(list, left->data, right->data)))
+        {
+            node = left;
+            left = left->next;
+        }
+        else
+        {
+            node = right;
+            right = right->next;
+        }
+
+        node->prev = tail;
+
+        if (tail == NULL)
+            head = node;
+        else
+            tail->next = node;
+
+        tail = node;
+    }
+
+    tail->next = NULL;
+
+    list->head = head;
+    list->tail = tail;
+    list->length += length;
+    list->version_id++;
+
+    sli_index_build(list);
+}
+
+/// \brief Sorts an array of elements in the list's order.
+///
+/// Implementation detail. A bottom-up merge sort that swaps between the
+/// elements array and a buffer of the same size. Equal elements keep their
+/// relative order.
+///
+/// \param[in] list SortedList_s with the compare function and order.
+/// \param[in] elements Elements to be sorted.
+/// \param[in] buffer Scratch space for \c count elements.
+/// \param[in] count Amount of elements.
+///
+/// \return Either \c elements or \c buffer, whichever ends up sorted.
+static void **sli_sort_array(SortedList list, void **elements, void **buffer,
+        integer_t count)
+{
+    void **source = elements, **target = buffer, **swap;
+
+    for (integer_t width = 1; width < count; width *= 2)
+    {
+        for (integer_t start = 0; start < count; start += 2 * width)
+        {
+            integer_t middle = start + width < count ? start + width : count;
+            integer_t end = middle + width < count ? middle + width : count;
+            integer_t i = start, j = middle, k = start;
+
+            while (i < middle && j < end)
+            {
+                if (sli_in_order(list, source[i], source[j]))
+                    target[k++] = source[i++];
+                else
+                    target[k++] = source[j++];
+            }
+
+            while (i < middle)
+                target[k++] = source[i++];
+
+            while (j < end)
+                target[k++] = source[j++];
+        }
+
+        swap = source;
+        source = target;
+        target = swap;
+    }
+
+    return source;
+}
+
+/// \brief Tells if two elements can stay in the given sequence.
+///
+/// Implementation detail. Returns true if \c first may come before \c second
+/// in the list's order, which also holds when both are equal.
+///
+/// \param[in] list SortedList_s with the compare function and order.
+/// \param[in] first Element that comes first.
+/// \param[in] second Element that comes after.
+///
+/// \return True if the two elements are in order.
+static bool sli_in_order(SortedList list, void *first, void *second)
+{
+    int comparison = list->v_compare(first, second);
+
+    if (list->order == ASCENDING)
+        return comparison <= 0;
+
+    return comparison >= 0;
+}
+
+/// \brief Returns a link of the skip index.
+///
+/// Implementation detail. Returns the link at \c level of a tower, or of the
+/// index header if \c tower is \c NULL.
+///
+/// \param[in] list An indexed SortedList_s.
+/// \param[in] tower A tower of the list or \c NULL for the header.
+/// \param[in] level Index level, starting at 0.
+///
+/// \return The link at the given level.
+static struct SortedListLink_s *sli_link(SortedList list,
+        SortedListTower tower, integer_t level)
+{
+    if (tower == NULL)
+        return &list->index->link[level];
+
+    return &tower->link[level];
+}
+
+/// \brief Picks the height of a new tower.
+///
+/// Implementation detail. Each level is reached with a probability of 1/4 so
+/// three out of four nodes get no tower at all. Uses an xorshift generator
+/// local to the list.
+///
+/// \param[in] list An indexed SortedList_s.
+///
+/// \return The amount of levels of the new tower, possibly 0.
+static integer_t sli_index_height(SortedList list)
+{
+    uint64_t x = list->index->state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    list->index->state = x;
+
+    integer_t height = 0;
+
+    while (height < SLI_INDEX_LEVELS && (x & 3) == 0)
+    {
+        height++;
+
+        x >>= 2;
+    }
+
+    return height;
+}
+
+/// \brief Finds the last node that comes before a key.
+///
+/// Implementation detail. Goes down the skip index and then along the list to
+/// the last node that comes before \c key in the list's order or, if
+/// \c equal is true, that comes before or is equal to it. At each level the
+/// last tower visited and its position are stored in \c update and \c rank.
+///
+/// \param[in] list An indexed SortedList_s.
+/// \param[in] key Key to be searched.
+/// \param[in] equal If elements equal to the key are also skipped.
+/// \param[out] update The last tower visited at each level.
+/// \param[out] rank Positions of those towers.
+/// \param[out] position Position of the node found, or -1.
+///
+/// \return The node found or \c NULL if no node comes before the key.
+static SortedListNode sli_index_seek(SortedList list, void *key, bool equal,
+        SortedListTower *update, integer_t *rank, integer_t *position)
+{
+    SortedListTower tower = NULL;
+
+    *position = -1;
+
+    for (integer_t level = list->index->levels - 1; level >= 0; level--)
+    {
+        struct SortedListLink_s *link = sli_link(list, tower, level);
+
+        while (link->next != NULL && (equal
+                ? sli_in_order(list, link->next->node->data, key)
+                : !sli_in_order(list, key, link->next->node->data)))
+        {
+            *position += link->span;
+
+            tower = link->next;
+
+            link = &tower->link[level];
+        }
+
+        update[level] = tower;
+        rank[level] = *position;
+    }
+
+    // Finish on the list itself, expected to be only a few nodes away
+    SortedListNode node = tower == NULL ? NULL : tower->node;
+    SortedListNode scan = node == NULL ? list->head : node->next;
+
+    while (scan != NULL && (equal
+            ? sli_in_order(list, scan->data, key)
+            : !sli_in_order(list, key, scan->data)))
+    {
+        (*position)++;
+
+        node = scan;
+
+        scan = scan->next;
+    }
+
+    return node;
+}
+
+/// \brief Links a new node into an indexed list.
+///
+/// Implementation detail. Finds the node's position through the index, links
+/// it before any equal elements just like sli_insert() and gives it a tower
+/// of a random height. The list's length is not changed. If the tower can't
+/// be allocated the node is simply left without one.
+///
+/// \param[in] list An indexed SortedList_s.
+/// \param[in] node A new node with its data set.
+static void sli_index_insert(SortedList list, SortedListNode node)
+{
+    struct SortedListIndex_s *index = list->index;
+
+    SortedListTower update[SLI_INDEX_LEVELS];
+    integer_t rank[SLI_INDEX_LEVELS];
+    integer_t levels = index->levels, position;
+
+    SortedListNode before = sli_index_seek(list, node->data, false, update,
+            rank, &position);
+
+    // The new node goes right after 'before'
+    position++;
+
+    SortedListNode after = before == NULL ? list->head : before->next;
+
+    node->prev = before;
+    node->next = after;
+
+    if (before == NULL)
+        list->head = node;
+    else
+        before->next = node;
+
+    if (after == NULL)
+        list->tail = node;
+    else
+        after->prev = node;
+
+    integer_t height = sli_index_height(list);
+
+    SortedListTower tower = NULL;
+
+    if (height > 0)
+    {
+        tower = malloc(sizeof(struct SortedListTower_s) +
+                       sizeof(struct SortedListLink_s) * (size_t)height);
+
+        if (!tower)
+            height = 0;
+    }
+
+    // New levels start at the header and span the whole list
+    for (integer_t level = levels; level < height; level++)
+    {
+        index->link[level].next = NULL;
+        index->link[level].span = list->length + 1;
+
+        update[level] = NULL;
+        rank[level] = -1;
+    }
+
+    if (height > levels)
+        index->levels = height;
+
+    for (integer_t level = 0; level < index->levels; level++)
+    {
+        struct SortedListLink_s *link = sli_link(list, update[level], level);
+
+        if (level >= height)
+        {
+            // Jumps over the new node
+            link->span++;
+
+            continue;
+        }
+
+        tower->link[level].next = link->next;
+        tower->link[level].prev = update[level];
+        tower->link[level].span = rank[level] + link->span + 1 - position;
+
+        if (link->next != NULL)
+            link->next->link[level].prev = tower;
+
+        link->next = tower;
+        link->span = position - rank[level];
+    }
+
+    if (tower != NULL)
+    {
+        tower->node = node;
+        tower->height = height;
+    }
+
+    node->tower = tower;
+}
+
+/// \brief Removes a node from the skip index.
+///
+/// Implementation detail. Must be called after the node is unlinked from the
+/// list, while its \c prev pointer still points to its old neighbour. The
+/// towers before the node that jump over it are found by walking backwards,
+/// which takes O(log n) expected. The node's tower is then freed.
+///
+/// \param[in] list SortedList_s the node belonged to.
+/// \param[in] node The node being removed.
+static void sli_index_remove(SortedList list, SortedListNode node)
+{
+    struct SortedListIndex_s *index = list->index;
+
+    if (index == NULL)
+        return;
+
+    SortedListTower tower = node->tower;
+
+    integer_t height = tower == NULL ? 0 : tower->height;
+    integer_t level = 0;
+
+    for (; level < height; level++)
+    {
+        struct SortedListLink_s *own = &tower->link[level];
+        struct SortedListLink_s *link = sli_link(list, own->prev, level);
+
+        link->next = own->next;
+        link->span += own->span - 1;
+
+        if (own->next != NULL)
+            own->next->link[level].prev = own->prev;
+    }
+
+    if (level < index->levels)
+    {
+        // The closest tower before the node, which covers the first level
+        // that is above the node's own
+        SortedListTower prev = NULL;
+
+        if (tower != NULL)
+            prev = tower->link[height - 1].prev;
+        else
+        {
+            SortedListNode scan = node->prev;
+
+            while (scan != NULL && scan->tower == NULL)
+                scan = scan->prev;
+
+            prev = scan == NULL ? NULL : scan->tower;
+        }
+
+        for (; level < index->levels; level++)
+        {
+            while (prev != NULL && prev->height <= level)
+                prev = prev->link[prev->height - 1].prev;
+
+            sli_link(list, prev, level)->span--;
+        }
+    }
+
+    while (index->levels > 0 && index->link[index->levels - 1].next == NULL)
+        index->levels--;
+
+    free(tower);
+
+    node->tower = NULL;
+}
+
+/// \brief Frees every tower of a list.
+///
+/// Implementation detail. Leaves the index header empty. Used when the nodes
+/// are about to be moved to a different list.
+///
+/// \param[in] list SortedList_s reference.
+static void sli_index_strip(SortedList list)
+{
+    if (list->index == NULL)
+        return;
+
+    for (SortedListNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        free(scan->tower);
+
+        scan->tower = NULL;
+    }
+
+    list->index->levels = 0;
+}
+
+/// \brief Builds the skip index of a list from scratch.
+///
+/// Implementation detail. Frees any tower the nodes have, which may be linked
+/// to another list, and builds new ones in a single pass. Does nothing if the
+/// list is not indexed.
+///
+/// \param[in] list SortedList_s reference.
+static void sli_index_build(SortedList list)
+{
+    struct SortedListIndex_s *index = list->index;
+
+    if (index == NULL)
+        return;
+
+    SortedListTower last[SLI_INDEX_LEVELS];
+    integer_t rank[SLI_INDEX_LEVELS];
+
+    index->levels = 0;
+
+    integer_t position = 0;
+
+    for (SortedListNode scan = list->head; scan != NULL; scan = scan->next)
+    {
+        free(scan->tower);
+
+        scan->tower = NULL;
+
+        integer_t height = sli_index_height(list);
+
+        if (height == 0)
+        {
+            position++;
+
+            continue;
+        }
+
+        SortedListTower tower = malloc(sizeof(struct SortedListTower_s) +
+                sizeof(struct SortedListLink_s) * (size_t)height);
+
+        if (!tower)
+        {
+            position++;
+
+            continue;
+        }
+
+        for (; index->levels < height; index->levels++)
+        {
+            last[index->levels] = NULL;
+            rank[index->levels] = -1;
+        }
+
+        for (integer_t level = 0; level < height; level++)
+        {
+            struct SortedListLink_s *link = sli_link(list, last[level], level);
+
+            link->next = tower;
+            link->span = position - rank[level];
+
+            tower->link[level].prev = last[level];
+
+            last[level] = tower;
+            rank[level] = position;
+        }
+
+        tower->node = scan;
+        tower->height = height;
+
+        scan->tower = tower;
+
+        position++;
+    }
+
+    for (integer_t level = 0; level < index->levels; level++)
+    {
+        struct SortedListLink_s *link = sli_link(list, last[level], level);
+
+        link->next = NULL;
+        link->span = list->length - rank[level];
+    }
+}
+
 ////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2338,6 +3389,8 @@ Status sli_iter_remove_next(SortedListIterator iter, void **result)
         node->next->prev = iter->cursor;
     }
 
+    sli_index_remove(iter->target, node);
+
     free(node);
 
     iter->target->length--;
@@ -2419,6 +3472,8 @@ Status sli_iter_remove_curr(SortedListIterator iter, void **result)
         // WHOA...
     }
 
+    sli_index_remove(iter->target, node);
+
     free(node);
 
     iter->target->length--;
@@ -2478,6 +3533,8 @@ Status sli_iter_remove_prev(SortedListIterator iter, void **result)
         node->prev->next = iter->cursor;
     }
 
+    sli_index_remove(iter->target, node);
+
     free(node);
 
     iter->target->length--;
@@ -754,6 +754,75 @@ sta_display(StackArray_t *stack, int display_mode)
     }
 }
 
+/// Saves the stack's elements from the bottom to the top, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] stack The stack to be saved.
+/// \param[in] serial The stream where the stack is written to.
+///
+/// \return True if the stack was saved or false if writing failed.
+bool
+sta_serialize(StackArray_t *stack, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_STACK_ARRAY, 0, stack->count))
+        return false;
+
+    for (integer_t i = 0; i < stack->count; i++)
+    {
+        if (!ser_write_element(serial, stack->interface->serialize,
+                               stack->buffer[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with sta_serialize(), keeping the same top.
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] stack An empty stack.
+/// \param[in] serial The stream where the stack is read from.
+///
+/// \return True if all elements were loaded. False if the stack is not empty,
+/// if the stream is not a valid StackArray_s, if reading failed or if the
+/// stack couldn't grow, in which case the stack is left empty.
+bool
+sta_deserialize(StackArray_t *stack, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!sta_empty(stack))
+        return false;
+
+    if (!ser_read_header(serial, SER_STACK_ARRAY, &layout, &count))
+        return false;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, stack->interface->deserialize, &element))
+        {
+            sta_erase(stack);
+            return false;
+        }
+
+        if (!sta_push(stack, element))
+        {
+            stack->interface->free(element);
+            sta_erase(stack);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 // This function reallocates the data buffer increasing its capacity
@@ -824,6 +893,10 @@ struct StackArrayIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t sta_iter_size = sizeof(StackArrayIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool
@@ -853,6 +926,24 @@ sta_iter_new(StackArray_t *target)
     return iter;
 }
 
+///
+/// \param[in,out] iter
+/// \param[in] target
+///
+/// \return
+bool
+sta_iter_init(StackArrayIterator_t *iter, StackArray_t *target)
+{
+    if (sta_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = 0;
+
+    return true;
+}
+
 ///
 /// \param[in] iter
 /// \param[in] target
@@ -944,7 +1035,7 @@ sta_iter_to_bottom(StackArrayIterator_t *iter)
 bool
 sta_iter_has_next(StackArrayIterator_t *iter)
 {
-    return iter->cursor < iter->target->count;
+    return iter->cursor < iter->target->count - 1;
 }
 
 ///
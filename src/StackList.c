@@ -792,6 +792,95 @@ stl_display(StackList_t *stack, int display_mode)
     }
 }
 
+/// Saves the stack's elements from the top to the bottom, each one encoded
+/// by the interface's codec. See Serial.h for the format.
+/// \par Interface Requirements
+/// - serialize
+///
+/// \param[in] stack The stack to be saved.
+/// \param[in] serial The stream where the stack is written to.
+///
+/// \return True if the stack was saved or false if writing failed.
+bool
+stl_serialize(StackList_t *stack, Serial_t *serial)
+{
+    if (!ser_write_header(serial, SER_STACK_LIST, 0, stack->count))
+        return false;
+
+    for (StackListNode_t *scan = stack->top; scan != NULL; scan = scan->below)
+    {
+        if (!ser_write_element(serial, stack->interface->serialize,
+                               scan->data))
+            return false;
+    }
+
+    return true;
+}
+
+/// Loads elements saved with stl_serialize(), keeping the same top. Nodes are
+/// linked below each other as they are read.
+/// \par Interface Requirements
+/// - deserialize
+/// - free
+///
+/// \param[in] stack An empty stack.
+/// \param[in] serial The stream where the stack is read from.
+///
+/// \return True if all elements were loaded. False if the stack is not empty,
+/// if the elements don't fit in the stack's limit, if the stream is not a
+/// valid StackList_s or if reading failed, in which case the stack is left
+/// empty.
+bool
+stl_deserialize(StackList_t *stack, Serial_t *serial)
+{
+    uint32_t layout;
+    integer_t count;
+
+    if (!stl_empty(stack))
+        return false;
+
+    if (!ser_read_header(serial, SER_STACK_LIST, &layout, &count))
+        return false;
+
+    if (!stl_fits(stack, (unsigned_t)count))
+        return false;
+
+    StackListNode_t *bottom = NULL;
+
+    for (integer_t i = 0; i < count; i++)
+    {
+        void *element;
+
+        if (!ser_read_element(serial, stack->interface->deserialize, &element))
+        {
+            stl_erase(stack);
+            return false;
+        }
+
+        StackListNode_t *node = stl_new_node(element);
+
+        if (!node)
+        {
+            stack->interface->free(element);
+            stl_erase(stack);
+            return false;
+        }
+
+        if (bottom == NULL)
+            stack->top = node;
+        else
+            bottom->below = node;
+
+        bottom = node;
+
+        stack->count++;
+    }
+
+    stack->version_id++;
+
+    return true;
+}
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static StackListNode_t *
@@ -852,6 +941,10 @@ struct StackListIterator_s
     integer_t target_id;
 };
 
+/// This can be used together with VLAs to allocate the iterator on the stack
+/// instead of a heap allocation.
+const unsigned_t stl_iter_size = sizeof(StackListIterator_t);
+
 ///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
 
 static bool
@@ -881,6 +974,24 @@ stl_iter_new(StackList_t *target)
     return iter;
 }
 
+///
+/// \param[in,out] iter
+/// \param[in] target
+///
+/// \return
+bool
+stl_iter_init(StackListIterator_t *iter, StackList_t *target)
+{
+    if (stl_empty(target))
+        return false;
+
+    iter->target = target;
+    iter->target_id = target->version_id;
+    iter->cursor = target->top;
+
+    return true;
+}
+
 ///
 /// \param[in] iter
 /// \param[in] target
@@ -0,0 +1,616 @@
+/**
+ * @file TimerWheel.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "TimerWheel.h"
+#include "NodePool.h"
+#include <inttypes.h>
+
+/// \brief Mask of the bits of a tick that index the slots of a level.
+#define TMW_SLOT_MASK (TMW_SLOTS - 1)
+
+/// \brief Largest distance between the current tick and a slot of the last
+/// level.
+#define TMW_MAX_DELTA \
+    ((UINT64_C(1) << (TMW_LEVEL_BITS * TMW_LEVELS)) - 1)
+
+/// \brief A TimerWheel_s timer.
+///
+/// Timers are nodes of a circular doubly-linked list, like the nodes of a
+/// CircularLinkedList_s. Each slot of the wheel is a sentinel node of one of
+/// these lists, so a timer is unlinked without knowing where it is.
+struct TimerWheelNode_s
+{
+    /// \brief Data pointer.
+    void *data;
+
+    /// \brief The tick when this timer expires.
+    uint64_t expires;
+
+    /// \brief Next node on the list.
+    struct TimerWheelNode_s *next;
+
+    /// \brief Previous node on the list.
+    struct TimerWheelNode_s *prev;
+
+    /// \brief Level of the slot that holds this timer.
+    unsigned short level;
+
+    /// \brief Index of the slot that holds this timer.
+    unsigned short slot;
+};
+
+/// A hierarchical timing wheel keeps timers in lists, one for each slot of
+/// a set of levels. The slots of level 0 are ticks, the slots of level 1
+/// are TMW_SLOTS ticks each, the slots of level 2 are TMW_SLOTS^2 ticks each
+/// and so on. A timer goes to the lowest level that reaches its expiration,
+/// in the slot indexed by the bits of that level in the expiration tick.
+///
+/// Scheduling and cancelling a timer are constant time: a timer is linked
+/// to or unlinked from a list. When the current tick crosses the start of a
+/// slot of a higher level, that slot is cascaded: its timers are scheduled
+/// again and move to lower levels. When the current tick reaches a slot of
+/// level 0, every timer in it has expired. Each timer is cascaded at most
+/// TMW_LEVELS - 1 times.
+///
+/// Every level has a bit mask of its non-empty slots. Advancing the wheel
+/// jumps straight to the next tick where a non-empty slot is cascaded or
+/// expires, so advancing over an idle stretch of any length costs a few
+/// bit operations per level.
+struct TimerWheel_s
+{
+    /// \brief Sentinel nodes of the lists of each slot.
+    struct TimerWheelNode_s slots[TMW_LEVELS][TMW_SLOTS];
+
+    /// \brief Bit \c i of a level is set if its slot \c i is not empty.
+    uint64_t occupied[TMW_LEVELS];
+
+    /// \brief The current tick.
+    uint64_t now;
+
+    /// \brief Current amount of scheduled timers.
+    integer_t count;
+
+    /// \brief Pool where the timers are allocated from.
+    struct NodePool_s *pool;
+
+    /// \brief TimerWheel_s interface.
+    ///
+    /// An interface is like a table that has function pointers for functions
+    /// that will manipulate a desired data type. Timers are ordered by their
+    /// ticks, so the interface only needs a free and a display function.
+    struct Interface_s *interface;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+tmw_place(TimerWheel_t *wheel, TimerWheelNode_t *node, uint64_t when);
+
+static void
+tmw_unlink(TimerWheel_t *wheel, TimerWheelNode_t *node);
+
+static void
+tmw_detach(TimerWheel_t *wheel, integer_t level, integer_t slot,
+           TimerWheelNode_t *list);
+
+static uint64_t
+tmw_next_tick(TimerWheel_t *wheel);
+
+static void
+tmw_clear(TimerWheel_t *wheel, bool elements);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Initializes a new empty TimerWheel_s.
+///
+/// \param[in] interface An interface with a free and a display function.
+/// \param[in] now The starting tick of the wheel.
+///
+/// \return A new TimerWheel_s or NULL if allocation failed.
+TimerWheel_t *
+tmw_new(Interface_t *interface, uint64_t now)
+{
+    TimerWheel_t *wheel = malloc(sizeof(TimerWheel_t));
+
+    if (!wheel)
+        return NULL;
+
+    wheel->pool = npl_new(sizeof(TimerWheelNode_t));
+
+    if (!wheel->pool)
+    {
+        free(wheel);
+        return NULL;
+    }
+
+    for (integer_t l = 0; l < TMW_LEVELS; l++)
+    {
+        for (integer_t s = 0; s < TMW_SLOTS; s++)
+        {
+            wheel->slots[l][s].next = &wheel->slots[l][s];
+            wheel->slots[l][s].prev = &wheel->slots[l][s];
+        }
+
+        wheel->occupied[l] = 0;
+    }
+
+    wheel->now = now;
+    wheel->count = 0;
+    wheel->interface = interface;
+
+    return wheel;
+}
+
+/// Frees the wheel and the elements of every timer.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] wheel The wheel to be freed from memory.
+void
+tmw_free(TimerWheel_t *wheel)
+{
+    tmw_clear(wheel, true);
+
+    npl_free(wheel->pool);
+
+    free(wheel);
+}
+
+/// Frees the wheel, leaving the elements intact.
+///
+/// \param[in] wheel The wheel to be freed from memory.
+void
+tmw_free_shallow(TimerWheel_t *wheel)
+{
+    npl_free(wheel->pool);
+
+    free(wheel);
+}
+
+/// Cancels every timer and frees their elements. The current tick is kept.
+///
+/// \par Interface Requirements
+/// - free
+///
+/// \param[in] wheel The wheel to be erased.
+void
+tmw_erase(TimerWheel_t *wheel)
+{
+    tmw_clear(wheel, true);
+}
+
+/// Cancels every timer, leaving their elements intact. The current tick is
+/// kept.
+///
+/// \param[in] wheel The wheel to be erased.
+void
+tmw_erase_shallow(TimerWheel_t *wheel)
+{
+    tmw_clear(wheel, false);
+}
+
+/// \param[in] wheel The target wheel.
+/// \param[in] new_interface The new interface.
+void
+tmw_config(TimerWheel_t *wheel, Interface_t *new_interface)
+{
+    wheel->interface = new_interface;
+}
+
+/// \param[in] wheel The target wheel.
+///
+/// \return The amount of scheduled timers.
+integer_t
+tmw_count(TimerWheel_t *wheel)
+{
+    return wheel->count;
+}
+
+/// \param[in] wheel The target wheel.
+///
+/// \return The current tick of the wheel.
+uint64_t
+tmw_now(TimerWheel_t *wheel)
+{
+    return wheel->now;
+}
+
+/// \param[in] handle A handle to a scheduled timer.
+///
+/// \return The element of the timer.
+void *
+tmw_element(TimerWheelNode_t *handle)
+{
+    return handle->data;
+}
+
+/// \param[in] handle A handle to a scheduled timer.
+///
+/// \return The tick when the timer expires, as it was scheduled.
+uint64_t
+tmw_expires(TimerWheelNode_t *handle)
+{
+    return handle->expires;
+}
+
+/// Schedules an element to expire at a given tick in constant time. A tick
+/// that is not after the current one expires at the next tick.
+///
+/// \param[in] wheel The target wheel.
+/// \param[in] expires The tick when the timer expires.
+/// \param[in] element The element of the timer.
+/// \param[out] handle A handle to the timer. Can be NULL. It is valid until
+/// the timer expires or is cancelled.
+///
+/// \return True if the timer was scheduled, false if allocation failed.
+bool
+tmw_schedule(TimerWheel_t *wheel, uint64_t expires, void *element,
+             TimerWheelNode_t **handle)
+{
+    TimerWheelNode_t *node = npl_alloc(wheel->pool);
+
+    if (!node)
+        return false;
+
+    node->data = element;
+    node->expires = expires;
+
+    tmw_place(wheel, node, expires > wheel->now ? expires : wheel->now + 1);
+
+    wheel->count++;
+
+    if (handle)
+        *handle = node;
+
+    return true;
+}
+
+/// Cancels a timer in constant time. Its handle is no longer valid.
+///
+/// \param[in] wheel The target wheel.
+/// \param[in] handle A handle to a timer of this wheel.
+/// \param[out] result The element of the timer. Can be NULL.
+///
+/// \return True if the timer was cancelled, false if the wheel is empty.
+bool
+tmw_cancel(TimerWheel_t *wheel, TimerWheelNode_t *handle, void **result)
+{
+    if (tmw_empty(wheel))
+        return false;
+
+    tmw_unlink(wheel, handle);
+
+    if (result)
+        *result = handle->data;
+
+    npl_release(wheel->pool, handle);
+
+    wheel->count--;
+
+    return true;
+}
+
+/// Moves a timer to expire at another tick in constant time, which is how a
+/// timeout is refreshed. The handle stays valid.
+///
+/// \param[in] wheel The target wheel.
+/// \param[in] handle A handle to a timer of this wheel.
+/// \param[in] expires The new tick when the timer expires.
+///
+/// \return True if the timer was moved, false if the wheel is empty.
+bool
+tmw_reschedule(TimerWheel_t *wheel, TimerWheelNode_t *handle,
+               uint64_t expires)
+{
+    if (tmw_empty(wheel))
+        return false;
+
+    tmw_unlink(wheel, handle);
+
+    handle->expires = expires;
+
+    tmw_place(wheel, handle, expires > wheel->now ? expires : wheel->now + 1);
+
+    return true;
+}
+
+/// Advances the current tick up to a given tick and expires every timer due
+/// until then, ticks in order. Ticks where no slot has to be cascaded or
+/// expired are skipped, so the cost does not depend on how far the wheel
+/// advances.
+///
+/// A timer is removed from the wheel before its element is visited, so the
+/// function can schedule, reschedule or cancel any timer, including the
+/// ones that expire in the same tick. Timers scheduled from the function
+/// for a tick that was already reached expire at the next tick.
+///
+/// \param[in] wheel The target wheel.
+/// \param[in] now The new current tick. If it is not after the current tick
+/// nothing happens.
+/// \param[in] function A function that receives the element of each expired
+/// timer and the context. Can be NULL.
+/// \param[in] context A context passed to the function. Can be NULL.
+///
+/// \return The amount of timers that expired.
+integer_t
+tmw_advance(TimerWheel_t *wheel, uint64_t now, foreach_f function,
+            void *context)
+{
+    integer_t expired = 0;
+
+    TimerWheelNode_t list;
+
+    while (wheel->now < now)
+    {
+        if (tmw_empty(wheel))
+        {
+            wheel->now = now;
+            break;
+        }
+
+        uint64_t tick = tmw_next_tick(wheel);
+
+        if (tick > now)
+        {
+            wheel->now = now;
+            break;
+        }
+
+        wheel->now = tick;
+
+        // Cascade from the lowest level up, at every level whose slot
+        // starts at this tick
+        for (integer_t l = 1; l < TMW_LEVELS; l++)
+        {
+            uint64_t shift = (uint64_t)(TMW_LEVEL_BITS * l);
+
+            if ((tick & ((UINT64_C(1) << shift) - 1)) != 0)
+                break;
+
+            integer_t slot = (integer_t)((tick >> shift) & TMW_SLOT_MASK);
+
+            if (!(wheel->occupied[l] & (UINT64_C(1) << slot)))
+                continue;
+
+            tmw_detach(wheel, l, slot, &list);
+
+            while (list.next != &list)
+            {
+                TimerWheelNode_t *node = list.next;
+
+                // Timers of this tick go to the slot about to expire
+                list.next = node->next;
+                tmw_place(wheel, node, node->expires);
+            }
+        }
+
+        integer_t slot = (integer_t)(tick & TMW_SLOT_MASK);
+
+        if (!(wheel->occupied[0] & (UINT64_C(1) << slot)))
+            continue;
+
+        // The whole slot is moved to a local list so the function can
+        // schedule timers for the next rotation or cancel timers that are
+        // about to expire
+        tmw_detach(wheel, 0, slot, &list);
+
+        while (list.next != &list)
+        {
+            TimerWheelNode_t *node = list.next;
+            void *element = node->data;
+
+            node->next->prev = &list;
+            list.next = node->next;
+
+            npl_release(wheel->pool, node);
+
+            wheel->count--;
+            expired++;
+
+            if (function)
+                function(element, context);
+        }
+    }
+
+    return expired;
+}
+
+/// \param[in] wheel The target wheel.
+///
+/// \return True if there are no scheduled timers, otherwise false.
+bool
+tmw_empty(TimerWheel_t *wheel)
+{
+    return wheel->count == 0;
+}
+
+/// Displays every non-empty slot and the elements of its timers with the
+/// ticks when they expire.
+///
+/// \par Interface Requirements
+/// - display
+///
+/// \param[in] wheel The wheel to be displayed.
+void
+tmw_display(TimerWheel_t *wheel)
+{
+    if (tmw_empty(wheel))
+    {
+        printf("\nTimer Wheel (tick %" PRIu64 ")\n[ empty ]\n", wheel->now);
+        return;
+    }
+
+    printf("\nTimer Wheel (tick %" PRIu64 ")\n", wheel->now);
+
+    for (integer_t l = 0; l < TMW_LEVELS; l++)
+    {
+        for (integer_t s = 0; s < TMW_SLOTS; s++)
+        {
+            TimerWheelNode_t *sentinel = &wheel->slots[l][s];
+
+            if (sentinel->next == sentinel)
+                continue;
+
+            printf("%" PRIdMAX ":%2" PRIdMAX " : [ ", l, s);
+
+            for (TimerWheelNode_t *node = sentinel->next; node != sentinel;
+                 node = node->next)
+            {
+                printf("%" PRIu64 ":", node->expires);
+                wheel->interface->display(node->data);
+                printf(node->next != sentinel ? ", " : " ");
+            }
+
+            printf("]\n");
+        }
+    }
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Links a node at the end of the slot that reaches a given tick, which must
+// not be before the current one. Ticks too far away go to the furthest slot
+// of the last level, to be placed again once cascaded.
+static void
+tmw_place(TimerWheel_t *wheel, TimerWheelNode_t *node, uint64_t when)
+{
+    uint64_t delta = when - wheel->now;
+
+    if (delta > TMW_MAX_DELTA)
+    {
+        delta = TMW_MAX_DELTA;
+        when = wheel->now + delta;
+    }
+
+    integer_t level = 0;
+
+    while (level < TMW_LEVELS - 1 &&
+           delta >> (TMW_LEVEL_BITS * (level + 1)) != 0)
+        level++;
+
+    integer_t slot = (integer_t)
+            ((when >> (TMW_LEVEL_BITS * level)) & TMW_SLOT_MASK);
+
+    TimerWheelNode_t *sentinel = &wheel->slots[level][slot];
+
+    node->next = sentinel;
+    node->prev = sentinel->prev;
+    sentinel->prev->next = node;
+    sentinel->prev = node;
+
+    node->level = (unsigned short)level;
+    node->slot = (unsigned short)slot;
+
+    wheel->occupied[level] |= UINT64_C(1) << slot;
+}
+
+// Unlinks a node from its slot
+static void
+tmw_unlink(TimerWheel_t *wheel, TimerWheelNode_t *node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+
+    TimerWheelNode_t *sentinel = &wheel->slots[node->level][node->slot];
+
+    if (sentinel->next == sentinel)
+        wheel->occupied[node->level] &= ~(UINT64_C(1) << node->slot);
+}
+
+// Moves every node of a slot to a list headed by a local sentinel, leaving
+// the slot empty. The slot must not be empty.
+static void
+tmw_detach(TimerWheel_t *wheel, integer_t level, integer_t slot,
+           TimerWheelNode_t *list)
+{
+    TimerWheelNode_t *sentinel = &wheel->slots[level][slot];
+
+    list->next = sentinel->next;
+    list->prev = sentinel->prev;
+    list->next->prev = list;
+    list->prev->next = list;
+
+    sentinel->next = sentinel;
+    sentinel->prev = sentinel;
+
+    wheel->occupied[level] &= ~(UINT64_C(1) << slot);
+}
+
+// Returns the first tick after the current one where a non-empty slot is
+// cascaded or expires. The wheel must not be empty.
+static uint64_t
+tmw_next_tick(TimerWheel_t *wheel)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (integer_t l = 0; l < TMW_LEVELS; l++)
+    {
+        uint64_t mask = wheel->occupied[l];
+
+        if (!mask)
+            continue;
+
+        unsigned shift = (unsigned)(TMW_LEVEL_BITS * l);
+        uint64_t base = wheel->now >> shift;
+        unsigned start = (unsigned)((base + 1) & TMW_SLOT_MASK);
+
+        // Bit 0 becomes the slot right after the current one, so the
+        // lowest bit set is how many slots away the next non-empty one is
+        if (start)
+            mask = (mask >> start) | (mask << (TMW_SLOTS - start));
+
+        uint64_t distance = 1;
+
+#if defined(__GNUC__)
+        distance += (uint64_t)__builtin_ctzll(mask);
+#else
+        while (!(mask & 1))
+        {
+            mask >>= 1;
+            distance++;
+        }
+#endif
+
+        uint64_t tick = (base + distance) << shift;
+
+        if (tick < best)
+            best = tick;
+    }
+
+    return best;
+}
+
+// Unlinks every timer, freeing the elements if asked to
+static void
+tmw_clear(TimerWheel_t *wheel, bool elements)
+{
+    for (integer_t l = 0; l < TMW_LEVELS; l++)
+    {
+        for (integer_t s = 0; s < TMW_SLOTS; s++)
+        {
+            TimerWheelNode_t *sentinel = &wheel->slots[l][s];
+
+            if (elements)
+            {
+                for (TimerWheelNode_t *node = sentinel->next;
+                     node != sentinel; node = node->next)
+                    wheel->interface->free(node->data);
+            }
+
+            sentinel->next = sentinel;
+            sentinel->prev = sentinel;
+        }
+
+        wheel->occupied[l] = 0;
+    }
+
+    npl_clear(wheel->pool);
+
+    wheel->count = 0;
+}
@@ -9,6 +9,8 @@
 #include "AVLTree.h"
 #include "UnitTest.h"
 #include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
 
 void avl_test_IO0(UnitTest ut)
 {
@@ -257,6 +259,197 @@ void avl_test_IO3(UnitTest ut)
     ut_error();
 }
 
+struct avl_test_reader
+{
+    AVLTreeSync_t *sync;
+    atomic_bool *done;
+    bool success;
+};
+
+static void *avl_test_reader_run(void *argument)
+{
+    struct avl_test_reader *reader = argument;
+
+    reader->success = true;
+
+    int64_t sentinel = -1;
+
+    while (!atomic_load(reader->done))
+    {
+        // The sentinel is the minimum and is never removed
+        int64_t *min = avl_sync_min(reader->sync);
+        int64_t *max = avl_sync_max(reader->sync);
+
+        if (!min || !max || *min != sentinel || *max < *min)
+            reader->success = false;
+
+        if (!avl_sync_contains(reader->sync, &sentinel))
+            reader->success = false;
+
+        free(min);
+        free(max);
+    }
+
+    return NULL;
+}
+
+// Checks both modes with readers running while a writer changes the tree
+void avl_test_sync(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        goto error;
+
+    SyncMode modes[2] = { SYNC_RWLOCK, SYNC_RCU };
+
+    for (int m = 0; m < 2; m++)
+    {
+        AVLTreeSync_t *sync = avl_sync_new(interface, modes[m]);
+
+        if (!sync)
+            goto error;
+
+        if (!avl_sync_insert(sync, new_int64_t(-1)))
+            goto error;
+
+        atomic_bool done = false;
+        pthread_t handles[4];
+        struct avl_test_reader readers[4];
+
+        for (int i = 0; i < 4; i++)
+        {
+            readers[i].sync = sync;
+            readers[i].done = &done;
+
+            pthread_create(&handles[i], NULL, avl_test_reader_run, &readers[i]);
+        }
+
+        const int64_t elements = 500;
+        bool success = true;
+
+        for (int64_t i = 0; i < elements; i++)
+            success = success && avl_sync_insert(sync, new_int64_t(i));
+
+        int64_t duplicate = 0;
+        success = success && !avl_sync_insert(sync, &duplicate);
+
+        for (int64_t i = 0; i < elements; i += 2)
+            success = success && avl_sync_remove(sync, &i);
+
+        success = success && !avl_sync_remove(sync, &duplicate);
+
+        atomic_store(&done, true);
+
+        for (int i = 0; i < 4; i++)
+        {
+            pthread_join(handles[i], NULL);
+            success = success && readers[i].success;
+        }
+
+        int64_t odd = 1;
+
+        ut_equals_bool(ut, true, success, __func__);
+        ut_equals_bool(ut, true, avl_sync_contains(sync, &odd), __func__);
+        ut_equals_integer_t(ut, elements / 2 + 1, avl_sync_size(sync),
+                            __func__);
+        ut_equals_bool(ut, true, avl_sync_mode(sync) == modes[m], __func__);
+
+        avl_sync_free(sync);
+    }
+
+    interface_free(interface);
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (interface)
+        interface_free(interface);
+    ut_error();
+}
+
+static bool avl_test_load(void *target, Serial_t *serial)
+{
+    return avl_deserialize(target, serial);
+}
+
+static bool avl_test_empty(void *target)
+{
+    return avl_empty(target);
+}
+
+// Saves a tree and loads it back without rotations, after checking that
+// a cut stream and a newer version are both refused
+void avl_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    AVLTree_t *tree = avl_new(interface);
+    AVLTree_t *loaded = avl_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !tree || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        void *element = new_int64_t(random_int64_t(-5000, 5000));
+
+        if (!avl_insert(tree, element))
+            free(element);
+    }
+
+    ut_equals_bool(ut, true, avl_serialize(tree, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, avl_test_load, avl_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, avl_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, avl_size(tree), avl_size(loaded), __func__);
+    ut_equals_int(ut, 0, compare_int64_t(avl_min(tree), avl_min(loaded)),
+                  __func__);
+    ut_equals_int(ut, 0, compare_int64_t(avl_max(tree), avl_max(loaded)),
+                  __func__);
+
+    // Every key is found and removed from the loaded tree
+    bool removed = true;
+
+    while (!avl_empty(tree))
+    {
+        void *key = copy_int64_t(avl_peek(tree));
+
+        removed = removed && avl_remove(tree, key) && avl_remove(loaded, key);
+
+        free(key);
+    }
+
+    ut_equals_bool(ut, true, removed, __func__);
+    ut_equals_bool(ut, true, avl_empty(loaded), __func__);
+
+    ser_free(serial);
+    avl_free(tree);
+    avl_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (tree)
+        avl_free(tree);
+    if (loaded)
+        avl_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all AVLTree tests
 Status AVLTreeTests(void)
 {
@@ -271,6 +464,8 @@ Status AVLTreeTests(void)
     avl_test_IO1(ut);
     avl_test_IO2(ut);
     avl_test_IO3(ut);
+    avl_test_sync(ut);
+    avl_test_serialize(ut);
 
     ut_report(ut, "AVLTree");
 
@@ -160,6 +160,359 @@ void arr_test_IO2(UnitTest ut)
     ut_error();
 }
 
+static bool arr_test_odd(const void *element, void *context)
+{
+    (void)context;
+    return *(const int64_t *)element % 2 != 0;
+}
+
+static void *arr_test_negate(const void *element, void *context)
+{
+    (void)context;
+    return new_int64_t(-*(const int64_t *)element);
+}
+
+static void arr_test_sum(void *accumulator, const void *element, void *context)
+{
+    (void)context;
+    *(int64_t *)accumulator += *(const int64_t *)element;
+}
+
+static void arr_test_combine(void *accumulator, const void *partial,
+                             void *context)
+{
+    (void)context;
+    *(int64_t *)accumulator += *(const int64_t *)partial;
+}
+
+// Tests map, filter and reduce, skipping empty positions
+void arr_test_functional(UnitTest ut)
+{
+    const integer_t length = 30000;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Array_t *array = arr_new(interface, length);
+
+    if (!array || !interface)
+        goto error;
+
+    // Every third position is left empty
+    int64_t expected = 0, odds = 0;
+    for (integer_t i = 0; i < length; i++)
+    {
+        if (i % 3 == 0)
+            continue;
+
+        void *elem = new_int64_t(i);
+        if (arr_set(array, elem, i) < 0)
+        {
+            free(elem);
+            goto error;
+        }
+
+        expected += i;
+        odds += i % 2 != 0 ? 1 : 0;
+    }
+
+    for (integer_t threads = 0; threads <= 4; threads += 4)
+    {
+        ThreadPool_t *pool = tpl_new(threads);
+
+        if (!pool)
+            goto error;
+
+        Array_t *negated = arr_parallel_map(array, pool, NULL, arr_test_negate,
+                                            NULL);
+        Array_t *filtered = arr_filter(array, arr_test_odd, NULL);
+        Array_t *parallel_filtered = arr_parallel_filter(array, pool,
+                                                         arr_test_odd, NULL);
+
+        if (!negated || !filtered || !parallel_filtered)
+        {
+            tpl_free(pool);
+            goto error;
+        }
+
+        int64_t sum = 0, parallel_sum = 0;
+
+        arr_reduce(negated, &sum, arr_test_sum, NULL);
+        arr_parallel_reduce(array, pool, &parallel_sum, sizeof(int64_t),
+                            arr_test_sum, arr_test_combine, NULL);
+
+        ut_equals_bool(ut, true, sum == -expected, __func__);
+        ut_equals_bool(ut, true, parallel_sum == expected, __func__);
+        ut_equals_integer_t(ut, arr_count(array), arr_count(negated), __func__);
+        ut_equals_integer_t(ut, odds, arr_length(filtered), __func__);
+        ut_equals_integer_t(ut, odds, arr_count(parallel_filtered), __func__);
+
+        void *R0, *R1;
+        bool same_order = true;
+        for (integer_t i = 0; i < odds; i++)
+        {
+            arr_get(filtered, &R0, i);
+            arr_get(parallel_filtered, &R1, i);
+
+            if (compare_int64_t(R0, R1) != 0)
+                same_order = false;
+        }
+
+        ut_equals_bool(ut, true, same_order, __func__);
+
+        arr_free(negated);
+        arr_free(filtered);
+        arr_free(parallel_filtered);
+
+        tpl_free(pool);
+    }
+
+    arr_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (array)
+        arr_free(array);
+    interface_free(interface);
+    ut_error();
+}
+
+static bool arr_test_none(const void *element, void *context)
+{
+    (void)element;
+    (void)context;
+    return false;
+}
+
+// A filter that matches nothing gives back an array of length 0
+void arr_test_filter_empty(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Array_t *array = arr_new(interface, 100);
+    Array_t *filtered = NULL, *parallel_filtered = NULL;
+    ThreadPool_t *pool = tpl_new(4);
+
+    if (!array || !interface || !pool)
+        goto error;
+
+    for (integer_t i = 0; i < 100; i += 2)
+    {
+        void *elem = new_int64_t(i);
+        if (arr_set(array, elem, i) < 0)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    filtered = arr_filter(array, arr_test_none, NULL);
+    parallel_filtered = arr_parallel_filter(array, pool, arr_test_none, NULL);
+
+    if (!filtered || !parallel_filtered)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, arr_length(filtered), __func__);
+    ut_equals_integer_t(ut, 0, arr_count(filtered), __func__);
+    ut_equals_bool(ut, true, arr_empty(filtered), __func__);
+    ut_equals_integer_t(ut, 0, arr_length(parallel_filtered), __func__);
+    ut_equals_bool(ut, true, arr_empty(parallel_filtered), __func__);
+
+    // Filtering an array of length 0 works the same way
+    Array_t *again = arr_filter(filtered, arr_test_odd, NULL);
+
+    if (!again)
+        goto error;
+
+    ut_equals_integer_t(ut, 0, arr_length(again), __func__);
+
+    arr_free(again);
+    arr_free(filtered);
+    arr_free(parallel_filtered);
+    arr_free(array);
+    tpl_free(pool);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (filtered)
+        arr_free(filtered);
+    if (parallel_filtered)
+        arr_free(parallel_filtered);
+    if (array)
+        arr_free(array);
+    if (pool)
+        tpl_free(pool);
+    interface_free(interface);
+    ut_error();
+}
+
+// Iterators only start over arrays with at least one element
+void arr_test_iter(UnitTest ut)
+{
+    ARR_ITER_DECL(iter)
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Array_t *none = arr_new(interface, 0);
+    Array_t *array = arr_new(interface, 10);
+    Array_t *filtered = NULL;
+
+    if (!interface || !none || !array)
+        goto error;
+
+    ut_equals_bool(ut, false, arr_iter_init(iter, none), __func__);
+    ut_equals_bool(ut, false, arr_iter_init(iter, array), __func__);
+
+    for (integer_t i = 0; i < 10; i += 3)
+    {
+        void *elem = new_int64_t(i);
+        if (arr_set(array, elem, i) < 0)
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    filtered = arr_filter(array, arr_test_none, NULL);
+
+    if (!filtered)
+        goto error;
+
+    ut_equals_bool(ut, false, arr_iter_init(iter, filtered), __func__);
+    ut_equals_bool(ut, true, arr_iter_init(iter, array), __func__);
+
+    // Empty slots are visited too
+    integer_t visited = 0;
+    int64_t sum = 0;
+
+    do
+    {
+        int64_t *element = arr_iter_peek(iter);
+
+        if (element)
+            sum += *element;
+
+        visited++;
+    } while (arr_iter_next(iter));
+
+    ut_equals_integer_t(ut, 10, visited, __func__);
+    ut_equals_bool(ut, true, sum == 18, __func__);
+
+    arr_free(filtered);
+    arr_free(array);
+    arr_free(none);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (filtered)
+        arr_free(filtered);
+    if (array)
+        arr_free(array);
+    if (none)
+        arr_free(none);
+    interface_free(interface);
+    ut_error();
+}
+
+static bool arr_test_load(void *target, Serial_t *serial)
+{
+    return arr_deserialize(target, serial);
+}
+
+static bool arr_test_empty(void *target)
+{
+    return arr_empty(target);
+}
+
+// Saves an array with empty slots and loads it into a longer one, after
+// checking that a cut stream and a newer version are both refused
+void arr_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    Array_t *array = arr_new(interface, 500);
+    Array_t *loaded = arr_new(interface, 600);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !array || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    // Every fifth slot is left empty
+    for (integer_t i = 0; i < 500; i++)
+    {
+        if (i % 5 != 0 && arr_set(array, new_int64_t(i * 7), i) < 0)
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, arr_serialize(array, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, arr_test_load, arr_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, arr_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, arr_count(array), arr_count(loaded), __func__);
+
+    bool same = true;
+    void *R0, *R1;
+
+    for (integer_t i = 0; i < 600; i++)
+    {
+        arr_get(loaded, &R1, i);
+
+        if (i < 500 && arr_get(array, &R0, i) == 0)
+            same = same && R1 != NULL && compare_int64_t(R0, R1) == 0;
+        else
+            same = same && R1 == NULL;
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Slots are kept, so a shorter array can't hold them
+    Array_t *shorter = arr_new(interface, 499);
+
+    if (!shorter)
+        goto error;
+
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, arr_deserialize(shorter, serial), __func__);
+
+    arr_free(shorter);
+
+    ser_free(serial);
+    arr_free(array);
+    arr_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (array)
+        arr_free(array);
+    if (loaded)
+        arr_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all Array tests
 Status ArrayTests(void)
 {
@@ -172,6 +525,10 @@ Status ArrayTests(void)
 
     arr_test_IO1(ut);
     arr_test_IO2(ut);
+    arr_test_functional(ut);
+    arr_test_filter_empty(ut);
+    arr_test_iter(ut);
+    arr_test_serialize(ut);
 
     ut_report(ut, "Array");
 
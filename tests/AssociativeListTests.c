@@ -75,6 +75,377 @@ void ali_test_IO(UnitTest ut)
     ut_error();
 }
 
+// Runs the same operations on a plain and on an indexed list with duplicate
+// keys, checking that both always find the same value for every key
+void ali_test_indexed(UnitTest ut)
+{
+    Interface_t *key_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+    Interface_t *value_interface = interface_new(compare_int64_t,
+            copy_int64_t, display_int64_t, free, NULL, NULL);
+
+    AssociativeList_t *plain = ali_new(key_interface, value_interface, true);
+    AssociativeList_t *indexed = ali_new(key_interface, value_interface, true);
+
+    if (!plain || !indexed || !key_interface || !value_interface)
+        goto error;
+
+    ut_equals_bool(ut, false, ali_indexed(indexed), __func__);
+    ut_equals_bool(ut, true, ali_set_indexed(indexed, true), __func__);
+    ut_equals_bool(ut, true, ali_indexed(indexed), __func__);
+
+    bool same = true;
+    int64_t key;
+
+    for (int64_t i = 0; i < 3000; i++)
+    {
+        key = random_int64_t(0, 499);
+
+        if (!ali_insert(plain, new_int64_t(key), new_int64_t(i)))
+            goto error;
+        if (!ali_insert(indexed, new_int64_t(key), new_int64_t(i)))
+            goto error;
+
+        // Remove every once in a while so keys get shuffled around
+        if (i % 3 == 0)
+        {
+            void *R0, *R1;
+
+            key = random_int64_t(0, 499);
+
+            bool removed = ali_remove(plain, &key, &R0);
+
+            same = same && removed == ali_remove(indexed, &key, &R1);
+
+            if (removed)
+            {
+                same = same && *(int64_t *)R0 == *(int64_t *)R1;
+
+                free(R0);
+                free(R1);
+            }
+        }
+    }
+
+    ut_equals_integer_t(ut, ali_length(plain), ali_length(indexed), __func__);
+
+    for (key = 0; key < 600; key++)
+    {
+        int64_t *V0 = ali_get(plain, &key);
+        int64_t *V1 = ali_get(indexed, &key);
+
+        same = same && (V0 == NULL) == (V1 == NULL);
+        same = same && (V0 == NULL || *V0 == *V1);
+        same = same && ali_contains_key(indexed, &key) == (V0 != NULL);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Without the index the list must keep working the same way
+    ut_equals_bool(ut, true, ali_set_indexed(indexed, false), __func__);
+
+    key = 7;
+
+    while (ali_pop(plain, &key))
+        ut_equals_bool(ut, true, ali_pop(indexed, &key), __func__);
+
+    ut_equals_bool(ut, false, ali_contains_key(indexed, &key), __func__);
+    ut_equals_bool(ut, true, ali_set_indexed(indexed, true), __func__);
+    ut_equals_integer_t(ut, ali_length(plain), ali_length(indexed), __func__);
+
+    // An interface without a hash function can't be indexed
+    ali_config(indexed, value_interface, NULL);
+
+    ut_equals_bool(ut, false, ali_indexed(indexed), __func__);
+    ut_equals_bool(ut, false, ali_set_indexed(indexed, true), __func__);
+
+    ali_free(plain);
+    ali_free(indexed);
+    interface_free(key_interface);
+    interface_free(value_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (plain)
+        ali_free(plain);
+    if (indexed)
+        ali_free(indexed);
+    interface_free(key_interface);
+    interface_free(value_interface);
+    ut_error();
+}
+
+// Many equal keys keep their order in the index while they come and go
+void ali_test_indexed_duplicates(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    AssociativeList_t *list = ali_new(interface, interface, true);
+
+    if (!interface || !list)
+        goto error;
+
+    ali_set_indexed(list, true);
+
+    int64_t key = 1, other = 2;
+
+    for (int64_t i = 0; i < 20000; i++)
+    {
+        if (!ali_insert(list, new_int64_t(i % 8 ? key : other),
+                        new_int64_t(i)))
+            goto error;
+    }
+
+    bool ordered = true;
+    int64_t expected = 1;
+
+    // Values of the same key come out in the order they were inserted
+    for (int64_t i = 0; i < 17500; i++)
+    {
+        void *R;
+
+        if (!ali_remove(list, &key, &R))
+            goto error;
+
+        ordered = ordered && *(int64_t *)R == expected;
+        expected += expected % 8 == 7 ? 2 : 1;
+
+        free(R);
+
+        if (i % 1000 == 0 &&
+            !ali_insert(list, new_int64_t(key), new_int64_t(-1)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    // Only the values inserted while removing are left
+    while (ali_contains_key(list, &key))
+    {
+        ordered = ordered && *(int64_t *)ali_get(list, &key) == -1;
+
+        ali_pop(list, &key);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_integer_t(ut, 2500, ali_length(list), __func__);
+
+    // The bucket is empty again so it is started over
+    if (!ali_insert(list, new_int64_t(key), new_int64_t(42)))
+        goto error;
+
+    ut_equals_bool(ut, true, *(int64_t *)ali_get(list, &key) == 42, __func__);
+    ut_equals_bool(ut, true, *(int64_t *)ali_get(list, &other) == 0, __func__);
+
+    ali_free(list);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list)
+        ali_free(list);
+    interface_free(interface);
+    ut_error();
+}
+
+static bool ali_test_load(void *target, Serial_t *serial)
+{
+    return ali_deserialize(target, serial);
+}
+
+static bool ali_test_empty(void *target)
+{
+    return ali_empty(target);
+}
+
+// Saves pairs with repeated keys and loads them back in the same order into
+// an indexed list, after checking that a cut stream, a newer version and a
+// list without duplicate keys are all refused
+void ali_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    AssociativeList_t *list = ali_new(interface, interface, true);
+    AssociativeList_t *loaded = ali_new(interface, interface, true);
+    AssociativeList_t *unique = ali_new(interface, interface, false);
+    Serial_t *serial = ser_new_buffer();
+    void **K0 = NULL, **V0 = NULL, **K1 = NULL, **V1 = NULL;
+
+    if (!interface || !list || !loaded || !unique || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+    ali_set_indexed(loaded, true);
+
+    for (int64_t i = 0; i < 300; i++)
+    {
+        if (!ali_insert(list, new_int64_t(i % 50), new_int64_t(i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, ali_serialize(list, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, ali_test_load, ali_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, false, ali_deserialize(unique, serial), __func__);
+    ut_equals_bool(ut, true, ali_empty(unique), __func__);
+
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, true, ali_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, ali_length(list), ali_length(loaded), __func__);
+
+    if (!ali_to_arrays(list, &K0, &V0) || !ali_to_arrays(loaded, &K1, &V1))
+        goto error;
+
+    bool same = true;
+
+    for (integer_t i = 0; i < ali_length(list); i++)
+    {
+        same = same && compare_int64_t(K0[i], K1[i]) == 0 &&
+               compare_int64_t(V0[i], V1[i]) == 0;
+
+        free(K0[i]);
+        free(V0[i]);
+        free(K1[i]);
+        free(V1[i]);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // The index finds the first value saved for each key
+    int64_t key = 42;
+
+    ut_equals_bool(ut, true, *(int64_t *)ali_get(loaded, &key) == 42,
+                   __func__);
+
+    free(K0);
+    free(V0);
+    free(K1);
+    free(V1);
+    ser_free(serial);
+    ali_free(list);
+    ali_free(loaded);
+    ali_free(unique);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    free(K0);
+    free(V0);
+    free(K1);
+    free(V1);
+    if (serial)
+        ser_free(serial);
+    if (list)
+        ali_free(list);
+    if (loaded)
+        ali_free(loaded);
+    if (unique)
+        ali_free(unique);
+    interface_free(interface);
+    ut_error();
+}
+
+// Tests iterating over the key-value pairs in both directions
+void ali_test_iterator(UnitTest ut)
+{
+    char iter_storage[ali_iter_size];
+    AssociativeListIterator_t *iter =
+        (AssociativeListIterator_t*)&iter_storage[0];
+
+    Interface_t *key_interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+    Interface_t *value_interface = interface_new(compare_int64_t,
+            copy_int64_t, display_int64_t, free, NULL, NULL);
+
+    AssociativeList_t *list = ali_new(key_interface, value_interface, false);
+
+    if (!list || !key_interface || !value_interface)
+        goto error;
+
+    ut_equals_bool(ut, ali_iter_init(iter, list), false, __func__);
+
+    int64_t key_sum = 0, value_sum = 0;
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        if (!ali_insert(list, new_int64_t(i), new_int64_t(i * 2)))
+            goto error;
+
+        key_sum += i;
+        value_sum += i * 2;
+    }
+
+    if (!ali_iter_init(iter, list))
+        goto error;
+
+    void *K, *V;
+    bool paired = true;
+
+    do
+    {
+        if (!ali_iter_get(iter, &K, &V))
+            goto error;
+
+        paired = paired && *(int64_t*)K * 2 == *(int64_t*)V;
+
+        key_sum -= *(int64_t*)K;
+    } while (ali_iter_next(iter));
+
+    if (!ali_iter_to_tail(iter))
+        goto error;
+
+    do
+    {
+        value_sum -= *(int64_t*)ali_iter_peek_value(iter);
+    } while (ali_iter_prev(iter));
+
+    ut_equals_bool(ut, paired, true, __func__);
+    ut_equals_integer_t(ut, key_sum, 0, __func__);
+    ut_equals_integer_t(ut, value_sum, 0, __func__);
+
+    // Values can be changed without invalidating the iterator
+    K = ali_iter_peek_key(iter);
+
+    if (!ali_iter_set_value(iter, new_int64_t(-1)))
+        goto error;
+
+    ut_equals_integer_t(ut, *(int64_t*)ali_get(list, K), -1, __func__);
+    ut_equals_bool(ut, ali_iter_has_prev(iter), false, __func__);
+    ut_equals_bool(ut, ali_iter_next(iter), true, __func__);
+
+    if (!ali_pop(list, K))
+        goto error;
+
+    ut_equals_bool(ut, ali_iter_prev(iter), false, __func__);
+    ut_equals_bool(ut, ali_iter_get(iter, &K, NULL), false, __func__);
+
+    ali_free(list);
+    interface_free(key_interface);
+    interface_free(value_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (list)
+        ali_free(list);
+    interface_free(key_interface);
+    interface_free(value_interface);
+    ut_error();
+}
+
 // Runs all AssociativeList tests
 Status AssociativeListTests(void)
 {
@@ -86,6 +457,10 @@ Status AssociativeListTests(void)
         goto error;
 
     ali_test_IO(ut);
+    ali_test_indexed(ut);
+    ali_test_indexed_duplicates(ut);
+    ali_test_iterator(ut);
+    ali_test_serialize(ut);
 
     ut_report(ut, "AssociativeList");
 
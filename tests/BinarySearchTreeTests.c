@@ -257,6 +257,86 @@ void bst_test_IO3(UnitTest ut)
     ut_error();
 }
 
+static bool bst_test_load(void *target, Serial_t *serial)
+{
+    return bst_deserialize(target, serial);
+}
+
+static bool bst_test_empty(void *target)
+{
+    return bst_empty(target);
+}
+
+// Saves a tree that degenerated into a list and loads it back balanced,
+// after checking that a cut stream and a newer version are both refused
+void bst_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    BinarySearchTree_t *tree = bst_new(interface);
+    BinarySearchTree_t *loaded = bst_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !tree || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    // Ascending keys leave every node with only a right child
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        if (!bst_insert(tree, new_int64_t(i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, bst_serialize(tree, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, bst_test_load, bst_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, bst_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, bst_count(tree), bst_count(loaded), __func__);
+    ut_equals_int(ut, 0, compare_int64_t(bst_min(tree), bst_min(loaded)),
+                  __func__);
+    ut_equals_int(ut, 0, compare_int64_t(bst_max(tree), bst_max(loaded)),
+                  __func__);
+
+    // Every key is found and removed from the loaded tree
+    bool removed = true;
+
+    while (!bst_empty(tree))
+    {
+        void *key = copy_int64_t(bst_peek(tree));
+
+        removed = removed && bst_remove(tree, key) && bst_remove(loaded, key);
+
+        free(key);
+    }
+
+    ut_equals_bool(ut, true, removed, __func__);
+    ut_equals_bool(ut, true, bst_empty(loaded), __func__);
+
+    ser_free(serial);
+    bst_free(tree);
+    bst_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (tree)
+        bst_free(tree);
+    if (loaded)
+        bst_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all BinarySearchTree tests
 Status BinarySearchTreeTests(void)
 {
@@ -271,6 +351,7 @@ Status BinarySearchTreeTests(void)
     bst_test_IO1(ut);
     bst_test_IO2(ut);
     bst_test_IO3(ut);
+    bst_test_serialize(ut);
 
     ut_report(ut, "BinarySearchTree");
 
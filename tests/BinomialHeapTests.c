@@ -0,0 +1,288 @@
+/**
+ * @file BinomialHeapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "BinomialHeap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Removing every element yields them in heap order for both kinds
+void bnh_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    BinomialHeap_t *max_heap = bnh_new(interface, MaxHeap);
+    BinomialHeap_t *min_heap = bnh_new(interface, MinHeap);
+
+    if (!interface || !max_heap || !min_heap)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int32_t value = random_int32_t(-500, 500);
+
+        if (!bnh_insert(max_heap, new_int32_t(value), NULL))
+            goto error;
+
+        if (!bnh_insert(min_heap, new_int32_t(value), NULL))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1000, bnh_count(max_heap), __func__);
+
+    void *R;
+    int32_t last = INT32_MAX;
+    bool ordered = true;
+
+    while (!bnh_empty(max_heap))
+    {
+        if (!bnh_remove(max_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R <= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    last = INT32_MIN;
+    ordered = true;
+
+    while (!bnh_empty(min_heap))
+    {
+        if (!bnh_remove(min_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R >= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, false, bnh_remove(min_heap, &R), __func__);
+    ut_equals_bool(ut, true, bnh_peek(min_heap) == NULL, __func__);
+
+    bnh_free(max_heap);
+    bnh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (max_heap)
+        bnh_free(max_heap);
+    if (min_heap)
+        bnh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Changes elements through their handles
+void bnh_test_handles(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    BinomialHeap_t *heap = bnh_new(interface, MinHeap);
+
+    if (!interface || !heap)
+        goto error;
+
+    BinomialHeapNode_t *handles[100];
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        if (!bnh_insert(heap, new_int32_t(1000 + i), &handles[i]))
+            goto error;
+    }
+
+    // Removing the root consolidates the tree so handles are not all roots
+    void *R;
+
+    if (!bnh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    // Decrease every odd element below all the others
+    for (int32_t i = 1; i < 100; i += 2)
+    {
+        *(int32_t *)bnh_element(handles[i]) = -i;
+
+        ut_equals_bool(ut, true, bnh_decrease_key(heap, handles[i]),
+                       __func__);
+        ut_equals_int(ut, -i, *(int32_t *)bnh_peek(heap), __func__);
+    }
+
+    // An element that loses priority is removed and inserted again
+    ut_equals_bool(ut, true, bnh_delete(heap, handles[99], &R), __func__);
+    ut_equals_int(ut, -99, *(int32_t *)R, __func__);
+
+    *(int32_t *)R = 5000;
+
+    if (!bnh_insert(heap, R, &handles[99]))
+        goto error;
+
+    ut_equals_int(ut, -97, *(int32_t *)bnh_peek(heap), __func__);
+
+    // Remove elements from the middle of the heap
+    for (int32_t i = 2; i < 100; i += 2)
+    {
+        ut_equals_bool(ut, true, bnh_delete(heap, handles[i], &R), __func__);
+        ut_equals_int(ut, 1000 + i, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    ut_equals_integer_t(ut, 50, bnh_count(heap), __func__);
+
+    int32_t expected = -97;
+
+    for (int i = 0; i < 49; i++, expected += 2)
+    {
+        if (!bnh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    if (!bnh_remove(heap, &R))
+        goto error;
+
+    ut_equals_int(ut, 5000, *(int32_t *)R, __func__);
+    ut_equals_bool(ut, true, bnh_empty(heap), __func__);
+
+    free(R);
+
+    bnh_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        bnh_free(heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Melding moves every element and keeps the handles valid
+void bnh_test_meld(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    BinomialHeap_t *heap = bnh_new(interface, MaxHeap);
+    BinomialHeap_t *other = bnh_new(interface, MaxHeap);
+    BinomialHeap_t *min_heap = bnh_new(interface, MinHeap);
+
+    if (!interface || !heap || !other || !min_heap)
+        goto error;
+
+    BinomialHeapNode_t *handle = NULL;
+
+    for (int32_t i = 0; i < 50; i++)
+    {
+        if (!bnh_insert(heap, new_int32_t(i * 2), NULL))
+            goto error;
+
+        if (!bnh_insert(other, new_int32_t(i * 2 + 1), i == 0 ? &handle : NULL))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, bnh_meld(heap, min_heap), __func__);
+    ut_equals_bool(ut, false, bnh_meld(heap, heap), __func__);
+    ut_equals_bool(ut, true, bnh_meld(heap, other), __func__);
+    ut_equals_integer_t(ut, 100, bnh_count(heap), __func__);
+    ut_equals_bool(ut, true, bnh_empty(other), __func__);
+
+    // The handle from the other heap now belongs to this one
+    *(int32_t *)bnh_element(handle) = 1000;
+
+    ut_equals_bool(ut, true, bnh_decrease_key(heap, handle), __func__);
+    ut_equals_int(ut, 1000, *(int32_t *)bnh_peek(heap), __func__);
+
+    void *R;
+    int32_t expected = 99;
+
+    if (!bnh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    for (int i = 0; i < 98; i++, expected--)
+    {
+        if (!bnh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    // Melding into an empty heap
+    ut_equals_bool(ut, true, bnh_meld(other, heap), __func__);
+    ut_equals_integer_t(ut, 1, bnh_count(other), __func__);
+    ut_equals_int(ut, 0, *(int32_t *)bnh_peek(other), __func__);
+
+    bnh_erase(other);
+
+    ut_equals_bool(ut, true, bnh_empty(other), __func__);
+
+    bnh_free(heap);
+    bnh_free(other);
+    bnh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        bnh_free(heap);
+    if (other)
+        bnh_free(other);
+    if (min_heap)
+        bnh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all BinomialHeap tests
+Status BinomialHeapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    bnh_test_IO(ut);
+    bnh_test_handles(ut);
+    bnh_test_meld(ut);
+
+    ut_report(ut, "BinomialHeap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "BinomialHeap");
+    ut_delete(&ut);
+    return st;
+}
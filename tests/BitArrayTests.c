@@ -41,6 +41,56 @@ void bit_test_resize(UnitTest ut)
     ut_error();
 }
 
+// Shrinking must keep the reallocated buffer, otherwise the array is left
+// with a stale pointer that bit_free() frees a second time
+void bit_test_shrink(UnitTest ut)
+{
+    BitArray_t *bits = bit_create(65536);
+
+    if (!bits)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+    {
+        if (!bit_resize(bits, 1000))
+            goto error;
+
+        if (!bit_fill(bits))
+            goto error;
+
+        if (!bit_resize(bits, 100000))
+            goto error;
+    }
+
+    if (!bit_resize(bits, 70))
+        goto error;
+
+    if (!bit_fill(bits))
+        goto error;
+
+    ut_equals_unsigned_t(ut, 70, bit_nbits(bits), __func__);
+    ut_equals_unsigned_t(ut, 2, bit_nwords(bits), __func__);
+
+    BitArray_t *copy = bit_copy(bits);
+
+    if (!copy)
+        goto error;
+
+    ut_equals_unsigned_t(ut, bit_cardinality(bits), bit_cardinality(copy),
+                         __func__);
+
+    bit_free(copy);
+    bit_free(bits);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (bits)
+        bit_free(bits);
+    ut_error();
+}
+
 void bit_test_grow(UnitTest ut)
 {
     BitArray_t *bits = bit_create(140);
@@ -1024,6 +1074,70 @@ void bit_test_intersects(UnitTest ut)
     ut_error();
 }
 
+static bool bit_test_load(void *target, Serial_t *serial)
+{
+    return bit_deserialize(target, serial);
+}
+
+// bit_test_serialize() loads over 10 bits where only bit 3 is set
+static bool bit_test_untouched(void *bits)
+{
+    return bit_nbits(bits) == 10 && bit_cardinality(bits) == 1 &&
+           bit_get(bits, 3);
+}
+
+// Saves a bit array that doesn't end on a word boundary and loads it over
+// another one, which is left untouched by a cut stream or a newer version
+void bit_test_serialize(UnitTest ut)
+{
+    BitArray_t *bits = bit_create(10000);
+    BitArray_t *loaded = bit_create(10);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!bits || !loaded || !serial)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+        bit_set(bits, (unsigned_t)random_int64_t(0, 9999));
+
+    bit_set(bits, 9999);
+    bit_set(loaded, 3);
+
+    ut_equals_bool(ut, true, bit_serialize(bits, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, bit_test_load,
+                           bit_test_untouched, __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, bit_deserialize(loaded, serial), __func__);
+    ut_equals_unsigned_t(ut, 10000, bit_nbits(loaded), __func__);
+    ut_equals_unsigned_t(ut, bit_cardinality(bits), bit_cardinality(loaded),
+                         __func__);
+
+    bool same = true;
+
+    for (unsigned_t i = 0; i < 10000; i++)
+        same = same && bit_get(bits, i) == bit_get(loaded, i);
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    ser_free(serial);
+    bit_free(bits);
+    bit_free(loaded);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (bits)
+        bit_free(bits);
+    if (loaded)
+        bit_free(loaded);
+    ut_error();
+}
+
 // Runs all BitArray tests
 Status BitArrayTests(void)
 {
@@ -1035,6 +1149,7 @@ Status BitArrayTests(void)
         goto error;
 
     bit_test_resize(ut);
+    bit_test_shrink(ut);
     bit_test_grow(ut);
     bit_test_clear_unused_bits(ut);
     bit_test_NOT(ut);
@@ -1056,6 +1171,7 @@ Status BitArrayTests(void)
     bit_test_flip_range(ut);
     bit_test_put_range(ut);
     bit_test_intersects(ut);
+    bit_test_serialize(ut);
 
     ut_report(ut, "BitArray");
     ut_delete(&ut);
@@ -10,6 +10,22 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The legacy lists take callbacks with non-const parameters
+static int cll_test_compare(void *element1, void *element2)
+{
+    return compare_int64_t(element1, element2);
+}
+
+static void *cll_test_copy(void *element)
+{
+    return copy_int64_t(element);
+}
+
+static void cll_test_display(void *element)
+{
+    display_int64_t(element);
+}
+
 // Tests limit functionality
 Status cll_test_limit(UnitTest ut)
 {
@@ -61,6 +77,193 @@ Status cll_test_limit(UnitTest ut)
     return st;
 }
 
+// Tests moving ranges of nodes between lists
+Status cll_test_splice(UnitTest ut)
+{
+    CircularLinkedList src = NULL, dst = NULL;
+
+    Status st = cll_create(&src, cll_test_compare, cll_test_copy,
+                           cll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    st = cll_create(&dst, cll_test_compare, cll_test_copy, cll_test_display,
+                    free);
+
+    if (st != DS_OK)
+        goto error;
+
+    // Inserting before the cursor appends to the end of the circle
+    for (int i = 0; i < 10; i++)
+    {
+        st = cll_insert_before(src, new_int64_t(i));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    for (int i = 100; i < 105; i++)
+    {
+        st = cll_insert_before(dst, new_int64_t(i));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    ut_equals_int(ut, cll_splice(dst, 0, dst, 0, 1), DS_ERR_INVALID_ARGUMENT,
+                  __func__);
+    ut_equals_int(ut, cll_splice(dst, 0, src, 3, 10), DS_ERR_OUT_OF_RANGE,
+                  __func__);
+    ut_equals_int(ut, cll_splice(dst, 6, src, 3, 6), DS_ERR_OUT_OF_RANGE,
+                  __func__);
+
+    // Middle to middle, then a range holding the cursor of src which moves
+    // past it, and finally everything left in src to the cursor of dst
+    ut_equals_int(ut, cll_splice(dst, 2, src, 3, 6), DS_OK, __func__);
+    ut_equals_int(ut, cll_splice(dst, 9, src, 0, 1), DS_OK, __func__);
+    ut_equals_int(ut, *(int64_t*)cll_peek(src), 2, __func__);
+    ut_equals_int(ut, cll_splice(dst, 0, src, 0, 3), DS_OK, __func__);
+
+    ut_equals_integer_t(ut, cll_length(src), 0, __func__);
+    ut_equals_integer_t(ut, cll_length(dst), 15, __func__);
+    ut_equals_bool(ut, cll_peek(src) == NULL, true, __func__);
+
+    int64_t expected[] = { 2, 7, 8, 9, 100, 101, 3, 4, 5, 6, 102, 103, 104,
+                           0, 1 };
+
+    bool same = true;
+    void *R;
+
+    // Removing the current element moves the cursor forward
+    for (int i = 0; i < 15; i++)
+    {
+        st = cll_remove_current(dst, &R);
+
+        if (st != DS_OK)
+            goto error;
+
+        same = same && *(int64_t*)R == expected[i];
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    cll_free(&src);
+    cll_free(&dst);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    cll_free(&src);
+    cll_free(&dst);
+    return st;
+}
+
+static bool cll_test_load(void *list, Serial_t *serial)
+{
+    return cll_deserialize(list, deserialize_int64_t, serial) == DS_OK;
+}
+
+static bool cll_test_empty(void *target)
+{
+    return cll_empty(target);
+}
+
+// Saves a list through an explicit codec and loads it back with the cursor
+// at the same element, after checking that a cut stream, a newer version and
+// a list that is too short are all refused
+Status cll_test_serialize(UnitTest ut)
+{
+    CircularLinkedList list = NULL, loaded = NULL, limited = NULL;
+    Serial_t *serial = ser_new_buffer();
+
+    Status st = DS_OK;
+
+    st += cll_create(&list, cll_test_compare, cll_test_copy, cll_test_display,
+                     free);
+    st += cll_create(&loaded, cll_test_compare, cll_test_copy,
+                     cll_test_display, free);
+    st += cll_create(&limited, cll_test_compare, cll_test_copy,
+                     cll_test_display, free);
+
+    if (st != DS_OK || !serial)
+        goto error;
+
+    for (int64_t i = 0; i < 300; i++)
+        st += cll_insert_before(list, new_int64_t(i));
+
+    // The cursor is saved wherever it is
+    st += cll_iter_next(list, 137);
+
+    if (st != DS_OK)
+        goto error;
+
+    st = cll_serialize(list, serialize_int64_t, serial);
+
+    if (st != DS_OK)
+        goto error;
+
+    if (!ut_serial_rejects(ut, serial, loaded, cll_test_load, cll_test_empty,
+                           __func__))
+    {
+        st = DS_ERR_ALLOC;
+        goto error;
+    }
+
+    // The elements have to fit in the limit of the loaded list
+    st = cll_set_limit(limited, cll_length(list) - 1);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, DS_ERR_FULL,
+                  cll_deserialize(limited, deserialize_int64_t, serial),
+                  __func__);
+    ut_equals_bool(ut, true, cll_empty(limited), __func__);
+
+    ser_rewind(serial);
+
+    ut_equals_int(ut, DS_OK,
+                  cll_deserialize(loaded, deserialize_int64_t, serial),
+                  __func__);
+    ut_equals_integer_t(ut, cll_length(list), cll_length(loaded), __func__);
+
+    // Going around both circles from their cursors gives the same elements
+    bool same = true;
+
+    for (integer_t i = 0; i < cll_length(list) + 1; i++)
+    {
+        same = same && compare_int64_t(cll_peek(list), cll_peek(loaded)) == 0;
+
+        st += cll_iter_next(list, 1);
+        st += cll_iter_next(loaded, 1);
+    }
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_bool(ut, true, *(int64_t *)cll_peek(loaded) == 138, __func__);
+
+    ser_free(serial);
+    cll_free(&list);
+    cll_free(&loaded);
+    cll_free(&limited);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    cll_free(&list);
+    cll_free(&loaded);
+    cll_free(&limited);
+    return st;
+}
+
 // Runs all CircularLinkedList tests
 Status CircularLinkedListTests(void)
 {
@@ -72,6 +275,8 @@ Status CircularLinkedListTests(void)
         goto error;
 
     st += cll_test_limit(ut);
+    st += cll_test_splice(ut);
+    st += cll_test_serialize(ut);
 
     if (st != DS_OK)
         goto error;
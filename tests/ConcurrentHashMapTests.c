@@ -0,0 +1,278 @@
+/**
+ * @file ConcurrentHashMapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ConcurrentHashMap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+void chm_test_IO(UnitTest ut)
+{
+    Interface_t *string_interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+    Interface_t *double_interface = interface_new(compare_double, copy_double,
+            display_double, free, hash_double, NULL);
+
+    ConcurrentHashMap_t *map = chm_new(string_interface, double_interface, 4);
+
+    if (!map || !string_interface || !double_interface)
+        goto error;
+
+    if (!chm_put(map, new_string("Apple"), new_double(0.49)))
+        goto error;
+    if (!chm_put(map, new_string("Grape Juice"), new_double(1.29)))
+        goto error;
+    if (!chm_put(map, new_string("Maple Syrup"), new_double(2.99)))
+        goto error;
+
+    ut_equals_integer_t(ut, 4, chm_shards(map), __func__);
+    ut_equals_integer_t(ut, 3, chm_size(map), __func__);
+
+    void *R = NULL;
+
+    ut_equals_bool(ut, true, chm_get(map, "Apple", &R), __func__);
+    ut_equals_double(ut, 0.49, *(double *)R, __func__);
+    free(R);
+
+    // Replacing keeps the size
+    if (!chm_put(map, new_string("Apple"), new_double(0.59)))
+        goto error;
+
+    ut_equals_integer_t(ut, 3, chm_size(map), __func__);
+    ut_equals_bool(ut, true, chm_get(map, "Apple", &R), __func__);
+    ut_equals_double(ut, 0.59, *(double *)R, __func__);
+    free(R);
+
+    ut_equals_bool(ut, false, chm_get(map, "Soybeans", &R), __func__);
+    ut_equals_bool(ut, false, chm_contains_key(map, "Soybeans"), __func__);
+
+    if (!chm_remove(map, "Grape Juice", &R))
+        goto error;
+
+    ut_equals_double(ut, 1.29, *(double *)R, __func__);
+    free(R);
+
+    if (!chm_remove(map, "Maple Syrup", NULL))
+        goto error;
+
+    ut_equals_bool(ut, false, chm_remove(map, "Maple Syrup", NULL), __func__);
+    ut_equals_integer_t(ut, 1, chm_size(map), __func__);
+
+    chm_erase(map);
+
+    ut_equals_bool(ut, true, chm_empty(map), __func__);
+
+    chm_free(map);
+    interface_free(string_interface);
+    interface_free(double_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        chm_free(map);
+    interface_free(string_interface);
+    interface_free(double_interface);
+    ut_error();
+}
+
+// Checks growth and backward shift deletion with a single shard
+void chm_test_growth(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    ConcurrentHashMap_t *map = chm_new(interface, interface, 1);
+
+    if (!map || !interface)
+        goto error;
+
+    const int64_t elements = 10000;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!chm_put(map, new_int64_t(i), new_int64_t(i * 2)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, elements, chm_size(map), __func__);
+
+    // Remove every odd key
+    for (int64_t i = 1; i < elements; i += 2)
+    {
+        if (!chm_remove(map, &i, NULL))
+            goto error;
+    }
+
+    bool all_found = true;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        void *R = NULL;
+        bool found = chm_get(map, &i, &R);
+
+        if (i % 2 == 0)
+            all_found = all_found && found && *(int64_t *)R == i * 2;
+        else
+            all_found = all_found && !found;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, all_found, __func__);
+    ut_equals_integer_t(ut, elements / 2, chm_size(map), __func__);
+
+    chm_free(map);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        chm_free(map);
+    interface_free(interface);
+    ut_error();
+}
+
+static void *chm_test_square(const void *key, void *context)
+{
+    atomic_int *calls = context;
+
+    atomic_fetch_add(calls, 1);
+
+    return new_int64_t(*(const int64_t *)key * *(const int64_t *)key);
+}
+
+struct chm_test_worker
+{
+    ConcurrentHashMap_t *map;
+    atomic_int *calls;
+    int64_t id;
+    int64_t keys;
+    bool success;
+};
+
+static void *chm_test_worker_run(void *argument)
+{
+    struct chm_test_worker *worker = argument;
+
+    worker->success = true;
+
+    for (int64_t i = 0; i < worker->keys; i++)
+    {
+        // Private keys are inserted, read back and half of them removed
+        int64_t key = (worker->id + 1) * 1000000 + i;
+        void *R = NULL;
+
+        if (!chm_put(worker->map, new_int64_t(key), new_int64_t(-key)))
+            worker->success = false;
+
+        if (!chm_get(worker->map, &key, &R) || *(int64_t *)R != -key)
+            worker->success = false;
+
+        free(R);
+
+        if (i % 2 == 1 && !chm_remove(worker->map, &key, NULL))
+            worker->success = false;
+
+        // Shared keys are computed by whichever thread gets there first
+        int64_t shared = i % 100;
+
+        if (!chm_compute_if_absent(worker->map, &shared, chm_test_square,
+                                   worker->calls, &R))
+            worker->success = false;
+        else if (*(int64_t *)R != shared * shared)
+            worker->success = false;
+
+        free(R);
+    }
+
+    return NULL;
+}
+
+// Checks that many threads operating at the same time don't lose updates
+void chm_test_threads(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    ConcurrentHashMap_t *map = chm_new(interface, interface, 8);
+
+    if (!map || !interface)
+        goto error;
+
+    const int64_t threads = 4, keys = 5000;
+
+    atomic_int calls = 0;
+    pthread_t handles[4];
+    struct chm_test_worker workers[4];
+
+    for (int64_t i = 0; i < threads; i++)
+    {
+        workers[i].map = map;
+        workers[i].calls = &calls;
+        workers[i].id = i;
+        workers[i].keys = keys;
+
+        pthread_create(&handles[i], NULL, chm_test_worker_run, &workers[i]);
+    }
+
+    bool success = true;
+
+    for (int64_t i = 0; i < threads; i++)
+    {
+        pthread_join(handles[i], NULL);
+        success = success && workers[i].success;
+    }
+
+    ut_equals_bool(ut, true, success, __func__);
+    ut_equals_integer_t(ut, 100, atomic_load(&calls), __func__);
+    ut_equals_integer_t(ut, threads * keys / 2 + 100, chm_size(map), __func__);
+
+    chm_free(map);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        chm_free(map);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all ConcurrentHashMap tests
+Status ConcurrentHashMapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    chm_test_IO(ut);
+    chm_test_growth(ut);
+    chm_test_threads(ut);
+
+    ut_report(ut, "ConcurrentHashMap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ConcurrentHashMap");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file ConcurrentStackTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ConcurrentStack.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Checks the LIFO order with a single thread
+void cst_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    ConcurrentStack_t *stack = cst_new(interface);
+
+    if (!stack || !interface)
+        goto error;
+
+    ut_equals_bool(ut, true, cst_empty(stack), __func__);
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        if (!cst_push(stack, new_int64_t(i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 100, cst_count(stack), __func__);
+
+    bool in_order = true;
+
+    for (int64_t i = 99; i >= 50; i--)
+    {
+        void *R = NULL;
+
+        if (!cst_pop(stack, &R))
+            goto error;
+
+        in_order = in_order && *(int64_t *)R == i;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, in_order, __func__);
+    ut_equals_integer_t(ut, 50, cst_count(stack), __func__);
+
+    cst_erase(stack);
+
+    void *R = NULL;
+
+    ut_equals_bool(ut, false, cst_pop(stack, &R), __func__);
+    ut_equals_bool(ut, true, cst_empty(stack), __func__);
+
+    cst_free(stack);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (stack)
+        cst_free(stack);
+    interface_free(interface);
+    ut_error();
+}
+
+struct cst_test_worker
+{
+    ConcurrentStack_t *stack;
+    atomic_int *seen;
+    int64_t id;
+    int64_t elements;
+};
+
+static void *cst_test_worker_run(void *argument)
+{
+    struct cst_test_worker *worker = argument;
+
+    // Interleave pushes and pops so that some of them get eliminated
+    for (int64_t i = 0; i < worker->elements; i++)
+    {
+        int64_t *element = malloc(sizeof(int64_t));
+
+        *element = worker->id * worker->elements + i;
+
+        cst_push(worker->stack, element);
+
+        if (i % 2 == 1)
+        {
+            void *R;
+
+            for (int j = 0; j < 2; j++)
+            {
+                if (cst_pop(worker->stack, &R))
+                {
+                    atomic_fetch_add(&worker->seen[*(int64_t *)R], 1);
+                    free(R);
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Checks that no element is lost or popped twice with many threads
+void cst_test_threads(UnitTest ut)
+{
+    const int64_t threads = 4, elements = 20000;
+
+    ConcurrentStack_t *stack = cst_new(NULL);
+    atomic_int *seen = calloc((size_t)(threads * elements), sizeof(atomic_int));
+
+    if (!stack || !seen)
+        goto error;
+
+    pthread_t handles[4];
+    struct cst_test_worker workers[4];
+
+    for (int64_t i = 0; i < threads; i++)
+    {
+        workers[i].stack = stack;
+        workers[i].seen = seen;
+        workers[i].id = i;
+        workers[i].elements = elements;
+
+        pthread_create(&handles[i], NULL, cst_test_worker_run, &workers[i]);
+    }
+
+    for (int64_t i = 0; i < threads; i++)
+        pthread_join(handles[i], NULL);
+
+    void *R;
+
+    while (cst_pop(stack, &R))
+    {
+        atomic_fetch_add(&seen[*(int64_t *)R], 1);
+        free(R);
+    }
+
+    bool exactly_once = true;
+
+    for (int64_t i = 0; i < threads * elements; i++)
+        exactly_once = exactly_once && atomic_load(&seen[i]) == 1;
+
+    ut_equals_bool(ut, true, exactly_once, __func__);
+    ut_equals_integer_t(ut, 0, cst_count(stack), __func__);
+
+    cst_free_shallow(stack);
+    free(seen);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (stack)
+        cst_free_shallow(stack);
+    free(seen);
+    ut_error();
+}
+
+// Runs all ConcurrentStack tests
+Status ConcurrentStackTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    cst_test_IO(ut);
+    cst_test_threads(ut);
+
+    ut_report(ut, "ConcurrentStack");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ConcurrentStack");
+    ut_delete(&ut);
+    return st;
+}
@@ -358,6 +358,175 @@ void dqa_test_growth(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Tests the iterator on a deque that wraps around its buffer
+void dqa_test_iterator(UnitTest ut)
+{
+    char iter_storage[dqa_iter_size];
+    DequeArrayIterator_t *iter = (DequeArrayIterator_t*)&iter_storage[0];
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    if (!int_interface)
+        goto error;
+
+    DequeArray_t *deque = dqa_create(int_interface, 8, 200);
+
+    if (!deque)
+        goto error;
+
+    ut_equals_bool(ut, dqa_iter_init(iter, deque), false, __func__);
+
+    // From front to rear: 4 3 2 1 0 5 6 7 8 9
+    for (int i = 0; i < 5; i++)
+    {
+        if (!dqa_enqueue_front(deque, new_int32_t(i)))
+            goto error;
+        if (!dqa_enqueue_rear(deque, new_int32_t(i + 5)))
+            goto error;
+    }
+
+    int32_t expected[] = { 4, 3, 2, 1, 0, 5, 6, 7, 8, 9 };
+
+    if (!dqa_iter_init(iter, deque))
+        goto error;
+
+    bool same = true;
+    int count = 0;
+
+    do
+    {
+        same = same && *(int32_t*)dqa_iter_peek(iter) == expected[count++];
+    } while (dqa_iter_next(iter));
+
+    ut_equals_int(ut, count, 10, __func__);
+
+    if (!dqa_iter_to_rear(iter))
+        goto error;
+
+    do
+    {
+        same = same && *(int32_t*)dqa_iter_peek(iter) == expected[--count];
+    } while (dqa_iter_prev(iter));
+
+    ut_equals_int(ut, count, 0, __func__);
+
+    DQA_FOR_EACH(deque, {
+        same = same && *(int32_t*)var == expected[count++];
+    })
+
+    ut_equals_int(ut, count, 10, __func__);
+    ut_equals_bool(ut, same, true, __func__);
+
+    // Setting through the iterator is not a structural modification
+    if (!dqa_iter_next(iter) || !dqa_iter_set(iter, new_int32_t(30)))
+        goto error;
+
+    ut_equals_int(ut, *(int32_t*)dqa_iter_peek_prev(iter), 4, __func__);
+    ut_equals_int(ut, *(int32_t*)dqa_iter_peek_next(iter), 2, __func__);
+
+    void *R;
+
+    if (!dqa_dequeue_front(deque, &R))
+        goto error;
+
+    free(R);
+
+    ut_equals_int(ut, *(int32_t*)dqa_peek_front(deque), 30, __func__);
+    ut_equals_bool(ut, dqa_iter_next(iter), false, __func__);
+    ut_equals_bool(ut, dqa_iter_peek(iter) == NULL, true, __func__);
+
+    dqa_free(deque);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    dqa_free(deque);
+    interface_free(int_interface);
+}
+
+static bool dqa_test_load(void *target, Serial_t *serial)
+{
+    return dqa_deserialize(target, serial);
+}
+
+static bool dqa_test_empty(void *target)
+{
+    return dqa_empty(target);
+}
+
+// Saves a deque filled from both ends and loads it back, after checking
+// that a cut stream and a newer version are both refused
+void dqa_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    DequeArray_t *deque = dqa_new(interface);
+    DequeArray_t *loaded = dqa_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !deque || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        bool inserted = i % 2 == 0
+                        ? dqa_enqueue_front(deque, new_int64_t(i))
+                        : dqa_enqueue_rear(deque, new_int64_t(i));
+
+        if (!inserted)
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, dqa_serialize(deque, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, dqa_test_load, dqa_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, dqa_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, dqa_count(deque), dqa_count(loaded), __func__);
+    ut_equals_int(ut, 0, dqa_compare(deque, loaded), __func__);
+
+    // A locked deque that is too small is left empty
+    DequeArray_t *small = dqa_create(interface, 16, 200);
+
+    if (!small)
+        goto error;
+
+    dqa_capacity_lock(small);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, dqa_deserialize(small, serial), __func__);
+    ut_equals_bool(ut, true, dqa_empty(small), __func__);
+
+    dqa_free(small);
+
+    ser_free(serial);
+    dqa_free(deque);
+    dqa_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (deque)
+        dqa_free(deque);
+    if (loaded)
+        dqa_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all DequeArray tests
 Status DequeArrayTests(void)
 {
@@ -373,6 +542,8 @@ Status DequeArrayTests(void)
     dqa_test_locked(ut);
     dqa_test_intensive(ut);
     dqa_test_growth(ut);
+    dqa_test_iterator(ut);
+    dqa_test_serialize(ut);
 
     ut_report(ut, "DequeArray");
 
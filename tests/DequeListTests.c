@@ -93,7 +93,215 @@ void dql_test_foreach(UnitTest ut)
 
     ut_equals_int(ut, 250500, sum, __func__);
 
+    sum = 0;
+
+    // continue moves on to the next element
+    DQL_FOR_EACH(deque, {
+            int32_t i = *(int*)var;
+            if (i % 2 != 0)
+                continue;
+            sum += i;
+    })
+
+    ut_equals_int(ut, 250500, sum, __func__);
+
     dql_erase(deque);
+
+    // Nothing to visit in an empty deque
+    integer_t visited = 0;
+
+    DQL_FOR_EACH(deque, {
+            visited++;
+    })
+
+    ut_equals_integer_t(ut, 0, visited, __func__);
+}
+
+// Tests moving ranges of nodes between deques
+void dql_test_splice(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    DQL_DECL(src)
+    DQL_DECL(dst)
+    dql_init(src, &int_interface);
+    dql_init(dst, &int_interface);
+
+    for (int i = 0; i < 10; i++)
+    {
+        if (!dql_enqueue_rear(src, new_int32_t(i)))
+            goto error;
+    }
+
+    for (int i = 100; i < 105; i++)
+    {
+        if (!dql_enqueue_rear(dst, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, dql_splice(dst, 0, dst, 0, 1), false, __func__);
+    ut_equals_bool(ut, dql_splice(dst, 0, src, 3, 10), false, __func__);
+    ut_equals_bool(ut, dql_splice(dst, 6, src, 3, 6), false, __func__);
+
+    // Middle to middle, then the remaining rear of src to dst's rear and
+    // finally everything left in src to dst's front
+    ut_equals_bool(ut, dql_splice(dst, 2, src, 3, 6), true, __func__);
+    ut_equals_bool(ut, dql_splice(dst, 9, src, 4, 5), true, __func__);
+    ut_equals_bool(ut, dql_splice(dst, 0, src, 0, 3), true, __func__);
+
+    ut_equals_integer_t(ut, dql_count(src), 0, __func__);
+    ut_equals_integer_t(ut, dql_count(dst), 15, __func__);
+
+    int32_t expected[] = { 0, 1, 2, 7, 100, 101, 3, 4, 5, 6, 102, 103, 104,
+                           8, 9 };
+
+    bool same = true;
+    void *R;
+
+    // Checks both directions, alternating between both ends
+    for (int i = 0, j = 14; i <= j; i++, j--)
+    {
+        if (!dql_dequeue_front(dst, &R))
+            goto error;
+
+        same = same && *(int32_t*)R == expected[i];
+        free(R);
+
+        if (i == j)
+            break;
+
+        if (!dql_dequeue_rear(dst, &R))
+            goto error;
+
+        same = same && *(int32_t*)R == expected[j];
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_bool(ut, dql_empty(dst), true, __func__);
+
+    // Append and prepend take the whole deque
+    if (!dql_enqueue_rear(src, new_int32_t(1)) ||
+        !dql_enqueue_rear(src, new_int32_t(2)) ||
+        !dql_enqueue_rear(dst, new_int32_t(3)))
+        goto error;
+
+    ut_equals_bool(ut, dql_prepend(dst, src), true, __func__);
+
+    if (!dql_enqueue_rear(src, new_int32_t(4)) ||
+        !dql_enqueue_rear(src, new_int32_t(5)))
+        goto error;
+
+    ut_equals_bool(ut, dql_append(dst, src), true, __func__);
+    ut_equals_bool(ut, dql_append(dst, src), true, __func__);
+
+    ut_equals_integer_t(ut, dql_count(src), 0, __func__);
+    ut_equals_integer_t(ut, dql_count(dst), 5, __func__);
+    ut_equals_int(ut, *(int32_t*)dql_peek_front(dst), 1, __func__);
+    ut_equals_int(ut, *(int32_t*)dql_peek_rear(dst), 5, __func__);
+
+    for (int i = 1; i <= 5; i++)
+    {
+        if (!dql_dequeue_front(dst, &R))
+            goto error;
+
+        same = same && *(int32_t*)R == i;
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    dql_erase(src);
+    dql_erase(dst);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    dql_erase(src);
+    dql_erase(dst);
+}
+
+static bool dql_test_load(void *target, Serial_t *serial)
+{
+    return dql_deserialize(target, serial);
+}
+
+static bool dql_test_empty(void *target)
+{
+    return dql_empty(target);
+}
+
+// Saves a deque filled from both ends and loads it back, after checking
+// that a cut stream and a newer version are both refused
+void dql_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    DequeList_t *deque = dql_new(interface);
+    DequeList_t *loaded = dql_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !deque || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        bool inserted = i % 2 == 0
+                        ? dql_enqueue_front(deque, new_int64_t(i))
+                        : dql_enqueue_rear(deque, new_int64_t(i));
+
+        if (!inserted)
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, dql_serialize(deque, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, dql_test_load, dql_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, dql_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, dql_count(deque), dql_count(loaded), __func__);
+    ut_equals_int(ut, 0, dql_compare(deque, loaded), __func__);
+
+    // The elements have to fit in the limit of the loaded deque
+    DequeList_t *limited = dql_new(interface);
+
+    if (!limited)
+        goto error;
+
+    dql_set_limit(limited, dql_count(deque) - 1);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, dql_deserialize(limited, serial), __func__);
+    ut_equals_bool(ut, true, dql_empty(limited), __func__);
+
+    dql_free(limited);
+
+    ser_free(serial);
+    dql_free(deque);
+    dql_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (deque)
+        dql_free(deque);
+    if (loaded)
+        dql_free(loaded);
+    interface_free(interface);
+    ut_error();
 }
 
 // Runs all DequeList tests
@@ -108,6 +316,8 @@ Status DequeListTests(void)
 
     dql_test_limit(ut);
     dql_test_foreach(ut);
+    dql_test_splice(ut);
+    dql_test_serialize(ut);
 
     ut_report(ut, "DequeList");
 
@@ -10,6 +10,22 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The legacy lists take callbacks with non-const parameters
+static int dll_test_compare(void *element1, void *element2)
+{
+    return compare_int64_t(element1, element2);
+}
+
+static void *dll_test_copy(void *element)
+{
+    return copy_int64_t(element);
+}
+
+static void dll_test_display(void *element)
+{
+    display_int64_t(element);
+}
+
 // Tests dll_get
 Status dll_test_get(UnitTest ut)
 {
@@ -204,6 +220,519 @@ Status dll_test_indexof(UnitTest ut)
     return st;
 }
 
+// Compares only the keys so that equal keys can be told apart
+static int dll_test_compare_key(void *a, void *b)
+{
+    int64_t ka = *(int64_t*)a / 10000, kb = *(int64_t*)b / 10000;
+
+    return (ka > kb) - (ka < kb);
+}
+
+// Sorts random, sorted, reversed and partially sorted lists
+Status dll_test_sort(UnitTest ut)
+{
+    DoublyLinkedList list = NULL;
+
+    Status st = dll_create(&list, dll_test_compare_key, dll_test_copy,
+                           dll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    const int64_t n = 3000;
+
+    for (int shape = 0; shape < 4; shape++)
+    {
+        // The order of insertion goes in the lower digits
+        for (int64_t i = 0; i < n; i++)
+        {
+            int64_t key;
+
+            if (shape == 0)
+                key = random_int64_t(0, 99);
+            else if (shape == 1)
+                key = i;
+            else if (shape == 2)
+                key = n - i;
+            else
+                key = (i / 100) % 2 == 0 ? i % 100 : 100 - i % 100;
+
+            st = dll_insert_tail(list, new_int64_t(key * 10000 + i));
+
+            if (st != DS_OK)
+                goto error;
+        }
+
+        st = dll_sort(list);
+
+        if (st != DS_OK)
+            goto error;
+
+        // Keys in order and equal keys in their order of insertion
+        bool sorted = true;
+        void *R, *prev = NULL;
+
+        for (integer_t i = 0; i < dll_length(list); i++)
+        {
+            st = dll_get(list, &R, i);
+
+            if (st != DS_OK)
+                goto error;
+
+            if (prev != NULL)
+                sorted = sorted && compare_int64_t(prev, R) <= 0;
+
+            prev = R;
+        }
+
+        ut_equals_bool(ut, true, sorted, __func__);
+        ut_equals_integer_t(ut, n, dll_length(list), __func__);
+
+        // The tail is still the last node
+        st = dll_insert_tail(list, new_int64_t(-1));
+
+        if (st != DS_OK)
+            goto error;
+
+        st = dll_get(list, &R, n);
+
+        if (st != DS_OK)
+            goto error;
+
+        ut_equals_bool(ut, true, *(int64_t*)R == -1, __func__);
+
+        st = dll_erase(&list);
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    dll_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    dll_free(&list);
+    return st;
+}
+
+// Mixes positional operations with other changes and checks them against
+// an array, so a stale cached position would show up
+Status dll_test_cursor(UnitTest ut)
+{
+    DoublyLinkedList list = NULL;
+
+    Status st = dll_create(&list, dll_test_compare, dll_test_copy,
+                           dll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    int64_t array[600];
+    integer_t length = 0;
+
+    bool same = true;
+    void *R;
+
+    for (int i = 0; i < 4000; i++)
+    {
+        int op = (int)random_int64_t(0, 5);
+        integer_t position = random_int64_t(0, length);
+
+        if (length == 0 || (op == 0 && length < 600))
+        {
+            st = dll_insert_at(list, new_int64_t(i), position);
+
+            memmove(array + position + 1, array + position,
+                    sizeof(int64_t) * (size_t)(length - position));
+
+            array[position] = i;
+            length++;
+        }
+        else if (op == 1)
+        {
+            position = position % length;
+
+            st = dll_remove_at(list, &R, position);
+
+            if (st != DS_OK)
+                goto error;
+
+            same = same && *(int64_t*)R == array[position];
+
+            free(R);
+
+            memmove(array + position, array + position + 1,
+                    sizeof(int64_t) * (size_t)(length - position - 1));
+
+            length--;
+        }
+        else if (op == 2 && length < 600)
+        {
+            st = dll_insert_head(list, new_int64_t(i));
+
+            memmove(array + 1, array, sizeof(int64_t) * (size_t)length);
+
+            array[0] = i;
+            length++;
+        }
+        else if (op == 3)
+        {
+            st = dll_remove_head(list, &R);
+
+            free(R);
+
+            memmove(array, array + 1, sizeof(int64_t) * (size_t)(length - 1));
+
+            length--;
+        }
+        else
+        {
+            // A run of lookups in order from a random start
+            for (integer_t j = position % length; j < length; j++)
+            {
+                st = dll_get(list, &R, j);
+
+                if (st != DS_OK)
+                    goto error;
+
+                same = same && *(int64_t*)R == array[j];
+            }
+        }
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_integer_t(ut, length, dll_length(list), __func__);
+
+    dll_free(&list);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    dll_free(&list);
+    return st;
+}
+
+// Tests moving ranges of nodes between lists
+Status dll_test_splice(UnitTest ut)
+{
+    DoublyLinkedList src = NULL, dst = NULL;
+
+    Status st = dll_create(&src, dll_test_compare, dll_test_copy,
+                           dll_test_display, free);
+
+    if (st != DS_OK)
+        return st;
+
+    st = dll_create(&dst, dll_test_compare, dll_test_copy, dll_test_display,
+                    free);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+    {
+        st = dll_insert_tail(src, new_int64_t(i));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    for (int i = 100; i < 105; i++)
+    {
+        st = dll_insert_tail(dst, new_int64_t(i));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    ut_equals_int(ut, dll_splice(dst, 0, dst, 0, 1), DS_ERR_INVALID_ARGUMENT,
+                  __func__);
+    ut_equals_int(ut, dll_splice(dst, 0, src, 3, 10), DS_ERR_OUT_OF_RANGE,
+                  __func__);
+    ut_equals_int(ut, dll_splice(dst, 6, src, 3, 6), DS_ERR_OUT_OF_RANGE,
+                  __func__);
+
+    // Middle to middle, then the remaining tail of src to dst's tail and
+    // finally everything left in src to dst's head
+    ut_equals_int(ut, dll_splice(dst, 2, src, 3, 6), DS_OK, __func__);
+    ut_equals_int(ut, dll_splice(dst, 9, src, 4, 5), DS_OK, __func__);
+    ut_equals_int(ut, dll_splice(dst, 0, src, 0, 3), DS_OK, __func__);
+
+    ut_equals_integer_t(ut, dll_length(src), 0, __func__);
+    ut_equals_integer_t(ut, dll_length(dst), 15, __func__);
+
+    // The tail must have been kept in place
+    st = dll_insert_tail(dst, new_int64_t(200));
+
+    if (st != DS_OK)
+        goto error;
+
+    int64_t expected[] = { 0, 1, 2, 7, 100, 101, 3, 4, 5, 6, 102, 103, 104,
+                           8, 9, 200 };
+
+    bool same = true;
+    void *R;
+
+    for (integer_t i = 0; i < 16; i++)
+    {
+        st = dll_get(dst, &R, i);
+
+        if (st != DS_OK)
+            goto error;
+
+        same = same && *(int64_t*)R == expected[i];
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // The emptied list must still be usable
+    st = dll_insert_tail(src, new_int64_t(300));
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, dll_splice(src, 1, dst, 15, 15), DS_OK, __func__);
+
+    st = dll_get(src, &R, 1);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, *(int64_t*)R, 200, __func__);
+
+    dll_free(&src);
+    dll_free(&dst);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    dll_free(&src);
+    dll_free(&dst);
+    return st;
+}
+
+// Tests moving the end and a middle range of a list into empty lists
+Status dll_test_unlink(UnitTest ut)
+{
+    DoublyLinkedList list = NULL, tail = NULL, range = NULL;
+
+    Status st = DS_OK;
+
+    st += dll_create(&list, dll_test_compare, dll_test_copy, dll_test_display,
+                     free);
+    st += dll_create(&tail, dll_test_compare, dll_test_copy, dll_test_display,
+                     free);
+    st += dll_create(&range, dll_test_compare, dll_test_copy, dll_test_display,
+                     free);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+    {
+        st = dll_insert_tail(list, new_int64_t(i));
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    ut_equals_int(ut, dll_unlink(list, tail, 10), DS_ERR_OUT_OF_RANGE,
+                  __func__);
+    ut_equals_int(ut, dll_unlink_at(list, range, 4, 2),
+                  DS_ERR_INVALID_ARGUMENT, __func__);
+    ut_equals_int(ut, dll_unlink_at(list, list, 2, 4),
+                  DS_ERR_INVALID_OPERATION, __func__);
+
+    ut_equals_int(ut, dll_unlink_at(list, range, 2, 4), DS_OK, __func__);
+    ut_equals_int(ut, dll_unlink(list, tail, 4), DS_OK, __func__);
+
+    // Only empty lists can receive the elements
+    ut_equals_int(ut, dll_unlink(list, tail, 0), DS_ERR_INVALID_OPERATION,
+                  __func__);
+
+    // The tails of every list must have been kept in place
+    st += dll_insert_tail(list, new_int64_t(10));
+    st += dll_insert_tail(tail, new_int64_t(11));
+    st += dll_insert_tail(range, new_int64_t(12));
+
+    if (st != DS_OK)
+        goto error;
+
+    int64_t expected[][5] = { { 0, 1, 5, 6, 10 }, { 7, 8, 9, 11 },
+                              { 2, 3, 4, 12 } };
+    DoublyLinkedList lists[] = { list, tail, range };
+    integer_t lengths[] = { 5, 4, 4 };
+
+    bool same = true;
+    void *R;
+
+    for (int l = 0; l < 3; l++)
+    {
+        same = same && dll_length(lists[l]) == lengths[l];
+
+        for (integer_t i = 0; i < lengths[l]; i++)
+        {
+            st = dll_get(lists[l], &R, i);
+
+            if (st != DS_OK)
+                goto error;
+
+            same = same && *(int64_t*)R == expected[l][i];
+        }
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Unlinking from the head leaves the list empty but usable
+    dll_free(&range);
+
+    st = dll_create(&range, dll_test_compare, dll_test_copy, dll_test_display,
+                    free);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, dll_unlink(list, range, 0), DS_OK, __func__);
+    ut_equals_integer_t(ut, dll_length(list), 0, __func__);
+    ut_equals_integer_t(ut, dll_length(range), 5, __func__);
+
+    st = dll_insert_tail(list, new_int64_t(13));
+
+    if (st != DS_OK)
+        goto error;
+
+    st = dll_get(list, &R, 0);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, *(int64_t*)R, 13, __func__);
+
+    dll_free(&list);
+    dll_free(&tail);
+    dll_free(&range);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    dll_free(&list);
+    dll_free(&tail);
+    dll_free(&range);
+    return st;
+}
+
+static bool dll_test_load(void *list, Serial_t *serial)
+{
+    return dll_deserialize(list, deserialize_int64_t, serial) == DS_OK;
+}
+
+static bool dll_test_empty(void *target)
+{
+    return dll_empty(target);
+}
+
+// Saves a list through an explicit codec and loads it back in the same
+// order, after checking that a cut stream, a newer version and a list that
+// is too short are all refused
+Status dll_test_serialize(UnitTest ut)
+{
+    DoublyLinkedList list = NULL, loaded = NULL, limited = NULL;
+    Serial_t *serial = ser_new_buffer();
+
+    Status st = DS_OK;
+
+    st += dll_create(&list, dll_test_compare, dll_test_copy, dll_test_display,
+                     free);
+    st += dll_create(&loaded, dll_test_compare, dll_test_copy,
+                     dll_test_display, free);
+    st += dll_create(&limited, dll_test_compare, dll_test_copy,
+                     dll_test_display, free);
+
+    if (st != DS_OK || !serial)
+        goto error;
+
+    for (int64_t i = 0; i < 300; i++)
+        st += dll_insert_tail(list, new_int64_t(random_int64_t(-100, 100)));
+
+    if (st != DS_OK)
+        goto error;
+
+    st = dll_serialize(list, serialize_int64_t, serial);
+
+    if (st != DS_OK)
+        goto error;
+
+    if (!ut_serial_rejects(ut, serial, loaded, dll_test_load, dll_test_empty,
+                           __func__))
+    {
+        st = DS_ERR_ALLOC;
+        goto error;
+    }
+
+    // The elements have to fit in the limit of the loaded list
+    st = dll_set_limit(limited, dll_length(list) - 1);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, DS_ERR_FULL,
+                  dll_deserialize(limited, deserialize_int64_t, serial),
+                  __func__);
+    ut_equals_bool(ut, true, dll_empty(limited), __func__);
+
+    ser_rewind(serial);
+
+    ut_equals_int(ut, DS_OK,
+                  dll_deserialize(loaded, deserialize_int64_t, serial),
+                  __func__);
+    ut_equals_integer_t(ut, dll_length(list), dll_length(loaded), __func__);
+
+    // Both lists give back the same elements from their heads
+    bool same = true;
+    void *R0 = NULL, *R1 = NULL;
+
+    while (!dll_empty(list))
+    {
+        st += dll_remove_head(list, &R0);
+        st += dll_remove_head(loaded, &R1);
+
+        if (st != DS_OK)
+            goto error;
+
+        same = same && compare_int64_t(R0, R1) == 0;
+
+        free(R0);
+        free(R1);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_bool(ut, true, dll_empty(loaded), __func__);
+
+    ser_free(serial);
+    dll_free(&list);
+    dll_free(&loaded);
+    dll_free(&limited);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    dll_free(&list);
+    dll_free(&loaded);
+    dll_free(&limited);
+    return st;
+}
+
 // Runs all DoublyLinkedList tests
 Status DoublyLinkedListTests(void)
 {
@@ -217,6 +746,11 @@ Status DoublyLinkedListTests(void)
     st += dll_test_get(ut);
     st += dll_test_limit(ut);
     st += dll_test_indexof(ut);
+    st += dll_test_sort(ut);
+    st += dll_test_cursor(ut);
+    st += dll_test_splice(ut);
+    st += dll_test_unlink(ut);
+    st += dll_test_serialize(ut);
 
     if (st != DS_OK)
         goto error;
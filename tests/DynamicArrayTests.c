@@ -105,6 +105,313 @@ void dar_test_growth(UnitTest ut)
     interface_free(interface);
 }
 
+static void dar_test_double(void *element, void *context)
+{
+    (void)context;
+    *(int32_t *)element *= 2;
+}
+
+static void *dar_test_square(const void *element, void *context)
+{
+    (void)context;
+    int32_t value = *(const int32_t *)element;
+    return new_int64_t((int64_t)value * value);
+}
+
+static bool dar_test_even(const void *element, void *context)
+{
+    (void)context;
+    return *(const int32_t *)element % 2 == 0;
+}
+
+static void dar_test_sum(void *accumulator, const void *element, void *context)
+{
+    (void)context;
+    *(int64_t *)accumulator += *(const int64_t *)element;
+}
+
+static void dar_test_combine(void *accumulator, const void *partial,
+                             void *context)
+{
+    (void)context;
+    *(int64_t *)accumulator += *(const int64_t *)partial;
+}
+
+// Walks an array from front to rear and back again
+void dar_test_iter(UnitTest ut)
+{
+    DAR_ITER_DECL(iter)
+
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+                                           display_int32_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(interface);
+
+    if (!array)
+        goto error;
+
+    ut_equals_bool(ut, false, dar_iter_init(iter, array), __func__);
+
+    void *elem;
+    for (int i = 0; i < 10; i++)
+    {
+        elem = new_int32_t(i);
+
+        if (!dar_insert_back(array, elem))
+        {
+            free(elem);
+
+            goto error;
+        }
+    }
+
+    ut_equals_bool(ut, true, dar_iter_init(iter, array), __func__);
+
+    int32_t expected = 0;
+    bool in_order = true;
+
+    do
+    {
+        in_order = in_order && *(int32_t*)dar_iter_peek(iter) == expected;
+        expected++;
+    } while (dar_iter_next(iter));
+
+    ut_equals_int(ut, 10, expected, __func__);
+    ut_equals_bool(ut, false, dar_iter_has_next(iter), __func__);
+
+    // dar_iter_prev has to step back from the last element
+    integer_t steps = 0;
+    expected = 9;
+
+    while (dar_iter_prev(iter))
+    {
+        expected--;
+        in_order = in_order && *(int32_t*)dar_iter_peek(iter) == expected;
+        steps++;
+    }
+
+    ut_equals_integer_t(ut, 9, steps, __func__);
+    ut_equals_bool(ut, true, in_order, __func__);
+    ut_equals_bool(ut, false, dar_iter_has_prev(iter), __func__);
+
+    // Back to the rear in a single step
+    ut_equals_bool(ut, true, dar_iter_to_end(iter), __func__);
+    ut_equals_int(ut, 9, *(int32_t*)dar_iter_peek(iter), __func__);
+
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array)
+        dar_free(array);
+    interface_free(interface);
+}
+
+// Tests for_each, map, filter and reduce and their parallel versions
+void dar_test_functional(UnitTest ut)
+{
+    const int32_t elements = 100000;
+
+    Interface_t *int32_interface = interface_new(compare_int32_t, copy_int32_t,
+                                                 display_int32_t, free, NULL,
+                                                 NULL);
+    Interface_t *int64_interface = interface_new(compare_int64_t, copy_int64_t,
+                                                 display_int64_t, free, NULL,
+                                                 NULL);
+
+    DynamicArray_t *array = dar_new(int32_interface);
+
+    if (!array)
+        goto error;
+
+    void *elem;
+    for (int32_t i = 0; i < elements; i++)
+    {
+        elem = new_int32_t(i);
+
+        if (!dar_insert_back(array, elem))
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    // Every element is doubled by each round
+    int64_t factor = 1;
+
+    // 0 is the serial pool, which must give exactly the same results
+    for (integer_t threads = 0; threads <= 4; threads += 4)
+    {
+        factor *= 2;
+
+        ThreadPool_t *pool = tpl_new(threads);
+
+        if (!pool)
+            goto error;
+
+        dar_parallel_for_each(array, pool, dar_test_double, NULL);
+
+        DynamicArray_t *squares = dar_map(array, int64_interface,
+                                          dar_test_square, NULL);
+        DynamicArray_t *parallel_squares = dar_parallel_map(array, pool,
+                int64_interface, dar_test_square, NULL);
+
+        DynamicArray_t *evens = dar_filter(squares, dar_test_even, NULL);
+        DynamicArray_t *parallel_evens = dar_parallel_filter(squares, pool,
+                dar_test_even, NULL);
+
+        if (!squares || !parallel_squares || !evens || !parallel_evens)
+        {
+            tpl_free(pool);
+            goto error;
+        }
+
+        int64_t sum = 0, parallel_sum = 0;
+
+        dar_reduce(squares, &sum, dar_test_sum, NULL);
+
+        if (!dar_parallel_reduce(parallel_squares, pool, &parallel_sum,
+                                 sizeof(int64_t), dar_test_sum,
+                                 dar_test_combine, NULL))
+        {
+            tpl_free(pool);
+            goto error;
+        }
+
+        // Sum of (factor * i)^2 for i in [0, elements)
+        int64_t n = elements;
+        int64_t expected = factor * factor * (n - 1) * n * (2 * n - 1) / 6;
+
+        ut_equals_bool(ut, true, sum == expected, __func__);
+        ut_equals_bool(ut, true, parallel_sum == expected, __func__);
+        ut_equals_integer_t(ut, elements, dar_size(parallel_squares), __func__);
+
+        // Every square of an even number is even
+        ut_equals_integer_t(ut, elements, dar_size(evens), __func__);
+        ut_equals_integer_t(ut, elements, dar_size(parallel_evens), __func__);
+
+        bool same_order = true;
+        for (integer_t i = 0; i < elements; i++)
+        {
+            if (compare_int64_t(dar_get(evens, i),
+                                dar_get(parallel_evens, i)) != 0)
+                same_order = false;
+        }
+
+        ut_equals_bool(ut, true, same_order, __func__);
+
+        dar_free(squares);
+        dar_free(parallel_squares);
+        dar_free(evens);
+        dar_free(parallel_evens);
+
+        tpl_free(pool);
+    }
+
+    // Each element was doubled twice
+    ut_equals_int(ut, 4 * (elements - 1), *(int32_t *)dar_max(array), __func__);
+
+    dar_free(array);
+    interface_free(int32_interface);
+    interface_free(int64_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (array)
+        dar_free(array);
+    interface_free(int32_interface);
+    interface_free(int64_interface);
+}
+
+static bool dar_test_load(void *target, Serial_t *serial)
+{
+    return dar_deserialize(target, serial);
+}
+
+static bool dar_test_empty(void *target)
+{
+    return dar_empty(target);
+}
+
+// Saves an array and loads it back in the same order, after checking that a
+// cut stream and a newer version are both refused
+void dar_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(interface);
+    DynamicArray_t *loaded = dar_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !array || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        if (!dar_insert_back(array, new_int64_t(random_int64_t(-500, 500))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, dar_serialize(array, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, dar_test_load, dar_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, dar_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, dar_size(array), dar_size(loaded), __func__);
+
+    bool same = true;
+
+    for (integer_t i = 0; i < dar_size(array); i++)
+        same = same && compare_int64_t(dar_get(array, i),
+                                       dar_get(loaded, i)) == 0;
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // A locked array can't grow to fit the elements
+    DynamicArray_t *locked = dar_create(interface, 100, 200);
+
+    if (!locked)
+        goto error;
+
+    dar_capacity_lock(locked);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, dar_deserialize(locked, serial), __func__);
+    ut_equals_bool(ut, true, dar_empty(locked), __func__);
+
+    dar_free(locked);
+
+    ser_free(serial);
+    dar_free(array);
+    dar_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (array)
+        dar_free(array);
+    if (loaded)
+        dar_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all DynamicArray tests
 Status DynamicArrayTests(void)
 {
@@ -117,6 +424,9 @@ Status DynamicArrayTests(void)
 
     dar_test_locked(ut);
     dar_test_growth(ut);
+    dar_test_iter(ut);
+    dar_test_functional(ut);
+    dar_test_serialize(ut);
 
     ut_report(ut, "DynamicArray");
 
@@ -0,0 +1,256 @@
+/**
+ * @file EpochTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "Epoch.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define EBR_TEST_ALIVE 0x0A11CE
+#define EBR_TEST_DEAD 0xDEAD
+
+struct ebr_test_node
+{
+    atomic_int magic;
+    int64_t value;
+};
+
+static atomic_llong ebr_test_live = 0;
+
+static struct ebr_test_node *ebr_test_node_new(int64_t value)
+{
+    struct ebr_test_node *node = malloc(sizeof(struct ebr_test_node));
+
+    atomic_init(&node->magic, EBR_TEST_ALIVE);
+    node->value = value;
+
+    atomic_fetch_add(&ebr_test_live, 1);
+
+    return node;
+}
+
+// Poisons the node before freeing it so that readers of freed memory are
+// caught even without a sanitizer
+static void ebr_test_node_free(void *pointer)
+{
+    struct ebr_test_node *node = pointer;
+
+    atomic_store(&node->magic, EBR_TEST_DEAD);
+
+    atomic_fetch_sub(&ebr_test_live, 1);
+
+    free(node);
+}
+
+// Checks deferred freeing and batching on a single thread
+void ebr_test_retire(UnitTest ut)
+{
+    ebr_synchronize();
+
+    long long before = atomic_load(&ebr_test_live);
+
+    ebr_enter();
+
+    // Nested sections only end at the outermost leave
+    ebr_enter();
+    ebr_leave();
+
+    ut_equals_bool(ut, true, ebr_active(), __func__);
+
+    for (integer_t i = 0; i < EBR_BATCH / 2; i++)
+        ebr_retire(ebr_test_node_new(i), ebr_test_node_free);
+
+    // Nothing can be freed while this thread is inside a critical section
+    ut_equals_integer_t(ut, EBR_BATCH / 2, ebr_pending(), __func__);
+    ut_equals_integer_t(ut, before + EBR_BATCH / 2,
+                        atomic_load(&ebr_test_live), __func__);
+
+    ebr_leave();
+
+    ut_equals_bool(ut, false, ebr_active(), __func__);
+
+    integer_t epoch = ebr_epoch();
+
+    ebr_synchronize();
+
+    ut_equals_bool(ut, true, ebr_epoch() >= epoch + 2, __func__);
+    ut_equals_integer_t(ut, 0, ebr_pending(), __func__);
+    ut_equals_integer_t(ut, before, atomic_load(&ebr_test_live), __func__);
+
+    // Without readers retired memory is reclaimed in batches
+    for (integer_t i = 0; i < EBR_BATCH * 10; i++)
+        ebr_retire(ebr_test_node_new(i), ebr_test_node_free);
+
+    ut_equals_bool(ut, true, ebr_pending() < EBR_BATCH * 10, __func__);
+
+    // Elements retired through an interface
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        goto error;
+
+    ebr_retire_element(interface, new_int64_t(1));
+
+    // The element is freed later with the stored function
+    interface_free(interface);
+
+    ebr_synchronize();
+
+    ut_equals_integer_t(ut, 0, ebr_pending(), __func__);
+    ut_equals_integer_t(ut, before, atomic_load(&ebr_test_live), __func__);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+struct ebr_test_shared
+{
+    _Atomic(struct ebr_test_node *) slots[8];
+    atomic_bool done;
+};
+
+struct ebr_test_worker
+{
+    struct ebr_test_shared *shared;
+    uint64_t seed;
+    bool writer;
+    bool success;
+};
+
+static void *ebr_test_worker_run(void *argument)
+{
+    struct ebr_test_worker *worker = argument;
+    struct ebr_test_shared *shared = worker->shared;
+
+    worker->success = true;
+
+    for (integer_t i = 0; !atomic_load(&shared->done) || i < 1000; i++)
+    {
+        worker->seed ^= worker->seed << 13;
+        worker->seed ^= worker->seed >> 7;
+        worker->seed ^= worker->seed << 17;
+
+        size_t slot = worker->seed % 8;
+
+        ebr_enter();
+
+        if (worker->writer)
+        {
+            // Replace a node and retire the old one
+            struct ebr_test_node *node = ebr_test_node_new((int64_t)i);
+            struct ebr_test_node *old = atomic_exchange(&shared->slots[slot],
+                                                        node);
+
+            ebr_retire(old, ebr_test_node_free);
+        }
+        else
+        {
+            // Whatever is read must stay alive until the section ends
+            struct ebr_test_node *node = atomic_load(&shared->slots[slot]);
+
+            for (int j = 0; j < 8; j++)
+            {
+                if (atomic_load(&node->magic) != EBR_TEST_ALIVE)
+                    worker->success = false;
+            }
+        }
+
+        ebr_leave();
+    }
+
+    return NULL;
+}
+
+// Readers and writers hammer a few shared slots; any node freed too early is
+// detected by its poisoned magic number and reported by ThreadSanitizer or
+// AddressSanitizer builds
+void ebr_test_stress(UnitTest ut)
+{
+    ebr_synchronize();
+
+    long long before = atomic_load(&ebr_test_live);
+
+    struct ebr_test_shared shared;
+
+    for (int i = 0; i < 8; i++)
+        atomic_init(&shared.slots[i], ebr_test_node_new(i));
+
+    atomic_init(&shared.done, false);
+
+    pthread_t handles[6];
+    struct ebr_test_worker workers[6];
+
+    for (int i = 0; i < 6; i++)
+    {
+        workers[i].shared = &shared;
+        workers[i].seed = 0x9E3779B97F4A7C15 * (uint64_t)(i + 1);
+        workers[i].writer = i < 2;
+
+        pthread_create(&handles[i], NULL, ebr_test_worker_run, &workers[i]);
+    }
+
+    // Let them run for a while
+    for (int i = 0; i < 20000; i++)
+    {
+        ebr_enter();
+        ebr_leave();
+    }
+
+    atomic_store(&shared.done, true);
+
+    bool success = true;
+
+    for (int i = 0; i < 6; i++)
+    {
+        pthread_join(handles[i], NULL);
+        success = success && workers[i].success;
+    }
+
+    ut_equals_bool(ut, true, success, __func__);
+
+    // Threads that exited left their pending nodes behind as orphans
+    ebr_synchronize();
+
+    ut_equals_integer_t(ut, before + 8, atomic_load(&ebr_test_live), __func__);
+
+    for (int i = 0; i < 8; i++)
+        ebr_test_node_free(atomic_load(&shared.slots[i]));
+
+    ut_equals_integer_t(ut, before, atomic_load(&ebr_test_live), __func__);
+}
+
+// Runs all Epoch tests
+Status EpochTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ebr_test_retire(ut);
+    ebr_test_stress(ut);
+
+    ut_report(ut, "Epoch");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "Epoch");
+    ut_delete(&ut);
+    return st;
+}
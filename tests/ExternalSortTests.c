@@ -0,0 +1,192 @@
+/**
+ * @file ExternalSortTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ExternalSort.h"
+#include "DynamicArray.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Sorts with a tiny budget so that many runs are spilled and merged in more
+// than one pass, and with a budget big enough to never touch the disk
+void exs_test_runs(UnitTest ut)
+{
+    const int64_t elements = 20000;
+
+    size_t budgets[2] = { 2048, 1 << 24 };
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int b = 0; b < 2; b++)
+    {
+        ExternalSort_t *sorter = exs_new(interface, budgets[b]);
+
+        if (!sorter)
+            goto error;
+
+        int64_t sum0 = 0, sum1 = 0;
+
+        for (int64_t i = 0; i < elements; i++)
+        {
+            int64_t *element = new_int64_t(random_int64_t(-elements, elements));
+
+            sum0 += *element;
+
+            if (!exs_add(sorter, element))
+                free(element);
+        }
+
+        ut_equals_integer_t(ut, elements, exs_count(sorter), __func__);
+        ut_equals_bool(ut, b == 0, exs_runs(sorter) > 1, __func__);
+        ut_equals_bool(ut, true, exs_finish(sorter), __func__);
+
+        bool sorted = true;
+        integer_t taken = 0;
+        void *prev = NULL, *element;
+
+        while (exs_next(sorter, &element))
+        {
+            sum1 += *(int64_t *)element;
+
+            if (prev)
+            {
+                sorted = sorted && compare_int64_t(prev, element) <= 0;
+                free(prev);
+            }
+
+            prev = element;
+            taken++;
+        }
+
+        free(prev);
+
+        ut_equals_bool(ut, false, exs_failed(sorter), __func__);
+        ut_equals_bool(ut, true, sorted, __func__);
+        ut_equals_integer_t(ut, elements, taken, __func__);
+        ut_equals_bool(ut, true, sum0 == sum1, __func__);
+
+        exs_free(sorter);
+    }
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    interface_free(interface);
+    ut_error();
+}
+
+// Sorts a saved DynamicArray_s of strings from one stream into another
+void exs_test_stream(UnitTest ut)
+{
+    const integer_t elements = 3000;
+
+    Interface_t *interface = interface_new(compare_string, copy_string,
+                                           display_string, free, NULL, NULL);
+
+    DynamicArray_t *array = dar_new(interface);
+    Serial_t *input = ser_new_buffer();
+    Serial_t *output = ser_new_buffer();
+
+    if (!interface || !array || !input || !output)
+        goto error;
+
+    interface_codec(interface, serialize_string, deserialize_string);
+
+    for (integer_t i = 0; i < elements; i++)
+        dar_insert_back(array, random_string(1, 12, true));
+
+    if (!dar_serialize(array, input))
+        goto error;
+
+    dar_erase(array);
+    ser_rewind(input);
+
+    // A budget of a few kilobytes spills several runs
+    ut_equals_bool(ut, true, exs_sort(input, output, interface, 4096),
+                   __func__);
+
+    ser_rewind(output);
+
+    ut_equals_bool(ut, true, dar_deserialize(array, output), __func__);
+    ut_equals_integer_t(ut, elements, dar_size(array), __func__);
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < dar_size(array); i++)
+        sorted = sorted && compare_string(dar_get(array, i - 1),
+                                          dar_get(array, i)) <= 0;
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    // An element that is not fully written is an error
+    size_t size;
+    const void *data = ser_data(input, &size);
+
+    Serial_t *truncated = ser_new_view(data, size - 1);
+    Serial_t *discard = ser_new_buffer();
+
+    if (!truncated || !discard)
+        goto error;
+
+    ut_equals_bool(ut, false, exs_sort(truncated, discard, interface, 4096),
+                   __func__);
+
+    ser_free(truncated);
+    ser_free(discard);
+    ser_free(input);
+    ser_free(output);
+    dar_free(array);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (input)
+        ser_free(input);
+    if (output)
+        ser_free(output);
+    if (array)
+        dar_free(array);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all ExternalSort tests
+Status ExternalSortTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    exs_test_runs(ut);
+    exs_test_stream(ut);
+
+    ut_report(ut, "ExternalSort");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ExternalSort");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file FibonacciHeapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "FibonacciHeap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Removing every element yields them in heap order for both kinds
+void fbh_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    FibonacciHeap_t *max_heap = fbh_new(interface, MaxHeap);
+    FibonacciHeap_t *min_heap = fbh_new(interface, MinHeap);
+
+    if (!interface || !max_heap || !min_heap)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int32_t value = random_int32_t(-500, 500);
+
+        if (!fbh_insert(max_heap, new_int32_t(value), NULL))
+            goto error;
+
+        if (!fbh_insert(min_heap, new_int32_t(value), NULL))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1000, fbh_count(max_heap), __func__);
+
+    void *R;
+    int32_t last = INT32_MAX;
+    bool ordered = true;
+
+    while (!fbh_empty(max_heap))
+    {
+        if (!fbh_remove(max_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R <= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    last = INT32_MIN;
+    ordered = true;
+
+    while (!fbh_empty(min_heap))
+    {
+        if (!fbh_remove(min_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R >= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, false, fbh_remove(min_heap, &R), __func__);
+    ut_equals_bool(ut, true, fbh_peek(min_heap) == NULL, __func__);
+
+    fbh_free(max_heap);
+    fbh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (max_heap)
+        fbh_free(max_heap);
+    if (min_heap)
+        fbh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Changes elements through their handles
+void fbh_test_handles(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    FibonacciHeap_t *heap = fbh_new(interface, MinHeap);
+
+    if (!interface || !heap)
+        goto error;
+
+    FibonacciHeapNode_t *handles[100];
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        if (!fbh_insert(heap, new_int32_t(1000 + i), &handles[i]))
+            goto error;
+    }
+
+    // Removing the root consolidates the tree so handles are not all roots
+    void *R;
+
+    if (!fbh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    // Decrease every odd element below all the others
+    for (int32_t i = 1; i < 100; i += 2)
+    {
+        *(int32_t *)fbh_element(handles[i]) = -i;
+
+        ut_equals_bool(ut, true, fbh_decrease_key(heap, handles[i]),
+                       __func__);
+        ut_equals_int(ut, -i, *(int32_t *)fbh_peek(heap), __func__);
+    }
+
+    // An element that loses priority is removed and inserted again
+    ut_equals_bool(ut, true, fbh_delete(heap, handles[99], &R), __func__);
+    ut_equals_int(ut, -99, *(int32_t *)R, __func__);
+
+    *(int32_t *)R = 5000;
+
+    if (!fbh_insert(heap, R, &handles[99]))
+        goto error;
+
+    ut_equals_int(ut, -97, *(int32_t *)fbh_peek(heap), __func__);
+
+    // Remove elements from the middle of the heap
+    for (int32_t i = 2; i < 100; i += 2)
+    {
+        ut_equals_bool(ut, true, fbh_delete(heap, handles[i], &R), __func__);
+        ut_equals_int(ut, 1000 + i, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    ut_equals_integer_t(ut, 50, fbh_count(heap), __func__);
+
+    int32_t expected = -97;
+
+    for (int i = 0; i < 49; i++, expected += 2)
+    {
+        if (!fbh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    if (!fbh_remove(heap, &R))
+        goto error;
+
+    ut_equals_int(ut, 5000, *(int32_t *)R, __func__);
+    ut_equals_bool(ut, true, fbh_empty(heap), __func__);
+
+    free(R);
+
+    fbh_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        fbh_free(heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Melding moves every element and keeps the handles valid
+void fbh_test_meld(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    FibonacciHeap_t *heap = fbh_new(interface, MaxHeap);
+    FibonacciHeap_t *other = fbh_new(interface, MaxHeap);
+    FibonacciHeap_t *min_heap = fbh_new(interface, MinHeap);
+
+    if (!interface || !heap || !other || !min_heap)
+        goto error;
+
+    FibonacciHeapNode_t *handle = NULL;
+
+    for (int32_t i = 0; i < 50; i++)
+    {
+        if (!fbh_insert(heap, new_int32_t(i * 2), NULL))
+            goto error;
+
+        if (!fbh_insert(other, new_int32_t(i * 2 + 1), i == 0 ? &handle : NULL))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, fbh_meld(heap, min_heap), __func__);
+    ut_equals_bool(ut, false, fbh_meld(heap, heap), __func__);
+    ut_equals_bool(ut, true, fbh_meld(heap, other), __func__);
+    ut_equals_integer_t(ut, 100, fbh_count(heap), __func__);
+    ut_equals_bool(ut, true, fbh_empty(other), __func__);
+
+    // The handle from the other heap now belongs to this one
+    *(int32_t *)fbh_element(handle) = 1000;
+
+    ut_equals_bool(ut, true, fbh_decrease_key(heap, handle), __func__);
+    ut_equals_int(ut, 1000, *(int32_t *)fbh_peek(heap), __func__);
+
+    void *R;
+    int32_t expected = 99;
+
+    if (!fbh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    for (int i = 0; i < 98; i++, expected--)
+    {
+        if (!fbh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    // Melding into an empty heap
+    ut_equals_bool(ut, true, fbh_meld(other, heap), __func__);
+    ut_equals_integer_t(ut, 1, fbh_count(other), __func__);
+    ut_equals_int(ut, 0, *(int32_t *)fbh_peek(other), __func__);
+
+    fbh_erase(other);
+
+    ut_equals_bool(ut, true, fbh_empty(other), __func__);
+
+    fbh_free(heap);
+    fbh_free(other);
+    fbh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        fbh_free(heap);
+    if (other)
+        fbh_free(other);
+    if (min_heap)
+        fbh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all FibonacciHeap tests
+Status FibonacciHeapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    fbh_test_IO(ut);
+    fbh_test_handles(ut);
+    fbh_test_meld(ut);
+
+    ut_report(ut, "FibonacciHeap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "FibonacciHeap");
+    ut_delete(&ut);
+    return st;
+}
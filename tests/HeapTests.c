@@ -127,6 +127,169 @@ void hep_test_IO1(UnitTest ut)
     }
 }
 
+// Checks that a MaxHeap saved to memory can be loaded as a MinHeap
+void hep_test_serialize(UnitTest ut)
+{
+    const int64_t elements = 1000;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    Heap_t *max_heap = hep_new(interface, MaxHeap);
+    Heap_t *min_heap = hep_new(interface, MinHeap);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !max_heap || !min_heap || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        void *element = new_int64_t(random_int64_t(-elements, elements));
+
+        if (!hep_insert(max_heap, element))
+            free(element);
+    }
+
+    ut_equals_bool(ut, true, hep_serialize(max_heap, serial), __func__);
+
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, true, hep_deserialize(min_heap, serial), __func__);
+    ut_equals_integer_t(ut, hep_count(max_heap), hep_count(min_heap), __func__);
+
+    // Loading into a heap that is not empty is refused
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, hep_deserialize(min_heap, serial), __func__);
+
+    bool sorted = true;
+    void *prev = NULL, *elem;
+
+    while (!hep_empty(min_heap))
+    {
+        if (!hep_remove(min_heap, &elem))
+            goto error;
+
+        if (prev)
+        {
+            sorted = sorted && compare_int64_t(prev, elem) <= 0;
+            free(prev);
+        }
+
+        prev = elem;
+    }
+
+    free(prev);
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    ser_free(serial);
+    hep_free(max_heap);
+    hep_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (serial)
+        ser_free(serial);
+    if (max_heap)
+        hep_free(max_heap);
+    if (min_heap)
+        hep_free(min_heap);
+    interface_free(interface);
+}
+
+// Tests that the iterator visits every element without removing them
+void hep_test_iterator(UnitTest ut)
+{
+    char iter_storage[hep_iter_size];
+    HeapIterator_t *iter = (HeapIterator_t*)&iter_storage[0];
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    Heap_t *heap = hep_new(int_interface, MaxHeap);
+
+    if (!int_interface || !heap)
+        goto error;
+
+    ut_equals_bool(ut, hep_iter_init(iter, heap), false, __func__);
+
+    int sum0 = 0, sum1 = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int32_t *elem = new_int32_t(random_int32_t(-1000, 1000));
+        sum0 += *elem;
+
+        if (!hep_insert(heap, elem))
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    if (!hep_iter_init(iter, heap))
+        goto error;
+
+    // The root is visited first
+    ut_equals_bool(ut, hep_iter_peek(iter) == hep_peek(heap), true, __func__);
+
+    int count = 0;
+    void *R;
+
+    do
+    {
+        if (!hep_iter_get(iter, &R))
+            goto error;
+
+        sum1 += *(int32_t*)R;
+        count++;
+    } while (hep_iter_next(iter));
+
+    ut_equals_int(ut, count, 1000, __func__);
+    ut_equals_int(ut, sum0, sum1, __func__);
+
+    sum1 = 0;
+
+    HEP_FOR_EACH(heap, {
+        sum1 += *(int32_t*)var;
+    })
+
+    ut_equals_int(ut, sum0, sum1, __func__);
+    ut_equals_bool(ut, hep_iter_peek_next(iter) == NULL, true, __func__);
+
+    if (!hep_iter_to_start(iter))
+        goto error;
+
+    ut_equals_bool(ut, hep_iter_has_prev(iter), false, __func__);
+
+    // Removing the root invalidates the iterator
+    if (!hep_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    ut_equals_bool(ut, hep_iter_next(iter), false, __func__);
+    ut_equals_bool(ut, hep_iter_peek(iter) == NULL, true, __func__);
+
+    hep_free(heap);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    hep_free(heap);
+    interface_free(int_interface);
+}
+
 // Runs all Heap tests
 Status HeapTests(void)
 {
@@ -139,6 +302,8 @@ Status HeapTests(void)
 
     hep_test_IO0(ut);
     hep_test_IO1(ut);
+    hep_test_serialize(ut);
+    hep_test_iterator(ut);
 
     ut_report(ut, "Heap");
 
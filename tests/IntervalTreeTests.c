@@ -0,0 +1,311 @@
+/**
+ * @file IntervalTreeTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "IntervalTree.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// An interval kept outside of the tree to check its queries
+struct ivt_test_interval
+{
+    int64_t low;
+    int64_t high;
+    bool present;
+};
+
+// Checks that the visited elements overlap the query and come in order
+struct ivt_test_context
+{
+    struct ivt_test_interval *intervals;
+    int64_t low;
+    int64_t high;
+    int64_t last_low;
+    integer_t visited;
+    bool overlapping;
+    bool ordered;
+};
+
+static void ivt_test_visit(void *element, void *context)
+{
+    struct ivt_test_context *ctx = context;
+    struct ivt_test_interval *I = &ctx->intervals[*(int64_t *)element];
+
+    ctx->overlapping = ctx->overlapping && I->present &&
+                       I->low <= ctx->high && ctx->low <= I->high;
+    ctx->ordered = ctx->ordered && I->low >= ctx->last_low;
+    ctx->last_low = I->low;
+    ctx->visited++;
+}
+
+// Only counts the visited elements
+static void ivt_test_tally(void *element, void *context)
+{
+    (void)element;
+
+    (*(integer_t *)context)++;
+}
+
+// Counts the intervals that overlap [low, high] by brute force
+static integer_t ivt_test_count(struct ivt_test_interval *intervals,
+                                integer_t total, int64_t low, int64_t high)
+{
+    integer_t count = 0;
+
+    for (integer_t i = 0; i < total; i++)
+    {
+        if (intervals[i].present && intervals[i].low <= high &&
+            low <= intervals[i].high)
+            count++;
+    }
+
+    return count;
+}
+
+// Queries match a brute force search while intervals come and go
+void ivt_test_overlap(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    IntervalTree_t *tree = ivt_new(interface);
+
+    struct ivt_test_interval intervals[2000];
+
+    if (!interface || !tree)
+        goto error;
+
+    for (int64_t i = 0; i < 2000; i++)
+    {
+        int64_t low = random_int64_t(0, 10000);
+        int64_t high = low + random_int64_t(0, i % 10 == 0 ? 5000 : 100);
+
+        intervals[i] = (struct ivt_test_interval){ low, high, true };
+
+        if (!ivt_insert(tree, low, high, new_int64_t(i)))
+            goto error;
+    }
+
+    // Remove half of them
+    bool removed = true;
+
+    for (int64_t i = 0; i < 2000; i += 2)
+    {
+        void *R;
+
+        removed = removed && ivt_remove(tree, intervals[i].low,
+                                        intervals[i].high, &i, &R);
+        removed = removed && *(int64_t *)R == i;
+        intervals[i].present = false;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, removed, __func__);
+    ut_equals_integer_t(ut, 1000, ivt_size(tree), __func__);
+
+    struct ivt_test_context ctx = { intervals, 0, 0, INT64_MIN, 0, true,
+                                    true };
+
+    bool matching = true;
+
+    for (int q = 0; q < 500; q++)
+    {
+        int64_t low = random_int64_t(-100, 11000);
+        int64_t high = low + random_int64_t(0, q % 2 ? 0 : 500);
+
+        ctx.low = low;
+        ctx.high = high;
+        ctx.last_low = INT64_MIN;
+        ctx.visited = 0;
+
+        integer_t visited = q % 2 ? ivt_stab(tree, low, ivt_test_visit, &ctx)
+                                  : ivt_overlap(tree, low, high,
+                                                ivt_test_visit, &ctx);
+
+        matching = matching && visited == ctx.visited &&
+                   visited == ivt_test_count(intervals, 2000, low, high);
+    }
+
+    ut_equals_bool(ut, true, matching, __func__);
+    ut_equals_bool(ut, true, ctx.overlapping, __func__);
+    ut_equals_bool(ut, true, ctx.ordered, __func__);
+
+    // An inverted interval is neither inserted nor queried
+    ut_equals_bool(ut, false, ivt_insert(tree, 10, 5, NULL), __func__);
+    ut_equals_integer_t(ut, 0, ivt_overlap(tree, 10, 5, ivt_test_visit,
+                                           &ctx), __func__);
+
+    ivt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (tree)
+        ivt_free(tree);
+    interface_free(interface);
+    ut_error();
+}
+
+// Identical intervals are told apart by their elements
+void ivt_test_duplicates(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    IntervalTree_t *tree = ivt_new(interface);
+
+    if (!interface || !tree)
+        goto error;
+
+    for (int64_t i = 0; i < 100; i++)
+    {
+        if (!ivt_insert(tree, 10, 20, new_int64_t(i)))
+            goto error;
+    }
+
+    int64_t element = 42, missing = 100;
+
+    ut_equals_bool(ut, true, ivt_contains(tree, 10, 20, &element), __func__);
+    ut_equals_bool(ut, false, ivt_contains(tree, 10, 21, &element), __func__);
+    ut_equals_bool(ut, false, ivt_contains(tree, 10, 20, &missing), __func__);
+
+    integer_t visited = 0;
+
+    ut_equals_integer_t(ut, 100, ivt_stab(tree, 20, ivt_test_tally, &visited),
+                        __func__);
+    ut_equals_integer_t(ut, 100, visited, __func__);
+    ut_equals_integer_t(ut, 0, ivt_stab(tree, 21, ivt_test_tally, &visited),
+                        __func__);
+
+    void *R;
+
+    if (!ivt_remove(tree, 10, 20, &element, &R))
+        goto error;
+
+    free(R);
+
+    ut_equals_bool(ut, false, ivt_contains(tree, 10, 20, &element), __func__);
+    ut_equals_bool(ut, false, ivt_remove(tree, 10, 20, &element, NULL),
+                   __func__);
+    ut_equals_integer_t(ut, 99, ivt_size(tree), __func__);
+
+    int64_t low, high;
+
+    if (!ivt_insert(tree, -5, 0, new_int64_t(-1)))
+        goto error;
+
+    if (!ivt_insert(tree, 15, 50, new_int64_t(-2)))
+        goto error;
+
+    ut_equals_bool(ut, true, ivt_span(tree, &low, &high), __func__);
+    ut_equals_bool(ut, true, low == -5 && high == 50, __func__);
+
+    ivt_erase(tree);
+
+    ut_equals_bool(ut, true, ivt_empty(tree), __func__);
+    ut_equals_bool(ut, false, ivt_span(tree, &low, &high), __func__);
+
+    ivt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (tree)
+        ivt_free(tree);
+    interface_free(interface);
+    ut_error();
+}
+
+// Results can be collected in a DynamicArray_t
+void ivt_test_array(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    IntervalTree_t *tree = ivt_new(interface);
+    DynamicArray_t *array = dar_new(interface);
+
+    if (!interface || !tree || !array)
+        goto error;
+
+    // [i, i + 9] for every i in [0, 1000)
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!ivt_insert(tree, i, i + 9, new_int64_t(i)))
+            goto error;
+    }
+
+    if (!ivt_overlap_array(tree, 100, 199, array))
+        goto error;
+
+    // Intervals starting from 91 up to 199
+    ut_equals_integer_t(ut, 109, dar_size(array), __func__);
+
+    bool ordered = true;
+
+    for (integer_t i = 0; i < dar_size(array); i++)
+        ordered = ordered && *(int64_t *)dar_get(array, i) == 91 + i;
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    // Results are appended after what the array already has
+    if (!ivt_overlap_array(tree, 2000, 3000, array))
+        goto error;
+
+    if (!ivt_overlap_array(tree, -10, 0, array))
+        goto error;
+
+    ut_equals_integer_t(ut, 110, dar_size(array), __func__);
+    ut_equals_bool(ut, true, *(int64_t *)dar_get(array, 109) == 0, __func__);
+
+    dar_free_shallow(array);
+    ivt_free(tree);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (array)
+        dar_free_shallow(array);
+    if (tree)
+        ivt_free(tree);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all IntervalTree tests
+Status IntervalTreeTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    ivt_test_overlap(ut);
+    ivt_test_duplicates(ut);
+    ivt_test_array(ut);
+
+    ut_report(ut, "IntervalTree");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "IntervalTree");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,237 @@
+/**
+ * @file LRUCacheTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "LRUCache.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Measures a string with its terminator
+static size_t lru_test_size(const void *element)
+{
+    return strlen(element) + 1;
+}
+
+// Checks that the least recently used pairs are the ones evicted
+void lru_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    LRUCache_t *cache = lru_new(interface, interface, 100, LRU_PLAIN);
+
+    if (!interface || !cache)
+        goto error;
+
+    for (int64_t i = 0; i < 200; i++)
+    {
+        if (!lru_put(cache, new_int64_t(i), new_int64_t(-i)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 100, lru_count(cache), __func__);
+    ut_equals_integer_t(ut, 100, lru_evictions(cache), __func__);
+
+    int64_t key = 99;
+
+    ut_equals_bool(ut, true, lru_get(cache, &key) == NULL, __func__);
+
+    key = 100;
+
+    int64_t *value = lru_get(cache, &key);
+
+    ut_equals_bool(ut, true, value && *value == -100, __func__);
+
+    // 100 was used so 101 is now the least recently used
+    if (!lru_put(cache, new_int64_t(200), new_int64_t(-200)))
+        goto error;
+
+    ut_equals_bool(ut, true, lru_contains_key(cache, &key), __func__);
+
+    key = 101;
+
+    ut_equals_bool(ut, false, lru_contains_key(cache, &key), __func__);
+    ut_equals_integer_t(ut, 1, lru_hits(cache), __func__);
+    ut_equals_integer_t(ut, 1, lru_misses(cache), __func__);
+
+    // Putting an existing key replaces its value
+    if (!lru_put(cache, new_int64_t(150), new_int64_t(0)))
+        goto error;
+
+    key = 150;
+
+    ut_equals_bool(ut, true, *(int64_t *)lru_peek(cache, &key) == 0,
+                   __func__);
+    ut_equals_integer_t(ut, 100, lru_count(cache), __func__);
+
+    void *R;
+
+    ut_equals_bool(ut, true, lru_remove(cache, &key, &R), __func__);
+    ut_equals_bool(ut, true, *(int64_t *)R == 0, __func__);
+    ut_equals_bool(ut, false, lru_pop(cache, &key), __func__);
+
+    free(R);
+
+    // Shrinking evicts the least recently used pairs
+    ut_equals_bool(ut, true, lru_set_capacity(cache, 10), __func__);
+    ut_equals_integer_t(ut, 10, lru_count(cache), __func__);
+
+    key = 200;
+
+    ut_equals_bool(ut, true, lru_contains_key(cache, &key), __func__);
+
+    lru_erase(cache);
+
+    ut_equals_bool(ut, true, lru_empty(cache), __func__);
+    ut_equals_integer_t(ut, 0, lru_weight(cache), __func__);
+
+    lru_free(cache);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (cache)
+        lru_free(cache);
+    interface_free(interface);
+    ut_error();
+}
+
+// A cache with a budget of bytes
+void lru_test_bytes(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+
+    if (!interface)
+        goto error;
+
+    interface_size(interface, lru_test_size);
+
+    LRUCache_t *cache = lru_new(interface, interface, 64, LRU_PLAIN);
+
+    if (!cache)
+        goto error;
+
+    // Each pair takes 16 bytes
+    char key[8];
+
+    for (int i = 0; i < 10; i++)
+    {
+        snprintf(key, sizeof(key), "key_%03d", i);
+
+        if (!lru_put(cache, new_string(key), new_string(key)))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 4, lru_count(cache), __func__);
+    ut_equals_integer_t(ut, 64, lru_weight(cache), __func__);
+    ut_equals_bool(ut, true, lru_contains_key(cache, "key_006"), __func__);
+    ut_equals_bool(ut, false, lru_contains_key(cache, "key_005"), __func__);
+
+    // A pair larger than the whole cache is not taken
+    char *big = random_string(80, 80, true);
+    char *small = new_string("x");
+
+    ut_equals_bool(ut, false, lru_put(cache, big, small), __func__);
+    ut_equals_integer_t(ut, 4, lru_count(cache), __func__);
+
+    free(big);
+    free(small);
+
+    lru_free(cache);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    interface_free(interface);
+    ut_error();
+}
+
+// A scan over keys that are used only once flushes a plain cache but not a
+// segmented one
+void lru_test_segmented(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    if (!interface)
+        goto error;
+
+    LRUPolicy policies[2] = { LRU_PLAIN, LRU_SEGMENTED };
+    integer_t kept[2];
+
+    for (int p = 0; p < 2; p++)
+    {
+        LRUCache_t *cache = lru_new(interface, interface, 100, policies[p]);
+
+        if (!cache)
+            goto error;
+
+        // A hot set used twice
+        for (int64_t i = 0; i < 50; i++)
+            lru_put(cache, new_int64_t(i), new_int64_t(i));
+
+        for (int64_t i = 0; i < 50; i++)
+            lru_get(cache, &i);
+
+        for (int64_t i = 1000; i < 2000; i++)
+            lru_put(cache, new_int64_t(i), new_int64_t(i));
+
+        kept[p] = 0;
+
+        for (int64_t i = 0; i < 50; i++)
+            kept[p] += lru_contains_key(cache, &i) ? 1 : 0;
+
+        ut_equals_integer_t(ut, 100, lru_count(cache), __func__);
+        ut_equals_integer_t(ut, 50, lru_hits(cache), __func__);
+
+        lru_free(cache);
+    }
+
+    ut_equals_integer_t(ut, 0, kept[0], __func__);
+    ut_equals_integer_t(ut, 50, kept[1], __func__);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all LRUCache tests
+Status LRUCacheTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    lru_test_IO(ut);
+    lru_test_bytes(ut);
+    lru_test_segmented(ut);
+
+    ut_report(ut, "LRUCache");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "LRUCache");
+    ut_delete(&ut);
+    return st;
+}
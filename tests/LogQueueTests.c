@@ -0,0 +1,235 @@
+/**
+ * @file LogQueueTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "LogQueue.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Deletes a log directory and everything in it
+static void lgq_test_remove(const char *directory)
+{
+    DIR *handle = opendir(directory);
+
+    if (!handle)
+        return;
+
+    char path[512];
+    struct dirent *entry;
+
+    while ((entry = readdir(handle)) != NULL)
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+
+        snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+        unlink(path);
+    }
+
+    closedir(handle);
+    rmdir(directory);
+}
+
+// Checks the FIFO order across the memory window, segments and a restart
+void lgq_test_restart(UnitTest ut)
+{
+    const int64_t elements = 20000;
+
+    char directory[] = "/tmp/lgq_testXXXXXX";
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface || !mkdtemp(directory))
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    // A small window and small segments so both are exercised
+    LogQueue_t *queue = lgq_create(directory, interface, 64, 4096, 500);
+
+    if (!queue)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+        lgq_enqueue(queue, new_int64_t(i));
+
+    ut_equals_integer_t(ut, elements, lgq_count(queue), __func__);
+    ut_equals_bool(ut, true, lgq_segments(queue) > 1, __func__);
+
+    bool in_order = true;
+    void *R;
+
+    for (int64_t i = 0; i < elements / 2; i++)
+    {
+        if (!lgq_dequeue(queue, &R))
+            goto error;
+
+        in_order = in_order && *(int64_t *)R == i;
+
+        free(R);
+    }
+
+    integer_t segments = lgq_segments(queue);
+
+    ut_equals_bool(ut, true, lgq_close(queue), __func__);
+
+    queue = lgq_create(directory, interface, 64, 4096, 500);
+
+    if (!queue)
+        goto error;
+
+    ut_equals_integer_t(ut, elements / 2, lgq_count(queue), __func__);
+
+    // Segments that were all dequeued are deleted
+    ut_equals_bool(ut, true, lgq_segments(queue) <= segments, __func__);
+
+    for (int64_t i = elements / 2; i < elements; i++)
+    {
+        if (!lgq_dequeue(queue, &R))
+            goto error;
+
+        in_order = in_order && *(int64_t *)R == i;
+
+        free(R);
+
+        // Keep appending while reading
+        if (i % 4 == 0)
+            lgq_enqueue(queue, new_int64_t(elements + i / 4));
+    }
+
+    ut_equals_bool(ut, true, in_order, __func__);
+    ut_equals_integer_t(ut, elements / 8, lgq_count(queue), __func__);
+
+    ut_equals_bool(ut, true, lgq_dequeue(queue, &R), __func__);
+    ut_equals_bool(ut, true, R && *(int64_t *)R == elements + elements / 8,
+                   __func__);
+
+    free(R);
+
+    ut_equals_bool(ut, false, lgq_failed(queue), __func__);
+    ut_equals_bool(ut, true, lgq_close(queue), __func__);
+
+    lgq_test_remove(directory);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    lgq_test_remove(directory);
+    interface_free(interface);
+    ut_error();
+}
+
+// Checks that a record cut by a crash is dropped when the log is opened
+void lgq_test_torn(UnitTest ut)
+{
+    char directory[] = "/tmp/lgq_testXXXXXX";
+    char path[64];
+
+    Interface_t *interface = interface_new(compare_string, copy_string,
+                                           display_string, free, NULL, NULL);
+
+    if (!interface || !mkdtemp(directory))
+        goto error;
+
+    interface_codec(interface, serialize_string, deserialize_string);
+
+    LogQueue_t *queue = lgq_create(directory, interface, 16, 1 << 20, 0);
+
+    if (!queue)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+        lgq_enqueue(queue, new_string("element"));
+
+    lgq_close(queue);
+
+    // Half of a record: its size, its checksum and only some of its bytes
+    snprintf(path, sizeof(path), "%s/%020d.log", directory, 0);
+
+    int fd = open(path, O_WRONLY | O_APPEND);
+
+    if (fd < 0)
+        goto error;
+
+    unsigned char torn[12] = { 7, 0, 0, 0, 1, 2, 3, 4, 'e', 'l', 'e', 'm' };
+
+    bool written = write(fd, torn, sizeof(torn)) == sizeof(torn);
+
+    close(fd);
+
+    if (!written)
+        goto error;
+
+    queue = lgq_create(directory, interface, 16, 1 << 20, 0);
+
+    if (!queue)
+        goto error;
+
+    ut_equals_integer_t(ut, 10, lgq_count(queue), __func__);
+
+    // New records go right after the last complete one
+    lgq_enqueue(queue, new_string("last"));
+
+    void *R = NULL;
+
+    for (int i = 0; i < 11; i++)
+    {
+        free(R);
+
+        if (!lgq_dequeue(queue, &R))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, strcmp(R, "last") == 0, __func__);
+    ut_equals_bool(ut, true, lgq_empty(queue), __func__);
+
+    free(R);
+
+    lgq_close(queue);
+    lgq_test_remove(directory);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    lgq_test_remove(directory);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all LogQueue tests
+Status LogQueueTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    lgq_test_restart(ut);
+    lgq_test_torn(ut);
+
+    ut_report(ut, "LogQueue");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "LogQueue");
+    ut_delete(&ut);
+    return st;
+}
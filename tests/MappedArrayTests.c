@@ -0,0 +1,208 @@
+/**
+ * @file MappedArrayTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "MappedArray.h"
+#include "UnitTest.h"
+#include "Utility.h"
+#include <unistd.h>
+
+// Writes a table of keys to a new temporary file and stores its path
+static bool mar_test_table(char *path, const void *data, size_t size)
+{
+    strcpy(path, "/tmp/mar_testXXXXXX");
+
+    int fd = mkstemp(path);
+
+    if (fd < 0)
+        return false;
+
+    bool written = write(fd, data, size) == (ssize_t)size;
+
+    close(fd);
+
+    return written;
+}
+
+// Checks the binary searches over a sorted table of int64_t with duplicates
+void mar_test_search(UnitTest ut)
+{
+    const int64_t elements = 10000;
+
+    char path[32] = "";
+    MappedArray_t *array = NULL;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    // Only even keys, each one twice
+    int64_t *keys = malloc(sizeof(int64_t) * (size_t)elements);
+
+    if (!interface || !keys)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+        keys[i] = (i / 2) * 2;
+
+    if (!mar_test_table(path, keys, sizeof(int64_t) * (size_t)elements))
+        goto error;
+
+    array = mar_open(path, sizeof(int64_t), interface);
+
+    if (!array)
+        goto error;
+
+    ut_equals_integer_t(ut, elements, mar_count(array), __func__);
+    ut_equals_bool(ut, true, mar_advise(array, MAR_SEQUENTIAL), __func__);
+    ut_equals_bool(ut, true, mar_sorted(array), __func__);
+    ut_equals_bool(ut, true, mar_advise(array, MAR_RANDOM), __func__);
+
+    bool found = true, missing = true;
+
+    for (int64_t key = 0; key < elements; key += 2)
+    {
+        int64_t odd = key + 1;
+
+        found = found && mar_contains(array, &key) &&
+                mar_index_first(array, &key) == key &&
+                mar_index_last(array, &key) == key + 1;
+
+        missing = missing && !mar_contains(array, &odd) &&
+                  mar_lower_bound(array, &odd) == key + 2;
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_bool(ut, true, missing, __func__);
+
+    int64_t below = -5, above = elements * 2;
+
+    ut_equals_integer_t(ut, 0, mar_lower_bound(array, &below), __func__);
+    ut_equals_integer_t(ut, elements, mar_lower_bound(array, &above),
+                        __func__);
+    ut_equals_integer_t(ut, -1, mar_index_last(array, &below), __func__);
+    ut_equals_integer_t(ut, -1, mar_index_first(array, &above), __func__);
+
+    // Records are used in place
+    ut_equals_bool(ut, true, mar_get(array, 10) ==
+                   (const char *)mar_data(array) + 10 * sizeof(int64_t),
+                   __func__);
+    ut_equals_bool(ut, true, mar_get(array, elements) == NULL, __func__);
+
+    ut_equals_bool(ut, true, mar_close(array), __func__);
+
+    unlink(path);
+    free(keys);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (array)
+        mar_close(array);
+    if (path[0])
+        unlink(path);
+    free(keys);
+    interface_free(interface);
+    ut_error();
+}
+
+// Checks empty files, unsorted files and files with a partial record
+void mar_test_files(UnitTest ut)
+{
+    char path[32] = "";
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        goto error;
+
+    int64_t keys[4] = { 3, 1, 2, 0 };
+
+    if (!mar_test_table(path, keys, 0))
+        goto error;
+
+    MappedArray_t *array = mar_open(path, sizeof(int64_t), interface);
+
+    ut_equals_bool(ut, true, array != NULL, __func__);
+
+    if (array)
+    {
+        ut_equals_bool(ut, true, mar_empty(array), __func__);
+        ut_equals_integer_t(ut, 0, mar_lower_bound(array, &keys[0]), __func__);
+        ut_equals_bool(ut, false, mar_contains(array, &keys[0]), __func__);
+
+        mar_close(array);
+    }
+
+    unlink(path);
+
+    if (!mar_test_table(path, keys, sizeof(keys)))
+        goto error;
+
+    array = mar_open(path, sizeof(int64_t), interface);
+
+    ut_equals_bool(ut, true, array != NULL, __func__);
+
+    if (array)
+    {
+        ut_equals_bool(ut, false, mar_sorted(array), __func__);
+
+        mar_close(array);
+    }
+
+    unlink(path);
+
+    if (!mar_test_table(path, keys, sizeof(keys) - 1))
+        goto error;
+
+    ut_equals_bool(ut, true, mar_open(path, sizeof(int64_t), interface) == NULL,
+                   __func__);
+
+    unlink(path);
+
+    ut_equals_bool(ut, true, mar_open(path, sizeof(int64_t), interface) == NULL,
+                   __func__);
+
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (path[0])
+        unlink(path);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all MappedArray tests
+Status MappedArrayTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    mar_test_search(ut);
+    mar_test_files(ut);
+
+    ut_report(ut, "MappedArray");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "MappedArray");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file NodePoolTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "NodePool.h"
+#include "UnitTest.h"
+
+// Released nodes are reused before new ones are carved from a block
+void npl_test_reuse(UnitTest ut)
+{
+    NodePool_t *pool = npl_new(sizeof(int64_t) * 3);
+
+    if (!pool)
+        goto error;
+
+    int64_t *nodes[1000];
+
+    for (int i = 0; i < 1000; i++)
+    {
+        nodes[i] = npl_alloc(pool);
+
+        if (!nodes[i])
+            goto error;
+
+        nodes[i][0] = i;
+        nodes[i][2] = -i;
+    }
+
+    ut_equals_integer_t(ut, 1000, npl_in_use(pool), __func__);
+
+    bool intact = true;
+
+    for (int i = 0; i < 1000; i++)
+        intact = intact && nodes[i][0] == i && nodes[i][2] == -i;
+
+    ut_equals_bool(ut, true, intact, __func__);
+
+    npl_release(pool, nodes[10]);
+    npl_release(pool, nodes[20]);
+
+    ut_equals_integer_t(ut, 998, npl_in_use(pool), __func__);
+    ut_equals_bool(ut, true, npl_alloc(pool) == nodes[20], __func__);
+    ut_equals_bool(ut, true, npl_alloc(pool) == nodes[10], __func__);
+
+    npl_clear(pool);
+
+    ut_equals_integer_t(ut, 0, npl_in_use(pool), __func__);
+    ut_equals_bool(ut, true, npl_alloc(pool) != NULL, __func__);
+
+    npl_free(pool);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (pool)
+        npl_free(pool);
+    ut_error();
+}
+
+// Merging moves the free nodes of the other pool too
+void npl_test_merge(UnitTest ut)
+{
+    NodePool_t *pool = npl_new(sizeof(void *));
+    NodePool_t *other = npl_new(sizeof(void *));
+
+    if (!pool || !other)
+        goto error;
+
+    void *mine = npl_alloc(pool);
+    void *theirs[2] = { npl_alloc(other), npl_alloc(other) };
+
+    if (!mine || !theirs[0] || !theirs[1])
+        goto error;
+
+    npl_release(pool, mine);
+    npl_release(other, theirs[0]);
+
+    npl_merge(pool, other);
+
+    ut_equals_integer_t(ut, 1, npl_in_use(pool), __func__);
+    ut_equals_integer_t(ut, 0, npl_in_use(other), __func__);
+
+    // Nodes from the other pool are now released to this one
+    npl_release(pool, theirs[1]);
+
+    void *first = npl_alloc(pool);
+    void *second = npl_alloc(pool);
+    void *third = npl_alloc(pool);
+
+    ut_equals_bool(ut, true, first == theirs[1], __func__);
+    ut_equals_bool(ut, true, second == mine, __func__);
+    ut_equals_bool(ut, true, third == theirs[0], __func__);
+
+    npl_free(pool);
+    npl_free(other);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (pool)
+        npl_free(pool);
+    if (other)
+        npl_free(other);
+    ut_error();
+}
+
+// Runs all NodePool tests
+Status NodePoolTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    npl_test_reuse(ut);
+    npl_test_merge(ut);
+
+    ut_report(ut, "NodePool");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "NodePool");
+    ut_delete(&ut);
+    return st;
+}
@@ -0,0 +1,283 @@
+/**
+ * @file PairingHeapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "PairingHeap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Removing every element yields them in heap order for both kinds
+void pqh_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    PairingHeap_t *max_heap = pqh_new(interface, MaxHeap);
+    PairingHeap_t *min_heap = pqh_new(interface, MinHeap);
+
+    if (!interface || !max_heap || !min_heap)
+        goto error;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int32_t value = random_int32_t(-500, 500);
+
+        if (!pqh_insert(max_heap, new_int32_t(value), NULL))
+            goto error;
+
+        if (!pqh_insert(min_heap, new_int32_t(value), NULL))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1000, pqh_count(max_heap), __func__);
+
+    void *R;
+    int32_t last = INT32_MAX;
+    bool ordered = true;
+
+    while (!pqh_empty(max_heap))
+    {
+        if (!pqh_remove(max_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R <= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    last = INT32_MIN;
+    ordered = true;
+
+    while (!pqh_empty(min_heap))
+    {
+        if (!pqh_remove(min_heap, &R))
+            goto error;
+
+        ordered = ordered && *(int32_t *)R >= last;
+        last = *(int32_t *)R;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, false, pqh_remove(min_heap, &R), __func__);
+    ut_equals_bool(ut, true, pqh_peek(min_heap) == NULL, __func__);
+
+    pqh_free(max_heap);
+    pqh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (max_heap)
+        pqh_free(max_heap);
+    if (min_heap)
+        pqh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Changes elements through their handles
+void pqh_test_handles(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    PairingHeap_t *heap = pqh_new(interface, MinHeap);
+
+    if (!interface || !heap)
+        goto error;
+
+    PairingHeapNode_t *handles[100];
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        if (!pqh_insert(heap, new_int32_t(1000 + i), &handles[i]))
+            goto error;
+    }
+
+    // Removing the root consolidates the tree so handles are not all roots
+    void *R;
+
+    if (!pqh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    // Decrease every odd element below all the others
+    for (int32_t i = 1; i < 100; i += 2)
+    {
+        *(int32_t *)pqh_element(handles[i]) = -i;
+
+        ut_equals_bool(ut, true, pqh_decrease_key(heap, handles[i]),
+                       __func__);
+        ut_equals_int(ut, -i, *(int32_t *)pqh_peek(heap), __func__);
+    }
+
+    // Increase an element so it has to move down
+    *(int32_t *)pqh_element(handles[99]) = 5000;
+
+    ut_equals_bool(ut, true, pqh_update(heap, handles[99]), __func__);
+    ut_equals_int(ut, -97, *(int32_t *)pqh_peek(heap), __func__);
+
+    // Remove elements from the middle of the heap
+    for (int32_t i = 2; i < 100; i += 2)
+    {
+        ut_equals_bool(ut, true, pqh_delete(heap, handles[i], &R), __func__);
+        ut_equals_int(ut, 1000 + i, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    ut_equals_integer_t(ut, 50, pqh_count(heap), __func__);
+
+    int32_t expected = -97;
+
+    for (int i = 0; i < 49; i++, expected += 2)
+    {
+        if (!pqh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    if (!pqh_remove(heap, &R))
+        goto error;
+
+    ut_equals_int(ut, 5000, *(int32_t *)R, __func__);
+    ut_equals_bool(ut, true, pqh_empty(heap), __func__);
+
+    free(R);
+
+    pqh_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        pqh_free(heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Melding moves every element and keeps the handles valid
+void pqh_test_meld(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, NULL);
+
+    PairingHeap_t *heap = pqh_new(interface, MaxHeap);
+    PairingHeap_t *other = pqh_new(interface, MaxHeap);
+    PairingHeap_t *min_heap = pqh_new(interface, MinHeap);
+
+    if (!interface || !heap || !other || !min_heap)
+        goto error;
+
+    PairingHeapNode_t *handle = NULL;
+
+    for (int32_t i = 0; i < 50; i++)
+    {
+        if (!pqh_insert(heap, new_int32_t(i * 2), NULL))
+            goto error;
+
+        if (!pqh_insert(other, new_int32_t(i * 2 + 1), i == 0 ? &handle : NULL))
+            goto error;
+    }
+
+    ut_equals_bool(ut, false, pqh_meld(heap, min_heap), __func__);
+    ut_equals_bool(ut, false, pqh_meld(heap, heap), __func__);
+    ut_equals_bool(ut, true, pqh_meld(heap, other), __func__);
+    ut_equals_integer_t(ut, 100, pqh_count(heap), __func__);
+    ut_equals_bool(ut, true, pqh_empty(other), __func__);
+
+    // The handle from the other heap now belongs to this one
+    *(int32_t *)pqh_element(handle) = 1000;
+
+    ut_equals_bool(ut, true, pqh_decrease_key(heap, handle), __func__);
+    ut_equals_int(ut, 1000, *(int32_t *)pqh_peek(heap), __func__);
+
+    void *R;
+    int32_t expected = 99;
+
+    if (!pqh_remove(heap, &R))
+        goto error;
+
+    free(R);
+
+    for (int i = 0; i < 98; i++, expected--)
+    {
+        if (!pqh_remove(heap, &R))
+            goto error;
+
+        ut_equals_int(ut, expected, *(int32_t *)R, __func__);
+
+        free(R);
+    }
+
+    // Melding into an empty heap
+    ut_equals_bool(ut, true, pqh_meld(other, heap), __func__);
+    ut_equals_integer_t(ut, 1, pqh_count(other), __func__);
+    ut_equals_int(ut, 0, *(int32_t *)pqh_peek(other), __func__);
+
+    pqh_erase(other);
+
+    ut_equals_bool(ut, true, pqh_empty(other), __func__);
+
+    pqh_free(heap);
+    pqh_free(other);
+    pqh_free(min_heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        pqh_free(heap);
+    if (other)
+        pqh_free(other);
+    if (min_heap)
+        pqh_free(min_heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all PairingHeap tests
+Status PairingHeapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    pqh_test_IO(ut);
+    pqh_test_handles(ut);
+    pqh_test_meld(ut);
+
+    ut_report(ut, "PairingHeap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "PairingHeap");
+    ut_delete(&ut);
+    return st;
+}
@@ -165,6 +165,166 @@ void pli_test_limit(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Tests that the iterator visits the elements in order of priority
+void pli_test_iterator(UnitTest ut)
+{
+    char iter_storage[pli_iter_size];
+    PriorityListIterator_t *iter = (PriorityListIterator_t*)&iter_storage[0];
+
+    Interface_t *int_interface = interface_new(compare_int32_t, copy_int32_t,
+            display_int32_t, free, NULL, compare_int32_t);
+
+    PriorityList_t *plist = pli_new(int_interface);
+
+    if (!int_interface || !plist)
+        goto error;
+
+    ut_equals_bool(ut, pli_iter_init(iter, plist), false, __func__);
+
+    for (int i = 0; i < 100; i++)
+    {
+        int32_t *elem = new_int32_t(random_int32_t(0, 200));
+
+        if (!pli_insert(plist, elem))
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    if (!pli_iter_init(iter, plist))
+        goto error;
+
+    bool sorted = true;
+    int count = 1;
+    void *R;
+
+    ut_equals_bool(ut, pli_iter_peek(iter) == pli_peek(plist), true, __func__);
+
+    while (pli_iter_has_next(iter))
+    {
+        int32_t *next = pli_iter_peek_next(iter);
+
+        if (!pli_iter_get(iter, &R) || !pli_iter_next(iter))
+            goto error;
+
+        sorted = sorted && int_interface->priority(R, next) >= 0;
+        count++;
+    }
+
+    ut_equals_bool(ut, sorted, true, __func__);
+    ut_equals_int(ut, count, 100, __func__);
+
+    if (!pli_remove(plist, &R))
+        goto error;
+
+    free(R);
+
+    ut_equals_bool(ut, pli_iter_to_front(iter), false, __func__);
+
+    pli_iter_retarget(iter, plist);
+
+    ut_equals_bool(ut, pli_iter_peek(iter) == pli_peek(plist), true, __func__);
+
+    pli_free(plist);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    pli_free(plist);
+    interface_free(int_interface);
+}
+
+static bool pli_test_load(void *target, Serial_t *serial)
+{
+    return pli_deserialize(target, serial);
+}
+
+static bool pli_test_empty(void *target)
+{
+    return pli_empty(target);
+}
+
+// Saves a priority list and loads it back without comparing priorities,
+// after checking that a cut stream and a newer version are both refused
+void pli_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL,
+                                           compare_int64_t);
+
+    PriorityList_t *plist = pli_new(interface);
+    PriorityList_t *loaded = pli_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !plist || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 500; i++)
+    {
+        if (!pli_insert(plist, new_int64_t(random_int64_t(-100, 100))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, pli_serialize(plist, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, pli_test_load, pli_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, pli_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, pli_count(plist), pli_count(loaded), __func__);
+    ut_equals_int(ut, 0, pli_compare(plist, loaded), __func__);
+
+    // New elements still find their place by priority
+    if (!pli_insert(loaded, new_int64_t(0)))
+        goto error;
+
+    bool ordered = true;
+    void *prev = NULL, *curr;
+
+    while (!pli_empty(loaded))
+    {
+        if (!pli_remove(loaded, &curr))
+            goto error;
+
+        if (prev)
+        {
+            ordered = ordered && compare_int64_t(prev, curr) >= 0;
+            free(prev);
+        }
+
+        prev = curr;
+    }
+
+    free(prev);
+
+    ut_equals_bool(ut, true, ordered, __func__);
+
+    ser_free(serial);
+    pli_free(plist);
+    pli_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (serial)
+        ser_free(serial);
+    if (plist)
+        pli_free(plist);
+    if (loaded)
+        pli_free(loaded);
+    interface_free(interface);
+}
+
 // Runs all PriorityList tests
 Status PriorityListTests(void)
 {
@@ -177,6 +337,8 @@ Status PriorityListTests(void)
 
     pli_test_IO0(ut);
     pli_test_limit(ut);
+    pli_test_iterator(ut);
+    pli_test_serialize(ut);
 
     ut_report(ut, "PriorityList");
 
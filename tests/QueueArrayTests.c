@@ -269,6 +269,180 @@ void qar_test_growth(UnitTest ut)
     interface_free(int_interface);
 }
 
+// Tests the iterator on a queue that wraps around its buffer
+void qar_test_iterator(UnitTest ut)
+{
+    char iter_storage[qar_iter_size];
+    QueueArrayIterator_t *iter = (QueueArrayIterator_t*)&iter_storage[0];
+
+    Interface int_interface = interface_new(compare_int32_t, copy_int32_t,
+                                            display_int32_t, free, NULL, NULL);
+
+    if (!int_interface)
+        goto error;
+
+    QueueArray_t *queue = qar_create(int_interface, 8, 200);
+
+    if (!queue)
+        goto error;
+
+    ut_equals_bool(ut, qar_iter_init(iter, queue), false, __func__);
+
+    void *R;
+
+    // Moves the front forward so the elements wrap around the buffer
+    for (int i = 0; i < 12; i++)
+    {
+        if (!qar_enqueue(queue, new_int32_t(i)))
+            goto error;
+
+        if (i % 2 == 0)
+        {
+            if (!qar_dequeue(queue, &R))
+                goto error;
+
+            free(R);
+        }
+    }
+
+    if (!qar_iter_init(iter, queue))
+        goto error;
+
+    bool same = true;
+    int32_t expected = 6;
+
+    do
+    {
+        same = same && *(int32_t*)qar_iter_peek(iter) == expected++;
+    } while (qar_iter_next(iter));
+
+    ut_equals_int(ut, expected, 12, __func__);
+
+    if (!qar_iter_to_rear(iter))
+        goto error;
+
+    do
+    {
+        same = same && *(int32_t*)qar_iter_peek(iter) == --expected;
+    } while (qar_iter_prev(iter));
+
+    ut_equals_int(ut, expected, 6, __func__);
+    ut_equals_bool(ut, same, true, __func__);
+
+    if (!qar_iter_set(iter, new_int32_t(60)))
+        goto error;
+
+    ut_equals_int(ut, *(int32_t*)qar_peek_front(queue), 60, __func__);
+    ut_equals_int(ut, *(int32_t*)qar_iter_peek_next(iter), 7, __func__);
+    ut_equals_bool(ut, qar_iter_peek_prev(iter) == NULL, true, __func__);
+
+    if (!qar_enqueue(queue, new_int32_t(12)))
+        goto error;
+
+    ut_equals_bool(ut, qar_iter_next(iter), false, __func__);
+    ut_equals_bool(ut, qar_iter_get(iter, &R), false, __func__);
+
+    qar_free(queue);
+    interface_free(int_interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    qar_free(queue);
+    interface_free(int_interface);
+}
+
+static bool qar_test_load(void *target, Serial_t *serial)
+{
+    return qar_deserialize(target, serial);
+}
+
+static bool qar_test_empty(void *target)
+{
+    return qar_empty(target);
+}
+
+// Saves a queue that wraps around its buffer and loads it back, after
+// checking that a cut stream and a newer version are both refused
+void qar_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    QueueArray_t *queue = qar_new(interface);
+    QueueArray_t *loaded = qar_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !queue || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!qar_enqueue(queue, new_int64_t(i)))
+            goto error;
+    }
+
+    // Moves the front away from the start of the buffer
+    for (int64_t i = 0; i < 300; i++)
+    {
+        void *element;
+
+        if (!qar_dequeue(queue, &element))
+            goto error;
+
+        free(element);
+
+        if (!qar_enqueue(queue, new_int64_t(1000 + i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, qar_serialize(queue, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, qar_test_load, qar_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, qar_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, qar_count(queue), qar_count(loaded), __func__);
+    ut_equals_int(ut, 0, qar_compare(queue, loaded), __func__);
+
+    // A locked queue that is too small is left empty
+    QueueArray_t *small = qar_create(interface, 16, 200);
+
+    if (!small)
+        goto error;
+
+    qar_capacity_lock(small);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, qar_deserialize(small, serial), __func__);
+    ut_equals_bool(ut, true, qar_empty(small), __func__);
+
+    qar_free(small);
+
+    ser_free(serial);
+    qar_free(queue);
+    qar_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (queue)
+        qar_free(queue);
+    if (loaded)
+        qar_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all QueueArray tests
 Status QueueArrayTests(void)
 {
@@ -283,6 +457,8 @@ Status QueueArrayTests(void)
     qar_test_locked(ut);
     qar_test_intensive(ut);
     qar_test_growth(ut);
+    qar_test_iterator(ut);
+    qar_test_serialize(ut);
 
     ut_report(ut, "QueueArray");
 
@@ -94,7 +94,179 @@ void qli_test_foreach(UnitTest ut)
 
     ut_equals_int(ut, 250500, sum, __func__);
 
+    sum = 0;
+
+    // continue moves on to the next element
+    QLI_FOR_EACH(queue, {
+            int32_t i = *(int*)var;
+            if (i % 2 != 0)
+                continue;
+            sum += i;
+    })
+
+    ut_equals_int(ut, 250500, sum, __func__);
+
     qli_erase(queue);
+
+    // Nothing to visit in an empty queue
+    integer_t visited = 0;
+
+    QLI_FOR_EACH(queue, {
+            visited++;
+    })
+
+    ut_equals_integer_t(ut, 0, visited, __func__);
+}
+
+// Tests moving ranges of nodes between queues
+void qli_test_splice(UnitTest ut)
+{
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    QLI_DECL(src)
+    QLI_DECL(dst)
+    qli_init(src, &int_interface);
+    qli_init(dst, &int_interface);
+
+    for (int i = 0; i < 10; i++)
+    {
+        if (!qli_enqueue(src, new_int32_t(i)))
+            goto error;
+    }
+
+    for (int i = 100; i < 105; i++)
+    {
+        if (!qli_enqueue(dst, new_int32_t(i)))
+            goto error;
+    }
+
+    ut_equals_bool(ut, qli_splice(dst, 0, dst, 0, 1), false, __func__);
+    ut_equals_bool(ut, qli_splice(dst, 0, src, 3, 10), false, __func__);
+    ut_equals_bool(ut, qli_splice(dst, 6, src, 3, 6), false, __func__);
+
+    // Middle to middle, then the remaining rear of src to dst's rear and
+    // finally everything left in src to dst's front
+    ut_equals_bool(ut, qli_splice(dst, 2, src, 3, 6), true, __func__);
+    ut_equals_bool(ut, qli_splice(dst, 9, src, 4, 5), true, __func__);
+    ut_equals_bool(ut, qli_splice(dst, 0, src, 0, 3), true, __func__);
+
+    ut_equals_integer_t(ut, qli_count(src), 0, __func__);
+    ut_equals_integer_t(ut, qli_count(dst), 15, __func__);
+
+    // The rear must have been kept in place
+    if (!qli_enqueue(dst, new_int32_t(200)))
+        goto error;
+
+    // And the emptied queue must still be usable
+    if (!qli_enqueue(src, new_int32_t(300)) || !qli_append(src, dst))
+        goto error;
+
+    int32_t expected[] = { 300, 0, 1, 2, 7, 100, 101, 3, 4, 5, 6, 102, 103,
+                           104, 8, 9, 200 };
+
+    bool same = true;
+    void *R;
+
+    for (int i = 0; i < 17; i++)
+    {
+        if (!qli_dequeue(src, &R))
+            goto error;
+
+        same = same && *(int32_t*)R == expected[i];
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_bool(ut, qli_empty(src), true, __func__);
+    ut_equals_bool(ut, qli_empty(dst), true, __func__);
+
+    qli_erase(src);
+    qli_erase(dst);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    qli_erase(src);
+    qli_erase(dst);
+}
+
+static bool qli_test_load(void *target, Serial_t *serial)
+{
+    return qli_deserialize(target, serial);
+}
+
+static bool qli_test_empty(void *target)
+{
+    return qli_empty(target);
+}
+
+// Saves a queue and loads it back with the same front, after checking
+// that a cut stream and a newer version are both refused
+void qli_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    QueueList_t *queue = qli_new(interface);
+    QueueList_t *loaded = qli_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !queue || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!qli_enqueue(queue, new_int64_t(random_int64_t(-1000, 1000))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, qli_serialize(queue, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, qli_test_load, qli_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, qli_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, qli_count(queue), qli_count(loaded), __func__);
+    ut_equals_int(ut, 0, qli_compare(queue, loaded), __func__);
+
+    // The elements have to fit in the limit of the loaded queue
+    QueueList_t *limited = qli_new(interface);
+
+    if (!limited)
+        goto error;
+
+    qli_set_limit(limited, qli_count(queue) - 1);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, qli_deserialize(limited, serial), __func__);
+    ut_equals_bool(ut, true, qli_empty(limited), __func__);
+
+    qli_free(limited);
+
+    ser_free(serial);
+    qli_free(queue);
+    qli_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (queue)
+        qli_free(queue);
+    if (loaded)
+        qli_free(loaded);
+    interface_free(interface);
+    ut_error();
 }
 
 // Runs all QueueList tests
@@ -109,6 +281,8 @@ Status QueueListTests(void)
 
     qli_test_limit(ut);
     qli_test_foreach(ut);
+    qli_test_splice(ut);
+    qli_test_serialize(ut);
 
     ut_report(ut, "QueueList");
 
@@ -0,0 +1,180 @@
+/**
+ * @file RadixHeapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "RadixHeap.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Removing every element yields the keys in ascending order
+void rxh_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    RadixHeap_t *heap = rxh_new(interface);
+
+    if (!interface || !heap)
+        goto error;
+
+    uint64_t sum = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int64_t key = random_int64_t(0, 100000);
+
+        sum += (uint64_t)key;
+
+        if (!rxh_insert(heap, (uint64_t)key, new_int64_t(key)))
+            goto error;
+    }
+
+    // Keys at the top of the range use the highest bucket
+    if (!rxh_insert(heap, UINT64_MAX, new_int64_t(-1)))
+        goto error;
+
+    ut_equals_integer_t(ut, 1001, rxh_count(heap), __func__);
+
+    uint64_t key, last = 0, removed = 0;
+    void *R;
+    bool ordered = true, matching = true;
+
+    while (rxh_count(heap) > 1)
+    {
+        if (!rxh_remove(heap, &key, &R))
+            goto error;
+
+        ordered = ordered && key >= last;
+        matching = matching && (uint64_t)*(int64_t *)R == key;
+        last = key;
+        removed += key;
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, matching, __func__);
+    ut_equals_bool(ut, true, removed == sum, __func__);
+
+    // A key lower than the last removed one is rejected
+    ut_equals_bool(ut, false, rxh_insert(heap, last - 1, NULL), __func__);
+    ut_equals_bool(ut, true, rxh_last(heap) == last, __func__);
+
+    if (!rxh_remove(heap, &key, &R))
+        goto error;
+
+    ut_equals_bool(ut, true, key == UINT64_MAX, __func__);
+    ut_equals_bool(ut, true, rxh_empty(heap), __func__);
+    ut_equals_bool(ut, false, rxh_remove(heap, &key, &R), __func__);
+
+    free(R);
+
+    rxh_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        rxh_free(heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// An event loop where each event schedules another one in the future
+void rxh_test_monotone(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    RadixHeap_t *heap = rxh_new(interface);
+
+    if (!interface || !heap)
+        goto error;
+
+    for (int i = 0; i < 100; i++)
+    {
+        int64_t time = random_int64_t(0, 50);
+
+        if (!rxh_insert(heap, (uint64_t)time, new_int64_t(time)))
+            goto error;
+    }
+
+    uint64_t now = 0, key;
+    void *R;
+    bool ordered = true, matching = true;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        if (!rxh_remove(heap, &key, &R))
+            goto error;
+
+        ordered = ordered && key >= now;
+        matching = matching && (uint64_t)*(int64_t *)R == key;
+        now = key;
+
+        // Reuse the element for the next event
+        *(int64_t *)R = (int64_t)now + random_int64_t(0, 1000);
+
+        if (!rxh_insert(heap, (uint64_t)*(int64_t *)R, R))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, ordered, __func__);
+    ut_equals_bool(ut, true, matching, __func__);
+    ut_equals_integer_t(ut, 100, rxh_count(heap), __func__);
+
+    int64_t *peeked = rxh_peek(heap, &key);
+
+    ut_equals_bool(ut, true, peeked && (uint64_t)*peeked == key, __func__);
+    ut_equals_bool(ut, true, rxh_last(heap) == key, __func__);
+
+    // After erasing, any key can be inserted again
+    rxh_erase(heap);
+
+    ut_equals_bool(ut, true, rxh_empty(heap), __func__);
+    ut_equals_bool(ut, true, rxh_insert(heap, 0, new_int64_t(0)), __func__);
+
+    rxh_free(heap);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (heap)
+        rxh_free(heap);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all RadixHeap tests
+Status RadixHeapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    rxh_test_IO(ut);
+    rxh_test_monotone(ut);
+
+    ut_report(ut, "RadixHeap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "RadixHeap");
+    ut_delete(&ut);
+    return st;
+}
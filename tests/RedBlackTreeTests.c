@@ -9,6 +9,8 @@
 #include "RedBlackTree.h"
 #include "UnitTest.h"
 #include "Utility.h"
+#include <pthread.h>
+#include <stdatomic.h>
 
 void rbt_test_IO0(UnitTest ut)
 {
@@ -258,6 +260,211 @@ void rbt_test_IO3(UnitTest ut)
     ut_error();
 }
 
+struct rbt_test_reader
+{
+    RedBlackTreeSync_t *sync;
+    atomic_bool *done;
+    bool success;
+};
+
+static void *rbt_test_reader_run(void *argument)
+{
+    struct rbt_test_reader *reader = argument;
+
+    reader->success = true;
+
+    int64_t sentinel = -1;
+
+    while (!atomic_load(reader->done))
+    {
+        // The sentinel is the minimum and is never removed
+        int64_t *min = rbt_sync_min(reader->sync);
+        int64_t *max = rbt_sync_max(reader->sync);
+
+        if (!min || !max || *min != sentinel || *max < *min)
+            reader->success = false;
+
+        if (!rbt_sync_contains(reader->sync, &sentinel))
+            reader->success = false;
+
+        free(min);
+        free(max);
+    }
+
+    return NULL;
+}
+
+// Checks both modes with readers running while a writer changes the tree
+void rbt_test_sync(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    if (!interface)
+        goto error;
+
+    SyncMode modes[2] = { SYNC_RWLOCK, SYNC_RCU };
+
+    for (int m = 0; m < 2; m++)
+    {
+        RedBlackTreeSync_t *sync = rbt_sync_new(interface, modes[m]);
+
+        if (!sync)
+            goto error;
+
+        if (!rbt_sync_insert(sync, new_int64_t(-1)))
+            goto error;
+
+        atomic_bool done = false;
+        pthread_t handles[4];
+        struct rbt_test_reader readers[4];
+
+        for (int i = 0; i < 4; i++)
+        {
+            readers[i].sync = sync;
+            readers[i].done = &done;
+
+            pthread_create(&handles[i], NULL, rbt_test_reader_run, &readers[i]);
+        }
+
+        const int64_t elements = 500;
+        bool success = true;
+
+        for (int64_t i = 0; i < elements; i++)
+            success = success && rbt_sync_insert(sync, new_int64_t(i));
+
+        int64_t duplicate = 0;
+        success = success && !rbt_sync_insert(sync, &duplicate);
+
+        for (int64_t i = 0; i < elements; i += 2)
+            success = success && rbt_sync_remove(sync, &i);
+
+        success = success && !rbt_sync_remove(sync, &duplicate);
+
+        atomic_store(&done, true);
+
+        for (int i = 0; i < 4; i++)
+        {
+            pthread_join(handles[i], NULL);
+            success = success && readers[i].success;
+        }
+
+        int64_t odd = 1;
+
+        ut_equals_bool(ut, true, success, __func__);
+        ut_equals_bool(ut, true, rbt_sync_contains(sync, &odd), __func__);
+        ut_equals_integer_t(ut, elements / 2 + 1, rbt_sync_size(sync),
+                            __func__);
+        ut_equals_bool(ut, true, rbt_sync_mode(sync) == modes[m], __func__);
+
+        rbt_sync_free(sync);
+    }
+
+    interface_free(interface);
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (interface)
+        interface_free(interface);
+    ut_error();
+}
+
+// Saves a tree to a file and checks that the loaded tree is still a valid
+// red-black tree
+void rbt_test_serialize(UnitTest ut)
+{
+    const integer_t T = 5000;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+                                           display_int64_t, free, NULL, NULL);
+
+    RedBlackTree_t *tree = rbt_new(interface);
+    RedBlackTree_t *loaded = rbt_new(interface);
+    Serial_t *serial = NULL;
+    FILE *file = tmpfile();
+
+    if (!interface || !tree || !loaded || !file)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (integer_t i = 0; i < T; i++)
+    {
+        void *element = new_int64_t(random_int64_t(0, T * 10));
+
+        if (!rbt_insert(tree, element))
+            free(element);
+    }
+
+    serial = ser_new_fd(fileno(file));
+
+    if (!serial)
+        goto error;
+
+    ut_equals_bool(ut, true, rbt_serialize(tree, serial), __func__);
+    ut_equals_bool(ut, true, ser_free(serial), __func__);
+
+    rewind(file);
+
+    serial = ser_new_fd(fileno(file));
+
+    if (!serial)
+        goto error;
+
+    ut_equals_bool(ut, true, rbt_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, rbt_size(tree), rbt_size(loaded), __func__);
+    ut_equals_int(ut, 0, compare_int64_t(rbt_min(tree), rbt_min(loaded)),
+                  __func__);
+    ut_equals_int(ut, 0, compare_int64_t(rbt_max(tree), rbt_max(loaded)),
+                  __func__);
+
+    // The loaded tree has to keep working as a red-black tree
+    for (int64_t i = -100; i < 0; i++)
+        rbt_insert(loaded, new_int64_t(i));
+
+    ut_equals_integer_t(ut, rbt_size(tree) + 100, rbt_size(loaded), __func__);
+
+    integer_t removed = 0;
+
+    while (!rbt_empty(loaded))
+    {
+        void *key = copy_int64_t(rbt_peek(loaded));
+
+        if (!rbt_remove(loaded, key))
+        {
+            free(key);
+            goto error;
+        }
+
+        free(key);
+        removed++;
+    }
+
+    ut_equals_integer_t(ut, rbt_size(tree) + 100, removed, __func__);
+
+    ser_free(serial);
+    fclose(file);
+    rbt_free(tree);
+    rbt_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (file)
+        fclose(file);
+    if (tree)
+        rbt_free(tree);
+    if (loaded)
+        rbt_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all RedBlackTree tests
 Status RedBlackTreeTests(void)
 {
@@ -272,6 +479,8 @@ Status RedBlackTreeTests(void)
     rbt_test_IO1(ut);
     rbt_test_IO2(ut);
     rbt_test_IO3(ut);
+    rbt_test_serialize(ut);
+    rbt_test_sync(ut);
 
     ut_report(ut, "RedBlackTree");
 
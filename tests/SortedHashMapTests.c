@@ -0,0 +1,239 @@
+/**
+ * @file SortedHashMapTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "SortedHashMap.h"
+#include "AssociativeList.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Inserts and removes many pairs, checking the lookups and that the pairs are
+// still in insertion order after the map is compacted, grown and shrunk
+void shm_test_IO(UnitTest ut)
+{
+    const int64_t elements = 20000;
+
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, hash_int64_t, NULL);
+
+    SortedHashMap_t *map = shm_new(interface, interface);
+
+    if (!interface || !map)
+        goto error;
+
+    for (int64_t i = 0; i < elements; i++)
+    {
+        if (!shm_insert(map, new_int64_t(i), new_int64_t(-i)))
+            goto error;
+    }
+
+    int64_t key = 5;
+    int64_t *duplicate = new_int64_t(key);
+
+    ut_equals_bool(ut, false, shm_insert(map, duplicate, NULL), __func__);
+    ut_equals_integer_t(ut, elements, shm_size(map), __func__);
+
+    free(duplicate);
+
+    // Remove every pair except the multiples of 10
+    bool found = true;
+
+    for (key = 0; key < elements; key++)
+    {
+        if (key % 10 != 0)
+            found = found && shm_pop(map, &key);
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_integer_t(ut, elements / 10, shm_size(map), __func__);
+    ut_equals_bool(ut, true, shm_capacity(map) < elements, __func__);
+
+    for (key = 0; key < elements; key++)
+    {
+        int64_t *value = shm_get(map, &key);
+
+        found = found && (key % 10 == 0) == (value != NULL);
+        found = found && (value == NULL || *value == -key);
+    }
+
+    ut_equals_bool(ut, true, found, __func__);
+
+    // Removing and inserting a key moves it to the end
+    void *R;
+
+    key = 0;
+
+    if (!shm_remove(map, &key, &R))
+        goto error;
+
+    ut_equals_bool(ut, true, *(int64_t *)R == 0, __func__);
+    ut_equals_bool(ut, false, shm_contains_key(map, &key), __func__);
+
+    if (!shm_insert(map, new_int64_t(key), R))
+        goto error;
+
+    void **keys, **values;
+
+    if (!shm_to_arrays(map, &keys, &values))
+        goto error;
+
+    bool in_order = *(int64_t *)keys[shm_size(map) - 1] == 0;
+
+    for (integer_t i = 0; i < shm_size(map); i++)
+    {
+        if (i < shm_size(map) - 1)
+            in_order = in_order && *(int64_t *)keys[i] == (i + 1) * 10;
+
+        in_order = in_order &&
+                   *(int64_t *)keys[i] == -*(int64_t *)values[i];
+
+        free(keys[i]);
+        free(values[i]);
+    }
+
+    free(keys);
+    free(values);
+
+    ut_equals_bool(ut, true, in_order, __func__);
+
+    shm_erase(map);
+
+    ut_equals_bool(ut, true, shm_empty(map), __func__);
+    ut_equals_bool(ut, false, shm_to_arrays(map, &keys, &values), __func__);
+
+    shm_free(map);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        shm_free(map);
+    interface_free(interface);
+    ut_error();
+}
+
+// Both containers keep insertion order, so with the same operations their
+// arrays must be the same
+void shm_test_to_arrays(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_string, copy_string,
+            display_string, free, hash_string, NULL);
+
+    SortedHashMap_t *map = shm_new(interface, interface);
+    AssociativeList_t *list = ali_new(interface, interface, false);
+
+    void **K_map = NULL, **V_map = NULL, **K_list = NULL, **V_list = NULL;
+
+    if (!interface || !map || !list)
+        goto error;
+
+    for (integer_t i = 0; i < 500; i++)
+    {
+        // Few possible keys so that many are inserted again or removed
+        char *key = random_string(1, 1, true);
+        char *value = random_string(1, 8, true);
+        char *key_copy = copy_string(key);
+        char *value_copy = copy_string(value);
+
+        bool inserted = shm_insert(map, key, value);
+
+        if (inserted != ali_insert(list, key_copy, value_copy))
+            goto error;
+
+        if (!inserted)
+        {
+            free(key);
+            free(value);
+            free(key_copy);
+            free(value_copy);
+        }
+
+        if (i % 4 == 0)
+        {
+            char *target = random_string(1, 1, true);
+
+            bool removed = shm_pop(map, target);
+
+            if (removed != ali_pop(list, target))
+                goto error;
+
+            free(target);
+        }
+    }
+
+    integer_t length = shm_size(map);
+
+    ut_equals_integer_t(ut, ali_length(list), length, __func__);
+
+    if (!shm_to_arrays(map, &K_map, &V_map))
+        goto error;
+    if (!ali_to_arrays(list, &K_list, &V_list))
+        goto error;
+
+    bool same = true;
+
+    for (integer_t i = 0; i < length; i++)
+    {
+        same = same && strcmp(K_map[i], K_list[i]) == 0;
+        same = same && strcmp(V_map[i], V_list[i]) == 0;
+
+        free(K_map[i]);
+        free(V_map[i]);
+        free(K_list[i]);
+        free(V_list[i]);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    free(K_map);
+    free(V_map);
+    free(K_list);
+    free(V_list);
+
+    shm_free(map);
+    ali_free(list);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (map)
+        shm_free(map);
+    if (list)
+        ali_free(list);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all SortedHashMap tests
+Status SortedHashMapTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    shm_test_IO(ut);
+    shm_test_to_arrays(ut);
+
+    ut_report(ut, "SortedHashMap");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "SortedHashMap");
+    ut_delete(&ut);
+    return st;
+}
@@ -10,6 +10,22 @@
 #include "UnitTest.h"
 #include "Utility.h"
 
+// The legacy lists take callbacks with non-const parameters
+static int sli_test_compare(void *element1, void *element2)
+{
+    return compare_int64_t(element1, element2);
+}
+
+static void *sli_test_copy(void *element)
+{
+    return copy_int64_t(element);
+}
+
+static void sli_test_display(void *element)
+{
+    display_int64_t(element);
+}
+
 // Tests insertion
 Status sli_test_insertion(UnitTest ut)
 {
@@ -304,6 +320,433 @@ Status sli_test_indexof(UnitTest ut)
     return st;
 }
 
+static bool sli_test_load(void *list, Serial_t *serial)
+{
+    return sli_deserialize(list, deserialize_int64_t, serial) == DS_OK;
+}
+
+static bool sli_test_empty(void *list)
+{
+    return sli_empty(list);
+}
+
+// Tests saving a list and loading it with the opposite order, after checking
+// that a cut stream and a newer version are both refused
+Status sli_test_serialize(UnitTest ut)
+{
+    SortedList list = NULL, loaded = NULL;
+    Serial_t *serial = ser_new_buffer();
+
+    Status st = DS_OK;
+
+    st += sli_create(&list, DESCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+    st += sli_create(&loaded, ASCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+
+    if (st != DS_OK || !serial)
+        goto error;
+
+    for (int64_t i = 0; i < 100; i++)
+        st += sli_insert(list, new_int64_t((i * 37) % 100));
+
+    st += sli_serialize(list, serialize_int64_t, serial);
+
+    if (st != DS_OK)
+        goto error;
+
+    if (!ut_serial_rejects(ut, serial, loaded, sli_test_load, sli_test_empty,
+                           __func__))
+    {
+        st = DS_ERR_ALLOC;
+        goto error;
+    }
+
+    st = sli_deserialize(loaded, deserialize_int64_t, serial);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, 100, sli_length(loaded), __func__);
+    ut_equals_bool(ut, true, sli_order(loaded) == ASCENDING, __func__);
+
+    void *R0 = NULL, *R1 = NULL;
+
+    st += sli_get(loaded, &R0, 0);
+    st += sli_get(loaded, &R1, 99);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, 0, (int)*(int64_t*)R0, __func__);
+    ut_equals_int(ut, 99, (int)*(int64_t*)R1, __func__);
+
+    free(R0);
+    free(R1);
+
+    // A list that is not empty is refused
+    ser_rewind(serial);
+
+    ut_equals_int(ut, DS_ERR_INVALID_OPERATION,
+                  sli_deserialize(loaded, deserialize_int64_t, serial),
+                  __func__);
+
+    ser_free(serial);
+    sli_free(&list);
+    sli_free(&loaded);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    sli_free(&list);
+    sli_free(&loaded);
+    return st;
+}
+
+// Tests merging lists of either order and inserting unsorted batches
+Status sli_test_merge(UnitTest ut)
+{
+    SortedList list1 = NULL, list2 = NULL;
+
+    Status st = DS_OK;
+
+    st += sli_create(&list1, ASCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+    st += sli_create(&list2, DESCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+
+    if (st != DS_OK)
+        goto error;
+
+    // Evens in list1 and odds in list2, plus one repeated value
+    for (int64_t i = 0; i < 1000; i++)
+        st += sli_insert(i % 2 == 0 ? list1 : list2, new_int64_t(i));
+
+    st += sli_insert(list2, new_int64_t(500));
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, DS_OK, sli_merge(list1, list2), __func__);
+    ut_equals_integer_t(ut, 1001, sli_length(list1), __func__);
+    ut_equals_bool(ut, true, sli_empty(list2), __func__);
+
+    void *elements[500];
+
+    for (int64_t i = 0; i < 500; i++)
+        elements[i] = new_int64_t((i * 263) % 500 - 250);
+
+    ut_equals_int(ut, DS_OK, sli_insert_all(list1, elements, 500), __func__);
+    ut_equals_integer_t(ut, 1501, sli_length(list1), __func__);
+
+    void **array = NULL;
+    integer_t length = 0;
+
+    st = sli_to_array(list1, &array, &length);
+
+    if (st != DS_OK)
+        goto error;
+
+    bool sorted = true;
+
+    for (integer_t i = 1; i < length; i++)
+        sorted = sorted && compare_int64_t(array[i - 1], array[i]) <= 0;
+
+    ut_equals_bool(ut, true, sorted, __func__);
+    ut_equals_bool(ut, true, *(int64_t*)array[0] == -250, __func__);
+    ut_equals_bool(ut, true, *(int64_t*)array[length - 1] == 999, __func__);
+
+    for (integer_t i = 0; i < length; i++)
+        free(array[i]);
+
+    free(array);
+
+    // Walking the links backwards must agree with walking them forwards
+    void *R = NULL;
+
+    st = sli_remove(list1, &R, sli_length(list1) - 2);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, true, *(int64_t*)R == 998, __func__);
+
+    free(R);
+
+    // Nothing is inserted when the batch doesn't fit the limit
+    st = sli_set_limit(list2, 3);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, DS_ERR_FULL, sli_insert_all(list2, elements, 4),
+                  __func__);
+    ut_equals_bool(ut, true, sli_empty(list2), __func__);
+
+    sli_free(&list1);
+    sli_free(&list2);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    sli_free(&list1);
+    sli_free(&list2);
+    return st;
+}
+
+// Orders integers by their last decimal digit only
+static int sli_test_compare_digit(void *element1, void *element2)
+{
+    int64_t digit1 = *(int64_t *)element1 % 10;
+    int64_t digit2 = *(int64_t *)element2 % 10;
+
+    return (digit1 > digit2) - (digit1 < digit2);
+}
+
+// Tests merging a list sorted by another compare function
+Status sli_test_merge_compare(UnitTest ut)
+{
+    SortedList list1 = NULL, list2 = NULL;
+
+    Status st = DS_OK;
+
+    st += sli_create(&list1, ASCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+    st += sli_create(&list2, ASCENDING, sli_test_compare_digit, sli_test_copy,
+                     sli_test_display, free);
+
+    if (st != DS_OK)
+        goto error;
+
+    st = sli_set_indexed(list1, true);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int64_t i = 0; i < 2000; i++)
+        st += sli_insert(i % 4 == 0 ? list1 : list2, new_int64_t(i));
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_int(ut, DS_OK, sli_merge(list1, list2), __func__);
+    ut_equals_integer_t(ut, 2000, sli_length(list1), __func__);
+    ut_equals_bool(ut, true, sli_empty(list2), __func__);
+
+    void **array = NULL;
+    integer_t length = 0;
+
+    st = sli_to_array(list1, &array, &length);
+
+    if (st != DS_OK)
+        goto error;
+
+    bool sorted = true;
+
+    for (integer_t i = 0; i < length; i++)
+        sorted = sorted && *(int64_t*)array[i] == i;
+
+    ut_equals_bool(ut, true, sorted, __func__);
+
+    for (integer_t i = 0; i < length; i++)
+        free(array[i]);
+
+    free(array);
+
+    // The skip index was rebuilt over the right order
+    bool found = true;
+
+    for (int64_t i = 0; i < 2000; i += 7)
+        found = found && sli_contains(list1, &i);
+
+    int64_t missing = 2000;
+
+    ut_equals_bool(ut, true, found, __func__);
+    ut_equals_bool(ut, false, sli_contains(list1, &missing), __func__);
+
+    sli_free(&list1);
+    sli_free(&list2);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    sli_free(&list1);
+    sli_free(&list2);
+    return st;
+}
+
+// Checks that an indexed list always agrees with a plain one
+Status sli_test_indexed(UnitTest ut)
+{
+    SortedList plain = NULL, indexed = NULL, half = NULL, other = NULL;
+    SortedListIterator iter = NULL;
+
+    Status st = DS_OK;
+
+    st += sli_create(&plain, ASCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+    st += sli_create(&indexed, ASCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+
+    if (st != DS_OK)
+        goto error;
+
+    st = sli_set_indexed(indexed, true);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_bool(ut, false, sli_indexed(plain), __func__);
+    ut_equals_bool(ut, true, sli_indexed(indexed), __func__);
+
+    bool same = true;
+    void *R0 = NULL, *R1 = NULL;
+
+    // Lots of repeated values and removals from everywhere
+    for (int i = 0; i < 6000; i++)
+    {
+        int64_t value = random_int64_t(0, 500);
+
+        if (i % 3 != 2 || sli_empty(plain))
+        {
+            st += sli_insert(plain, new_int64_t(value));
+            st += sli_insert(indexed, new_int64_t(value));
+        }
+        else
+        {
+            integer_t position = random_int64_t(0, sli_length(plain) - 1);
+
+            st += sli_remove(plain, &R0, position);
+            st += sli_remove(indexed, &R1, position);
+
+            same = same && *(int64_t*)R0 == *(int64_t*)R1;
+
+            free(R0);
+            free(R1);
+        }
+
+        if (st != DS_OK)
+            goto error;
+    }
+
+    st += sli_remove_max(indexed, &R0);
+    st += sli_remove_max(plain, &R1);
+    free(R0);
+    free(R1);
+    st += sli_remove_min(indexed, &R0);
+    st += sli_remove_min(plain, &R1);
+    free(R0);
+    free(R1);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int64_t key = -1; key <= 501; key++)
+    {
+        same = same && sli_index_first(plain, &key) ==
+                       sli_index_first(indexed, &key);
+        same = same && sli_index_last(plain, &key) ==
+                       sli_index_last(indexed, &key);
+        same = same && sli_contains(plain, &key) ==
+                       sli_contains(indexed, &key);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Removing through an iterator keeps the index in place
+    st = sli_iter_init(&iter, indexed);
+
+    if (st != DS_OK)
+        goto error;
+
+    for (int i = 0; i < 100; i++)
+        sli_iter_next(iter);
+
+    st += sli_iter_remove_curr(iter, &R0);
+    st += sli_iter_remove_next(iter, &R1);
+    free(R0);
+    free(R1);
+    st += sli_iter_remove_prev(iter, &R0);
+    free(R0);
+
+    sli_iter_free(&iter);
+
+    // The same nodes, at positions 100, 101 and 98
+    st += sli_remove(plain, &R0, 101);
+    free(R0);
+    st += sli_remove(plain, &R0, 100);
+    free(R0);
+    st += sli_remove(plain, &R0, 98);
+    free(R0);
+
+    if (st != DS_OK)
+        goto error;
+
+    // Operations that relink everything, then a final comparison
+    st += sli_create(&other, DESCENDING, sli_test_compare, sli_test_copy,
+                     sli_test_display, free);
+    st += sli_set_indexed(other, true);
+
+    for (int64_t i = 0; i < 300; i++)
+        st += sli_insert(other, new_int64_t(i * 2));
+
+    st += sli_merge(indexed, other);
+    st += sli_free(&other);
+
+    for (int64_t i = 0; i < 300; i++)
+        st += sli_insert(plain, new_int64_t(i * 2));
+
+    st += sli_unlink(indexed, &half, sli_length(indexed) / 3);
+    st += sli_merge(indexed, half);
+    st += sli_reverse(indexed);
+    st += sli_reverse(indexed);
+
+    if (st != DS_OK)
+        goto error;
+
+    ut_equals_integer_t(ut, sli_length(plain), sli_length(indexed), __func__);
+
+    for (integer_t i = 0; i < sli_length(plain) && st == DS_OK; i++)
+    {
+        st += sli_get(plain, &R0, i);
+        st += sli_get(indexed, &R1, i);
+
+        same = same && *(int64_t*)R0 == *(int64_t*)R1;
+
+        free(R0);
+        free(R1);
+    }
+
+    ut_equals_bool(ut, true, same, __func__);
+
+    // Turning it off changes nothing but the speed
+    st += sli_set_indexed(indexed, false);
+
+    for (int64_t key = 0; key < 20; key++)
+        same = same && sli_index_last(plain, &key) ==
+                       sli_index_last(indexed, &key);
+
+    ut_equals_bool(ut, true, same, __func__);
+    ut_equals_bool(ut, false, sli_indexed(indexed), __func__);
+
+    sli_free(&plain);
+    sli_free(&indexed);
+    sli_free(&half);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    sli_free(&plain);
+    sli_free(&indexed);
+    return st;
+}
+
 // Runs all SortedList tests
 Status SortedListTests(void)
 {
@@ -318,6 +761,10 @@ Status SortedListTests(void)
     st += sli_test_incomplete(ut);
     st += sli_test_limit(ut);
     st += sli_test_indexof(ut);
+    st += sli_test_serialize(ut);
+    st += sli_test_merge(ut);
+    st += sli_test_merge_compare(ut);
+    st += sli_test_indexed(ut);
 
     if (st != DS_OK)
         goto error;
@@ -125,6 +125,59 @@ void sta_test_growth(UnitTest ut)
     sta_free(stack);
 }
 
+// The iterator stops at the top of the stack
+void sta_test_iter(UnitTest ut)
+{
+    STA_ITER_DECL(iter)
+
+    Interface_t int_interface;
+    interface_init(&int_interface, compare_int32_t, copy_int32_t,
+                   display_int32_t, free, NULL, NULL);
+
+    StackArray_t *stack = sta_create(&int_interface, 8, 200);
+
+    if (!stack)
+        goto error;
+
+    ut_equals_bool(ut, false, sta_iter_init(iter, stack), __func__);
+
+    int *elem = NULL;
+    for (int i = 0; i < 5; i++)
+    {
+        elem = new_int32_t(i);
+
+        if (!sta_push(stack, elem))
+        {
+            free(elem);
+            goto error;
+        }
+    }
+
+    ut_equals_bool(ut, true, sta_iter_init(iter, stack), __func__);
+
+    integer_t visited = 0;
+
+    do
+    {
+        visited++;
+    } while (sta_iter_next(iter));
+
+    ut_equals_integer_t(ut, 5, visited, __func__);
+    ut_equals_bool(ut, false, sta_iter_has_next(iter), __func__);
+    ut_equals_bool(ut, false, sta_iter_next(iter), __func__);
+    ut_equals_int(ut, 4, *(int*)sta_iter_peek(iter), __func__);
+
+    sta_free(stack);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (stack)
+        sta_free(stack);
+}
+
 void sta_test_foreach(UnitTest ut)
 {
     Interface_t int_interface;
@@ -164,6 +217,29 @@ void sta_test_foreach(UnitTest ut)
 
     ut_equals_int(ut, 250500, sum, __func__);
 
+    sum = 0;
+
+    // continue moves on to the next element
+    STA_FOR_EACH(stack, {
+        int32_t i = *(int*)var;
+        if (i % 2 != 0)
+            continue;
+        sum += i;
+    })
+
+    ut_equals_int(ut, 250500, sum, __func__);
+
+    sta_erase(stack);
+
+    // Nothing to visit in an empty stack
+    integer_t visited = 0;
+
+    STA_FOR_EACH(stack, {
+        visited++;
+    })
+
+    ut_equals_integer_t(ut, 0, visited, __func__);
+
     sta_free(stack);
 
     return;
@@ -174,6 +250,81 @@ void sta_test_foreach(UnitTest ut)
     sta_free(stack);
 }
 
+static bool sta_test_load(void *target, Serial_t *serial)
+{
+    return sta_deserialize(target, serial);
+}
+
+static bool sta_test_empty(void *target)
+{
+    return sta_empty(target);
+}
+
+// Saves a stack and loads it back with the same top, after checking
+// that a cut stream and a newer version are both refused
+void sta_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    StackArray_t *stack = sta_new(interface);
+    StackArray_t *loaded = sta_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !stack || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!sta_push(stack, new_int64_t(random_int64_t(-1000, 1000))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, sta_serialize(stack, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, sta_test_load, sta_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, sta_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, sta_count(stack), sta_count(loaded), __func__);
+    ut_equals_int(ut, 0, sta_compare(stack, loaded), __func__);
+
+    // A locked stack that is too small is left empty
+    StackArray_t *small = sta_create(interface, 16, 200);
+
+    if (!small)
+        goto error;
+
+    sta_capacity_lock(small);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, sta_deserialize(small, serial), __func__);
+    ut_equals_bool(ut, true, sta_empty(small), __func__);
+
+    sta_free(small);
+
+    ser_free(serial);
+    sta_free(stack);
+    sta_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (stack)
+        sta_free(stack);
+    if (loaded)
+        sta_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all StackArray tests
 Status StackArrayTests(void)
 {
@@ -186,7 +337,9 @@ Status StackArrayTests(void)
 
     sta_test_locked(ut);
     sta_test_growth(ut);
+    sta_test_iter(ut);
     sta_test_foreach(ut);
+    sta_test_serialize(ut);
 
     ut_report(ut, "StackArray");
 
@@ -96,8 +96,29 @@ void stl_test_foreach(UnitTest ut)
 
     ut_equals_int(ut, 250500, sum, __func__);
 
+    sum = 0;
+
+    // continue moves on to the next element
+    STL_FOR_EACH(stack, {
+        int32_t i = *(int*)var;
+        if (i % 2 != 0)
+            continue;
+        sum += i;
+    })
+
+    ut_equals_int(ut, 250500, sum, __func__);
+
     stl_erase(stack);
 
+    // Nothing to visit in an empty stack
+    integer_t visited = 0;
+
+    STL_FOR_EACH(stack, {
+        visited++;
+    })
+
+    ut_equals_integer_t(ut, 0, visited, __func__);
+
     return;
 
     error:
@@ -106,6 +127,81 @@ void stl_test_foreach(UnitTest ut)
     stl_erase(stack);
 }
 
+static bool stl_test_load(void *target, Serial_t *serial)
+{
+    return stl_deserialize(target, serial);
+}
+
+static bool stl_test_empty(void *target)
+{
+    return stl_empty(target);
+}
+
+// Saves a stack and loads it back with the same top, after checking
+// that a cut stream and a newer version are both refused
+void stl_test_serialize(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    StackList_t *stack = stl_new(interface);
+    StackList_t *loaded = stl_new(interface);
+    Serial_t *serial = ser_new_buffer();
+
+    if (!interface || !stack || !loaded || !serial)
+        goto error;
+
+    interface_codec(interface, serialize_int64_t, deserialize_int64_t);
+
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        if (!stl_push(stack, new_int64_t(random_int64_t(-1000, 1000))))
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, stl_serialize(stack, serial), __func__);
+
+    if (!ut_serial_rejects(ut, serial, loaded, stl_test_load, stl_test_empty,
+                           __func__))
+        goto error;
+
+    ut_equals_bool(ut, true, stl_deserialize(loaded, serial), __func__);
+    ut_equals_integer_t(ut, stl_count(stack), stl_count(loaded), __func__);
+    ut_equals_int(ut, 0, stl_compare(stack, loaded), __func__);
+
+    // The elements have to fit in the limit of the loaded stack
+    StackList_t *limited = stl_new(interface);
+
+    if (!limited)
+        goto error;
+
+    stl_set_limit(limited, stl_count(stack) - 1);
+    ser_rewind(serial);
+
+    ut_equals_bool(ut, false, stl_deserialize(limited, serial), __func__);
+    ut_equals_bool(ut, true, stl_empty(limited), __func__);
+
+    stl_free(limited);
+
+    ser_free(serial);
+    stl_free(stack);
+    stl_free(loaded);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (serial)
+        ser_free(serial);
+    if (stack)
+        stl_free(stack);
+    if (loaded)
+        stl_free(loaded);
+    interface_free(interface);
+    ut_error();
+}
+
 // Runs all StackList tests
 Status StackListTests(void)
 {
@@ -118,6 +214,7 @@ Status StackListTests(void)
 
     stl_test_limit(ut);
     stl_test_foreach(ut);
+    stl_test_serialize(ut);
 
     ut_report(ut, "StackList");
 
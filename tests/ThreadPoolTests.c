@@ -0,0 +1,274 @@
+/**
+ * @file ThreadPoolTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ThreadPool.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+struct tpl_test_log
+{
+    integer_t *buffer;
+    integer_t count;
+};
+
+struct tpl_test_item
+{
+    struct tpl_test_log *log;
+    integer_t value;
+};
+
+static void tpl_test_log_task(void *argument)
+{
+    struct tpl_test_item *item = argument;
+
+    item->log->buffer[item->log->count++] = item->value;
+}
+
+static void tpl_test_sum_range(integer_t from, integer_t to, integer_t chunk,
+                               void *context)
+{
+    integer_t *partials = context;
+
+    for (integer_t i = from; i < to; i++)
+        partials[chunk] += i;
+}
+
+static void tpl_test_order_range(integer_t from, integer_t to, integer_t chunk,
+                                 void *context)
+{
+    struct tpl_test_log *log = context;
+
+    (void)to;
+
+    log->buffer[log->count++] = from * 1000 + chunk;
+}
+
+// Checks that a serial pool runs everything in order on the calling thread
+void tpl_test_serial(UnitTest ut)
+{
+    ThreadPool_t *pool = tpl_new(0);
+    TaskGroup_t *group = tpl_group_new();
+
+    struct tpl_test_item items[100];
+    struct tpl_test_log log;
+    integer_t buffer[100];
+
+    if (!pool || !group)
+        goto error;
+
+    log.buffer = buffer;
+    log.count = 0;
+
+    for (integer_t i = 0; i < 100; i++)
+    {
+        items[i].log = &log;
+        items[i].value = i;
+
+        if (!tpl_submit(pool, group, tpl_test_log_task, &items[i]))
+            goto error;
+    }
+
+    tpl_wait(pool, group);
+
+    bool in_order = log.count == 100;
+
+    for (integer_t i = 0; i < log.count; i++)
+        in_order = in_order && buffer[i] == i;
+
+    ut_equals_bool(ut, true, tpl_serial(pool), __func__);
+    ut_equals_bool(ut, true, in_order, __func__);
+    ut_equals_integer_t(ut, 0, tpl_group_pending(group), __func__);
+
+    // Chunks of a parallel for are also processed in order
+    log.count = 0;
+    tpl_parallel_for(pool, 0, 10000, 1000, tpl_test_order_range, &log);
+
+    in_order = log.count == 10;
+
+    for (integer_t i = 0; i < log.count; i++)
+        in_order = in_order && buffer[i] == (i * 1000) * 1000 + i;
+
+    ut_equals_integer_t(ut, 10, tpl_chunks(pool, 0, 10000, 1000), __func__);
+    ut_equals_bool(ut, true, in_order, __func__);
+
+    tpl_group_free(group);
+    tpl_free(pool);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    if (group)
+        tpl_group_free(group);
+    if (pool)
+        tpl_free(pool);
+}
+
+// Checks that every index is visited exactly once for many pool sizes
+void tpl_test_parallel_for(UnitTest ut)
+{
+    const integer_t elements = 1000000;
+    const integer_t expected = elements * (elements - 1) / 2;
+
+    for (integer_t threads = 0; threads <= 8; threads++)
+    {
+        ThreadPool_t *pool = tpl_new(threads);
+
+        if (!pool)
+            goto error;
+
+        integer_t grains[3] = { 0, 1, 4096 };
+
+        for (int g = 0; g < 3; g++)
+        {
+            integer_t chunks = tpl_chunks(pool, 0, elements, grains[g]);
+            integer_t *partials = calloc((size_t)chunks, sizeof(integer_t));
+
+            if (!partials)
+            {
+                tpl_free(pool);
+                goto error;
+            }
+
+            tpl_parallel_for(pool, 0, elements, grains[g], tpl_test_sum_range,
+                             partials);
+
+            integer_t sum = 0;
+            for (integer_t i = 0; i < chunks; i++)
+                sum += partials[i];
+
+            ut_equals_integer_t(ut, expected, sum, __func__);
+
+            free(partials);
+        }
+
+        tpl_free(pool);
+    }
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+}
+
+struct tpl_test_tree
+{
+    ThreadPool_t *pool;
+    TaskGroup_t *group;
+    integer_t depth;
+    integer_t *leaves;
+    integer_t index;
+};
+
+static void tpl_test_tree_task(void *argument)
+{
+    struct tpl_test_tree *node = argument;
+
+    if (node->depth == 0)
+    {
+        node->leaves[node->index] = 1;
+        free(node);
+        return;
+    }
+
+    // Nested parallelism: every task spawns two more and waits for them
+    TaskGroup_t *children = tpl_group_new();
+
+    for (integer_t i = 0; i < 2; i++)
+    {
+        struct tpl_test_tree *child = malloc(sizeof(struct tpl_test_tree));
+
+        *child = *node;
+        child->group = children;
+        child->depth = node->depth - 1;
+        child->index = node->index * 2 + i;
+
+        tpl_submit(node->pool, children, tpl_test_tree_task, child);
+    }
+
+    tpl_wait(node->pool, children);
+    tpl_group_free(children);
+
+    free(node);
+}
+
+// Checks that tasks waiting on other tasks don't deadlock the pool
+void tpl_test_nested(UnitTest ut)
+{
+    const integer_t depth = 12;
+    const integer_t total = (integer_t)1 << depth;
+
+    ThreadPool_t *pool = tpl_new(4);
+    TaskGroup_t *group = tpl_group_new();
+    integer_t *leaves = calloc((size_t)total, sizeof(integer_t));
+    struct tpl_test_tree *root = malloc(sizeof(struct tpl_test_tree));
+
+    if (!pool || !group || !leaves || !root)
+        goto error;
+
+    root->pool = pool;
+    root->group = group;
+    root->depth = depth;
+    root->leaves = leaves;
+    root->index = 0;
+
+    tpl_submit(pool, group, tpl_test_tree_task, root);
+    tpl_wait(pool, group);
+
+    integer_t sum = 0;
+    for (integer_t i = 0; i < total; i++)
+        sum += leaves[i];
+
+    ut_equals_integer_t(ut, total, sum, __func__);
+    ut_equals_integer_t(ut, 0, tpl_group_pending(group), __func__);
+
+    free(leaves);
+    tpl_group_free(group);
+    tpl_free(pool);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_error();
+    free(leaves);
+    free(root);
+    if (group)
+        tpl_group_free(group);
+    if (pool)
+        tpl_free(pool);
+}
+
+// Runs all ThreadPool tests
+Status ThreadPoolTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    tpl_test_serial(ut);
+    tpl_test_parallel_for(ut);
+    tpl_test_nested(ut);
+
+    ut_report(ut, "ThreadPool");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "ThreadPool");
+    ut_delete(&ut);
+    return st;
+}
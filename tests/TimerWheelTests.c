@@ -0,0 +1,297 @@
+/**
+ * @file TimerWheelTests.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "TimerWheel.h"
+#include "UnitTest.h"
+#include "Utility.h"
+
+// Checks the timers expired by tmw_advance()
+struct tmw_test_context
+{
+    TimerWheel_t *wheel;
+    uint64_t previous; // The tick before the wheel advanced
+    uint64_t last;     // Expiration of the last expired timer
+    integer_t expired;
+    bool in_time;
+    bool ordered;
+};
+
+static void tmw_test_expire(void *element, void *context)
+{
+    struct tmw_test_context *ctx = context;
+    uint64_t expires = (uint64_t)*(int64_t *)element;
+    uint64_t now = tmw_now(ctx->wheel);
+
+    // A timer expires at the first tick not before its expiration
+    ctx->in_time = ctx->in_time && expires <= now &&
+                   (expires > ctx->previous || now == ctx->previous + 1);
+    ctx->ordered = ctx->ordered && expires >= ctx->last;
+    ctx->last = expires;
+    ctx->expired++;
+
+    free(element);
+}
+
+// Timers expire in order at their ticks however the wheel advances
+void tmw_test_IO(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    TimerWheel_t *wheel = tmw_new(interface, 0);
+
+    if (!interface || !wheel)
+        goto error;
+
+    TimerWheelNode_t *handles[1000];
+
+    for (int i = 0; i < 1000; i++)
+    {
+        // Spread over several levels
+        int64_t expires = random_int64_t(1, 1 << (i % 24));
+
+        if (!tmw_schedule(wheel, (uint64_t)expires, new_int64_t(expires),
+                          &handles[i]))
+            goto error;
+    }
+
+    ut_equals_integer_t(ut, 1000, tmw_count(wheel), __func__);
+
+    // Cancel every fourth timer
+    void *R;
+    bool cancelled = true;
+
+    for (int i = 0; i < 1000; i += 4)
+    {
+        uint64_t expires = tmw_expires(handles[i]);
+
+        cancelled = cancelled &&
+                    *(int64_t *)tmw_element(handles[i]) == (int64_t)expires;
+        cancelled = cancelled && tmw_cancel(wheel, handles[i], &R);
+
+        free(R);
+    }
+
+    ut_equals_bool(ut, true, cancelled, __func__);
+    ut_equals_integer_t(ut, 750, tmw_count(wheel), __func__);
+
+    struct tmw_test_context ctx = { wheel, 0, 0, 0, true, true };
+
+    while (!tmw_empty(wheel))
+    {
+        ctx.previous = tmw_now(wheel);
+
+        uint64_t now = ctx.previous + (uint64_t)random_int64_t(1, 5000);
+
+        tmw_advance(wheel, now, tmw_test_expire, &ctx);
+
+        if (tmw_now(wheel) != now)
+            goto error;
+    }
+
+    ut_equals_bool(ut, true, ctx.in_time, __func__);
+    ut_equals_bool(ut, true, ctx.ordered, __func__);
+    ut_equals_integer_t(ut, 750, ctx.expired, __func__);
+
+    // Going back in time does nothing
+    ut_equals_integer_t(ut, 0, tmw_advance(wheel, 0, NULL, NULL), __func__);
+    ut_equals_bool(ut, false, tmw_cancel(wheel, handles[0], &R), __func__);
+
+    tmw_free(wheel);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (wheel)
+        tmw_free(wheel);
+    interface_free(interface);
+    ut_error();
+}
+
+// Connection timeouts that are refreshed keep being pushed forward
+void tmw_test_reschedule(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    TimerWheel_t *wheel = tmw_new(interface, 1000);
+
+    if (!interface || !wheel)
+        goto error;
+
+    TimerWheelNode_t *handles[100];
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (!tmw_schedule(wheel, 1300, new_int64_t(1300), &handles[i]))
+            goto error;
+    }
+
+    struct tmw_test_context ctx = { wheel, 0, 0, 0, true, true };
+
+    // Half of the connections stay active and refresh their timeout
+    for (uint64_t now = 1100; now <= 5000; now += 100)
+    {
+        for (int i = 0; i < 100; i += 2)
+        {
+            *(int64_t *)tmw_element(handles[i]) = (int64_t)now + 300;
+
+            if (!tmw_reschedule(wheel, handles[i], now + 300))
+                goto error;
+        }
+
+        ctx.previous = tmw_now(wheel);
+        ctx.last = 0;
+
+        tmw_advance(wheel, now, tmw_test_expire, &ctx);
+    }
+
+    ut_equals_bool(ut, true, ctx.in_time, __func__);
+    ut_equals_integer_t(ut, 50, ctx.expired, __func__);
+    ut_equals_integer_t(ut, 50, tmw_count(wheel), __func__);
+
+    // Far beyond the range of the levels and in the past
+    uint64_t far = tmw_now(wheel) + (UINT64_C(1) << 50) + 12345;
+
+    if (!tmw_schedule(wheel, far, new_int64_t((int64_t)far), NULL))
+        goto error;
+
+    if (!tmw_schedule(wheel, 10, new_int64_t(10), NULL))
+        goto error;
+
+    ctx.previous = tmw_now(wheel);
+    ctx.last = 0;
+    ctx.expired = 0;
+
+    ut_equals_integer_t(ut, 1, tmw_advance(wheel, ctx.previous + 1,
+                                           tmw_test_expire, &ctx), __func__);
+
+    ctx.previous = tmw_now(wheel);
+
+    ut_equals_integer_t(ut, 50, tmw_advance(wheel, far - 1,
+                                            tmw_test_expire, &ctx), __func__);
+    ut_equals_integer_t(ut, 1, tmw_count(wheel), __func__);
+
+    ctx.previous = tmw_now(wheel);
+
+    ut_equals_integer_t(ut, 1, tmw_advance(wheel, far,
+                                           tmw_test_expire, &ctx), __func__);
+    ut_equals_bool(ut, true, ctx.in_time, __func__);
+    ut_equals_bool(ut, true, tmw_empty(wheel), __func__);
+
+    tmw_free(wheel);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (wheel)
+        tmw_free(wheel);
+    interface_free(interface);
+    ut_error();
+}
+
+// Schedules the next timer of a periodic task from the expired one
+static void tmw_test_periodic(void *element, void *context)
+{
+    TimerWheel_t *wheel = context;
+    int64_t *runs = element;
+
+    (*runs)++;
+
+    if (*runs < 1000)
+        tmw_schedule(wheel, tmw_now(wheel) + 7, runs, NULL);
+}
+
+// Expired timers can schedule new ones
+void tmw_test_periodic_tasks(UnitTest ut)
+{
+    Interface_t *interface = interface_new(compare_int64_t, copy_int64_t,
+            display_int64_t, free, NULL, NULL);
+
+    TimerWheel_t *wheel = tmw_new(interface, 0);
+
+    int64_t runs[10] = { 0 };
+
+    if (!interface || !wheel)
+        goto error;
+
+    for (int i = 0; i < 10; i++)
+    {
+        if (!tmw_schedule(wheel, (uint64_t)i, &runs[i], NULL))
+            goto error;
+    }
+
+    // A single batch runs every task to completion
+    integer_t expired = tmw_advance(wheel, UINT64_C(1) << 20,
+                                    tmw_test_periodic, wheel);
+
+    bool completed = true;
+
+    for (int i = 0; i < 10; i++)
+        completed = completed && runs[i] == 1000;
+
+    ut_equals_integer_t(ut, 10000, expired, __func__);
+    ut_equals_bool(ut, true, completed, __func__);
+    ut_equals_bool(ut, true, tmw_empty(wheel), __func__);
+
+    // Erasing cancels everything
+    for (int i = 0; i < 10; i++)
+    {
+        if (!tmw_schedule(wheel, (uint64_t)i * 1000, new_int64_t(i), NULL))
+            goto error;
+    }
+
+    tmw_erase(wheel);
+
+    ut_equals_bool(ut, true, tmw_empty(wheel), __func__);
+    ut_equals_integer_t(ut, 0, tmw_advance(wheel, UINT64_C(1) << 21,
+                                           NULL, NULL), __func__);
+
+    tmw_free(wheel);
+    interface_free(interface);
+
+    return;
+
+    error:
+    printf("Error at %s\n", __func__);
+    if (wheel)
+        tmw_free_shallow(wheel);
+    interface_free(interface);
+    ut_error();
+}
+
+// Runs all TimerWheel tests
+Status TimerWheelTests(void)
+{
+    UnitTest ut;
+
+    Status st = ut_init(&ut);
+
+    if (st != DS_OK)
+        goto error;
+
+    tmw_test_IO(ut);
+    tmw_test_reschedule(ut);
+    tmw_test_periodic_tasks(ut);
+
+    ut_report(ut, "TimerWheel");
+
+    ut_delete(&ut);
+
+    return DS_OK;
+
+    error:
+    printf("Error at %s\n", __func__);
+    ut_report(ut, "TimerWheel");
+    ut_delete(&ut);
+    return st;
+}
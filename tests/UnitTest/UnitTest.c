@@ -141,6 +141,51 @@ void ut_equals_double(UnitTest ut, double param1, double param2,
     GlobalTotalTests++;
 }
 
+// Loads the structure saved in serial from a copy that is cut one byte short
+// and from a copy whose header claims a newer version. Both loads must fail
+// and leave the target untouched. The stream is rewound afterwards so it can
+// be loaded again. Returns false if the copies could not be allocated.
+bool ut_serial_rejects(UnitTest ut, Serial_t *serial, void *target,
+                       ut_load_f load, ut_check_f untouched,
+                       const char *test_name)
+{
+    size_t size;
+    const void *data = ser_data(serial, &size);
+
+    unsigned char *bytes = malloc(size);
+
+    if (!bytes)
+        return false;
+
+    // The version is saved right after the 4 bytes of the magic
+    memcpy(bytes, data, size);
+    bytes[4] = SER_VERSION + 1;
+
+    Serial_t *truncated = ser_new_view(data, size - 1);
+    Serial_t *newer = ser_new_view(bytes, size);
+
+    bool success = truncated && newer;
+
+    if (success)
+    {
+        ut_equals_bool(ut, false, load(target, truncated), test_name);
+        ut_equals_bool(ut, true, untouched(target), test_name);
+        ut_equals_bool(ut, false, load(target, newer), test_name);
+        ut_equals_bool(ut, true, untouched(target), test_name);
+    }
+
+    if (truncated)
+        ser_free(truncated);
+    if (newer)
+        ser_free(newer);
+
+    free(bytes);
+
+    ser_rewind(serial);
+
+    return success;
+}
+
 void ut_error()
 {
     GlobalTotalErrors++;
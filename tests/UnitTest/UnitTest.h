@@ -10,6 +10,7 @@
 #define C_DATASTRUCTURES_LIBRARY_UNITTEST_H
 
 #include "Core.h"
+#include "Serial.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,13 @@ void ut_equals_unsigned_t(UnitTest ut, unsigned_t param1, unsigned_t param2,
 void ut_equals_double(UnitTest ut, double param1, double param2,
                       const char *test_name);
 
+typedef bool(*ut_load_f)(void *target, Serial_t *serial);
+
+typedef bool(*ut_check_f)(void *target);
+
+bool ut_serial_rejects(UnitTest ut, Serial_t *serial, void *target,
+        ut_load_f load, ut_check_f untouched, const char *test_name);
+
 void ut_error();
 
 #ifdef __cplusplus
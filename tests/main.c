@@ -12,21 +12,37 @@ int main(void)
     AssociativeListTests();
     AVLTreeTests();
     BinarySearchTreeTests();
+    BinomialHeapTests();
     BitArrayTests();
     CircularLinkedListTests();
+    ConcurrentHashMapTests();
+    ConcurrentStackTests();
     DequeArrayTests();
     DequeListTests();
     DoublyLinkedListTests();
     DynamicArrayTests();
+    EpochTests();
+    ExternalSortTests();
+    FibonacciHeapTests();
     HeapTests();
+    IntervalTreeTests();
+    LogQueueTests();
+    LRUCacheTests();
+    MappedArrayTests();
+    NodePoolTests();
+    PairingHeapTests();
     PriorityListTests();
     QueueArrayTests();
     QueueListTests();
+    RadixHeapTests();
     RedBlackTreeTests();
     SinglyLinkedListTests();
+    SortedHashMapTests();
     SortedListTests();
     StackArrayTests();
     StackListTests();
+    ThreadPoolTests();
+    TimerWheelTests();
 
     FinalReport();
 }
\ No newline at end of file
@@ -88,6 +88,17 @@ clk_running(Clock_t *clk);
 bool
 clk_stopped(Clock_t *clk);
 
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref clk_now
+/// \brief Returns a monotonic wall-clock time in seconds.
+///
+/// The stopwatch functions measure processor time, which for a multi-threaded
+/// section is the sum over all threads. Use the difference between two calls
+/// to this function to measure elapsed real time instead.
+double
+clk_now(void);
+
 #ifdef __cplusplus
 }
 #endif
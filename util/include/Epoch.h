@@ -0,0 +1,86 @@
+/**
+ * @file Epoch.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_EPOCH_H
+#define C_DATASTRUCTURES_LIBRARY_EPOCH_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Amount of retired pointers a thread accumulates before it tries to
+/// reclaim memory.
+#define EBR_BATCH 64
+
+// Epoch-based reclamation (EBR).
+//
+// Structures whose readers don't take locks can't free a node as soon as it
+// is unlinked, since a concurrent reader might still be looking at it. With
+// EBR every access to such a structure happens between ebr_enter() and
+// ebr_leave(), and unlinked nodes are handed to ebr_retire() instead of being
+// freed. A retired pointer is only freed once every thread that was inside a
+// critical section when it was retired has left it.
+//
+// There is a single process-wide domain. Threads register themselves
+// automatically on their first call and unregister when they exit.
+
+/////////////////////////////////////////////////////////// CRITICAL SECTION ///
+
+/// \ref ebr_enter
+/// \brief Enters a critical section, in which retired memory is not freed.
+void
+ebr_enter(void);
+
+/// \ref ebr_leave
+/// \brief Leaves a critical section entered with ebr_enter().
+void
+ebr_leave(void);
+
+/// \ref ebr_active
+/// \brief Returns true if the calling thread is inside a critical section.
+bool
+ebr_active(void);
+
+//////////////////////////////////////////////////////////////// RECLAMATION ///
+
+/// \ref ebr_retire
+/// \brief Frees a pointer with a given function once no reader can see it.
+bool
+ebr_retire(void *pointer, free_f function);
+
+/// \ref ebr_retire_element
+/// \brief Frees an element with its interface's free function once no reader
+/// can see it.
+bool
+ebr_retire_element(Interface_t *interface, void *element);
+
+/// \ref ebr_synchronize
+/// \brief Waits for a grace period and frees the memory it made safe.
+void
+ebr_synchronize(void);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref ebr_epoch
+/// \brief Returns the current global epoch.
+integer_t
+ebr_epoch(void);
+
+/// \ref ebr_pending
+/// \brief Returns how many pointers retired by this thread are not freed yet.
+integer_t
+ebr_pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_EPOCH_H
@@ -0,0 +1,93 @@
+/**
+ * @file NodePool.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
+#define C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Amount of nodes in the first block of a pool.
+#define NPL_FIRST_BLOCK 32
+
+/// \brief Maximum amount of nodes in a block of a pool.
+#define NPL_MAX_BLOCK 4096
+
+// Node pool.
+//
+// Node-based structures that allocate and free a node on every operation
+// spend a good part of their time in malloc() and free(). A pool hands out
+// fixed-size nodes carved from large blocks and keeps released nodes in a
+// free list, so a node is reused instead of going back to the allocator.
+// Blocks start small and double in size up to NPL_MAX_BLOCK nodes. The
+// memory is only returned when the pool is cleared or freed.
+
+/// \struct NodePool_s
+/// \brief A pool of fixed-size nodes.
+struct NodePool_s;
+
+/// \brief A type for a node pool.
+///
+/// A type for a <code> struct NodePool_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct NodePool_s NodePool_t;
+
+/// \brief A pointer type for a node pool.
+///
+/// A pointer type to <code> struct NodePool_s </code>.
+typedef struct NodePool_s *NodePool;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref npl_new
+/// \brief Initializes a new pool of nodes of a given size.
+NodePool_t *
+npl_new(size_t node_size);
+
+/// \ref npl_free
+/// \brief Frees from memory a pool and every node it handed out.
+void
+npl_free(NodePool_t *pool);
+
+/// \ref npl_clear
+/// \brief Frees every node the pool handed out, keeping the pool usable.
+void
+npl_clear(NodePool_t *pool);
+
+///////////////////////////////////////////////////////////////////// NODES ///
+
+/// \ref npl_alloc
+/// \brief Returns an uninitialized node from the pool.
+void *
+npl_alloc(NodePool_t *pool);
+
+/// \ref npl_release
+/// \brief Gives a node back to the pool so it can be reused.
+void
+npl_release(NodePool_t *pool, void *node);
+
+/// \ref npl_merge
+/// \brief Moves every block and free node of a pool into another.
+void
+npl_merge(NodePool_t *pool, NodePool_t *other);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref npl_in_use
+/// \brief Returns how many nodes were handed out and not released.
+integer_t
+npl_in_use(NodePool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_NODEPOOL_H
@@ -0,0 +1,193 @@
+/**
+ * @file Serial.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SERIAL_H
+#define C_DATASTRUCTURES_LIBRARY_SERIAL_H
+
+#include "Core.h"
+#include "Interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Version of the format written by *_serialize() functions.
+///
+/// Incremented every time the layout of a structure changes. Streams written
+/// with a newer version are refused when loading.
+#define SER_VERSION 1
+
+// Binary serialization of data structures.
+//
+// Every structure is saved as a header followed by its contents:
+//
+// - magic    4 bytes, "DSLB"
+// - version  u16, \c SER_VERSION
+// - kind     u16, a \ref SerialKind
+// - layout   u32, structure specific (heap kind, sort order, ...)
+// - count    u64, amount of elements
+//
+// Elements are saved one after the other as an u32 with the size of the
+// encoding followed by the bytes produced by the element codec of the
+// structure's interface (see interface_codec()). NULL elements are saved as
+// the size \c SER_NULL without any bytes. All numbers are little-endian.
+//
+// Structures save their elements in the order that lets them be rebuilt in
+// linear time, so loading a sorted or balanced structure never compares two
+// elements.
+
+/// \brief Size written in place of a NULL element.
+#define SER_NULL UINT32_MAX
+
+/// \brief Size of the buffer of streams over a file descriptor.
+#define SER_CHUNK 65536
+
+/// \brief Identifies the structure that was saved in a stream.
+///
+/// The values are part of the format and must never change.
+enum SerialKind
+{
+    SER_ARRAY                  =  1,
+    SER_ASSOCIATIVE_LIST       =  2,
+    SER_AVL_TREE               =  3,
+    SER_BINARY_SEARCH_TREE     =  4,
+    SER_BIT_ARRAY              =  5,
+    SER_CIRCULAR_LINKED_LIST   =  6,
+    SER_DEQUE_ARRAY            =  7,
+    SER_DEQUE_LIST             =  8,
+    SER_DOUBLY_LINKED_LIST     =  9,
+    SER_DYNAMIC_ARRAY          = 10,
+    SER_HEAP                   = 11,
+    SER_PRIORITY_LIST          = 12,
+    SER_QUEUE_ARRAY            = 13,
+    SER_QUEUE_LIST             = 14,
+    SER_RED_BLACK_TREE         = 15,
+    SER_SINGLY_LINKED_LIST     = 16,
+    SER_SORTED_LIST            = 17,
+    SER_STACK_ARRAY            = 18,
+    SER_STACK_LIST             = 19
+};
+
+/// Defines a type to an <code> enum SerialKind </code>
+typedef enum SerialKind SerialKind;
+
+/// \struct Serial_s
+/// \brief A byte stream that structures are saved to and loaded from.
+///
+/// A stream either wraps a file descriptor, owns a growable memory buffer or
+/// reads from memory owned by the user.
+struct Serial_s;
+
+/// \ref Serial_t
+/// \brief A type for a byte stream.
+///
+/// A type for a <code> struct Serial_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct Serial_s Serial_t;
+
+/// \ref Serial
+/// \brief A pointer type for a byte stream.
+///
+/// A pointer type to <code> struct Serial_s </code>.
+typedef struct Serial_s *Serial;
+
+/////////////////////////////////////////////////////////////////// STREAMS ///
+
+/// \ref ser_new_fd
+/// \brief Creates a buffered stream over a file descriptor.
+Serial_t *
+ser_new_fd(int fd);
+
+/// \ref ser_new_buffer
+/// \brief Creates a stream that writes to a growable memory buffer.
+Serial_t *
+ser_new_buffer(void);
+
+/// \ref ser_new_view
+/// \brief Creates a read-only stream over memory owned by the caller.
+Serial_t *
+ser_new_view(const void *data, size_t size);
+
+/// \ref ser_free
+/// \brief Flushes and frees a stream. File descriptors are not closed.
+bool
+ser_free(Serial_t *serial);
+
+/// \ref ser_flush
+/// \brief Writes buffered bytes to the stream's file descriptor.
+bool
+ser_flush(Serial_t *serial);
+
+/// \ref ser_rewind
+/// \brief Makes a memory stream read from its first byte again.
+void
+ser_rewind(Serial_t *serial);
+
+/// \ref ser_data
+/// \brief Returns the bytes of a memory stream.
+const void *
+ser_data(Serial_t *serial, size_t *size);
+
+/// \ref ser_failed
+/// \brief Returns true if any operation on the stream failed.
+bool
+ser_failed(Serial_t *serial);
+
+//////////////////////////////////////////////////////////////// PRIMITIVES ///
+
+/// \ref ser_write
+/// \brief Writes raw bytes to a stream.
+bool
+ser_write(Serial_t *serial, const void *data, size_t size);
+
+/// \ref ser_read
+/// \brief Reads raw bytes from a stream.
+bool
+ser_read(Serial_t *serial, void *data, size_t size);
+
+/// \ref ser_write_u64
+/// \brief Writes an unsigned 64-bit number in little-endian.
+bool
+ser_write_u64(Serial_t *serial, uint64_t value);
+
+/// \ref ser_read_u64
+/// \brief Reads an unsigned 64-bit number in little-endian.
+bool
+ser_read_u64(Serial_t *serial, uint64_t *value);
+
+//////////////////////////////////////////////////////////////////// HEADER ///
+
+/// \ref ser_write_header
+/// \brief Writes the header that starts every saved structure.
+bool
+ser_write_header(Serial_t *serial, SerialKind kind, uint32_t layout,
+                 integer_t count);
+
+/// \ref ser_read_header
+/// \brief Reads and validates the header that starts every saved structure.
+bool
+ser_read_header(Serial_t *serial, SerialKind kind, uint32_t *layout,
+                integer_t *count);
+
+////////////////////////////////////////////////////////////////// ELEMENTS ///
+
+/// \ref ser_write_element
+/// \brief Writes a length-prefixed element encoded with a given codec.
+bool
+ser_write_element(Serial_t *serial, serialize_f function, const void *element);
+
+/// \ref ser_read_element
+/// \brief Reads a length-prefixed element decoded with a given codec.
+bool
+ser_read_element(Serial_t *serial, deserialize_f function, void **result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SERIAL_H
@@ -0,0 +1,83 @@
+/**
+ * @file Sync.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_SYNC_H
+#define C_DATASTRUCTURES_LIBRARY_SYNC_H
+
+#include "Core.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A writer-preferring readers-writer lock.
+///
+/// Once a writer is waiting, new readers wait as well so that a steady stream
+/// of readers can't starve writers.
+struct RWLock_s
+{
+    /// \brief Protects every other member.
+    pthread_mutex_t mutex;
+
+    /// \brief Signaled when readers may proceed.
+    pthread_cond_t readers_cond;
+
+    /// \brief Signaled when a writer may proceed.
+    pthread_cond_t writers_cond;
+
+    /// \brief Amount of readers holding the lock.
+    integer_t readers;
+
+    /// \brief Amount of writers waiting for the lock.
+    integer_t writers_waiting;
+
+    /// \brief If a writer is holding the lock.
+    bool writer;
+};
+
+/// \brief A type for a readers-writer lock.
+typedef struct RWLock_s RWLock_t;
+
+//////////////////////////////////////////////////////// READERS-WRITER LOCK ///
+
+/// \ref rwl_init
+/// \brief Initializes a readers-writer lock.
+bool
+rwl_init(RWLock_t *lock);
+
+/// \ref rwl_destroy
+/// \brief Releases the resources of a readers-writer lock.
+void
+rwl_destroy(RWLock_t *lock);
+
+/// \ref rwl_read_lock
+/// \brief Acquires the lock for reading.
+void
+rwl_read_lock(RWLock_t *lock);
+
+/// \ref rwl_read_unlock
+/// \brief Releases the lock acquired for reading.
+void
+rwl_read_unlock(RWLock_t *lock);
+
+/// \ref rwl_write_lock
+/// \brief Acquires the lock for writing.
+void
+rwl_write_lock(RWLock_t *lock);
+
+/// \ref rwl_write_unlock
+/// \brief Releases the lock acquired for writing.
+void
+rwl_write_unlock(RWLock_t *lock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_SYNC_H
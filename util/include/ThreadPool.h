@@ -0,0 +1,139 @@
+/**
+ * @file ThreadPool.h
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#ifndef C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
+#define C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
+
+#include "Core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief A task function.
+///
+/// A function that is executed by one of the pool's threads. It receives the
+/// argument given when the task was submitted.
+typedef void(*task_f)(void *);
+
+/// \brief A range function.
+///
+/// A function used by tpl_parallel_for() that processes every index in the
+/// range <code> [from, to) </code>. The third parameter is the index of the
+/// chunk being processed, starting at 0, and the last one is a user context.
+typedef void(*range_f)(integer_t, integer_t, integer_t, void *);
+
+/// \struct ThreadPool_s
+/// \brief A pool of worker threads with work-stealing task queues.
+struct ThreadPool_s;
+
+/// \ref ThreadPool_t
+/// \brief A type for a thread pool.
+///
+/// A type for a <code> struct ThreadPool_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct ThreadPool_s ThreadPool_t;
+
+/// \ref ThreadPool
+/// \brief A pointer type for a thread pool.
+///
+/// A pointer type to <code> struct ThreadPool_s </code>.
+typedef struct ThreadPool_s *ThreadPool;
+
+/// \struct TaskGroup_s
+/// \brief A join counter used to wait for a set of submitted tasks.
+struct TaskGroup_s;
+
+/// \ref TaskGroup_t
+/// \brief A type for a task group.
+///
+/// A type for a <code> struct TaskGroup_s </code> so you don't have to always
+/// write the full name of it.
+typedef struct TaskGroup_s TaskGroup_t;
+
+/// \ref TaskGroup
+/// \brief A pointer type for a task group.
+///
+/// A pointer type to <code> struct TaskGroup_s </code>.
+typedef struct TaskGroup_s *TaskGroup;
+
+///////////////////////////////////// STRUCTURE INITIALIZATION AND DELETION ///
+
+/// \ref tpl_new
+/// \brief Creates a new thread pool with a given amount of worker threads.
+ThreadPool_t *
+tpl_new(integer_t threads);
+
+/// \ref tpl_free
+/// \brief Runs all pending tasks, stops all threads and frees the pool.
+void
+tpl_free(ThreadPool_t *pool);
+
+/// \ref tpl_group_new
+/// \brief Creates a new task group.
+TaskGroup_t *
+tpl_group_new(void);
+
+/// \ref tpl_group_free
+/// \brief Frees from memory a task group.
+void
+tpl_group_free(TaskGroup_t *group);
+
+/////////////////////////////////////////////////////////////////// GETTERS ///
+
+/// \ref tpl_threads
+/// \brief Returns the amount of worker threads in the pool.
+integer_t
+tpl_threads(ThreadPool_t *pool);
+
+/// \ref tpl_serial
+/// \brief Returns true if the pool runs every task on the calling thread.
+bool
+tpl_serial(ThreadPool_t *pool);
+
+/// \ref tpl_hardware_threads
+/// \brief Returns the amount of processors available in the system.
+integer_t
+tpl_hardware_threads(void);
+
+/// \ref tpl_group_pending
+/// \brief Returns how many tasks of a group have not finished yet.
+integer_t
+tpl_group_pending(TaskGroup_t *group);
+
+////////////////////////////////////////////////////////// INPUT AND OUTPUT ///
+
+/// \ref tpl_submit
+/// \brief Submits a task to the pool, optionally tracked by a group.
+bool
+tpl_submit(ThreadPool_t *pool, TaskGroup_t *group, task_f task,
+           void *argument);
+
+/// \ref tpl_wait
+/// \brief Waits for all tasks of a group, helping to run pending tasks.
+void
+tpl_wait(ThreadPool_t *pool, TaskGroup_t *group);
+
+/////////////////////////////////////////////////////////////////// UTILITY ///
+
+/// \ref tpl_chunks
+/// \brief Returns in how many chunks tpl_parallel_for() splits a range.
+integer_t
+tpl_chunks(ThreadPool_t *pool, integer_t from, integer_t to, integer_t grain);
+
+/// \ref tpl_parallel_for
+/// \brief Splits a range in chunks and processes them in parallel.
+void
+tpl_parallel_for(ThreadPool_t *pool, integer_t from, integer_t to,
+                 integer_t grain, range_f body, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_LIBRARY_THREADPOOL_H
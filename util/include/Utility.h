@@ -79,6 +79,16 @@ unsigned_t hash_long_double(const void *element);
 unsigned_t hash_char(const void *element);
 unsigned_t hash_string(const void *element);
 
+size_t serialize_int64_t(const void *element, void *buffer, size_t size);
+size_t serialize_uint64_t(const void *element, void *buffer, size_t size);
+size_t serialize_double(const void *element, void *buffer, size_t size);
+size_t serialize_string(const void *element, void *buffer, size_t size);
+
+void *deserialize_int64_t(const void *buffer, size_t size);
+void *deserialize_uint64_t(const void *buffer, size_t size);
+void *deserialize_double(const void *buffer, size_t size);
+void *deserialize_string(const void *buffer, size_t size);
+
 void *new_int8_t(int8_t element);
 void *new_int16_t(int16_t element);
 void *new_int32_t(int32_t element);
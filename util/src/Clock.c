@@ -115,3 +115,13 @@ clk_stopped(Clock_t *clk)
 {
     return !clk->running;
 }
+
+double
+clk_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
@@ -0,0 +1,480 @@
+/**
+ * @file Epoch.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "Epoch.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/// \brief Assumed size of a cache line.
+#define EBR_CACHE_LINE 64
+
+/// \brief Set in a record's state while its thread is in a critical section.
+#define EBR_ACTIVE UINT64_C(1)
+
+/// \brief A pointer waiting to be freed.
+struct EpochRetired_s
+{
+    /// \brief What to free.
+    void *pointer;
+
+    /// \brief How to free it.
+    free_f function;
+
+    /// \brief The global epoch when the pointer was retired.
+    ///
+    /// The pointer can be freed once the global epoch is two ahead of it.
+    uint64_t epoch;
+};
+
+/// \brief A list of retired pointers.
+///
+/// Pointers are appended in epoch order, so the ones that are safe to free
+/// are always at the front, starting at \c head.
+struct EpochList_s
+{
+    /// \brief Buffer of retired pointers.
+    struct EpochRetired_s *buffer;
+
+    /// \brief Index of the oldest retired pointer.
+    integer_t head;
+
+    /// \brief One past the index of the newest retired pointer.
+    integer_t tail;
+
+    /// \brief Size of the buffer.
+    integer_t capacity;
+};
+
+/// \brief The state of one thread.
+///
+/// Records are never freed. When a thread exits its record is released and
+/// later reused by a new thread.
+struct EpochRecord_s
+{
+    /// \brief The epoch the thread observed when it entered a critical
+    /// section, shifted left by one, with \c EBR_ACTIVE set while inside it.
+    ///
+    /// The only member read by other threads, so it gets its own cache line.
+    _Alignas(EBR_CACHE_LINE) atomic_uint_fast64_t state;
+
+    /// \brief If a thread currently owns the record.
+    atomic_bool in_use;
+
+    /// \brief Next record in the registry.
+    ///
+    /// Never changes once the record is published.
+    struct EpochRecord_s *next;
+
+    /// \brief How many times ebr_enter() was called without a matching
+    /// ebr_leave().
+    integer_t nesting;
+
+    /// \brief Pointers retired by the owner since the last collection.
+    integer_t since_collect;
+
+    /// \brief Pointers retired by the owner and not freed yet.
+    struct EpochList_s retired;
+};
+
+/// \brief The process-wide reclamation domain.
+struct EpochDomain_s
+{
+    /// \brief The global epoch.
+    _Alignas(EBR_CACHE_LINE) atomic_uint_fast64_t epoch;
+
+    /// \brief Registry of every record ever created.
+    _Atomic(struct EpochRecord_s *) records;
+
+    /// \brief Protects \c orphans.
+    pthread_mutex_t orphans_mutex;
+
+    /// \brief Pointers left behind by threads that exited.
+    ///
+    /// Unlike thread lists these are not in epoch order.
+    struct EpochList_s orphans;
+
+    /// \brief Used to release a thread's record when it exits.
+    pthread_key_t key;
+};
+
+typedef struct EpochRetired_s EpochRetired_t;
+
+typedef struct EpochList_s EpochList_t;
+
+typedef struct EpochRecord_s EpochRecord_t;
+
+static struct EpochDomain_s ebr_domain = {
+        .records = NULL,
+        .orphans_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .orphans = { NULL, 0, 0, 0 }
+};
+
+static pthread_once_t ebr_once = PTHREAD_ONCE_INIT;
+
+static _Thread_local EpochRecord_t *ebr_current = NULL;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+ebr_init(void);
+
+static EpochRecord_t *
+ebr_record(void);
+
+static void
+ebr_release(void *record);
+
+static bool
+ebr_list_push(EpochList_t *list, void *pointer, free_f function,
+              uint64_t epoch);
+
+static void
+ebr_list_collect(EpochList_t *list, uint64_t epoch);
+
+static void
+ebr_collect(EpochRecord_t *record);
+
+static bool
+ebr_try_advance(void);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Critical sections can be nested; only the outermost ebr_enter() and
+/// ebr_leave() have any effect. While inside one, every pointer read from a
+/// structure protected by EBR stays valid even if another thread retires it.
+void
+ebr_enter(void)
+{
+    EpochRecord_t *record = ebr_record();
+
+    if (record->nesting++ > 0)
+        return;
+
+    uint64_t epoch = atomic_load(&ebr_domain.epoch);
+
+    // Sequentially consistent so that every read inside the section is
+    // ordered after the record is visible to threads advancing the epoch
+    atomic_store(&record->state, (epoch << 1) | EBR_ACTIVE);
+}
+
+/// Pointers read inside the critical section must not be used after leaving
+/// it.
+void
+ebr_leave(void)
+{
+    EpochRecord_t *record = ebr_record();
+
+    if (--record->nesting > 0)
+        return;
+
+    atomic_store(&record->state, 0);
+}
+
+/// \return True if the calling thread is inside a critical section.
+bool
+ebr_active(void)
+{
+    return ebr_record()->nesting > 0;
+}
+
+/// Hands a pointer that is no longer reachable from its structure to the
+/// reclamation domain. It will be freed with <code> function(pointer) </code>
+/// once every critical section that might have seen it has ended. Every
+/// \ref EBR_BATCH calls the thread tries to advance the global epoch and
+/// frees what became safe.
+///
+/// \param[in] pointer What to free.
+/// \param[in] function How to free it.
+///
+/// \return False if the list of retired pointers could not grow, in which
+/// case the pointer was not retired. Outside of a critical section this never
+/// happens: the function waits for a grace period and frees the pointer.
+bool
+ebr_retire(void *pointer, free_f function)
+{
+    EpochRecord_t *record = ebr_record();
+
+    uint64_t epoch = atomic_load(&ebr_domain.epoch);
+
+    if (!ebr_list_push(&record->retired, pointer, function, epoch))
+    {
+        if (record->nesting > 0)
+            return false;
+
+        ebr_synchronize();
+
+        function(pointer);
+
+        return true;
+    }
+
+    if (++record->since_collect >= EBR_BATCH)
+    {
+        ebr_try_advance();
+        ebr_collect(record);
+    }
+
+    return true;
+}
+
+/// Same as ebr_retire() using the free function of an interface. The function
+/// pointer is stored, not the interface, so the interface may be freed before
+/// the element is.
+///
+/// \param[in] interface An interface with a free function.
+/// \param[in] element The element to be freed.
+///
+/// \return False if the element could not be retired.
+bool
+ebr_retire_element(Interface_t *interface, void *element)
+{
+    return ebr_retire(element, interface->free);
+}
+
+/// Waits until the global epoch moves two steps ahead, which means that every
+/// critical section that was running when this function was called has
+/// ended. Then frees every pointer retired before the call by this thread or
+/// by threads that already exited. Pointers retired by other live threads are
+/// freed by them. Must not be called inside a critical section.
+void
+ebr_synchronize(void)
+{
+    EpochRecord_t *record = ebr_record();
+
+    uint64_t target = atomic_load(&ebr_domain.epoch) + 2;
+
+    while (atomic_load(&ebr_domain.epoch) < target)
+    {
+        if (!ebr_try_advance())
+            sched_yield();
+    }
+
+    ebr_collect(record);
+}
+
+/// \return The current global epoch.
+integer_t
+ebr_epoch(void)
+{
+    pthread_once(&ebr_once, ebr_init);
+
+    return (integer_t)atomic_load(&ebr_domain.epoch);
+}
+
+/// \return How many pointers retired by this thread are not freed yet.
+integer_t
+ebr_pending(void)
+{
+    EpochRecord_t *record = ebr_record();
+
+    return record->retired.tail - record->retired.head;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static void
+ebr_init(void)
+{
+    atomic_init(&ebr_domain.epoch, 0);
+
+    pthread_key_create(&ebr_domain.key, ebr_release);
+}
+
+// Returns the calling thread's record, registering the thread if needed
+static EpochRecord_t *
+ebr_record(void)
+{
+    if (ebr_current)
+        return ebr_current;
+
+    pthread_once(&ebr_once, ebr_init);
+
+    EpochRecord_t *record = atomic_load(&ebr_domain.records);
+
+    // Reuse the record of a thread that exited
+    for (; record; record = record->next)
+    {
+        bool expected = false;
+
+        if (atomic_compare_exchange_strong(&record->in_use, &expected, true))
+            break;
+    }
+
+    if (!record)
+    {
+        record = aligned_alloc(EBR_CACHE_LINE, sizeof(EpochRecord_t));
+
+        // Without a record the thread can't run safely at all
+        if (!record)
+            abort();
+
+        atomic_init(&record->state, 0);
+        atomic_init(&record->in_use, true);
+
+        record->retired = (EpochList_t){ NULL, 0, 0, 0 };
+
+        record->next = atomic_load(&ebr_domain.records);
+
+        while (!atomic_compare_exchange_weak(&ebr_domain.records,
+                                             &record->next, record))
+            ;
+    }
+
+    record->nesting = 0;
+    record->since_collect = 0;
+
+    ebr_current = record;
+
+    pthread_setspecific(ebr_domain.key, record);
+
+    return record;
+}
+
+// Called when a registered thread exits
+static void
+ebr_release(void *argument)
+{
+    EpochRecord_t *record = argument;
+
+    ebr_collect(record);
+
+    EpochList_t *list = &record->retired;
+
+    // What is still pending is handed to whoever collects the orphans
+    if (list->head < list->tail)
+    {
+        pthread_mutex_lock(&ebr_domain.orphans_mutex);
+
+        for (integer_t i = list->head; i < list->tail; i++)
+        {
+            EpochRetired_t *retired = &list->buffer[i];
+
+            // If this fails the pointer is leaked rather than freed too early
+            ebr_list_push(&ebr_domain.orphans, retired->pointer,
+                          retired->function, retired->epoch);
+        }
+
+        pthread_mutex_unlock(&ebr_domain.orphans_mutex);
+    }
+
+    free(list->buffer);
+
+    *list = (EpochList_t){ NULL, 0, 0, 0 };
+
+    atomic_store(&record->state, 0);
+    atomic_store(&record->in_use, false);
+
+    ebr_current = NULL;
+}
+
+static bool
+ebr_list_push(EpochList_t *list, void *pointer, free_f function,
+              uint64_t epoch)
+{
+    if (list->tail == list->capacity)
+    {
+        // Reuse the space of pointers that were already freed
+        if (list->head > 0)
+        {
+            memmove(list->buffer, list->buffer + list->head,
+                    sizeof(EpochRetired_t) * (size_t)(list->tail - list->head));
+
+            list->tail -= list->head;
+            list->head = 0;
+        }
+
+        if (list->tail == list->capacity)
+        {
+            integer_t capacity = list->capacity == 0 ? EBR_BATCH
+                                                     : list->capacity * 2;
+
+            EpochRetired_t *buffer = realloc(list->buffer,
+                                             sizeof(EpochRetired_t)
+                                             * (size_t)capacity);
+
+            if (!buffer)
+                return false;
+
+            list->buffer = buffer;
+            list->capacity = capacity;
+        }
+    }
+
+    list->buffer[list->tail++] = (EpochRetired_t){ pointer, function, epoch };
+
+    return true;
+}
+
+// Frees the pointers of an epoch ordered list that are safe at a given epoch
+static void
+ebr_list_collect(EpochList_t *list, uint64_t epoch)
+{
+    while (list->head < list->tail &&
+           list->buffer[list->head].epoch + 2 <= epoch)
+    {
+        EpochRetired_t *retired = &list->buffer[list->head++];
+
+        retired->function(retired->pointer);
+    }
+
+    if (list->head == list->tail)
+        list->head = list->tail = 0;
+}
+
+static void
+ebr_collect(EpochRecord_t *record)
+{
+    uint64_t epoch = atomic_load(&ebr_domain.epoch);
+
+    record->since_collect = 0;
+
+    ebr_list_collect(&record->retired, epoch);
+
+    if (pthread_mutex_trylock(&ebr_domain.orphans_mutex) != 0)
+        return;
+
+    EpochList_t *orphans = &ebr_domain.orphans;
+    integer_t kept = 0;
+
+    // Orphans are not ordered, so keep the ones that are not safe yet
+    for (integer_t i = 0; i < orphans->tail; i++)
+    {
+        EpochRetired_t retired = orphans->buffer[i];
+
+        if (retired.epoch + 2 <= epoch)
+            retired.function(retired.pointer);
+        else
+            orphans->buffer[kept++] = retired;
+    }
+
+    orphans->tail = kept;
+
+    pthread_mutex_unlock(&ebr_domain.orphans_mutex);
+}
+
+// The epoch can only move forward when every thread inside a critical section
+// has already observed the current one
+static bool
+ebr_try_advance(void)
+{
+    uint64_t epoch = atomic_load(&ebr_domain.epoch);
+
+    for (EpochRecord_t *record = atomic_load(&ebr_domain.records); record;
+         record = record->next)
+    {
+        uint64_t state = atomic_load(&record->state);
+
+        if ((state & EBR_ACTIVE) && (state >> 1) != epoch)
+            return false;
+    }
+
+    return atomic_compare_exchange_strong(&ebr_domain.epoch, &epoch, epoch + 1);
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
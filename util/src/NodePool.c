@@ -0,0 +1,278 @@
+/**
+ * @file NodePool.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "NodePool.h"
+#include <stddef.h>
+
+/// \brief A block of nodes.
+///
+/// The nodes follow the header, which is padded so they are suitably aligned
+/// for any type.
+struct NodePoolBlock_s
+{
+    /// \brief Next block in the pool.
+    struct NodePoolBlock_s *next;
+
+    /// \brief Amount of nodes in this block.
+    integer_t capacity;
+};
+
+/// A pool hands out nodes from the free list first. When it is empty the
+/// next untouched node of the newest block is taken, and when that block is
+/// exhausted a new one is allocated, twice as large as the previous one.
+///
+/// Released nodes are chained through their first bytes, which is why a node
+/// is never smaller than a pointer.
+struct NodePool_s
+{
+    /// \brief Size of each node, rounded up to keep every node aligned.
+    size_t node_size;
+
+    /// \brief Size of a block header, rounded up to keep nodes aligned.
+    size_t header_size;
+
+    /// \brief The newest block, where untouched nodes are taken from.
+    struct NodePoolBlock_s *blocks;
+
+    /// \brief The oldest block.
+    struct NodePoolBlock_s *blocks_tail;
+
+    /// \brief Amount of untouched nodes taken from the newest block.
+    integer_t used;
+
+    /// \brief Released nodes.
+    void *free_list;
+
+    /// \brief The last released node in the free list.
+    void *free_tail;
+
+    /// \brief Amount of nodes handed out and not released.
+    integer_t in_use;
+};
+
+/// \brief Alignment of the nodes.
+#define NPL_ALIGN (_Alignof(max_align_t))
+
+/// \brief Rounds a size up to a multiple of the alignment.
+#define NPL_ROUND(size) (((size) + NPL_ALIGN - 1) / NPL_ALIGN * NPL_ALIGN)
+
+/// \brief The next node in the free list.
+#define NPL_NEXT(node) (*(void **)(node))
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+npl_grow(NodePool_t *pool);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// \param[in] node_size The size of every node handed out by the pool.
+///
+/// \return A new empty NodePool_s or NULL if allocation failed.
+NodePool_t *
+npl_new(size_t node_size)
+{
+    NodePool_t *pool = malloc(sizeof(NodePool_t));
+
+    if (!pool)
+        return NULL;
+
+    if (node_size < sizeof(void *))
+        node_size = sizeof(void *);
+
+    pool->node_size = NPL_ROUND(node_size);
+    pool->header_size = NPL_ROUND(sizeof(struct NodePoolBlock_s));
+
+    pool->blocks = NULL;
+    pool->blocks_tail = NULL;
+    pool->used = 0;
+
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+
+    pool->in_use = 0;
+
+    return pool;
+}
+
+/// \param[in] pool The pool to be freed from memory.
+void
+npl_free(NodePool_t *pool)
+{
+    npl_clear(pool);
+
+    free(pool);
+}
+
+/// Returns every block to the allocator. Any node handed out by the pool
+/// becomes invalid.
+///
+/// \param[in] pool The pool to be cleared.
+void
+npl_clear(NodePool_t *pool)
+{
+    struct NodePoolBlock_s *block = pool->blocks;
+
+    while (block)
+    {
+        struct NodePoolBlock_s *next = block->next;
+
+        free(block);
+
+        block = next;
+    }
+
+    pool->blocks = NULL;
+    pool->blocks_tail = NULL;
+    pool->used = 0;
+
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+
+    pool->in_use = 0;
+}
+
+/// \param[in] pool The target pool.
+///
+/// \return A node of the pool's node size or NULL if allocation failed.
+void *
+npl_alloc(NodePool_t *pool)
+{
+    void *node;
+
+    if (pool->free_list)
+    {
+        node = pool->free_list;
+
+        pool->free_list = NPL_NEXT(node);
+
+        if (!pool->free_list)
+            pool->free_tail = NULL;
+    }
+    else
+    {
+        if (!pool->blocks || pool->used == pool->blocks->capacity)
+        {
+            if (!npl_grow(pool))
+                return NULL;
+        }
+
+        node = (char *)pool->blocks + pool->header_size +
+               (size_t)pool->used * pool->node_size;
+
+        pool->used++;
+    }
+
+    pool->in_use++;
+
+    return node;
+}
+
+/// \param[in] pool The pool that handed out the node.
+/// \param[in] node The node to be reused.
+void
+npl_release(NodePool_t *pool, void *node)
+{
+    NPL_NEXT(node) = pool->free_list;
+
+    if (!pool->free_list)
+        pool->free_tail = node;
+
+    pool->free_list = node;
+    pool->in_use--;
+}
+
+/// Moves every block and free node of \c other into \c pool in constant
+/// time, leaving \c other empty. Nodes handed out by \c other stay valid and
+/// must now be released to \c pool. Both pools must have the same node size.
+///
+/// \param[in] pool The pool that receives the nodes.
+/// \param[in] other The pool to be emptied.
+void
+npl_merge(NodePool_t *pool, NodePool_t *other)
+{
+    if (!other->blocks)
+        return;
+
+    // The newest block of pool keeps being used for untouched nodes
+    if (pool->blocks)
+    {
+        pool->blocks_tail->next = other->blocks;
+        pool->blocks_tail = other->blocks_tail;
+    }
+    else
+    {
+        pool->blocks = other->blocks;
+        pool->blocks_tail = other->blocks_tail;
+        pool->used = other->used;
+    }
+
+    if (other->free_list)
+    {
+        if (pool->free_list)
+            NPL_NEXT(pool->free_tail) = other->free_list;
+        else
+            pool->free_list = other->free_list;
+
+        pool->free_tail = other->free_tail;
+    }
+
+    pool->in_use += other->in_use;
+
+    other->blocks = NULL;
+    other->blocks_tail = NULL;
+    other->used = 0;
+
+    other->free_list = NULL;
+    other->free_tail = NULL;
+
+    other->in_use = 0;
+}
+
+/// \param[in] pool The target pool.
+///
+/// \return How many nodes were handed out and not released.
+integer_t
+npl_in_use(NodePool_t *pool)
+{
+    return pool->in_use;
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Allocates a new block, twice as large as the newest one
+static bool
+npl_grow(NodePool_t *pool)
+{
+    integer_t capacity = NPL_FIRST_BLOCK;
+
+    if (pool->blocks)
+    {
+        capacity = pool->blocks->capacity * 2;
+
+        if (capacity > NPL_MAX_BLOCK)
+            capacity = NPL_MAX_BLOCK;
+    }
+
+    struct NodePoolBlock_s *block =
+            malloc(pool->header_size + (size_t)capacity * pool->node_size);
+
+    if (!block)
+        return false;
+
+    block->capacity = capacity;
+    block->next = pool->blocks;
+
+    if (!pool->blocks)
+        pool->blocks_tail = block;
+
+    pool->blocks = block;
+    pool->used = 0;
+
+    return true;
+}
@@ -0,0 +1,643 @@
+/**
+ * @file Serial.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "Serial.h"
+#include <errno.h>
+#include <unistd.h>
+
+/// \brief Bytes that start every saved structure.
+static const unsigned char ser_magic[4] = { 'D', 'S', 'L', 'B' };
+
+/// A byte stream. Streams over a file descriptor keep a buffer of
+/// \c SER_CHUNK bytes that is either filled by reads or drained by writes,
+/// while memory streams keep all their bytes in the buffer and only move the
+/// read position.
+struct Serial_s
+{
+    /// \brief File descriptor or -1 for memory streams.
+    int fd;
+
+    /// \brief Buffered bytes.
+    unsigned char *buffer;
+
+    /// \brief Amount of valid bytes in the buffer.
+    size_t size;
+
+    /// \brief Buffer capacity.
+    size_t capacity;
+
+    /// \brief Position of the next byte to be read.
+    size_t position;
+
+    /// \brief If the buffer belongs to the user and can't be written to.
+    bool view;
+
+    /// \brief If the buffer of a file descriptor stream holds bytes that were
+    /// not written yet.
+    bool writing;
+
+    /// \brief Set by the first operation that fails.
+    bool failed;
+};
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+ser_reserve(Serial_t *serial, size_t size);
+
+static bool
+ser_fill(Serial_t *serial, size_t size);
+
+static bool
+ser_fail(Serial_t *serial);
+
+static void
+ser_encode(unsigned char *buffer, uint64_t value, int bytes);
+
+static uint64_t
+ser_decode(const unsigned char *buffer, int bytes);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// The stream doesn't own the file descriptor. Bytes written are buffered
+/// until the buffer is full or until ser_flush() or ser_free() are called.
+///
+/// \param[in] fd A file descriptor opened for reading or writing.
+///
+/// \return A new stream or NULL if allocation failed.
+Serial_t *
+ser_new_fd(int fd)
+{
+    Serial_t *serial = malloc(sizeof(Serial_t));
+
+    if (!serial)
+        return NULL;
+
+    serial->buffer = malloc(SER_CHUNK);
+
+    if (!serial->buffer)
+    {
+        free(serial);
+        return NULL;
+    }
+
+    serial->fd = fd;
+    serial->size = 0;
+    serial->capacity = SER_CHUNK;
+    serial->position = 0;
+    serial->view = false;
+    serial->writing = false;
+    serial->failed = false;
+
+    return serial;
+}
+
+/// Bytes written are appended to a buffer that grows as needed. They can be
+/// retrieved with ser_data() or read back after calling ser_rewind().
+///
+/// \return A new stream or NULL if allocation failed.
+Serial_t *
+ser_new_buffer(void)
+{
+    Serial_t *serial = malloc(sizeof(Serial_t));
+
+    if (!serial)
+        return NULL;
+
+    serial->fd = -1;
+    serial->buffer = NULL;
+    serial->size = 0;
+    serial->capacity = 0;
+    serial->position = 0;
+    serial->view = false;
+    serial->writing = false;
+    serial->failed = false;
+
+    return serial;
+}
+
+/// The memory is not copied, so it must outlive the stream. Elements are
+/// decoded straight from it, which makes this the fastest way to load a
+/// structure from a memory-mapped file.
+///
+/// \param[in] data The bytes to be read.
+/// \param[in] size Amount of bytes.
+///
+/// \return A new stream or NULL if allocation failed.
+Serial_t *
+ser_new_view(const void *data, size_t size)
+{
+    Serial_t *serial = malloc(sizeof(Serial_t));
+
+    if (!serial)
+        return NULL;
+
+    serial->fd = -1;
+    serial->buffer = (unsigned char *)data;
+    serial->size = size;
+    serial->capacity = size;
+    serial->position = 0;
+    serial->view = true;
+    serial->writing = false;
+    serial->failed = false;
+
+    return serial;
+}
+
+/// \param[in] serial The stream to be freed.
+///
+/// \return False if flushing the buffered bytes failed.
+bool
+ser_free(Serial_t *serial)
+{
+    bool flushed = ser_flush(serial);
+
+    if (!serial->view)
+        free(serial->buffer);
+
+    free(serial);
+
+    return flushed;
+}
+
+/// Does nothing for memory streams.
+///
+/// \param[in] serial The target stream.
+///
+/// \return False if the stream failed or if writing failed.
+bool
+ser_flush(Serial_t *serial)
+{
+    if (serial->failed)
+        return false;
+
+    if (serial->fd < 0 || !serial->writing)
+        return true;
+
+    size_t written = 0;
+
+    while (written < serial->size)
+    {
+        ssize_t result = write(serial->fd, serial->buffer + written,
+                               serial->size - written);
+
+        if (result < 0 && errno == EINTR)
+            continue;
+
+        if (result <= 0)
+            return ser_fail(serial);
+
+        written += (size_t)result;
+    }
+
+    serial->size = 0;
+    serial->writing = false;
+
+    return true;
+}
+
+/// Does nothing for streams over a file descriptor.
+///
+/// \param[in] serial The target stream.
+void
+ser_rewind(Serial_t *serial)
+{
+    if (serial->fd < 0)
+        serial->position = 0;
+}
+
+/// \param[in] serial The target stream.
+/// \param[out] size Amount of bytes in the stream.
+///
+/// \return The bytes of a memory stream or NULL for streams over a file
+/// descriptor.
+const void *
+ser_data(Serial_t *serial, size_t *size)
+{
+    if (serial->fd >= 0)
+    {
+        *size = 0;
+        return NULL;
+    }
+
+    *size = serial->size;
+
+    return serial->buffer;
+}
+
+/// Once an operation fails every following operation fails too, so checking
+/// this after saving or loading a structure is enough.
+///
+/// \param[in] serial The target stream.
+///
+/// \return True if any operation failed.
+bool
+ser_failed(Serial_t *serial)
+{
+    return serial->failed;
+}
+
+/// \param[in] serial The target stream.
+/// \param[in] data Bytes to be written.
+/// \param[in] size Amount of bytes.
+///
+/// \return False if the stream is read-only or if writing failed.
+bool
+ser_write(Serial_t *serial, const void *data, size_t size)
+{
+    if (serial->failed)
+        return false;
+
+    if (serial->fd >= 0 && size > serial->capacity)
+    {
+        // Too large to be buffered; write it directly
+        if (!ser_flush(serial))
+            return false;
+
+        const unsigned char *bytes = data;
+
+        while (size > 0)
+        {
+            ssize_t result = write(serial->fd, bytes, size);
+
+            if (result < 0 && errno == EINTR)
+                continue;
+
+            if (result <= 0)
+                return ser_fail(serial);
+
+            bytes += result;
+            size -= (size_t)result;
+        }
+
+        return true;
+    }
+
+    if (!ser_reserve(serial, size))
+        return false;
+
+    memcpy(serial->buffer + serial->size, data, size);
+
+    serial->size += size;
+
+    return true;
+}
+
+/// \param[in] serial The target stream.
+/// \param[out] data Where the bytes are copied to.
+/// \param[in] size Amount of bytes.
+///
+/// \return False if the stream ended before all bytes were read.
+bool
+ser_read(Serial_t *serial, void *data, size_t size)
+{
+    if (serial->failed)
+        return false;
+
+    unsigned char *bytes = data;
+
+    while (size > 0)
+    {
+        if (!ser_fill(serial, 1))
+            return false;
+
+        size_t available = serial->size - serial->position;
+        size_t amount = available < size ? available : size;
+
+        memcpy(bytes, serial->buffer + serial->position, amount);
+
+        serial->position += amount;
+        bytes += amount;
+        size -= amount;
+    }
+
+    return true;
+}
+
+/// \param[in] serial The target stream.
+/// \param[in] value The number to be written.
+///
+/// \return False if writing failed.
+bool
+ser_write_u64(Serial_t *serial, uint64_t value)
+{
+    unsigned char bytes[8];
+
+    ser_encode(bytes, value, 8);
+
+    return ser_write(serial, bytes, 8);
+}
+
+/// \param[in] serial The target stream.
+/// \param[out] value The number read.
+///
+/// \return False if reading failed.
+bool
+ser_read_u64(Serial_t *serial, uint64_t *value)
+{
+    unsigned char bytes[8];
+
+    if (!ser_read(serial, bytes, 8))
+        return false;
+
+    *value = ser_decode(bytes, 8);
+
+    return true;
+}
+
+/// \param[in] serial The target stream.
+/// \param[in] kind Which structure is being saved.
+/// \param[in] layout Structure specific information.
+/// \param[in] count Amount of elements that follow.
+///
+/// \return False if writing failed.
+bool
+ser_write_header(Serial_t *serial, SerialKind kind, uint32_t layout,
+                 integer_t count)
+{
+    unsigned char bytes[20];
+
+    memcpy(bytes, ser_magic, 4);
+
+    ser_encode(bytes + 4, SER_VERSION, 2);
+    ser_encode(bytes + 6, (uint64_t)kind, 2);
+    ser_encode(bytes + 8, layout, 4);
+    ser_encode(bytes + 12, (uint64_t)count, 8);
+
+    return ser_write(serial, bytes, 20);
+}
+
+/// \param[in] serial The target stream.
+/// \param[in] kind Which structure is expected.
+/// \param[out] layout Structure specific information.
+/// \param[out] count Amount of elements that follow.
+///
+/// \return False if the header is not valid, was written by a newer version
+/// or belongs to another structure.
+bool
+ser_read_header(Serial_t *serial, SerialKind kind, uint32_t *layout,
+                integer_t *count)
+{
+    unsigned char bytes[20];
+
+    if (!ser_read(serial, bytes, 20))
+        return false;
+
+    if (memcmp(bytes, ser_magic, 4) != 0)
+        return ser_fail(serial);
+
+    uint64_t version = ser_decode(bytes + 4, 2);
+    uint64_t saved_kind = ser_decode(bytes + 6, 2);
+    uint64_t saved_count = ser_decode(bytes + 12, 8);
+
+    if (version == 0 || version > SER_VERSION || saved_kind != (uint64_t)kind)
+        return ser_fail(serial);
+
+    if (saved_count > INTMAX_MAX)
+        return ser_fail(serial);
+
+    *layout = (uint32_t)ser_decode(bytes + 8, 4);
+    *count = (integer_t)saved_count;
+
+    return true;
+}
+
+/// The element is encoded straight into the stream's buffer whenever it
+/// fits, so usually no extra copy is made.
+///
+/// \param[in] serial The target stream.
+/// \param[in] function The element codec.
+/// \param[in] element The element to be written. Can be NULL.
+///
+/// \return False if the codec is missing or if writing failed.
+bool
+ser_write_element(Serial_t *serial, serialize_f function, const void *element)
+{
+    unsigned char prefix[4];
+
+    if (!element)
+    {
+        ser_encode(prefix, SER_NULL, 4);
+
+        return ser_write(serial, prefix, 4);
+    }
+
+    if (!function)
+        return ser_fail(serial);
+
+    if (!ser_reserve(serial, 4))
+        return false;
+
+    size_t available = serial->capacity - serial->size - 4;
+
+    size_t size = function(element, serial->buffer + serial->size + 4,
+                           available);
+
+    if (size >= SER_NULL)
+        return ser_fail(serial);
+
+    if (size > available)
+    {
+        if (serial->fd < 0 || size + 4 <= serial->capacity)
+        {
+            // Make room and encode it again in place
+            if (!ser_reserve(serial, size + 4))
+                return false;
+
+            function(element, serial->buffer + serial->size + 4, size);
+        }
+        else
+        {
+            // Larger than the whole buffer of a file descriptor stream
+            unsigned char *bytes = malloc(size);
+
+            if (!bytes)
+                return ser_fail(serial);
+
+            function(element, bytes, size);
+
+            ser_encode(prefix, size, 4);
+
+            bool written = ser_write(serial, prefix, 4) &&
+                           ser_write(serial, bytes, size);
+
+            free(bytes);
+
+            return written;
+        }
+    }
+
+    ser_encode(serial->buffer + serial->size, size, 4);
+
+    serial->size += size + 4;
+
+    return true;
+}
+
+/// Memory streams decode elements straight from their buffer.
+///
+/// \param[in] serial The target stream.
+/// \param[in] function The element codec.
+/// \param[out] result The element read. Can be NULL if a NULL element was
+/// written.
+///
+/// \return False if the codec is missing, if reading failed or if the codec
+/// couldn't decode the element.
+bool
+ser_read_element(Serial_t *serial, deserialize_f function, void **result)
+{
+    *result = NULL;
+
+    unsigned char prefix[4];
+
+    if (!ser_read(serial, prefix, 4))
+        return false;
+
+    uint64_t size = ser_decode(prefix, 4);
+
+    if (size == SER_NULL)
+        return true;
+
+    if (!function)
+        return ser_fail(serial);
+
+    if (serial->fd < 0 || size <= serial->capacity)
+    {
+        if (!ser_fill(serial, size))
+            return false;
+
+        *result = function(serial->buffer + serial->position, size);
+
+        serial->position += size;
+    }
+    else
+    {
+        unsigned char *bytes = malloc(size);
+
+        if (!bytes)
+            return ser_fail(serial);
+
+        if (ser_read(serial, bytes, size))
+            *result = function(bytes, size);
+
+        free(bytes);
+    }
+
+    return *result != NULL || ser_fail(serial);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+// Makes room for size bytes at the end of the buffer
+static bool
+ser_reserve(Serial_t *serial, size_t size)
+{
+    if (serial->failed || serial->view)
+        return ser_fail(serial);
+
+    if (serial->fd >= 0)
+    {
+        // Discard what was buffered for reading
+        if (!serial->writing)
+        {
+            serial->size = 0;
+            serial->position = 0;
+            serial->writing = true;
+        }
+
+        if (serial->capacity - serial->size < size && !ser_flush(serial))
+            return false;
+
+        serial->writing = true;
+
+        return true;
+    }
+
+    if (serial->capacity - serial->size >= size)
+        return true;
+
+    size_t capacity = serial->capacity < 64 ? 64 : serial->capacity;
+
+    while (capacity - serial->size < size)
+        capacity *= 2;
+
+    unsigned char *buffer = realloc(serial->buffer, capacity);
+
+    if (!buffer)
+        return ser_fail(serial);
+
+    serial->buffer = buffer;
+    serial->capacity = capacity;
+
+    return true;
+}
+
+// Makes sure that at least size contiguous bytes can be read
+static bool
+ser_fill(Serial_t *serial, size_t size)
+{
+    if (serial->size - serial->position >= size)
+        return true;
+
+    if (serial->fd < 0 || size > serial->capacity)
+        return ser_fail(serial);
+
+    if (serial->writing && !ser_flush(serial))
+        return false;
+
+    // Move what is left to the beginning and read after it
+    memmove(serial->buffer, serial->buffer + serial->position,
+            serial->size - serial->position);
+
+    serial->size -= serial->position;
+    serial->position = 0;
+
+    while (serial->size < size)
+    {
+        ssize_t result = read(serial->fd, serial->buffer + serial->size,
+                              serial->capacity - serial->size);
+
+        if (result < 0 && errno == EINTR)
+            continue;
+
+        if (result <= 0)
+            return ser_fail(serial);
+
+        serial->size += (size_t)result;
+    }
+
+    return true;
+}
+
+static bool
+ser_fail(Serial_t *serial)
+{
+    serial->failed = true;
+
+    return false;
+}
+
+static void
+ser_encode(unsigned char *buffer, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+        buffer[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint64_t
+ser_decode(const unsigned char *buffer, int bytes)
+{
+    uint64_t value = 0;
+
+    for (int i = 0; i < bytes; i++)
+        value |= (uint64_t)buffer[i] << (8 * i);
+
+    return value;
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -0,0 +1,117 @@
+/**
+ * @file Sync.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "Sync.h"
+
+//////////////////////////////////////////////////////// READERS-WRITER LOCK ///
+
+/// \param[in] lock The lock to be initialized.
+///
+/// \return False if any of the underlying primitives failed to initialize.
+bool
+rwl_init(RWLock_t *lock)
+{
+    if (pthread_mutex_init(&lock->mutex, NULL) != 0)
+        return false;
+
+    if (pthread_cond_init(&lock->readers_cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&lock->mutex);
+        return false;
+    }
+
+    if (pthread_cond_init(&lock->writers_cond, NULL) != 0)
+    {
+        pthread_cond_destroy(&lock->readers_cond);
+        pthread_mutex_destroy(&lock->mutex);
+        return false;
+    }
+
+    lock->readers = 0;
+    lock->writers_waiting = 0;
+    lock->writer = false;
+
+    return true;
+}
+
+/// \param[in] lock The lock to be destroyed. It must not be held.
+void
+rwl_destroy(RWLock_t *lock)
+{
+    pthread_cond_destroy(&lock->writers_cond);
+    pthread_cond_destroy(&lock->readers_cond);
+    pthread_mutex_destroy(&lock->mutex);
+}
+
+/// Waits while a writer holds the lock or is waiting for it.
+///
+/// \param[in] lock The target lock.
+void
+rwl_read_lock(RWLock_t *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+
+    while (lock->writer || lock->writers_waiting > 0)
+        pthread_cond_wait(&lock->readers_cond, &lock->mutex);
+
+    lock->readers++;
+
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/// \param[in] lock The target lock.
+void
+rwl_read_unlock(RWLock_t *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+
+    lock->readers--;
+
+    if (lock->readers == 0 && lock->writers_waiting > 0)
+        pthread_cond_signal(&lock->writers_cond);
+
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/// Waits until there are no readers and no writer holding the lock.
+///
+/// \param[in] lock The target lock.
+void
+rwl_write_lock(RWLock_t *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+
+    lock->writers_waiting++;
+
+    while (lock->writer || lock->readers > 0)
+        pthread_cond_wait(&lock->writers_cond, &lock->mutex);
+
+    lock->writers_waiting--;
+    lock->writer = true;
+
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/// Hands the lock to the next writer if there is one, otherwise wakes up all
+/// waiting readers.
+///
+/// \param[in] lock The target lock.
+void
+rwl_write_unlock(RWLock_t *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+
+    lock->writer = false;
+
+    if (lock->writers_waiting > 0)
+        pthread_cond_signal(&lock->writers_cond);
+    else
+        pthread_cond_broadcast(&lock->readers_cond);
+
+    pthread_mutex_unlock(&lock->mutex);
+}
@@ -0,0 +1,796 @@
+/**
+ * @file ThreadPool.c
+ *
+ * @author Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ * @date 02/03/2019
+ */
+
+#include "ThreadPool.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <unistd.h>
+
+/// \brief A task waiting to be executed.
+///
+/// Tasks are stored by value inside each worker's deque so that submitting a
+/// task never allocates memory unless the deque needs to grow.
+struct ThreadPoolTask_s
+{
+    /// \brief Function to be executed.
+    task_f function;
+
+    /// \brief Argument passed to the function.
+    void *argument;
+
+    /// \brief Group notified when the task finishes or NULL.
+    struct TaskGroup_s *group;
+};
+
+/// \brief A work-stealing deque.
+///
+/// Each worker owns one deque. The owner pushes and pops tasks from the
+/// \c bottom (LIFO, which keeps recently spawned work in cache) while other
+/// threads steal from the \c top (FIFO, taking the oldest and usually
+/// biggest pieces of work). Both indexes only grow and are mapped to the
+/// circular \c buffer by masking with <code> capacity - 1 </code>.
+struct ThreadPoolDeque_s
+{
+    /// \brief Protects the whole deque.
+    pthread_mutex_t lock;
+
+    /// \brief Circular buffer of tasks.
+    struct ThreadPoolTask_s *buffer;
+
+    /// \brief Buffer capacity, always a power of two.
+    integer_t capacity;
+
+    /// \brief Index of the oldest task.
+    integer_t top;
+
+    /// \brief Index one past the newest task.
+    integer_t bottom;
+};
+
+/// \brief A worker thread.
+struct ThreadPoolWorker_s
+{
+    /// \brief The pool this worker belongs to.
+    struct ThreadPool_s *pool;
+
+    /// \brief Position of this worker in the pool's worker array.
+    integer_t index;
+
+    /// \brief Tasks owned by this worker.
+    struct ThreadPoolDeque_s deque;
+
+    /// \brief Thread handle.
+    pthread_t thread;
+};
+
+/// A ThreadPool_s keeps a fixed amount of worker threads, each with its own
+/// task deque. Tasks submitted from a worker go to its own deque and tasks
+/// submitted from outside the pool are distributed in a round-robin fashion.
+/// An idle worker first looks at its own deque and then tries to steal tasks
+/// from the other workers before going to sleep.
+///
+/// A pool created with zero threads is a serial pool. It has no threads at
+/// all and every task is executed on the calling thread at the moment it is
+/// submitted, in submission order. This makes every algorithm built on top of
+/// the pool deterministic, which is very handy for tests and debugging.
+///
+/// \par Functions
+/// Located in the file ThreadPool.c
+struct ThreadPool_s
+{
+    /// \brief Worker threads.
+    struct ThreadPoolWorker_s *workers;
+
+    /// \brief Amount of worker threads.
+    integer_t threads;
+
+    /// \brief Total amount of tasks sitting in any of the deques.
+    _Atomic integer_t pending;
+
+    /// \brief How many workers are sleeping or about to sleep.
+    _Atomic integer_t sleepers;
+
+    /// \brief Round-robin counter for tasks submitted from outside the pool.
+    _Atomic integer_t next_victim;
+
+    /// \brief Set when the pool is being freed.
+    bool shutdown;
+
+    /// \brief Protects \c shutdown and is used together with \c wake.
+    pthread_mutex_t lock;
+
+    /// \brief Idle workers sleep on this condition variable.
+    pthread_cond_t wake;
+};
+
+/// A TaskGroup_s is a join counter. Each task submitted with a group
+/// increments its counter and decrements it when the task is finished. Use
+/// tpl_wait() to block until the counter reaches zero.
+struct TaskGroup_s
+{
+    /// \brief Amount of tasks not yet finished.
+    _Atomic integer_t pending;
+
+    /// \brief Used together with \c done.
+    pthread_mutex_t lock;
+
+    /// \brief Signaled when \c pending reaches zero.
+    pthread_cond_t done;
+};
+
+/// \brief Shared state of a tpl_parallel_for() call.
+///
+/// Lives on the stack of the calling thread. Every participating thread
+/// claims chunks by incrementing \c next until all chunks are taken.
+struct ThreadPoolRange_s
+{
+    range_f body;
+    void *context;
+    integer_t from;
+    integer_t to;
+    integer_t grain;
+    integer_t chunks;
+    _Atomic integer_t next;
+};
+
+/// Worker that is running on the current thread, if any.
+static _Thread_local struct ThreadPoolWorker_s *tpl_current = NULL;
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+tpl_deque_init(struct ThreadPoolDeque_s *deque);
+
+static void
+tpl_deque_free(struct ThreadPoolDeque_s *deque);
+
+static bool
+tpl_deque_push(struct ThreadPoolDeque_s *deque, struct ThreadPoolTask_s task);
+
+static bool
+tpl_deque_pop(struct ThreadPoolDeque_s *deque, struct ThreadPoolTask_s *task);
+
+static bool
+tpl_deque_steal(struct ThreadPoolDeque_s *deque,
+                struct ThreadPoolTask_s *task);
+
+static bool
+tpl_take(ThreadPool_t *pool, struct ThreadPoolWorker_s *self,
+         struct ThreadPoolTask_s *task);
+
+static void
+tpl_run(struct ThreadPoolTask_s *task);
+
+static void *
+tpl_worker_main(void *argument);
+
+static void
+tpl_range_task(void *argument);
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
+
+/// Creates a new thread pool. If \c threads is 0 the pool is serial and all
+/// tasks are executed on the calling thread in submission order.
+///
+/// \param[in] threads Amount of worker threads. Must be 0 or greater.
+///
+/// \return A new ThreadPool_s or NULL if \c threads is negative or if any
+/// allocation or thread creation failed.
+ThreadPool_t *
+tpl_new(integer_t threads)
+{
+    if (threads < 0)
+        return NULL;
+
+    ThreadPool_t *pool = malloc(sizeof(ThreadPool_t));
+
+    if (!pool)
+        return NULL;
+
+    pool->workers = NULL;
+    pool->threads = threads;
+    pool->shutdown = false;
+
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->next_victim, 0);
+
+    if (threads == 0)
+        return pool;
+
+    pool->workers = malloc(sizeof(struct ThreadPoolWorker_s) * (size_t)threads);
+
+    if (!pool->workers)
+    {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+
+    integer_t created = 0;
+
+    for (integer_t i = 0; i < threads; i++)
+    {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+
+        if (!tpl_deque_init(&pool->workers[i].deque))
+            break;
+
+        created++;
+    }
+
+    // All deques must exist before any thread starts stealing
+    if (created == threads)
+    {
+        for (created = 0; created < threads; created++)
+        {
+            if (pthread_create(&pool->workers[created].thread, NULL,
+                    tpl_worker_main, &pool->workers[created]) != 0)
+                break;
+        }
+
+        if (created == threads)
+            return pool;
+
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = true;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (integer_t i = 0; i < created; i++)
+            pthread_join(pool->workers[i].thread, NULL);
+
+        created = threads;
+    }
+
+    for (integer_t i = 0; i < created; i++)
+        tpl_deque_free(&pool->workers[i].deque);
+
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+
+    free(pool->workers);
+    free(pool);
+
+    return NULL;
+}
+
+/// Stops the pool. All tasks that were already submitted are executed before
+/// the worker threads exit.
+///
+/// \param[in] pool The pool to be freed from memory.
+void
+tpl_free(ThreadPool_t *pool)
+{
+    if (pool->threads > 0)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = true;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (integer_t i = 0; i < pool->threads; i++)
+            pthread_join(pool->workers[i].thread, NULL);
+
+        for (integer_t i = 0; i < pool->threads; i++)
+            tpl_deque_free(&pool->workers[i].deque);
+
+        pthread_cond_destroy(&pool->wake);
+        pthread_mutex_destroy(&pool->lock);
+
+        free(pool->workers);
+    }
+
+    free(pool);
+}
+
+/// Creates a new task group with no pending tasks.
+///
+/// \return A new TaskGroup_s or NULL if allocation failed.
+TaskGroup_t *
+tpl_group_new(void)
+{
+    TaskGroup_t *group = malloc(sizeof(TaskGroup_t));
+
+    if (!group)
+        return NULL;
+
+    atomic_init(&group->pending, 0);
+
+    pthread_mutex_init(&group->lock, NULL);
+    pthread_cond_init(&group->done, NULL);
+
+    return group;
+}
+
+/// Frees a task group. The group must not have any pending tasks.
+///
+/// \param[in] group The group to be freed from memory.
+void
+tpl_group_free(TaskGroup_t *group)
+{
+    pthread_cond_destroy(&group->done);
+    pthread_mutex_destroy(&group->lock);
+
+    free(group);
+}
+
+/// \param[in] pool The target pool.
+///
+/// \return The amount of worker threads or 0 if the pool is serial.
+integer_t
+tpl_threads(ThreadPool_t *pool)
+{
+    return pool->threads;
+}
+
+/// \param[in] pool The target pool.
+///
+/// \return True if the pool has no threads and runs tasks when submitted.
+bool
+tpl_serial(ThreadPool_t *pool)
+{
+    return pool->threads == 0;
+}
+
+/// Useful to decide how many threads a pool should have.
+///
+/// \return The amount of online processors or 1 if it can't be determined.
+integer_t
+tpl_hardware_threads(void)
+{
+    long result = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return result < 1 ? 1 : (integer_t)result;
+}
+
+/// \param[in] group The target group.
+///
+/// \return How many tasks of this group have not finished yet.
+integer_t
+tpl_group_pending(TaskGroup_t *group)
+{
+    return atomic_load(&group->pending);
+}
+
+/// Submits a task to the pool. If the calling thread is one of the pool's
+/// workers the task goes to its own deque, otherwise it goes to the deque of
+/// the next worker in a round-robin order. On a serial pool the task is
+/// executed right away.
+///
+/// \param[in] pool The target pool.
+/// \param[in] group A group to keep track of this task or NULL.
+/// \param[in] task The function to be executed.
+/// \param[in] argument Argument passed to the task.
+///
+/// \return True if the task was submitted or false if the deque could not
+/// grow.
+bool
+tpl_submit(ThreadPool_t *pool, TaskGroup_t *group, task_f task,
+           void *argument)
+{
+    struct ThreadPoolTask_s item = { task, argument, group };
+
+    if (group)
+        atomic_fetch_add(&group->pending, 1);
+
+    if (tpl_serial(pool))
+    {
+        tpl_run(&item);
+        return true;
+    }
+
+    struct ThreadPoolDeque_s *deque;
+
+    if (tpl_current != NULL && tpl_current->pool == pool)
+        deque = &tpl_current->deque;
+    else
+        deque = &pool->workers[atomic_fetch_add(&pool->next_victim, 1) %
+                               pool->threads].deque;
+
+    if (!tpl_deque_push(deque, item))
+    {
+        if (group)
+            atomic_fetch_sub(&group->pending, 1);
+
+        return false;
+    }
+
+    atomic_fetch_add(&pool->pending, 1);
+
+    // Pairs with the sleepers increment in tpl_worker_main(); either the
+    // worker sees the new task or we see the worker and wake it up.
+    if (atomic_load(&pool->sleepers) > 0)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return true;
+}
+
+/// Blocks until every task in the group has finished. While waiting, the
+/// calling thread runs pending tasks from the pool so that waiting inside a
+/// task (nested parallelism) never starves the pool.
+///
+/// \param[in] pool The pool where the tasks were submitted.
+/// \param[in] group The group to wait for.
+void
+tpl_wait(ThreadPool_t *pool, TaskGroup_t *group)
+{
+    if (tpl_serial(pool))
+        return;
+
+    struct ThreadPoolWorker_s *self = NULL;
+
+    if (tpl_current != NULL && tpl_current->pool == pool)
+        self = tpl_current;
+
+    struct ThreadPoolTask_s task;
+
+    while (atomic_load(&group->pending) > 0)
+    {
+        if (tpl_take(pool, self, &task))
+        {
+            tpl_run(&task);
+            continue;
+        }
+
+        // Nothing to help with, so sleep for a short while. New tasks might
+        // still be spawned by the ones running so we can't block forever.
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+
+        deadline.tv_nsec += 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+
+        pthread_mutex_lock(&group->lock);
+        if (atomic_load(&group->pending) > 0)
+            pthread_cond_timedwait(&group->done, &group->lock, &deadline);
+        pthread_mutex_unlock(&group->lock);
+    }
+
+    // The last task might still be holding the lock to signal us
+    pthread_mutex_lock(&group->lock);
+    pthread_mutex_unlock(&group->lock);
+}
+
+/// Returns in how many chunks tpl_parallel_for() will split the range
+/// <code> [from, to) </code>. Use it to allocate one partial result per chunk
+/// when doing reductions.
+///
+/// \param[in] pool The target pool.
+/// \param[in] from First index of the range.
+/// \param[in] to One past the last index of the range.
+/// \param[in] grain Maximum size of each chunk or 0 for an automatic size.
+///
+/// \return The amount of chunks.
+integer_t
+tpl_chunks(ThreadPool_t *pool, integer_t from, integer_t to, integer_t grain)
+{
+    integer_t length = to - from;
+
+    if (length <= 0)
+        return 0;
+
+    if (grain <= 0)
+    {
+        // About four chunks per thread so that stealing can balance the load
+        integer_t parts = pool->threads > 0 ? pool->threads * 4 : 1;
+
+        grain = (length + parts - 1) / parts;
+    }
+
+    return (length + grain - 1) / grain;
+}
+
+/// Splits the range <code> [from, to) </code> in chunks of at most \c grain
+/// indexes and calls \c body once for each chunk. The calling thread also
+/// processes chunks and the function only returns when all of them are
+/// done. On a serial pool the chunks are processed in order.
+///
+/// Chunks are claimed dynamically so no memory is allocated. If a helper
+/// task can't be submitted the calling thread simply processes more chunks.
+///
+/// \param[in] pool The target pool.
+/// \param[in] from First index of the range.
+/// \param[in] to One past the last index of the range.
+/// \param[in] grain Maximum size of each chunk or 0 for an automatic size.
+/// \param[in] body Function that processes a chunk.
+/// \param[in] context User context passed to \c body.
+void
+tpl_parallel_for(ThreadPool_t *pool, integer_t from, integer_t to,
+                 integer_t grain, range_f body, void *context)
+{
+    integer_t chunks = tpl_chunks(pool, from, to, grain);
+
+    if (chunks == 0)
+        return;
+
+    if (grain <= 0)
+        grain = ((to - from) + chunks - 1) / chunks;
+
+    if (tpl_serial(pool) || chunks == 1)
+    {
+        for (integer_t c = 0; c < chunks; c++)
+        {
+            integer_t start = from + c * grain;
+            integer_t end = start + grain < to ? start + grain : to;
+
+            body(start, end, c, context);
+        }
+
+        return;
+    }
+
+    struct ThreadPoolRange_s range;
+
+    range.body = body;
+    range.context = context;
+    range.from = from;
+    range.to = to;
+    range.grain = grain;
+    range.chunks = chunks;
+
+    atomic_init(&range.next, 0);
+
+    struct TaskGroup_s group;
+
+    atomic_init(&group.pending, 0);
+    pthread_mutex_init(&group.lock, NULL);
+    pthread_cond_init(&group.done, NULL);
+
+    // The calling thread is one of the participants
+    integer_t helpers = chunks - 1 < pool->threads ? chunks - 1 : pool->threads;
+
+    for (integer_t i = 0; i < helpers; i++)
+    {
+        if (!tpl_submit(pool, &group, tpl_range_task, &range))
+            break;
+    }
+
+    tpl_range_task(&range);
+
+    tpl_wait(pool, &group);
+
+    pthread_cond_destroy(&group.done);
+    pthread_mutex_destroy(&group.lock);
+}
+
+///////////////////////////////////////////////////// NOT EXPOSED FUNCTIONS ///
+
+static bool
+tpl_deque_init(struct ThreadPoolDeque_s *deque)
+{
+    deque->buffer = malloc(sizeof(struct ThreadPoolTask_s) * 64);
+
+    if (!deque->buffer)
+        return false;
+
+    deque->capacity = 64;
+    deque->top = 0;
+    deque->bottom = 0;
+
+    pthread_mutex_init(&deque->lock, NULL);
+
+    return true;
+}
+
+static void
+tpl_deque_free(struct ThreadPoolDeque_s *deque)
+{
+    pthread_mutex_destroy(&deque->lock);
+
+    free(deque->buffer);
+}
+
+static bool
+tpl_deque_push(struct ThreadPoolDeque_s *deque, struct ThreadPoolTask_s task)
+{
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->bottom - deque->top == deque->capacity)
+    {
+        integer_t new_capacity = deque->capacity * 2;
+
+        struct ThreadPoolTask_s *new_buffer =
+                malloc(sizeof(struct ThreadPoolTask_s) * (size_t)new_capacity);
+
+        if (!new_buffer)
+        {
+            pthread_mutex_unlock(&deque->lock);
+            return false;
+        }
+
+        // Unwrap the circular buffer
+        for (integer_t i = deque->top; i < deque->bottom; i++)
+            new_buffer[i & (new_capacity - 1)] =
+                    deque->buffer[i & (deque->capacity - 1)];
+
+        free(deque->buffer);
+
+        deque->buffer = new_buffer;
+        deque->capacity = new_capacity;
+    }
+
+    deque->buffer[deque->bottom & (deque->capacity - 1)] = task;
+    deque->bottom++;
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return true;
+}
+
+static bool
+tpl_deque_pop(struct ThreadPoolDeque_s *deque, struct ThreadPoolTask_s *task)
+{
+    bool success = false;
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->bottom > deque->top)
+    {
+        deque->bottom--;
+        *task = deque->buffer[deque->bottom & (deque->capacity - 1)];
+        success = true;
+    }
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return success;
+}
+
+static bool
+tpl_deque_steal(struct ThreadPoolDeque_s *deque,
+                struct ThreadPoolTask_s *task)
+{
+    bool success = false;
+
+    // Don't wait for a busy victim, there are others to try
+    if (pthread_mutex_trylock(&deque->lock) != 0)
+        return false;
+
+    if (deque->bottom > deque->top)
+    {
+        *task = deque->buffer[deque->top & (deque->capacity - 1)];
+        deque->top++;
+        success = true;
+    }
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return success;
+}
+
+static bool
+tpl_take(ThreadPool_t *pool, struct ThreadPoolWorker_s *self,
+         struct ThreadPoolTask_s *task)
+{
+    if (atomic_load(&pool->pending) == 0)
+        return false;
+
+    if (self != NULL && tpl_deque_pop(&self->deque, task))
+    {
+        atomic_fetch_sub(&pool->pending, 1);
+        return true;
+    }
+
+    integer_t start = self != NULL ? self->index + 1 : 0;
+
+    for (integer_t i = 0; i < pool->threads; i++)
+    {
+        struct ThreadPoolWorker_s *victim =
+                &pool->workers[(start + i) % pool->threads];
+
+        if (victim == self)
+            continue;
+
+        if (tpl_deque_steal(&victim->deque, task))
+        {
+            atomic_fetch_sub(&pool->pending, 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void
+tpl_run(struct ThreadPoolTask_s *task)
+{
+    struct TaskGroup_s *group = task->group;
+
+    task->function(task->argument);
+
+    if (!group)
+        return;
+
+    // Decrementing under the lock guarantees that the group is no longer
+    // touched once a waiter gets past the handshake at the end of tpl_wait()
+    pthread_mutex_lock(&group->lock);
+
+    if (atomic_fetch_sub(&group->pending, 1) == 1)
+        pthread_cond_broadcast(&group->done);
+
+    pthread_mutex_unlock(&group->lock);
+}
+
+static void *
+tpl_worker_main(void *argument)
+{
+    struct ThreadPoolWorker_s *self = argument;
+    ThreadPool_t *pool = self->pool;
+
+    tpl_current = self;
+
+    struct ThreadPoolTask_s task;
+
+    for (;;)
+    {
+        if (tpl_take(pool, self, &task))
+        {
+            tpl_run(&task);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+
+        atomic_fetch_add(&pool->sleepers, 1);
+
+        while (atomic_load(&pool->pending) == 0 && !pool->shutdown)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+
+        atomic_fetch_sub(&pool->sleepers, 1);
+
+        bool done = pool->shutdown && atomic_load(&pool->pending) == 0;
+
+        pthread_mutex_unlock(&pool->lock);
+
+        if (done)
+            break;
+
+        // A steal might have failed on a busy deque
+        if (atomic_load(&pool->pending) > 0)
+            sched_yield();
+    }
+
+    tpl_current = NULL;
+
+    return NULL;
+}
+
+static void
+tpl_range_task(void *argument)
+{
+    struct ThreadPoolRange_s *range = argument;
+
+    for (;;)
+    {
+        integer_t chunk = atomic_fetch_add(&range->next, 1);
+
+        if (chunk >= range->chunks)
+            break;
+
+        integer_t start = range->from + chunk * range->grain;
+        integer_t end = start + range->grain < range->to ?
+                        start + range->grain : range->to;
+
+        range->body(start, end, chunk, range->context);
+    }
+}
+
+////////////////////////////////////////////// END OF NOT EXPOSED FUNCTIONS ///
@@ -506,6 +506,118 @@ unsigned_t hash_string(const void *element)
     return x;
 }
 
+// Numbers are encoded in little-endian so that files can be moved between
+// machines
+static void encode_uint64_t(uint64_t value, void *buffer)
+{
+    unsigned char *b = (unsigned char*)buffer;
+
+    for (int i = 0; i < 8; i++)
+        b[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint64_t decode_uint64_t(const void *buffer)
+{
+    const unsigned char *b = (const unsigned char*)buffer;
+
+    uint64_t value = 0;
+
+    for (int i = 0; i < 8; i++)
+        value |= (uint64_t)b[i] << (8 * i);
+
+    return value;
+}
+
+size_t serialize_int64_t(const void *element, void *buffer, size_t size)
+{
+    const int64_t *e = (const int64_t*)element;
+
+    if (size >= sizeof(int64_t))
+        encode_uint64_t((uint64_t)*e, buffer);
+
+    return sizeof(int64_t);
+}
+
+size_t serialize_uint64_t(const void *element, void *buffer, size_t size)
+{
+    const uint64_t *e = (const uint64_t*)element;
+
+    if (size >= sizeof(uint64_t))
+        encode_uint64_t(*e, buffer);
+
+    return sizeof(uint64_t);
+}
+
+size_t serialize_double(const void *element, void *buffer, size_t size)
+{
+    uint64_t bits;
+
+    memcpy(&bits, element, sizeof(double));
+
+    if (size >= sizeof(double))
+        encode_uint64_t(bits, buffer);
+
+    return sizeof(double);
+}
+
+size_t serialize_string(const void *element, void *buffer, size_t size)
+{
+    const char *e = (const char*)element;
+
+    // The terminating null character is implied by the encoding's size
+    size_t length = strlen(e);
+
+    if (size >= length)
+        memcpy(buffer, e, length);
+
+    return length;
+}
+
+void *deserialize_int64_t(const void *buffer, size_t size)
+{
+    if (size != sizeof(int64_t))
+        return NULL;
+
+    return new_int64_t((int64_t)decode_uint64_t(buffer));
+}
+
+void *deserialize_uint64_t(const void *buffer, size_t size)
+{
+    if (size != sizeof(uint64_t))
+        return NULL;
+
+    return new_uint64_t(decode_uint64_t(buffer));
+}
+
+void *deserialize_double(const void *buffer, size_t size)
+{
+    if (size != sizeof(double))
+        return NULL;
+
+    uint64_t bits = decode_uint64_t(buffer);
+
+    double *e = malloc(sizeof(double));
+
+    if (e)
+        memcpy(e, &bits, sizeof(double));
+
+    return e;
+}
+
+void *deserialize_string(const void *buffer, size_t size)
+{
+    char *e = malloc(size + 1);
+
+    if (!e)
+        return NULL;
+
+    memcpy(e, buffer, size);
+
+    e[size] = '\0';
+
+    return e;
+}
+
 void *new_int8_t(int8_t element)
 {
     int8_t *e = malloc(sizeof(int8_t));